@@ -8,5 +8,6 @@ rm /Users/illusion/dev/Everett/src/dimension_wasm_interface.ts
 rm -f /Users/illusion/dev/Everett/src/Nero.d.ts
 cp build-wasm/Nero.js /Users/illusion/dev/Everett/public/wasm/Nero.js
 cp build-wasm/Nero.wasm /Users/illusion/dev/Everett/public/wasm/Nero.wasm
+cp src/formulas/physics_formulas.pack /Users/illusion/dev/Everett/public/wasm/physics_formulas.pack
 cp build-wasm/Nero.d.ts /Users/illusion/dev/Everett/src/Nero.d.ts
 cp dimension_wasm_interface.ts /Users/illusion/dev/Everett/src/dimension_wasm_interface.ts
\ No newline at end of file
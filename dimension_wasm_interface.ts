@@ -23,6 +23,7 @@ export interface Expression {
 }
 
 export interface FormulaResult {
+    index: number;      // pass to evaluate_formula_chain
     name: string;
     latex: string;
     category: string;
@@ -74,7 +75,7 @@ function embindFormulaToResult(f: Formula): FormulaResult {
         description: v.description as string,
         is_constant: v.is_constant,
     }));
-    return { name: f.name as string, latex: f.latex as string, category: f.category as string, variables };
+    return { index: f.index, name: f.name as string, latex: f.latex as string, category: f.category as string, variables };
 }
 
 // ============================================================================
@@ -84,6 +85,7 @@ function embindFormulaToResult(f: Formula): FormulaResult {
 export class DimensionalEvaluator {
     private module: MainModule;
     private is_destroyed: boolean = false;
+    private formula_pack_request?: Promise<boolean>;
 
     constructor(wasm_module: MainModule) {
         this.module = wasm_module;
@@ -206,6 +208,56 @@ export class DimensionalEvaluator {
         return formulas;
     }
 
+    // Formulas whose name, category or variable descriptions match the words of
+    // `query`; misspelt and unfinished words still match
+    search_formulas(query: string, limit: number = 20): FormulaResult[] {
+        this._check_initialized();
+
+        const raw = this.module.dv_search_formulas(query, limit);
+        const formulas: FormulaResult[] = [];
+        for (let i = 0; i < raw.size(); i++) {
+            formulas.push(embindFormulaToResult(raw.get(i)!));
+        }
+        raw.delete();
+
+        return formulas;
+    }
+
+    // Computes target_unit with the suggested formula `index` (FormulaResult.index of a
+    // top-level suggestion), deriving its missing inputs with the chain it was suggested with
+    evaluate_formula_chain(target_unit: number[], index: number): EvalResult {
+        this._check_initialized();
+
+        const vec = new this.module.VectorInt();
+        for (let i = 0; i < 7; i++) {
+            vec.push_back(target_unit[i] ?? 0);
+        }
+
+        const raw = this.module.dv_evaluate_formula_chain(vec, index);
+        vec.delete();
+        return embindResultToEvalResult(raw);
+    }
+
+    // Replaces the searched formulas with a pack built by formula_gen/formulas_to_pack.ts
+    load_formula_pack(bytes: Uint8Array): boolean {
+        this._check_initialized();
+        return this.module.dv_load_formula_pack(bytes);
+    }
+
+    // Fetches and loads a pack the first time it is asked for; later calls share the
+    // same request until it fails. Needed before searching when Nero.wasm was built with
+    // NERO_EMBED_FORMULAS=OFF.
+    fetch_formula_pack(url: string): Promise<boolean> {
+        this.formula_pack_request ??= fetch(url)
+            .then(response => response.ok ? response.arrayBuffer() : Promise.reject(new Error(`${response.status} fetching ${url}`)))
+            .then(buffer => this.load_formula_pack(new Uint8Array(buffer)))
+            .catch(error => {
+                this.formula_pack_request = undefined;
+                throw error;
+            });
+        return this.formula_pack_request;
+    }
+
     // ========================================================================
     // Variables Management
     // ========================================================================
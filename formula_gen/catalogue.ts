@@ -0,0 +1,95 @@
+import all_formulas from "./all_formulas.json"
+
+// Shared by formulas_to_cpp.ts and formulas_to_pack.ts, so the constexpr tables and a
+// binary pack hold the same families, variable tables and output-unit index
+
+export type SourceFormula = typeof all_formulas[0];
+
+export interface CatalogueVariable {
+    name: string;
+    unit: number[];
+    description: string;
+    constant: boolean;
+}
+
+export interface CatalogueFamily {
+    name: string;
+    category: string;
+    equation: string;        // as written; derived formulas are rearranged from it at runtime
+    first_variable: number;
+    variable_count: number;
+}
+
+export interface CatalogueFormula {
+    family: number;
+    latex: string;           // empty for a form the runtime derives from the family's equation
+    solve_for: number;       // index into the family's variables, NO_SOLVE_FOR if absent
+}
+
+export interface CatalogueGroup {
+    unit: number[];
+    packed: bigint;
+    first: number;           // into producers
+    count: number;
+}
+
+export interface Catalogue {
+    variables: CatalogueVariable[];
+    families: CatalogueFamily[];
+    formulas: CatalogueFormula[];
+    groups: CatalogueGroup[];    // ascending by packed unit
+    producers: number[];         // formula indices, ascending within a group
+}
+
+export const NO_SOLVE_FOR = 0xFF;
+// Physics::MAX_INPUT_TYPES: FormulaDatabase keeps this many input slots per formula
+export const MAX_INPUT_TYPES = 8;
+
+// Same bits as dv::UnitVector::packed(): lane i is a two's complement byte at bit 8i
+export function pack_unit(unit: number[]): bigint {
+    let packed = 0n;
+    unit.forEach((exponent, i) => { packed |= BigInt(exponent & 0xFF) << BigInt(8 * i); });
+    return packed;
+}
+
+// Consecutive rearrangements of the same equation form one family that owns the
+// variable table and the equation; identical tables are stored once and shared.
+// Only rearrangements the runtime cannot derive itself keep their own text.
+export function build_catalogue(source: SourceFormula[] = all_formulas): Catalogue {
+    const catalogue: Catalogue = { variables: [], families: [], formulas: [], groups: [], producers: [] };
+    const tables = new Map<string, number>();    // table key -> first variable
+    const by_output = new Map<bigint, { unit: number[], formulas: number[] }>();
+
+    let family_key = '';
+    for(const f of source){
+        const vars = f.variables as CatalogueVariable[];
+        if(vars.length > MAX_INPUT_TYPES)
+            throw new Error(`Formula "${f.name}" has ${vars.length} variables, more than the ${MAX_INPUT_TYPES} a formula may have`);
+        const table_key = JSON.stringify(vars);
+        if(`${f.name}\n${f.equation}\n${table_key}` !== family_key){
+            family_key = `${f.name}\n${f.equation}\n${table_key}`;
+            if(!tables.has(table_key)){
+                tables.set(table_key, catalogue.variables.length);
+                catalogue.variables.push(...vars);
+            }
+            catalogue.families.push({ name: f.name, category: '', equation: f.equation, first_variable: tables.get(table_key)!, variable_count: vars.length });
+        }
+        const solve_for = vars.findIndex((v) => v.name === f.solve_for);
+        if(solve_for >= 0){
+            const unit = vars[solve_for].unit;
+            const packed = pack_unit(unit);
+            if(!by_output.has(packed)) by_output.set(packed, { unit, formulas: [] });
+            by_output.get(packed)!.formulas.push(catalogue.formulas.length);
+        }
+        const derived = f.derived && solve_for >= 0;
+        catalogue.formulas.push({ family: catalogue.families.length - 1, latex: derived ? '' : f.latex, solve_for: solve_for < 0 ? NO_SOLVE_FOR : solve_for });
+    }
+
+    const packed_units = [...by_output.keys()].sort((a, b) => a < b ? -1 : a > b ? 1 : 0);
+    for(const packed of packed_units){
+        const { unit, formulas } = by_output.get(packed)!;
+        catalogue.groups.push({ unit, packed, first: catalogue.producers.length, count: formulas.length });
+        catalogue.producers.push(...formulas);
+    }
+    return catalogue;
+}
@@ -1,5 +1,5 @@
 import fs from "fs";
-import { rearrangeLatex } from "./rearrange";
+import { isolatableNatively, rearrangeLatex } from "./rearrange";
 import formulas_dynamics from "./formulas_dynamics.json"
 import formulas_gravity from "./formulas_gravity.json"
 import formulas_modern_physics from "./formulas_modern_physics.json"
@@ -192,7 +192,9 @@ const formlua_list = [
     ...parse_pushbacks_to_json(fs.readFileSync("./formula_gen/ALL.txt").toString("utf-8"))
 ];
 
-const output_formulas: (typeof formlua_list[0] & { solve_for: string })[] = [];
+// Every rearrangement keeps the equation it came from; `derived` ones are left for the
+// native engine (src/rearrange.cpp) to isolate on demand instead of being stored
+const output_formulas: (typeof formlua_list[0] & { solve_for: string, equation: string, derived: boolean })[] = [];
 const seen_latex = new Set<string>([]);
 
 for (const formula of formlua_list) {
@@ -204,7 +206,9 @@ for (const formula of formlua_list) {
             {
                 ...formula,
                 latex: arangement.latex,
-                solve_for: arangement.variable
+                solve_for: arangement.variable,
+                equation: formula.latex,
+                derived: isolatableNatively(formula.latex, arangement.variable)
             }
         );
         seen_latex.add(arangement.latex);
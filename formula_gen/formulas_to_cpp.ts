@@ -1,49 +1,63 @@
-import all_formulas from "./all_formulas.json"
 import fs from 'fs';
+import { build_catalogue, NO_SOLVE_FOR } from "./catalogue";
 
-function chunkify<T>(array: T[], size: number): T[][]{
-	const chunk_map: T[][] = [];
-	for(let i = 0; i < array.length; i += size){
-		chunk_map.push(array.slice(i, i + size));
-	}
-	return chunk_map;
-}
-
-const chunk_size = all_formulas.length / 20;
+// Emits the whole catalogue as constexpr tables, so the database lives in read-only
+// data and costs nothing to construct at startup
 
-function to_formula_list(formulas: (typeof all_formulas[0])[]): string[][] {
-    return chunkify(formulas.map((f) => {
-        const vars = f.variables.map((v: any) => {
-            const unit = `{${v.unit.join(', ')}}`;
-            return `{"${v.name}", ${unit}, "${v.description}", ${v.constant}}`;
-        }).join(',');
-
-        return `\t\tthis->formulas.emplace_back("${f.name}", "${f.latex}", std::vector<Variable>{${vars}}, "${f.solve_for}");`.replaceAll('\\', '\\\\');
-    }), chunk_size);
+function cpp_string(s: string): string {
+    return `"${s.replaceAll('\\', '\\\\').replaceAll('"', '\\"')}"`;
 }
 
-const formula_chunks = to_formula_list(all_formulas);
-
-const str = `#include "physics_formulas.hpp"
+const catalogue = build_catalogue();
 
-namespace Physics {
-    FormulaDatabase::FormulaDatabase() {
-        this->formulas.reserve(2000);
-${new Array(formula_chunks.length).fill(0).map((_, i) => `\t\tbatch_${i}();`).join('\n')}
-    }
-} // namespace Physics
-`
+const variable_rows = catalogue.variables.map((v) =>
+    `\t\t{${cpp_string(v.name)}, {${v.unit.join(', ')}}, ${cpp_string(v.description)}, ${v.constant}},`);
+const family_rows = catalogue.families.map((f) =>
+    `\t\t{${cpp_string(f.name)}, {variables + ${f.first_variable}, ${f.variable_count}}, {}, ${cpp_string(f.equation)}},`);
+const formula_rows = catalogue.formulas.map((f) =>
+    `\t\t{families + ${f.family}, ${cpp_string(f.latex)}, ${f.solve_for === NO_SOLVE_FOR ? 'Formula::no_solve_for' : f.solve_for}},`);
+const group_rows = catalogue.groups.map((g) =>
+    `\t\t{{${g.unit.join(', ')}}, ${g.first}, ${g.count}},`);
+const producer_rows: string[] = [];
+for(let i = 0; i < catalogue.producers.length; i += 16)
+    producer_rows.push(`\t\t${catalogue.producers.slice(i, i + 16).join(', ')},`);
 
-fs.writeFileSync("src/formulas/physics_formulas_main.cpp", str);
-for(let i = 0; i < formula_chunks.length; i++){
-    const str = 
-`#include "physics_formulas.hpp"
+const str = `// Generated by formula_gen/formulas_to_cpp.ts, do not edit
+#include "physics_formulas.hpp"
+#include <algorithm>
 
 namespace Physics {
-    void FormulaDatabase::batch_${i}() {
-${formula_chunks[i].join('\n')}
-    }
+#ifdef NERO_NO_EMBEDDED_FORMULAS
+    FormulaCatalogue builtin_catalogue() noexcept { return {}; }
+#else
+namespace {
+    constexpr Variable variables[] = {
+${variable_rows.join('\n')}
+    };
+
+    constexpr FormulaFamily families[] = {
+${family_rows.join('\n')}
+    };
+    // FormulaDatabase keeps MAX_INPUT_TYPES input slots per formula
+    static_assert(std::ranges::all_of(families, [](const FormulaFamily& f) { return f.variables.size() <= MAX_INPUT_TYPES; }),
+                  "a formula family has more variables than MAX_INPUT_TYPES");
+
+    constexpr Formula formulas[] = {
+${formula_rows.join('\n')}
+    };
+
+    constexpr OutputGroup output_groups[] = {
+${group_rows.join('\n')}
+    };
+
+    constexpr std::uint32_t producers[] = {
+${producer_rows.join('\n')}
+    };
+} // namespace
+
+    FormulaCatalogue builtin_catalogue() noexcept { return { formulas, output_groups, producers }; }
+#endif
 } // namespace Physics
 `
-    fs.writeFileSync(`src/formulas/physics_formulas_batch${i}.cpp`, str);
-}
\ No newline at end of file
+
+fs.writeFileSync("src/formulas/physics_formulas_table.cpp", str);
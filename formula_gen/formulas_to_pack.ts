@@ -0,0 +1,92 @@
+import fs from 'fs';
+import all_formulas from "./all_formulas.json"
+import { build_catalogue, pack_unit } from "./catalogue";
+
+// Writes the catalogue as a binary pack that Physics::FormulaPack maps or loads at
+// runtime (layout documented in src/formulas/formula_pack.hpp). Usage:
+//   ts-node -T formula_gen/formulas_to_pack.ts [out.pack] [formulas_<domain>.json ...]
+// Naming domain files keeps only the families defined in them, e.g. an electronics pack
+// from formulas_dc_circuits.json and formulas_current_resistance.json.
+
+const [out_path = "src/formulas/physics_formulas.pack", ...domain_files] = process.argv.slice(2);
+
+let source = all_formulas;
+if(domain_files.length > 0){
+    const names = new Set<string>();
+    for(const file of domain_files)
+        for(const f of JSON.parse(fs.readFileSync(file, 'utf8'))) names.add(f.name);
+    source = all_formulas.filter((f) => names.has(f.name));
+}
+const catalogue = build_catalogue(source);
+
+const PACK_MAGIC = 0x4B50464E;    // "NFPK"
+const PACK_VERSION = 2;
+
+// Identical strings share one pool entry
+const pool: Buffer[] = [];
+let pool_size = 0;
+const interned = new Map<string, [number, number]>();
+function intern(s: string): [number, number] {
+    if(!interned.has(s)){
+        const bytes = Buffer.from(s, 'utf8');
+        interned.set(s, [pool_size, bytes.length]);
+        pool.push(bytes);
+        pool_size += bytes.length;
+    }
+    return interned.get(s)!;
+}
+
+const align8 = (n: number) => (n + 7) & ~7;
+
+const groups = Buffer.alloc(align8(catalogue.groups.length * 16));
+catalogue.groups.forEach((g, i) => {
+    groups.writeBigUInt64LE(pack_unit(g.unit), i * 16);
+    groups.writeUInt32LE(g.first, i * 16 + 8);
+    groups.writeUInt32LE(g.count, i * 16 + 12);
+});
+
+const producers = Buffer.alloc(align8(catalogue.producers.length * 4));
+catalogue.producers.forEach((p, i) => producers.writeUInt32LE(p, i * 4));
+
+const variables = Buffer.alloc(catalogue.variables.length * 32);
+catalogue.variables.forEach((v, i) => {
+    const [name, name_length] = intern(v.name);
+    const [description, description_length] = intern(v.description);
+    variables.writeBigUInt64LE(pack_unit(v.unit), i * 32);
+    variables.writeUInt32LE(name, i * 32 + 8);
+    variables.writeUInt32LE(name_length, i * 32 + 12);
+    variables.writeUInt32LE(description, i * 32 + 16);
+    variables.writeUInt32LE(description_length, i * 32 + 20);
+    variables.writeUInt32LE(v.constant ? 1 : 0, i * 32 + 24);
+});
+
+const families = Buffer.alloc(catalogue.families.length * 32);
+catalogue.families.forEach((f, i) => {
+    const [name, name_length] = intern(f.name);
+    const [category, category_length] = intern(f.category);
+    const [equation, equation_length] = intern(f.equation);
+    families.writeUInt32LE(name, i * 32);
+    families.writeUInt32LE(name_length, i * 32 + 4);
+    families.writeUInt32LE(category, i * 32 + 8);
+    families.writeUInt32LE(category_length, i * 32 + 12);
+    families.writeUInt32LE(equation, i * 32 + 16);
+    families.writeUInt32LE(equation_length, i * 32 + 20);
+    families.writeUInt32LE(f.first_variable, i * 32 + 24);
+    families.writeUInt32LE(f.variable_count, i * 32 + 28);
+});
+
+const formulas = Buffer.alloc(catalogue.formulas.length * 16);
+catalogue.formulas.forEach((f, i) => {
+    const [latex, latex_length] = intern(f.latex);
+    formulas.writeUInt32LE(latex, i * 16);
+    formulas.writeUInt32LE(latex_length, i * 16 + 4);
+    formulas.writeUInt32LE(f.family, i * 16 + 8);
+    formulas.writeUInt32LE(f.solve_for, i * 16 + 12);
+});
+
+const header = Buffer.alloc(32);
+[PACK_MAGIC, PACK_VERSION, pool_size, catalogue.variables.length, catalogue.families.length,
+ catalogue.formulas.length, catalogue.groups.length, catalogue.producers.length]
+    .forEach((field, i) => header.writeUInt32LE(field, i * 4));
+
+fs.writeFileSync(out_path, Buffer.concat([header, groups, producers, variables, families, formulas, ...pool]));
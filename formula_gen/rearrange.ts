@@ -961,6 +961,76 @@ function isolate(lhs: Node, rhs: Node, target: string): Node | null {
   return null;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Native isolation check
+//
+// src/rearrange.cpp isolates a variable at runtime by inverting the operations
+// around its single occurrence. Forms it can derive are left out of the compiled
+// database, so this must only accept what it handles.
+// ─────────────────────────────────────────────────────────────────────────────
+
+const NATIVE_INVERTIBLE = new Set(["ln", "log", "sin", "cos", "tan", "arcsin", "arccos", "arctan"]);
+
+function countVar(node: Node, varName: string): number {
+  switch (node.kind) {
+    case "var": return node.name === varName ? 1 : 0;
+    case "num": return 0;
+    case "neg": return countVar(node.arg, varName);
+    case "pm":  return countVar(node.base, varName) + countVar(node.delta, varName);
+    case "fn":  return node.args.reduce((n, a) => n + countVar(a, varName), 0);
+    case "eq": case "add": case "sub": case "mul": case "div": case "pow":
+      return countVar(node.left, varName) + countVar(node.right, varName);
+  }
+}
+
+function nativePath(node: Node, target: string): boolean {
+  switch (node.kind) {
+    case "var": return node.name === target;
+    case "neg": return nativePath(node.arg, target);
+    case "add": case "sub": case "mul": case "div": case "pow":
+      return nativePath(containsVar(node.left, target) ? node.left : node.right, target);
+    case "fn":
+      return NATIVE_INVERTIBLE.has(node.name) && node.args.length >= 1
+        && node.args.slice(1).every(a => !containsVar(a, target)) && nativePath(node.args[0], target);
+    default: return false;
+  }
+}
+
+// Commands the C++ lexer (src/lexer.cpp) matches by prefix after a backslash, so a
+// longer command starting with one is misread: \sigma lexes as \sig, \cdots as \cdot
+const NATIVE_KEYWORDS = [
+  "arcsin", "arccos", "arctan", "arcsec", "arccsc", "arccot", "floor", "round", "times",
+  "sqrt", "ceil", "fact", "frac", "cdot", "prod", "lnot", "land", "conj", "sin", "cos", "tan",
+  "sec", "csc", "cot", "abs", "nCr", "nPr", "log", "sum", "int", "min", "max", "gcd", "lcm",
+  "sig", "det", "lor", "leq", "geq", "mod", "pi", "ln", "pm",
+];
+// Commands that parse natively only with syntax the equations here do not use
+// (\sum_{i=..}^{..}, a lone \text{..} name)
+const NATIVE_UNSUPPORTED = new Set(["sum", "prod", "int", "text"]);
+
+function nativeCommand(name: string): boolean {
+  if (NATIVE_UNSUPPORTED.has(name)) return false;
+  return NATIVE_KEYWORDS.includes(name) || !NATIVE_KEYWORDS.some(keyword => name.startsWith(keyword));
+}
+
+/** True when `variable` occurs once in `latex` under operations the C++ engine inverts. */
+export function isolatableNatively(latex: string, variable: string): boolean {
+  // The tokeniser here reads |x| and [..] as plain grouping; the C++ parser does not
+  if (/[|[]/.test(latex)) return false;
+  // Nor would the C++ lexer read every command the way this tokeniser does
+  for (const [, name] of latex.matchAll(/\\([a-zA-Z]+)/g))
+    if (!nativeCommand(name)) return false;
+  let equation: Node;
+  try {
+    equation = new Parser(tokenise(latex)).parseEquation();
+  } catch {
+    return false;
+  }
+  const eq = equation as Eq;
+  if (countVar(eq, variable) !== 1) return false;
+  return nativePath(containsVar(eq.left, variable) ? eq.left : eq.right, variable);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // LaTeX serialiser
 // ─────────────────────────────────────────────────────────────────────────────
@@ -1 +1 @@
-ts-node -T formula_gen/formula_extractor.ts && ts-node -T formula_gen/formulas_to_cpp.ts
\ No newline at end of file
+ts-node -T formula_gen/formula_extractor.ts && ts-node -T formula_gen/formulas_to_cpp.ts && ts-node -T formula_gen/formulas_to_pack.ts
@@ -0,0 +1,56 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <new>
+
+namespace {
+    // Enough for the nodes and text of a typical line; later blocks double
+    constexpr std::size_t first_block_size = 4096;
+    thread_local dv::Arena *active_arena = nullptr;
+}
+
+dv::Arena::~Arena(){
+    while(last) {
+        Block *previous = last->previous;
+        ::operator delete(last);
+        last = previous;
+    }
+}
+
+void* dv::Arena::allocate(std::size_t size, std::size_t alignment){
+    auto aligned = [&](std::byte *at) {
+        const auto address = reinterpret_cast<std::uintptr_t>(at);
+        return at + (alignment - address % alignment) % alignment;
+    };
+    std::byte *at = cursor ? aligned(cursor) : nullptr;
+    if(!at || at + size > limit) {
+        const std::size_t block_size = std::max(last ? last->size * 2 : first_block_size, sizeof(Block) + size + alignment);
+        last = ::new(::operator new(block_size)) Block{last, block_size};
+        cursor = reinterpret_cast<std::byte*>(last) + sizeof(Block);
+        limit = reinterpret_cast<std::byte*>(last) + block_size;
+        at = aligned(cursor);
+    }
+    cursor = at + size;
+    return at;
+}
+
+bool dv::Arena::owns(const void *memory) const noexcept{
+    const auto *at = static_cast<const std::byte*>(memory);
+    for(const Block *block = last; block; block = block->previous) {
+        const auto *begin = reinterpret_cast<const std::byte*>(block);
+        if(!std::less{}(at, begin) && std::less{}(at, begin + block->size)) return true;
+    }
+    return false;
+}
+
+std::size_t dv::Arena::block_count() const noexcept{
+    std::size_t count = 0;
+    for(const Block *block = last; block; block = block->previous) count++;
+    return count;
+}
+
+dv::Arena::Scope::Scope(Arena &arena) noexcept: previous{active_arena} { active_arena = &arena; }
+dv::Arena::Scope::~Scope() { active_arena = previous; }
+
+dv::Arena* dv::Arena::active() noexcept { return active_arena; }
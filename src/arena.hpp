@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+namespace dv {
+    // Bump allocator: memory is handed out from a few growing blocks and only returned,
+    // all at once, when the arena is destroyed. Objects placed in it still have to be
+    // destroyed before that; the arena only owns their memory.
+    class Arena {
+    public:
+        Arena() = default;
+        ~Arena();
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+        bool owns(const void *memory) const noexcept;
+        std::size_t block_count() const noexcept;
+
+        // While a Scope lives, AST nodes created on this thread are allocated from its
+        // arena (see AST::operator new); scopes nest
+        class Scope {
+        public:
+            explicit Scope(Arena &arena) noexcept;
+            ~Scope();
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        private:
+            Arena *previous;
+        };
+        // The arena of the innermost Scope on this thread, or nullptr
+        static Arena* active() noexcept;
+
+    private:
+        // Header at the start of every block, linking it to the one before
+        struct Block {
+            Block *previous;
+            std::size_t size;
+        };
+        Block *last = nullptr;
+        std::byte *cursor = nullptr;
+        std::byte *limit = nullptr;
+    };
+}
@@ -6,12 +6,25 @@
 #include <cstddef>
 #include <expected>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 
 namespace dv {
     class Evaluator;
     using MaybeEValue = std::expected<EValue, std::string>;
+
+    // Names bound by an enclosing \sum, \prod, \int, derivative or function call. Frames live on
+    // the C++ stack and link outwards; a function body starts a new chain, so it sees only its
+    // parameters and the globals.
+    struct Scope {
+        std::span<const std::string> names;
+        std::span<const EValue> values;
+        const Scope *parent = nullptr;
+        const EValue* find(std::string_view name) const noexcept;
+    };
+
     struct AST {
         struct ASTExpression {
             std::unique_ptr<AST> lhs;
@@ -29,11 +42,17 @@ namespace dv {
         AST(const Token token): token(token), data(ASTExpression{nullptr, nullptr, token.value}) {}
         AST(const Token token, std::unique_ptr<AST> lhs, std::unique_ptr<AST> rhs): token{token}, data{ASTExpression{std::move(lhs), std::move(rhs), 0.0}} {}
         AST(const Token token, std::vector<std::unique_ptr<AST>> args, std::unique_ptr<AST> special_value = nullptr): token{token}, data{ASTCall{std::move(args), std::move(special_value)}} {}
-        MaybeEValue evaluate(dv::Evaluator &evalulator);
-        MaybeEValue evaluate(const AST *ast, dv::Evaluator &evalulator);
-        MaybeEValue evaluate(const std::unique_ptr<AST> &ast, dv::Evaluator &evalulator);
+        MaybeEValue evaluate(dv::Evaluator &evalulator, const Scope *scope = nullptr);
+        MaybeEValue evaluate(const AST *ast, dv::Evaluator &evalulator, const Scope *scope = nullptr);
+        MaybeEValue evaluate(const std::unique_ptr<AST> &ast, dv::Evaluator &evalulator, const Scope *scope = nullptr);
         std::unique_ptr<AST> clone() const;
         std::string to_string(const std::uint16_t depth = 0) const noexcept;
+
+        // Nodes made while an Arena::Scope is active (a ParseSession parsing or cloning) are
+        // placed in that arena, others on the heap. Deleting a node runs its destructor
+        // either way but only frees heap memory; arena memory goes with its session.
+        static void* operator new(std::size_t size);
+        static void operator delete(void *node) noexcept;
     };
 }
 template <>
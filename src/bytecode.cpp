@@ -0,0 +1,589 @@
+#include "bytecode.hpp"
+#include "evaluator.hpp"
+#include "operators.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <optional>
+#include <span>
+#include <unordered_map>
+
+using dv::ops::get_real;
+using dv::ops::get_unit;
+using dv::ops::as_uv;
+
+// ============================================================================
+// Compiler
+// ============================================================================
+
+namespace {
+    class Compiler {
+    public:
+        Compiler(dv::Program &program, dv::SymbolTable &symbols, std::span<const std::string> parameters)
+            : program{program}, symbols{symbols} {
+            for(const auto &param : parameters) push_local(symbols.intern(param));
+            parameter_count = locals.size();
+        }
+
+        // Emits code leaving the value of `ast` on the stack, and returns whether that value
+        // is always a real UnitValue
+        bool emit_node(const dv::AST *ast) {
+            using dv::TokenType;
+            using dv::OpCode;
+            switch (ast->token.type) {
+                case TokenType::EQUAL: {
+                    const auto &expr = std::get<dv::AST::ASTExpression>(ast->data);
+                    if(expr.lhs->token.type == TokenType::FORMULA_QUERY) {
+                        const bool real = emit_node(expr.rhs.get());
+                        emit(OpCode::FORMULA_QUERY);
+                        return real;
+                    }
+                    if(expr.lhs->token.type == TokenType::FUNC_CALL) {
+                        emit(OpCode::DEFINE_FUNCTION, node_id(ast));
+                        return true;
+                    }
+                    const bool real = emit_node(expr.rhs.get());
+                    emit(OpCode::STORE_SLOT, symbols.intern(expr.lhs->token.text), string_id(expr.rhs->token.text));
+                    return real;
+                }
+                case TokenType::NUMERIC_LITERAL: {
+                    const auto &value = std::get<dv::AST::ASTExpression>(ast->data).value;
+                    program.constants.push_back(value);
+                    emit(OpCode::PUSH_CONSTANT, static_cast<std::uint32_t>(program.constants.size() - 1));
+                    const auto *uv = std::get_if<dv::UnitValue>(&value);
+                    return uv && !uv->is_complex();
+                }
+                case TokenType::IDENTIFIER: {
+                    const auto symbol = symbols.intern(ast->token.text);
+                    if(const auto local = find_local(symbol)) {
+                        emit(OpCode::LOAD_LOCAL, *local);
+                        // Loop, integral and derivative variables are always bound to reals
+                        return *local >= parameter_count;
+                    }
+                    emit(OpCode::LOAD_SLOT, symbol);
+                    return false;
+                }
+                case TokenType::BUILTIN_FUNC_SUM:
+                case TokenType::BUILTIN_FUNC_PROD:
+                case TokenType::BUILTIN_FUNC_INT: {
+                    const auto &call = std::get<dv::AST::ASTCall>(ast->data);
+                    emit_node(call.args[0].get());
+                    emit_node(call.args[1].get());
+                    const auto op = ast->token.type == TokenType::BUILTIN_FUNC_SUM  ? OpCode::SUM
+                                  : ast->token.type == TokenType::BUILTIN_FUNC_PROD ? OpCode::PRODUCT
+                                                                                    : OpCode::INTEGRAL;
+                    const auto at = emit(op, push_local(symbols.intern(call.special_value->token.text)));
+                    bool real_body = false;
+                    program.code[at].b = emit_body(call.args[2].get(), real_body);
+                    locals.pop_back();
+                    return op == OpCode::INTEGRAL || real_body;
+                }
+                case TokenType::DERIVATIVE: {
+                    const auto &call = std::get<dv::AST::ASTCall>(ast->data);
+                    const auto symbol = symbols.intern(call.special_value->token.text);
+                    const auto node = node_id(ast);
+                    // A local point is always bound; a global one is looked up when the derivative runs
+                    std::optional<std::size_t> point;
+                    if(const auto local = find_local(symbol)) emit(OpCode::LOAD_LOCAL, *local);
+                    else point = emit(OpCode::DERIVATIVE_POINT, symbol, 0, node);
+                    const auto at = emit(OpCode::DERIVATIVE, push_local(symbol), 0, node);
+                    bool real_body = false;
+                    program.code[at].b = emit_body(call.args[0].get(), real_body);
+                    locals.pop_back();
+                    // An unbound global point yields a derivative function instead
+                    if(point) program.code[*point].b = here() - static_cast<std::uint32_t>(*point) - 1;
+                    return !point;
+                }
+                case TokenType::PRIME:
+                case TokenType::FUNC_CALL: {
+                    const auto &call = std::get<dv::AST::ASTCall>(ast->data);
+                    const bool is_prime = ast->token.type == TokenType::PRIME;
+                    const auto name = string_id(ast->token.text);
+                    const auto argc = static_cast<std::uint32_t>(call.args.size());
+                    emit(OpCode::CHECK_FUNCTION, name, argc, is_prime ? 1 : 0);
+                    for(const auto &arg : call.args) emit_node(arg.get());
+                    if(is_prime) emit(OpCode::PRIME, name, argc, static_cast<std::uint32_t>((int)ast->token.value.value));
+                    else emit(OpCode::CALL_FUNCTION, name, argc);
+                    return is_prime;
+                }
+                case TokenType::PIECEWISE_BEGIN: {
+                    const auto &call = std::get<dv::AST::ASTCall>(ast->data);
+                    std::vector<std::size_t> exits;
+                    bool real = true;
+                    for(std::size_t i = 0; i + 1 < call.args.size(); i += 2) {
+                        emit_node(call.args[i + 1].get());
+                        const auto skip = emit(OpCode::JUMP_IF_FALSE);
+                        real = emit_node(call.args[i].get()) && real;
+                        exits.push_back(emit(OpCode::JUMP));
+                        program.code[skip].a = here();
+                    }
+                    emit(OpCode::FAIL, string_id("Piecewise: no matching condition"));
+                    for(const auto exit : exits) program.code[exit].a = here();
+                    return real;
+                }
+                case TokenType::FORMULA_QUERY:
+                    emit(OpCode::FAIL, string_id("'?' can only be used as '? = (unit)' to search for formulas"));
+                    return false;
+                default: break;
+            }
+            if(dv::is_eager_operator(ast->token.type)) {
+                std::uint32_t operand_count = 0;
+                bool real_operands = true;
+                if(const auto *expr = std::get_if<dv::AST::ASTExpression>(&ast->data)) {
+                    for(const auto *child : {expr->lhs.get(), expr->rhs.get()}) {
+                        if(!child) continue;
+                        real_operands = emit_node(child) && real_operands;
+                        operand_count++;
+                    }
+                } else {
+                    const auto &call = std::get<dv::AST::ASTCall>(ast->data);
+                    for(const auto &arg : call.args) real_operands = emit_node(arg.get()) && real_operands;
+                    operand_count = static_cast<std::uint32_t>(call.args.size());
+                    if(call.special_value) {
+                        real_operands = emit_node(call.special_value.get()) && real_operands;
+                        operand_count++;
+                    }
+                }
+                const bool real = real_operands && preserves_real(ast->token.type);
+                const bool kernel = real && operand_count == 2 && has_real_kernel(ast->token.type);
+                emit(kernel ? OpCode::APPLY_REAL : OpCode::APPLY, static_cast<std::uint32_t>(ast->token.type), operand_count);
+                return real;
+            }
+            emit(OpCode::FAIL, string_id(std::format("Unsupported expression (token: '{}')", ast->token.text)));
+            return false;
+        }
+
+        void finish() { emit(dv::OpCode::RETURN); }
+
+    private:
+        dv::Program &program;
+        dv::SymbolTable &symbols;
+        std::unordered_map<std::string, std::uint32_t> string_ids;
+        std::vector<dv::SymbolId> locals;   // bound names in scope, innermost last; position = frame index
+        std::size_t parameter_count = 0;    // leading locals bound by the caller
+
+        // Operators whose result is a real scalar whenever all their operands are
+        static bool preserves_real(dv::TokenType type) noexcept {
+            using dv::TokenType;
+            switch (type) {
+                case TokenType::PLUS:
+                case TokenType::MINUS:
+                case TokenType::TIMES:
+                case TokenType::DIVIDE:
+                case TokenType::FRACTION:
+                case TokenType::EXPONENT:
+                case TokenType::FACTORIAL:
+                case TokenType::PERCENT:
+                case TokenType::MODULO:
+                case TokenType::LESS_THAN:
+                case TokenType::GREATER_THAN:
+                case TokenType::LESS_EQUAL:
+                case TokenType::GREATER_EQUAL:
+                case TokenType::LOGICAL_AND:
+                case TokenType::LOGICAL_OR:
+                case TokenType::LOGICAL_NOT:
+                case TokenType::BUILTIN_FUNC_SIN:
+                case TokenType::BUILTIN_FUNC_COS:
+                case TokenType::BUILTIN_FUNC_TAN:
+                case TokenType::BUILTIN_FUNC_SEC:
+                case TokenType::BUILTIN_FUNC_CSC:
+                case TokenType::BUILTIN_FUNC_COT:
+                case TokenType::BUILTIN_FUNC_LOG:
+                case TokenType::ABSOLUTE_BAR:
+                case TokenType::BUILTIN_FUNC_ABS:
+                case TokenType::BUILTIN_FUNC_NCR:
+                case TokenType::BUILTIN_FUNC_NPR:
+                    return true;
+                default: return false;
+            }
+        }
+        // Binary operators with a UnitValue::*_real kernel
+        static bool has_real_kernel(dv::TokenType type) noexcept {
+            using dv::TokenType;
+            switch (type) {
+                case TokenType::PLUS:
+                case TokenType::MINUS:
+                case TokenType::TIMES:
+                case TokenType::DIVIDE:
+                case TokenType::FRACTION:
+                case TokenType::EXPONENT:
+                    return true;
+                default: return false;
+            }
+        }
+
+        std::uint32_t push_local(dv::SymbolId symbol) {
+            locals.push_back(symbol);
+            program.frame_size = std::max(program.frame_size, static_cast<std::uint32_t>(locals.size()));
+            return static_cast<std::uint32_t>(locals.size() - 1);
+        }
+        std::optional<std::uint32_t> find_local(dv::SymbolId symbol) const {
+            for(std::size_t i = locals.size(); i-- > 0;)
+                if(locals[i] == symbol) return static_cast<std::uint32_t>(i);
+            return std::nullopt;
+        }
+
+        std::uint32_t here() const { return static_cast<std::uint32_t>(program.code.size()); }
+
+        std::size_t emit(dv::OpCode op, std::uint32_t a = 0, std::uint32_t b = 0, std::uint32_t c = 0) {
+            program.code.push_back(dv::Instruction{op, a, b, c});
+            return program.code.size() - 1;
+        }
+
+        // Emits a body terminated by RETURN and returns its length
+        std::uint32_t emit_body(const dv::AST *body, bool &real) {
+            const auto begin = here();
+            real = emit_node(body);
+            emit(dv::OpCode::RETURN);
+            return here() - begin;
+        }
+
+        std::uint32_t string_id(std::string_view text) {
+            auto [found, inserted] = string_ids.try_emplace(std::string{text}, static_cast<std::uint32_t>(program.strings.size()));
+            if(inserted) program.strings.emplace_back(text);
+            return found->second;
+        }
+
+        std::uint32_t node_id(const dv::AST *node) {
+            program.nodes.push_back(node);
+            return static_cast<std::uint32_t>(program.nodes.size() - 1);
+        }
+    };
+}
+
+dv::Program dv::compile(const AST &ast, SymbolTable &symbols, std::span<const std::string> parameters) {
+    Program program;
+    Compiler compiler{program, symbols, parameters};
+    compiler.emit_node(&ast);
+    compiler.finish();
+    return program;
+}
+
+dv::Function dv::make_function(std::string name, std::vector<std::string> param_names, const AST &body, SymbolTable &symbols) {
+    auto session = std::make_shared<ParseSession>();
+    auto owned = session->clone(body);
+    auto program = compile(*owned, symbols, param_names);
+    dv::Function f;
+    f.name = std::move(name);
+    f.param_names = std::move(param_names);
+    f.program = std::make_shared<const Program>(std::move(program));
+    f.session = std::move(session);
+    f.body = std::shared_ptr<AST>(owned.release());
+    return f;
+}
+
+dv::MaybeEValue dv::define_function(const AST &definition, Evaluator &evaluator) {
+    const auto &expr = std::get<AST::ASTExpression>(definition.data);
+    const auto &call = std::get<AST::ASTCall>(expr.lhs->data);
+    std::string func_name = std::string(expr.lhs->token.text);
+    std::vector<std::string> param_names;
+    for(const auto &arg : call.args) {
+        if(arg->token.type != TokenType::IDENTIFIER) {
+            return std::unexpected{std::format("Function parameter must be a variable name, got '{}'", arg->token.text)};
+        }
+        param_names.emplace_back(arg->token.text);
+    }
+    evaluator.custom_functions.insert_or_assign(func_name, make_function(func_name, std::move(param_names), *expr.rhs, evaluator.get_symbols()));
+    return EValue{UnitValue{0.0}};
+}
+
+// ============================================================================
+// Virtual machine
+// ============================================================================
+
+namespace {
+    class VirtualMachine {
+    public:
+        explicit VirtualMachine(dv::Evaluator &evaluator)
+            : evaluator{evaluator}, symbols{evaluator.get_symbols()}, variables{evaluator.evaluated_variables} { stack.reserve(64); }
+
+        // Runs a whole program with a fresh frame on top of the stack
+        dv::MaybeEValue call(const dv::Program &program) {
+            const auto frame = stack.size();
+            stack.resize(frame + program.frame_size);
+            auto result = run(program, 0, frame);
+            stack.resize(frame);
+            return result;
+        }
+
+        dv::MaybeEValue call(const dv::Function &function, std::span<const dv::EValue> args) {
+            stack.insert(stack.end(), args.begin(), args.end());
+            return call_function(function, args.size());
+        }
+
+    private:
+        dv::Evaluator &evaluator;
+        dv::SymbolTable &symbols;
+        dv::VariableStore &variables;
+        std::vector<dv::EValue> stack;
+
+        // Runs from `pc` up to the matching RETURN and yields the value it leaves on the stack.
+        // Locals of the running program start at stack[frame].
+        dv::MaybeEValue run(const dv::Program &program, std::size_t pc, std::size_t frame);
+
+        dv::EValue pop() {
+            auto value = std::move(stack.back());
+            stack.pop_back();
+            return value;
+        }
+        // Calls `function` with the arguments on top of the stack, which become the first
+        // locals of its frame, and pops them
+        dv::MaybeEValue call_function(const dv::Function &function, std::size_t argc) {
+            const auto frame = stack.size() - argc;
+            const auto program = function.program;  // keeps the bytecode alive if the function is redefined
+            dv::MaybeEValue result;
+            if(program) {
+                if(program->frame_size > argc) stack.resize(frame + program->frame_size);
+                result = run(*program, 0, frame);
+            } else {
+                const dv::Scope scope{function.param_names, std::span{stack}.subspan(frame, argc), nullptr};
+                result = function.body->evaluate(evaluator, &scope);
+            }
+            stack.resize(frame);
+            return result;
+        }
+    };
+
+    dv::MaybeEValue VirtualMachine::run(const dv::Program &program, std::size_t pc, std::size_t frame) {
+        using dv::EValue;
+        using dv::UnitValue;
+        using dv::OpCode;
+        const auto base = stack.size();
+        auto fail = [&](std::string message) -> dv::MaybeEValue {
+            stack.resize(base);
+            return std::unexpected{std::move(message)};
+        };
+
+        while(true) {
+            const auto &ins = program.code[pc];
+            switch (ins.op) {
+                case OpCode::PUSH_CONSTANT:
+                    stack.push_back(program.constants[ins.a]);
+                    break;
+                case OpCode::LOAD_SLOT: {
+                    if(const auto *constant = evaluator.fixed_constants.get(ins.a))
+                        stack.push_back(*constant);
+                    else if(const auto *variable = variables.get(ins.a))
+                        stack.push_back(*variable);
+                    // Imaginary unit 'i' — only if not otherwise defined
+                    else if(symbols.name(ins.a) == "i")
+                        stack.push_back(UnitValue{0.0, 1.0, dv::UnitVector{dv::DIMENSIONLESS_VEC}});
+                    else
+                        return fail(std::format("Undefined variable '{}'", symbols.name(ins.a)));
+                    break;
+                }
+                case OpCode::LOAD_LOCAL: {
+                    EValue local = stack[frame + ins.a];
+                    stack.push_back(std::move(local));
+                    break;
+                }
+                case OpCode::STORE_SLOT:
+                    variables.set(ins.a, stack.back());
+                    evaluator.variable_source_expressions.insert_or_assign(symbols.name(ins.a), program.strings[ins.b]);
+                    break;
+                case OpCode::DEFINE_FUNCTION: {
+                    auto defined = dv::define_function(*program.nodes[ins.a], evaluator);
+                    if(!defined) return fail(std::move(defined.error()));
+                    stack.push_back(std::move(*defined));
+                    break;
+                }
+                case OpCode::FORMULA_QUERY:
+                    evaluator.last_formula_results = evaluator.get_available_formulas(get_unit(stack.back()));
+                    break;
+                case OpCode::APPLY: {
+                    const std::span<const EValue> operands{stack.data() + stack.size() - ins.b, ins.b};
+                    auto result = dv::apply_operator(static_cast<dv::TokenType>(ins.a), operands);
+                    if(!result) return fail(std::move(result.error()));
+                    stack.resize(stack.size() - ins.b);
+                    stack.push_back(std::move(*result));
+                    break;
+                }
+                case OpCode::APPLY_REAL: {
+                    // The compiler proved both operands real scalars, the result replaces the lhs
+                    const auto &rhs = *std::get_if<UnitValue>(&stack.back());
+                    auto &lhs = *std::get_if<UnitValue>(&stack[stack.size() - 2]);
+                    switch (static_cast<dv::TokenType>(ins.a)) {
+                        case dv::TokenType::PLUS:     lhs = lhs.add_real(rhs); break;
+                        case dv::TokenType::MINUS:    lhs = lhs.sub_real(rhs); break;
+                        case dv::TokenType::TIMES:    lhs = lhs.mul_real(rhs); break;
+                        case dv::TokenType::EXPONENT: lhs = lhs.pow_real(rhs); break;
+                        default:                      lhs = lhs.div_real(rhs); break;
+                    }
+                    stack.pop_back();
+                    break;
+                }
+                case OpCode::JUMP:
+                    pc = ins.a;
+                    continue;
+                case OpCode::JUMP_IF_FALSE: {
+                    const bool condition = get_real(pop()) != 0.0;
+                    if(!condition) {
+                        pc = ins.a;
+                        continue;
+                    }
+                    break;
+                }
+                case OpCode::FAIL:
+                    return fail(program.strings[ins.a]);
+                case OpCode::SUM:
+                case OpCode::PRODUCT: {
+                    const bool is_product = ins.op == OpCode::PRODUCT;
+                    const auto end_val = pop();
+                    const auto start_val = pop();
+                    const auto loop_var = frame + ins.a;
+                    int start = (int)get_real(start_val);
+                    int end   = (int)get_real(end_val);
+
+                    EValue accumulator{UnitValue{is_product ? 1.0 : 0.0}};
+                    for(int i = start; i <= end; i++) {
+                        stack[loop_var] = EValue{UnitValue{(dv::Scalar)i}};
+                        auto body_val = run(program, pc + 1, frame);
+                        if(!body_val) return fail(std::move(body_val.error()));
+                        accumulator = is_product ? accumulator * *body_val : accumulator + *body_val;
+                    }
+                    stack.push_back(std::move(accumulator));
+                    pc += ins.b;
+                    break;
+                }
+                // Simpson's 1/3 rule
+                case OpCode::INTEGRAL: {
+                    const auto upper = pop();
+                    const auto lower = pop();
+                    const auto int_var = frame + ins.a;
+
+                    dv::Scalar a = get_real(lower), b = get_real(upper);
+                    int n = 1000;
+                    dv::Scalar h_step = (b - a) / n;
+
+                    auto eval_at = [&](dv::Scalar x) -> dv::Scalar {
+                        stack[int_var] = EValue{UnitValue{x}};
+                        auto result = run(program, pc + 1, frame);
+                        return result ? get_real(*result) : 0.0;
+                    };
+
+                    dv::Scalar sum = eval_at(a) + eval_at(b);
+                    for(int j = 1; j < n; j++) {
+                        dv::Scalar x = a + j * h_step;
+                        sum += (j % 2 == 0) ? 2 * eval_at(x) : 4 * eval_at(x);
+                    }
+                    sum *= h_step / 3.0;
+
+                    stack.push_back(UnitValue{sum});
+                    pc += ins.b;
+                    break;
+                }
+                case OpCode::DERIVATIVE_POINT: {
+                    if(const auto *variable = variables.get(ins.a)) {
+                        stack.push_back(*variable);
+                        break;
+                    }
+                    if(const auto *constant = evaluator.fixed_constants.get(ins.a)) {
+                        stack.push_back(*constant);
+                        break;
+                    }
+                    // Return a Function that, when called, computes the derivative
+                    const auto &var_name = symbols.name(ins.a);
+                    auto f = dv::make_function("__deriv_" + var_name, {var_name}, *program.nodes[ins.c], symbols);
+                    evaluator.custom_functions.insert_or_assign(f.name, f);
+                    stack.push_back(std::move(f));
+                    pc += ins.b;
+                    break;
+                }
+                // Numerical central difference
+                case OpCode::DERIVATIVE: {
+                    const dv::Scalar x_val = get_real(pop());
+                    const auto var = frame + ins.a;
+                    int order = (int)program.nodes[ins.c]->token.value.value;
+                    if(order < 1) order = 1;
+
+                    dv::Scalar h = 1e-7;
+                    auto eval_at = [&](dv::Scalar x) -> dv::Scalar {
+                        stack[var] = EValue{UnitValue{x}};
+                        auto result = run(program, pc + 1, frame);
+                        return result ? get_real(*result) : 0.0;
+                    };
+
+                    dv::Scalar result = 0;
+                    if(order == 1) {
+                        result = (eval_at(x_val + h) - eval_at(x_val - h)) / (2 * h);
+                    } else if(order == 2) {
+                        result = (eval_at(x_val + h) - 2 * eval_at(x_val) + eval_at(x_val - h)) / (h * h);
+                    } else {
+                        dv::Scalar h_n = (dv::Scalar)std::pow(1e-7, 1.0 / order);
+                        result = (eval_at(x_val + h_n) - eval_at(x_val - h_n)) / (2 * h_n);
+                    }
+                    stack.push_back(UnitValue{result});
+                    pc += ins.b;
+                    break;
+                }
+                case OpCode::CHECK_FUNCTION: {
+                    const auto &func_name = program.strings[ins.a];
+                    auto found = evaluator.custom_functions.find(func_name);
+                    if(found == evaluator.custom_functions.end()) {
+                        return fail(ins.c ? std::format("Undefined function '{}' for derivative", func_name)
+                                          : std::format("Undefined function '{}'", func_name));
+                    }
+                    if(found->second.param_names.size() != ins.b) {
+                        return fail(std::format("Function '{}' expects {} args, got {}",
+                            func_name, found->second.param_names.size(), ins.b));
+                    }
+                    break;
+                }
+                case OpCode::CALL_FUNCTION: {
+                    auto result = call_function(evaluator.custom_functions.at(program.strings[ins.a]), ins.b);
+                    if(!result) return fail(std::move(result.error()));
+                    stack.push_back(std::move(*result));
+                    break;
+                }
+                // f'(x) — prime derivative of custom function
+                case OpCode::PRIME: {
+                    auto &cf = evaluator.custom_functions.at(program.strings[ins.a]);
+                    int order = (int)ins.c;
+                    if(order < 1) order = 1;
+
+                    // Only the first parameter varies
+                    std::vector<EValue> arg_values;
+                    for(std::size_t i = stack.size() - ins.b; i < stack.size(); i++)
+                        arg_values.push_back(as_uv(stack[i]));
+                    stack.resize(stack.size() - ins.b);
+
+                    const dv::Scalar x_val = arg_values.empty() ? 0.0 : get_real(arg_values[0]);
+                    dv::Scalar h = 1e-7;
+                    auto eval_func = [&](dv::Scalar x) -> dv::Scalar {
+                        for(std::size_t i = 0; i < arg_values.size(); i++)
+                            stack.push_back(i == 0 ? EValue{UnitValue{x}} : arg_values[i]);
+                        auto result = call_function(cf, arg_values.size());
+                        return result ? get_real(*result) : 0.0;
+                    };
+
+                    dv::Scalar result = 0;
+                    if(order == 1) {
+                        result = (eval_func(x_val + h) - eval_func(x_val - h)) / (2 * h);
+                    } else {
+                        result = (eval_func(x_val + h) - 2 * eval_func(x_val) + eval_func(x_val - h)) / (h * h);
+                    }
+                    stack.push_back(UnitValue{result});
+                    break;
+                }
+                case OpCode::RETURN: {
+                    auto result = pop();
+                    stack.resize(base);
+                    return result;
+                }
+            }
+            pc++;
+        }
+    }
+}
+
+dv::MaybeEValue dv::execute(const Program &program, Evaluator &evaluator) {
+    VirtualMachine vm{evaluator};
+    return vm.call(program);
+}
+
+dv::MaybeEValue dv::call(const Function &function, std::span<const EValue> args, Evaluator &evaluator) {
+    if(args.size() != function.param_names.size())
+        return std::unexpected{std::format("Function '{}' takes {} arguments, got {}", function.name, function.param_names.size(), args.size())};
+    VirtualMachine vm{evaluator};
+    return vm.call(function, args);
+}
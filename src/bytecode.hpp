@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ast.hpp"
+#include "parse_session.hpp"
+#include "parser.hpp"
+#include "symbol_table.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace dv {
+    class Evaluator;
+
+    // ============================================================================
+    // Flat bytecode for the stack VM. Operands live on a value stack; loop and
+    // derivative bodies are emitted inline right after their instruction and end
+    // with RETURN, so the VM can re-run them without touching the AST.
+    //
+    // Function parameters and loop variables are locals: slots of a frame at the
+    // bottom of the program's stack segment, resolved lexically at compile time.
+    //
+    // The compiler tracks which subexpressions can only produce a real scalar (literals,
+    // loop variables, integrals and operators closed over the reals) and emits APPLY_REAL
+    // for arithmetic on them, which skips the variant dispatch and the complex branches.
+    // ============================================================================
+    enum class OpCode : std::uint8_t {
+        PUSH_CONSTANT,      // push constants[a]
+        LOAD_SLOT,          // push the constant or variable in slot a
+        LOAD_LOCAL,         // push local a of the current frame
+        STORE_SLOT,         // bind slot a to the top value, strings[b] is its source text
+        DEFINE_FUNCTION,    // define the function of the '=' node nodes[a], push 0
+        FORMULA_QUERY,      // search formulas producing the unit of the top value
+        APPLY,              // replace the top b values with apply_operator(TokenType(a), ...)
+        APPLY_REAL,         // as APPLY for binary + - * / ^ on two operands proven real scalars at compile time
+        JUMP,               // continue at a
+        JUMP_IF_FALSE,      // pop, continue at a when the value is zero
+        FAIL,               // fail with strings[a]
+        SUM,                // pop end and start, sum the body (next b instructions) over local a
+        PRODUCT,            // as SUM, multiplying
+        INTEGRAL,           // pop upper and lower, Simpson's rule of the body over local a
+        DERIVATIVE_POINT,   // push the global in slot a; if unbound, push d/d slot a of nodes[c] as a function and skip b instructions
+        DERIVATIVE,         // pop the point, differentiate the body over local a, nodes[c] is the DERIVATIVE node
+        CHECK_FUNCTION,     // fail unless custom function strings[a] exists and takes b args (c = 1 for f'(x))
+        CALL_FUNCTION,      // call custom function strings[a] with the top b values
+        PRIME,              // order c derivative of custom function strings[a] at the top b values
+        RETURN,             // end of the program or of a loop body
+    };
+
+    struct Instruction {
+        OpCode op;
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        std::uint32_t c = 0;
+    };
+
+    struct Program {
+        std::vector<Instruction> code;
+        std::vector<EValue> constants;
+        std::vector<std::string> strings;   // names, source text and error messages
+        std::vector<const AST*> nodes;      // nodes cloned at run time, owned by the compiled AST
+        std::uint32_t frame_size = 0;       // locals: parameters first, then loop variables
+    };
+
+    // A parsed expression together with its bytecode
+    struct CompiledExpression : ASTDependencies {
+        Program program;
+    };
+
+    // Globals are resolved to slots of `symbols`, which must be the table of the evaluator
+    // that runs the program; `parameters` become the first locals of a function body
+    Program compile(const AST &ast, SymbolTable &symbols, std::span<const std::string> parameters = {});
+    MaybeEValue execute(const Program &program, Evaluator &evaluator);
+    // Calls a custom function with argument values, one per parameter
+    MaybeEValue call(const Function &function, std::span<const EValue> args, Evaluator &evaluator);
+
+    // Custom functions own a copy of their body, in a session of their own, and its bytecode
+    Function make_function(std::string name, std::vector<std::string> param_names, const AST &body, SymbolTable &symbols);
+    // f(x, y) = body
+    MaybeEValue define_function(const AST &definition, Evaluator &evaluator);
+}
@@ -0,0 +1,92 @@
+#include "dependency_graph.hpp"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+dv::DependencyGraph::DependencyGraph(std::span<const Node> nodes)
+    : input_edges(nodes.size()), cyclic(nodes.size(), false), cycle_names(nodes.size()) {
+    const auto count = static_cast<std::uint32_t>(nodes.size());
+
+    // name -> lines assigning it, in source order
+    std::unordered_map<std::string_view, std::vector<std::uint32_t>> definitions;
+    for(std::uint32_t i = 0; i < count; i++) {
+        if(!nodes[i].defines.empty()) definitions[nodes[i].defines].push_back(i);
+    }
+
+    std::vector<std::vector<std::uint32_t>> successors(count);
+    std::vector<std::uint32_t> in_degree(count, 0);
+    auto add_edge = [&](std::uint32_t from, std::uint32_t to) {
+        successors[from].push_back(to);
+        in_degree[to]++;
+    };
+
+    // Keep the name behind every input so cycles can be reported by name
+    std::vector<std::vector<std::pair<std::uint32_t, std::string_view>>> named_inputs(count);
+
+    for(std::uint32_t i = 0; i < count; i++) {
+        const auto &node = nodes[i];
+        if(node.reads_everything) {
+            for(std::uint32_t j = 0; j < i; j++) {
+                named_inputs[i].emplace_back(j, "ans");
+                add_edge(j, i);
+            }
+        }
+        if(!node.reads) continue;
+        for(const auto &name : *node.reads) {
+            auto found = definitions.find(name);
+            if(found == definitions.end()) continue;
+            const auto &defs = found->second;
+            auto first_at_or_below = std::lower_bound(defs.begin(), defs.end(), i);
+            std::uint32_t source;
+            if(first_at_or_below != defs.begin()) source = *std::prev(first_at_or_below);
+            else if(name == node.defines) continue;  // `x = x + 1` with no earlier x
+            else source = *first_at_or_below;
+
+            named_inputs[i].emplace_back(source, name);
+            add_edge(source, i);
+
+            // The next reassignment of the name has to wait until this line has read it
+            auto next_definition = std::upper_bound(defs.begin(), defs.end(), source);
+            if(next_definition != defs.end() && *next_definition != i) add_edge(i, *next_definition);
+        }
+    }
+    // Reassignments of a name keep their relative order
+    for(const auto &[name, defs] : definitions) {
+        for(std::size_t k = 0; k + 1 < defs.size(); k++) add_edge(defs[k], defs[k + 1]);
+    }
+
+    for(std::uint32_t i = 0; i < count; i++) {
+        auto &edges = input_edges[i];
+        for(const auto &[source, name] : named_inputs[i]) edges.push_back(source);
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    }
+
+    // Kahn's algorithm, always taking the lowest ready line so independent lines keep source order
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, std::greater<>> ready;
+    for(std::uint32_t i = 0; i < count; i++) {
+        if(in_degree[i] == 0) ready.push(i);
+    }
+    evaluation_order.reserve(count);
+    while(!ready.empty()) {
+        const auto line = ready.top();
+        ready.pop();
+        evaluation_order.push_back(line);
+        for(const auto next : successors[line]) {
+            if(--in_degree[next] == 0) ready.push(next);
+        }
+    }
+
+    if(evaluation_order.size() == count) return;
+    for(std::uint32_t i = 0; i < count; i++) cyclic[i] = in_degree[i] > 0;
+    for(std::uint32_t i = 0; i < count; i++) {
+        if(!cyclic[i]) continue;
+        for(const auto &[source, name] : named_inputs[i]) {
+            if(!cyclic[source]) continue;
+            if(cycle_names[i].empty() || name < cycle_names[i]) cycle_names[i] = name;
+        }
+        if(cycle_names[i].empty()) cycle_names[i] = nodes[i].defines;
+    }
+}
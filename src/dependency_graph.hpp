@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace dv {
+    // Orders the lines of a sheet so that every line runs after the lines whose
+    // values it reads. A name read by a line resolves to the nearest definition
+    // above it, or to the first one below it when nothing above defines it.
+    class DependencyGraph {
+    public:
+        struct Node {
+            std::string_view defines;                                  // assigned variable/function, empty if none
+            const std::unordered_set<std::string> *reads = nullptr;   // null when the line failed to parse
+            bool reads_everything = false;                             // `ans` and `?` see every line above them
+        };
+
+        explicit DependencyGraph(std::span<const Node> nodes);
+
+        // Lines whose results flow into line `index` (sorted, no duplicates)
+        std::span<const std::uint32_t> inputs(std::uint32_t index) const noexcept { return input_edges[index]; }
+        // Topological order, ties broken by source order. Lines on or behind a cycle are left out.
+        const std::vector<std::uint32_t>& order() const noexcept { return evaluation_order; }
+        bool is_cyclic(std::uint32_t index) const noexcept { return cyclic[index]; }
+        // Name through which a cyclic line reaches another cyclic line
+        std::string_view cycle_name(std::uint32_t index) const noexcept { return cycle_names[index]; }
+
+    private:
+        std::vector<std::vector<std::uint32_t>> input_edges;
+        std::vector<std::uint32_t> evaluation_order;
+        std::vector<bool> cyclic;
+        std::vector<std::string_view> cycle_names;
+    };
+}
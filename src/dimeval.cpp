@@ -2,54 +2,29 @@
 #include <algorithm>
 #include <cmath>
 
-static int8_t combine_sig_figs(int8_t a, int8_t b) {
-    if (a == 0) return b;
-    if (b == 0) return a;
-    return std::min(a, b);
-}
-
 // ============================================================================
 // UnitVector
 // ============================================================================
 
-bool dv::UnitVector::operator==(const UnitVector &rhs) const noexcept {
-    return this->vec == rhs.vec;
-}
-bool dv::UnitVector::operator==(const UnitVec &rhs) const noexcept {
-    return this->vec == rhs;
-}
-dv::UnitVector dv::UnitVector::operator+(const UnitVector &rhs) const noexcept {
-    UnitVector temp_vec = *this;
-    if (temp_vec != rhs) temp_vec.vec.fill(0);
-    return temp_vec;
-}
-dv::UnitVector dv::UnitVector::operator-(const UnitVector &rhs) const noexcept {
-    UnitVector temp_vec = *this;
-    if (temp_vec != rhs) temp_vec.vec.fill(0);
-    return temp_vec;
-}
-dv::UnitVector dv::UnitVector::operator*(const UnitVector &rhs) const noexcept {
-    UnitVector temp_vec;
-    for (uint32_t i = 0; i < vec.size(); i++) temp_vec.vec[i] = this->vec[i] + rhs.vec[i];
-    return temp_vec;
-}
-dv::UnitVector dv::UnitVector::operator/(const UnitVector &rhs) const noexcept {
-    UnitVector temp_vec;
-    for (uint32_t i = 0; i < vec.size(); i++) temp_vec.vec[i] = this->vec[i] - rhs.vec[i];
-    return temp_vec;
-}
 dv::UnitVector dv::UnitVector::operator^(const UnitVector &rhs) const noexcept {
     UnitVector temp_vec;
-    if (rhs == DIMENSIONLESS_VEC) {
-        temp_vec.vec.fill(0);
-        return temp_vec;
-    }
-    for (uint32_t i = 0; i < vec.size(); i++) temp_vec.vec[i] = this->vec[i] * rhs.vec[i];
+    if (rhs.is_dimensionless()) return temp_vec;
+    for (std::size_t i = 0; i < 7; i++) temp_vec.set(i, (int8_t)((*this)[i] * rhs[i]));
     return temp_vec;
 }
 dv::UnitVector dv::UnitVector::operator^(const double value) const noexcept {
     UnitVector temp_vec;
-    for (uint32_t i = 0; i < vec.size(); i++) temp_vec.vec[i] = (int8_t)(this->vec[i] * value);
+    const double magnitude = std::fabs(value);
+    if (magnitude == std::floor(magnitude) && magnitude <= 127) {
+        // Integer powers by SWAR double-and-add
+        UnitVector base = value < 0 ? UnitVector{} / *this : *this;
+        for (auto k = static_cast<std::uint32_t>(magnitude); k != 0; k >>= 1) {
+            if (k & 1) temp_vec = temp_vec * base;
+            base = base * base;
+        }
+        return temp_vec;
+    }
+    for (std::size_t i = 0; i < 7; i++) temp_vec.set(i, (int8_t)((*this)[i] * value));
     return temp_vec;
 }
 
@@ -61,13 +36,8 @@ dv::UnitValue dv::UnitValue::operator+() const noexcept {
     return *this;
 }
 dv::UnitValue dv::UnitValue::operator+(const UnitValue &rhs) const noexcept {
-    auto unit_result = this->unit + rhs.unit;
-    UnitValue result;
-    if (is_complex() || rhs.is_complex()) {
-        result = {this->value + rhs.value, this->imag + rhs.imag, unit_result};
-    } else {
-        result = {this->value + rhs.value, unit_result};
-    }
+    if (!is_complex() && !rhs.is_complex()) return add_real(rhs);
+    UnitValue result{this->value + rhs.value, this->imag + rhs.imag, this->unit + rhs.unit};
     result.sig_figs = combine_sig_figs(this->sig_figs, rhs.sig_figs);
     return result;
 }
@@ -77,77 +47,58 @@ dv::UnitValue dv::UnitValue::operator-() const noexcept {
     return result;
 }
 dv::UnitValue dv::UnitValue::operator-(const UnitValue &rhs) const noexcept {
-    auto unit_result = this->unit - rhs.unit;
-    UnitValue result;
-    if (is_complex() || rhs.is_complex()) {
-        result = {this->value - rhs.value, this->imag - rhs.imag, unit_result};
-    } else {
-        result = {this->value - rhs.value, unit_result};
-    }
+    if (!is_complex() && !rhs.is_complex()) return sub_real(rhs);
+    UnitValue result{this->value - rhs.value, this->imag - rhs.imag, this->unit - rhs.unit};
     result.sig_figs = combine_sig_figs(this->sig_figs, rhs.sig_figs);
     return result;
 }
 dv::UnitValue dv::UnitValue::operator*(const UnitValue &rhs) const noexcept {
-    auto unit_result = this->unit * rhs.unit;
-    UnitValue result;
-    if (is_complex() || rhs.is_complex()) {
-        long double r = this->value * rhs.value - this->imag * rhs.imag;
-        long double i = this->value * rhs.imag + this->imag * rhs.value;
-        result = {r, i, unit_result};
-    } else {
-        result = {this->value * rhs.value, unit_result};
-    }
+    if (!is_complex() && !rhs.is_complex()) return mul_real(rhs);
+    dv::Scalar r = this->value * rhs.value - this->imag * rhs.imag;
+    dv::Scalar i = this->value * rhs.imag + this->imag * rhs.value;
+    UnitValue result{r, i, this->unit * rhs.unit};
     result.sig_figs = combine_sig_figs(this->sig_figs, rhs.sig_figs);
     return result;
 }
 dv::UnitValue dv::UnitValue::operator/(const UnitValue &rhs) const noexcept {
-    auto unit_result = this->unit / rhs.unit;
-    UnitValue result;
-    if (is_complex() || rhs.is_complex()) {
-        long double denom = rhs.value * rhs.value + rhs.imag * rhs.imag;
-        long double r = (this->value * rhs.value + this->imag * rhs.imag) / denom;
-        long double i = (this->imag * rhs.value - this->value * rhs.imag) / denom;
-        result = {r, i, unit_result};
-    } else {
-        result = {this->value / rhs.value, unit_result};
-    }
+    if (!is_complex() && !rhs.is_complex()) return div_real(rhs);
+    dv::Scalar denom = rhs.value * rhs.value + rhs.imag * rhs.imag;
+    dv::Scalar r = (this->value * rhs.value + this->imag * rhs.imag) / denom;
+    dv::Scalar i = (this->imag * rhs.value - this->value * rhs.imag) / denom;
+    UnitValue result{r, i, this->unit / rhs.unit};
     result.sig_figs = combine_sig_figs(this->sig_figs, rhs.sig_figs);
     return result;
 }
 dv::UnitValue dv::UnitValue::operator^(const UnitValue &rhs) const noexcept {
+    if (!is_complex() && !rhs.is_complex()) return pow_real(rhs);
     auto unit_result = (rhs.unit == DIMENSIONLESS_VEC)
         ? (this->unit ^ rhs.value)
         : (this->unit ^ rhs.unit);
-    UnitValue result;
-    if (is_complex() || rhs.is_complex()) {
-        // z^w using polar form: z = r*e^(i*theta), w = w_r + i*w_i
-        // z^w = exp(w * ln(z)) = exp((w_r + i*w_i)*(ln(r) + i*theta))
-        double r = std::hypot((double)this->value, (double)this->imag);
-        double theta = std::atan2((double)this->imag, (double)this->value);
-        double w_r = (double)rhs.value, w_i = (double)rhs.imag;
-        double ln_r = std::log(r);
-        double real_exp = w_r * ln_r - w_i * theta;
-        double imag_exp = w_r * theta + w_i * ln_r;
-        double mag = std::exp(real_exp);
-        result = {(long double)(mag * std::cos(imag_exp)),
-                  (long double)(mag * std::sin(imag_exp)),
-                  unit_result};
-    } else {
-        result = {(long double)std::pow((double)this->value, (double)rhs.value), unit_result};
-    }
+    // z^w using polar form: z = r*e^(i*theta), w = w_r + i*w_i
+    // z^w = exp(w * ln(z)) = exp((w_r + i*w_i)*(ln(r) + i*theta))
+    double r = std::hypot((double)this->value, (double)this->imag);
+    double theta = std::atan2((double)this->imag, (double)this->value);
+    double w_r = (double)rhs.value, w_i = (double)rhs.imag;
+    double ln_r = std::log(r);
+    double real_exp = w_r * ln_r - w_i * theta;
+    double imag_exp = w_r * theta + w_i * ln_r;
+    double mag = std::exp(real_exp);
+    UnitValue result{(dv::Scalar)(mag * std::cos(imag_exp)),
+                     (dv::Scalar)(mag * std::sin(imag_exp)),
+                     unit_result};
     result.sig_figs = combine_sig_figs(this->sig_figs, rhs.sig_figs);
     return result;
 }
 dv::UnitValue dv::UnitValue::fact() const noexcept {
-    long double f = 1;
+    dv::Scalar f = 1;
     for (uint32_t i = 2; i <= (uint64_t)this->value; i++) f *= i;
     return {f, UnitVector{DIMENSIONLESS_VEC}};
 }
 dv::UnitValue dv::UnitValue::abs() const noexcept {
     if (is_complex()) {
-        return {(long double)std::hypot((double)value, (double)imag), this->unit};
+        return {(dv::Scalar)std::hypot((double)value, (double)imag), this->unit};
     }
-    return {(long double)std::fabs((double)this->value), this->unit};
+    return {(dv::Scalar)std::fabs((double)this->value), this->unit};
 }
 std::string dv::UnitValue::to_result_string() const noexcept {
     if (is_complex()) {
@@ -274,7 +225,7 @@ EValue operator+(const EValue &lhs, const EValue &rhs) noexcept {
         else if constexpr (std::is_same_v<L, UnitValueList> && std::is_same_v<R, UnitValueList>)
             return l + r;
         else
-            return UnitValue{0.0L};
+            return UnitValue{0.0};
     }, lhs, rhs);
 }
 
@@ -295,7 +246,7 @@ EValue operator-(const EValue &lhs, const EValue &rhs) noexcept {
         } else if constexpr (std::is_same_v<L, UnitValueList> && std::is_same_v<R, UnitValueList>)
             return l - r;
         else
-            return UnitValue{0.0L};
+            return UnitValue{0.0};
     }, lhs, rhs);
 }
 
@@ -312,7 +263,7 @@ EValue operator*(const EValue &lhs, const EValue &rhs) noexcept {
         else if constexpr (std::is_same_v<L, UnitValueList> && std::is_same_v<R, UnitValueList>)
             return l * r;
         else
-            return UnitValue{0.0L};
+            return UnitValue{0.0};
     }, lhs, rhs);
 }
 
@@ -332,7 +283,7 @@ EValue operator/(const EValue &lhs, const EValue &rhs) noexcept {
         } else if constexpr (std::is_same_v<L, UnitValueList> && std::is_same_v<R, UnitValueList>)
             return l / r;
         else
-            return UnitValue{0.0L};
+            return UnitValue{0.0};
     }, lhs, rhs);
 }
 
@@ -354,7 +305,7 @@ EValue operator^(const EValue &lhs, const EValue &rhs) noexcept {
             for (std::size_t i = 0; i < n; i++) result.elements.push_back(l.elements[i] ^ r.elements[i]);
             return result;
         } else
-            return UnitValue{0.0L};
+            return UnitValue{0.0};
     }, lhs, rhs);
 }
 
@@ -363,7 +314,7 @@ EValue operator-(const EValue &ev) noexcept {
         using T = std::decay_t<decltype(v)>;
         if constexpr (std::is_same_v<T, UnitValue>) return -v;
         else if constexpr (std::is_same_v<T, UnitValueList>) return -v;
-        else return UnitValue{0.0L};
+        else return UnitValue{0.0};
     }, ev);
 }
 
@@ -376,7 +327,7 @@ EValue evalue_fact(const EValue &ev) noexcept {
         using T = std::decay_t<decltype(v)>;
         if constexpr (std::is_same_v<T, UnitValue>) return v.fact();
         else if constexpr (std::is_same_v<T, UnitValueList>) return v.fact();
-        else return UnitValue{0.0L};
+        else return UnitValue{0.0};
     }, ev);
 }
 
@@ -385,8 +336,8 @@ EValue evalue_abs(const EValue &ev) noexcept {
         using T = std::decay_t<decltype(v)>;
         if constexpr (std::is_same_v<T, UnitValue>) return v.abs();
         else if constexpr (std::is_same_v<T, UnitValueList>) return v.abs();
-        else if constexpr (std::is_same_v<T, BooleanValue>) return UnitValue{v.value ? 1.0L : 0.0L};
-        else return UnitValue{0.0L};
+        else if constexpr (std::is_same_v<T, BooleanValue>) return UnitValue{v.value ? 1.0 : 0.0};
+        else return UnitValue{0.0};
     }, ev);
 }
 
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <variant>
@@ -31,36 +35,86 @@
 
 namespace dv {
     struct AST; // forward declaration for Function::body
+    struct Program; // forward declaration for Function::program
+    class ParseSession; // forward declaration for Function::session
 
     // m  s  kg  A  K  mol  cd
     using UnitVec = std::array<std::int8_t, 7>;
 
     static constexpr UnitVec DIMENSIONLESS_VEC = { 0, 0, 0, 0, 0, 0, 0 };
 
-    struct UnitVector {
-        UnitVec vec;
-        bool operator==(const UnitVector &rhs) const noexcept;
-        bool operator==(const UnitVec &rhs) const noexcept;
-        bool operator!=(const UnitVector &rhs) const noexcept { return !(*this == rhs); }
-        bool operator!=(const UnitVec &rhs) const noexcept { return !(*this == rhs); }
-        UnitVector operator+(const UnitVector &rhs) const noexcept;
-        UnitVector operator-(const UnitVector &rhs) const noexcept;
-        UnitVector operator*(const UnitVector &rhs) const noexcept;
-        UnitVector operator/(const UnitVector &rhs) const noexcept;
+    // Numeric type of every value. long double is a software-emulated 128-bit float in
+    // the wasm build, so the extended precision mode is opt-in (-DNERO_HIGH_PRECISION=ON)
+#ifdef NERO_HIGH_PRECISION
+    using Scalar = long double;
+#else
+    using Scalar = double;
+#endif
+
+    // The seven exponents packed one signed byte per lane into a single word (metre in the
+    // lowest byte, top byte always zero), so products and quotients of units are SWAR
+    // adds and subtracts and equality is one compare
+    class UnitVector {
+    public:
+        constexpr UnitVector() noexcept = default;
+        constexpr UnitVector(const UnitVec &v) noexcept {
+            for (std::size_t i = 0; i < v.size(); i++) set(i, v[i]);
+        }
+        constexpr UnitVector(std::int8_t m, std::int8_t s, std::int8_t kg, std::int8_t a,
+                             std::int8_t k, std::int8_t mol, std::int8_t cd) noexcept
+            : UnitVector{UnitVec{m, s, kg, a, k, mol, cd}} {}
+
+        constexpr std::int8_t operator[](std::size_t i) const noexcept {
+            return static_cast<std::int8_t>(static_cast<std::uint8_t>(bits >> (8 * i)));
+        }
+        constexpr void set(std::size_t i, std::int8_t exponent) noexcept {
+            bits = (bits & ~(std::uint64_t{0xFF} << (8 * i)))
+                 | (std::uint64_t{static_cast<std::uint8_t>(exponent)} << (8 * i));
+        }
+        constexpr UnitVec to_array() const noexcept {
+            UnitVec v{};
+            for (std::size_t i = 0; i < v.size(); i++) v[i] = (*this)[i];
+            return v;
+        }
+        constexpr std::uint64_t packed() const noexcept { return bits; }
+        static constexpr UnitVector from_bits(std::uint64_t packed) noexcept {
+            UnitVector u;
+            u.bits = packed;
+            return u;
+        }
+        constexpr bool is_dimensionless() const noexcept { return bits == 0; }
+
+        constexpr bool operator==(const UnitVector &rhs) const noexcept { return bits == rhs.bits; }
+        constexpr bool operator==(const UnitVec &rhs) const noexcept { return *this == UnitVector{rhs}; }
+        // Sums and differences keep the unit only when both sides agree
+        constexpr UnitVector operator+(const UnitVector &rhs) const noexcept { return *this == rhs ? *this : UnitVector{}; }
+        constexpr UnitVector operator-(const UnitVector &rhs) const noexcept { return *this == rhs ? *this : UnitVector{}; }
+        constexpr UnitVector operator*(const UnitVector &rhs) const noexcept {
+            return from_bits(((bits & ~HIGH_BITS) + (rhs.bits & ~HIGH_BITS)) ^ ((bits ^ rhs.bits) & HIGH_BITS));
+        }
+        constexpr UnitVector operator/(const UnitVector &rhs) const noexcept {
+            return from_bits(((bits | HIGH_BITS) - (rhs.bits & ~HIGH_BITS)) ^ ((bits ^ ~rhs.bits) & HIGH_BITS));
+        }
         UnitVector operator^(const UnitVector &rhs) const noexcept;
         UnitVector operator^(const double value) const noexcept;
+
+    private:
+        // Sign bit of each of the seven lanes
+        static constexpr std::uint64_t HIGH_BITS = 0x0080808080808080ull;
+        std::uint64_t bits = 0;
+
     };
 
     struct UnitValue {
-        long double value;
-        long double imag = 0.0;
+        Scalar value;
+        Scalar imag = 0.0;
         UnitVector unit;
         int8_t sig_figs = 0;  // 0 = unlimited/exact; >0 = significant figures count
 
         UnitValue() : value{0.0}, unit{DIMENSIONLESS_VEC} {}
-        UnitValue(const long double val) : value{val}, unit{DIMENSIONLESS_VEC} {}
-        UnitValue(const long double val, const UnitVector u) : value{val}, unit{u} {}
-        UnitValue(const long double val, const long double im, const UnitVector u)
+        UnitValue(const Scalar val) : value{val}, unit{DIMENSIONLESS_VEC} {}
+        UnitValue(const Scalar val, const UnitVector u) : value{val}, unit{u} {}
+        UnitValue(const Scalar val, const Scalar im, const UnitVector u)
             : value{val}, imag{im}, unit{u} {}
 
         bool is_complex() const noexcept { return imag != 0.0; }
@@ -75,8 +129,50 @@ namespace dv {
         UnitValue operator^(const UnitValue &rhs) const noexcept;
         UnitValue fact() const noexcept;
         UnitValue abs() const noexcept;
+
+        // Kernels for two real operands: the imaginary parts are neither read nor written.
+        // The operators above dispatch here when neither side is complex.
+        UnitValue add_real(const UnitValue &rhs) const noexcept;
+        UnitValue sub_real(const UnitValue &rhs) const noexcept;
+        UnitValue mul_real(const UnitValue &rhs) const noexcept;
+        UnitValue div_real(const UnitValue &rhs) const noexcept;
+        UnitValue pow_real(const UnitValue &rhs) const noexcept;
     };
 
+    // Sig figs of a result: the smaller count, 0 (exact) defers to the other side
+    inline int8_t combine_sig_figs(int8_t a, int8_t b) noexcept {
+        if (a == 0) return b;
+        if (b == 0) return a;
+        return std::min(a, b);
+    }
+
+    inline UnitValue UnitValue::add_real(const UnitValue &rhs) const noexcept {
+        UnitValue result{value + rhs.value, unit + rhs.unit};
+        result.sig_figs = combine_sig_figs(sig_figs, rhs.sig_figs);
+        return result;
+    }
+    inline UnitValue UnitValue::sub_real(const UnitValue &rhs) const noexcept {
+        UnitValue result{value - rhs.value, unit - rhs.unit};
+        result.sig_figs = combine_sig_figs(sig_figs, rhs.sig_figs);
+        return result;
+    }
+    inline UnitValue UnitValue::mul_real(const UnitValue &rhs) const noexcept {
+        UnitValue result{value * rhs.value, unit * rhs.unit};
+        result.sig_figs = combine_sig_figs(sig_figs, rhs.sig_figs);
+        return result;
+    }
+    inline UnitValue UnitValue::div_real(const UnitValue &rhs) const noexcept {
+        UnitValue result{value / rhs.value, unit / rhs.unit};
+        result.sig_figs = combine_sig_figs(sig_figs, rhs.sig_figs);
+        return result;
+    }
+    inline UnitValue UnitValue::pow_real(const UnitValue &rhs) const noexcept {
+        const auto unit_result = (rhs.unit == DIMENSIONLESS_VEC) ? (unit ^ rhs.value) : (unit ^ rhs.unit);
+        UnitValue result{(Scalar)std::pow((double)value, (double)rhs.value), unit_result};
+        result.sig_figs = combine_sig_figs(sig_figs, rhs.sig_figs);
+        return result;
+    }
+
     struct UnitValueList {
         std::vector<UnitValue> elements;
 
@@ -107,7 +203,9 @@ namespace dv {
     struct Function {
         std::string name;
         std::vector<std::string> param_names;
+        std::shared_ptr<const ParseSession> session;  // owns the body's nodes and text, so it comes first
         std::shared_ptr<AST> body;
+        std::shared_ptr<const Program> program;  // compiled body, null for hand-built functions
         std::string to_result_string() const noexcept;
     };
 
@@ -125,3 +223,11 @@ namespace dv {
     EValue evalue_fact(const EValue &ev) noexcept;
     EValue evalue_abs(const EValue &ev) noexcept;
 }
+
+template<>
+struct std::hash<dv::UnitVector> {
+    std::size_t operator()(const dv::UnitVector &unit) const noexcept {
+        const auto mixed = unit.packed() * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(mixed ^ (mixed >> 32));
+    }
+};
@@ -1,12 +1,14 @@
 #include "evaluator.hpp"
 #include "dimeval.hpp"
-#include "lexer.hpp"
 #include "parser.hpp"
+#include "parse_session.hpp"
 #include "ast.hpp"
+#include "dependency_graph.hpp"
+#include "bytecode.hpp"
+#include <algorithm>
 #include <expected>
 #include <format>
 #include <initializer_list>
-#include <numeric>
 #include <vector>
 #ifdef EVAL_PRINT_AST
 #include <print>
@@ -58,20 +60,157 @@ dv::Evaluator::Evaluator(){
 dv::Evaluator::MaybeEvaluated dv::Evaluator::evaluate_expression(const Expression &expression){
     auto parsed = parse_expression(expression);
     if(!parsed) return std::unexpected{parsed.error()};
-    return parsed.value().ast->evaluate(*this);
+    return execute(parsed.value()->program, *this);
 }
 
 
+namespace {
+    const dv::AST::ASTExpression* assignment_of(const dv::AST *root) {
+        if(root->token.type != dv::TokenType::EQUAL) return nullptr;
+        const auto *expr = std::get_if<dv::AST::ASTExpression>(&root->data);
+        return expr && expr->lhs ? expr : nullptr;
+    }
+}
+
+dv::Evaluator::SheetLine dv::Evaluator::parse_sheet_line(std::string source){
+    SheetLine line;
+    line.source = std::move(source);
+    line.id = next_line_id++;
+    auto parsed = parse_expression(line.source);
+    if(!parsed) {
+        line.parse_error = parsed.error();
+        return line;
+    }
+    line.parsed = std::move(parsed.value());
+    line.reads = line.parsed->identifier_dependencies;
+    if(const auto *assignment = assignment_of(line.parsed->ast.get())) {
+        const auto *lhs = assignment->lhs.get();
+        if(lhs->token.type == TokenType::IDENTIFIER || lhs->token.type == TokenType::FUNC_CALL)
+            line.defines = std::string(lhs->token.text);
+        line.is_formula_query = lhs->token.type == TokenType::FORMULA_QUERY;
+        // Parameters are bound by the definition, they don't refer to other lines
+        if(lhs->token.type == TokenType::FUNC_CALL) {
+            line.is_function_definition = true;
+            for(const auto &param : std::get<AST::ASTCall>(lhs->data).args)
+                if(param->token.type == TokenType::IDENTIFIER) line.reads.erase(std::string(param->token.text));
+        }
+    }
+    return line;
+}
+
+// Re-applies the side effects of a line whose result is reused instead of re-evaluated
+void dv::Evaluator::restore_line_bindings(const SheetLine &line){
+    if(!line.result) return;
+    if(line.is_function_definition) {
+        if(line.defined_function) custom_functions.insert_or_assign(line.defines, *line.defined_function);
+    }
+    else if(!line.defines.empty()) {
+        evaluated_variables.insert_or_assign(line.defines, *line.result);
+        variable_source_expressions.insert_or_assign(line.defines,
+            std::string{assignment_of(line.parsed->ast.get())->rhs->token.text});
+    }
+    else if(line.is_formula_query) {
+        last_formula_results = line.formula_results;
+    }
+    // Derivatives of unbound variables register a helper function as they evaluate
+    if(const auto *function = std::get_if<dv::Function>(&*line.result))
+        custom_functions.insert_or_assign(function->name, *function);
+}
+
 std::vector<dv::Evaluator::MaybeEvaluated> dv::Evaluator::evaluate_expression_list(const std::span<const dv::Expression> expression_list){
     evaluated_variables.clear();
     last_formula_results.clear();
     custom_functions.clear();
     variable_source_expressions.clear();
-    std::vector<dv::MaybeASTDependencies> parsed_expressions;
-    parsed_expressions.reserve(expression_list.size());
+    last_evaluation_stats = {};
+    const bool compacting = symbols->size() >= symbol_compaction_at;
+    if(compacting) compact_symbols();
+
+    // Lines are matched to the previous call by source text, so inserting or moving
+    // a line keeps the parsed AST and the last result of every untouched line
+    const bool constants_changed = constants_generation != sheet_constants_generation;
+    sheet_constants_generation = constants_generation;
+    std::unordered_map<std::string, std::vector<std::size_t>> previous_by_source;
+    for(std::size_t i = sheet.size(); i-- > 0;)
+        previous_by_source[sheet[i].source].push_back(i);
+
+    std::vector<SheetLine> lines;
+    lines.reserve(expression_list.size());
     for(const auto &expression : expression_list){
-        parsed_expressions.emplace_back(parse_expression(expression));
+        auto source = expression.get_single_expression();
+        auto previous = previous_by_source.find(source);
+        if(previous != previous_by_source.end() && !previous->second.empty()) {
+            lines.emplace_back(std::move(sheet[previous->second.back()]));
+            previous->second.pop_back();
+            if(constants_changed) lines.back().stale = true;
+            continue;
+        }
+        lines.emplace_back(parse_sheet_line(std::move(source)));
+    }
+
+    std::vector<DependencyGraph::Node> nodes(lines.size());
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        nodes[i].defines = lines[i].defines;
+        nodes[i].reads = lines[i].parsed ? &lines[i].reads : nullptr;
+        nodes[i].reads_everything = lines[i].is_formula_query || lines[i].reads.contains("ans");
+    }
+    const DependencyGraph graph{nodes};
+
+    // 'ans' is the last successful result above a line
+    auto set_ans_before = [&](std::size_t index) {
+        for(std::size_t i = index; i-- > 0;) {
+            if(lines[i].result) {
+                evaluated_variables.insert_or_assign("ans", *lines[i].result);
+                return;
+            }
+        }
+        evaluated_variables.erase("ans");
+    };
+
+    std::vector<bool> recomputed(lines.size(), false);
+    for(const auto index : graph.order()) {
+        auto &line = lines[index];
+        std::vector<std::uint64_t> inputs;
+        inputs.reserve(graph.inputs(index).size());
+        bool input_recomputed = false;
+        for(const auto input : graph.inputs(index)) {
+            inputs.push_back(lines[input].id);
+            input_recomputed = input_recomputed || recomputed[input];
+        }
+        std::sort(inputs.begin(), inputs.end());
+
+        if(!line.stale && !input_recomputed && inputs == line.inputs) {
+            last_evaluation_stats.lines_reused++;
+            restore_line_bindings(line);
+            continue;
+        }
+        line.inputs = std::move(inputs);
+        line.stale = false;
+        recomputed[index] = true;
+        last_evaluation_stats.lines_evaluated++;
+        if(!line.parsed) {
+            line.result = std::unexpected{line.parse_error};
+            continue;
+        }
+        if(nodes[index].reads_everything) set_ans_before(index);
+        line.result = execute(line.parsed->program, *this);
+        if(line.result && line.is_function_definition)
+            line.defined_function = custom_functions.at(line.defines);
+        if(line.result && line.is_formula_query)
+            line.formula_results = last_formula_results;
+    }
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        if(!graph.is_cyclic(i)) continue;
+        lines[i].stale = true;
+        const auto name = graph.cycle_name(i);
+        lines[i].result = std::unexpected{name.empty() ? std::string{"Circular dependency"}
+                                                       : std::format("Circular dependency through '{}'", name)};
     }
+    set_ans_before(lines.size());
+
+    std::vector<MaybeEvaluated> evaluated;
+    evaluated.reserve(lines.size());
+    for(const auto &line : lines) evaluated.push_back(line.result);
 
     // === Leaf detection for sig_figs display formatting ===
     // An expression is a "display leaf" if:
@@ -79,68 +218,34 @@ std::vector<dv::Evaluator::MaybeEvaluated> dv::Evaluator::evaluate_expression_li
     //   2. Its assigned output (if any) is not referenced by any other expression
     // Only display leaves apply sig-fig-aware scientific notation.
 
-    // Step A: extract assigned variable/function name for each expression
-    std::vector<std::string> assigned_vars(parsed_expressions.size());
-    for (size_t i = 0; i < parsed_expressions.size(); i++) {
-        if (!parsed_expressions[i]) continue;
-        const auto* root = parsed_expressions[i].value().ast.get();
-        if (root->token.type == TokenType::EQUAL) {
-            const auto* expr_data = std::get_if<dv::AST::ASTExpression>(&root->data);
-            if (expr_data && expr_data->lhs) {
-                auto t = expr_data->lhs->token.type;
-                if (t == TokenType::IDENTIFIER || t == TokenType::FUNC_CALL)
-                    assigned_vars[i] = std::string(expr_data->lhs->token.text);
-            }
-        }
-    }
-
-    // Step B: set of all user-defined names in this batch
+    // Set of all user-defined names in this batch
     std::unordered_set<std::string> user_defined_vars;
-    for (const auto& v : assigned_vars)
-        if (!v.empty()) user_defined_vars.insert(v);
+    for (const auto& line : lines)
+        if (!line.defines.empty()) user_defined_vars.insert(line.defines);
 
-    // Step C: for each expression, is its output referenced by any OTHER expression?
+    // For each expression, is its output referenced by any OTHER expression?
     auto is_depended_upon = [&](size_t i) -> bool {
-        if (assigned_vars[i].empty()) return false;
-        for (size_t j = 0; j < parsed_expressions.size(); j++) {
-            if (i == j || !parsed_expressions[j]) continue;
-            if (parsed_expressions[j].value().identifier_dependencies.count(assigned_vars[i]))
+        if (lines[i].defines.empty()) return false;
+        for (size_t j = 0; j < lines.size(); j++) {
+            if (i == j || !lines[j].parsed) continue;
+            if (lines[j].reads.count(lines[i].defines))
                 return true;
         }
         return false;
     };
 
-    // Step D: is_display_leaf — has user deps (excl. self-assignment ref) and is not depended upon
+    // is_display_leaf — has user deps (excl. self-assignment ref) and is not depended upon
     auto is_display_leaf = [&](size_t i) -> bool {
-        if (!parsed_expressions[i]) return false;
-        const auto& deps = parsed_expressions[i].value().identifier_dependencies;
-        const auto& self_var = assigned_vars[i];
+        if (!lines[i].parsed) return false;
         bool has_user_dep = false;
-        for (const auto& dep : deps) {
-            if (dep == self_var) continue;  // skip self (LHS parsed as IDENTIFIER)
+        for (const auto& dep : lines[i].reads) {
+            if (dep == lines[i].defines) continue;  // skip self (LHS parsed as IDENTIFIER)
             if (user_defined_vars.count(dep)) { has_user_dep = true; break; }
         }
         if (!has_user_dep) return false;
         return !is_depended_upon(i);
     };
 
-    std::vector<MaybeEvaluated> evaluated(parsed_expressions.size(), EValue{UnitValue{0.0L}});
-    std::vector<std::uint32_t> evaluation_indices(parsed_expressions.size());
-    std::iota(evaluation_indices.begin(), evaluation_indices.end(), 0);
-    // TODO sort this by dependencies
-
-    for(const auto evaluation_index: evaluation_indices){
-        if(!parsed_expressions[evaluation_index]) {
-            evaluated[evaluation_index] = std::unexpected{parsed_expressions[evaluation_index].error()};
-            continue;
-        }
-        evaluated[evaluation_index] = parsed_expressions[evaluation_index].value().ast->evaluate(*this);
-        // Store last successful result as 'ans'
-        if(evaluated[evaluation_index]) {
-            evaluated_variables.insert_or_assign("ans", evaluated[evaluation_index].value());
-        }
-    }
-
     // Apply conversion units: divide result value by conversion factor when units match
     for (size_t i = 0; i < expression_list.size(); i++) {
         if (expression_list[i].conversion_unit_expr.empty()) continue;
@@ -148,7 +253,7 @@ std::vector<dv::Evaluator::MaybeEvaluated> dv::Evaluator::evaluate_expression_li
         auto conv = evaluate_expression(Expression{"1", expression_list[i].conversion_unit_expr});
         if (!conv) continue;
         const auto* conv_uv = std::get_if<UnitValue>(&*conv);
-        if (!conv_uv || conv_uv->value == 0.0L) continue;
+        if (!conv_uv || conv_uv->value == 0.0) continue;
         auto* result_uv = std::get_if<UnitValue>(&*evaluated[i]);
         if (!result_uv) continue;
         if (result_uv->unit != conv_uv->unit) continue;
@@ -168,61 +273,202 @@ std::vector<dv::Evaluator::MaybeEvaluated> dv::Evaluator::evaluate_expression_li
             for (auto& e : uvl->elements) e.sig_figs = 0;
     }
 
+    sheet = std::move(lines);
+    // Allow the table to double over what this sheet needs before compacting again
+    if(compacting) symbol_compaction_at = std::max<std::size_t>(symbol_compaction_at, 2 * symbols->size());
     return evaluated;
 }
 
+void dv::Evaluator::compact_symbols(){
+    parse_cache.clear();
+    sheet.clear();
+    compiled_formulas.clear();
+    std::vector<std::pair<std::string, EValue>> constants;
+    constants.reserve(fixed_constants.size());
+    fixed_constants.for_each([&](const std::string &name, const EValue &value) { constants.emplace_back(name, value); });
+    fixed_constants.clear();
+    evaluated_variables.clear();
+    symbols->clear();
+    for(auto &[name, value] : constants) fixed_constants.insert_or_assign(name, std::move(value));
+}
+
 void dv::Evaluator::insert_constant(const std::string name, const Expression &expression){
     auto parsed_expression = parse_expression(expression.value_expr);
     auto parsed_unit_expression = parse_expression(expression.unit_expr);
     if(!parsed_expression || !parsed_unit_expression) return;
-    auto value_result = parsed_expression.value().ast->evaluate(*this);
-    auto unit_result = parsed_unit_expression.value().ast->evaluate(*this);
+    auto value_result = execute(parsed_expression.value()->program, *this);
+    auto unit_result = execute(parsed_unit_expression.value()->program, *this);
     if(!value_result || !unit_result) return;
     const UnitValue* vr = std::get_if<UnitValue>(&*value_result);
     const UnitValue* ur = std::get_if<UnitValue>(&*unit_result);
     if(!vr || !ur) return;
     EValue value = UnitValue{vr->value, ur->unit};
     fixed_constants.insert_or_assign(name, std::move(value));
+    constants_generation++;
+}
+
+bool dv::Evaluator::erase_constant(const std::string &name){
+    if(fixed_constants.erase(name) == 0) return false;
+    constants_generation++;
+    return true;
+}
+
+void dv::Evaluator::clear_constants(){
+    fixed_constants.clear();
+    constants_generation++;
 }
 
-std::vector<Physics::Formula> dv::Evaluator::get_available_formulas(const dv::UnitVector &target) const noexcept {
-    std::vector<dv::UnitVector> available_units;
-    for(const auto &[key, value]: this->evaluated_variables) {
+std::expected<void, std::string> dv::Evaluator::add_unit(std::string_view symbol, Scalar factor, UnitVector unit, bool prefixable){
+    if(!custom_units) custom_units = UnitRegistry::builtin();
+    auto added = custom_units->add(symbol, factor, unit, prefixable);
+    if(!added) return added;
+    // Text that was an identifier or a shorter unit may now lex as the new unit
+    parse_cache.clear();
+    sheet.clear();
+    return added;
+}
+
+void dv::Evaluator::use_formula_pack(std::shared_ptr<const Physics::FormulaPack> pack){
+    formula_pack = std::move(pack);
+    searcher.use_database(formula_pack ? formula_pack->database() : formula_database);
+    // Cached results index into the previous database
+    last_formula_results.clear();
+    suggestion_cache = {};
+    compiled_formulas.clear();
+    formula_latexes.clear();
+    for(auto &line : sheet)
+        if(line.is_formula_query) line.stale = true;
+}
+
+std::vector<dv::UnitVector> dv::Evaluator::available_units() const {
+    std::vector<dv::UnitVector> units;
+    this->evaluated_variables.for_each([&](const std::string &, const EValue &value) {
         if(const auto* uv = std::get_if<UnitValue>(&value))
-            available_units.push_back(uv->unit);
-    }
-    return searcher.find_by_units(available_units, target);
+            units.push_back(uv->unit);
+    });
+    // The search only depends on the multiset of units, not which variable holds them
+    std::ranges::sort(units, {}, &dv::UnitVector::packed);
+    return units;
 }
 
-dv::MaybeASTDependencies dv::Evaluator::parse_expression(const Expression expression){
-    auto single_expr = expression.get_single_expression();
-    Lexer lexer{single_expr};
-    const auto &tokens = lexer.extract_all_tokens();
-    if(!tokens) {
-        return std::unexpected{tokens.error()}; 
+std::vector<Physics::FormulaMatch> dv::Evaluator::get_available_formulas(const dv::UnitVector &target) const noexcept {
+    auto units = available_units();
+    if(units != suggestion_cache.pool || formula_chain_options != suggestion_cache.options) {
+        suggestion_cache.pool = std::move(units);
+        suggestion_cache.options = formula_chain_options;
+        suggestion_cache.by_target.clear();
     }
-    Parser parser{tokens.value()};
-#ifdef EVAL_PRINT_AST
-    auto p = parser.parse();
-    std::println("{}", *p.value());
-    return p;
-#else
-    return parser.parse();
-#endif
+    auto [entry, inserted] = suggestion_cache.by_target.try_emplace(target.packed());
+    if(inserted) {
+        entry->second = searcher.find_by_units(suggestion_cache.pool, target, formula_chain_options);
+        formula_suggestion_stats.searches++;
+    } else {
+        formula_suggestion_stats.hits++;
+    }
+    return entry->second;
 }
 
-dv::MaybeASTDependencies dv::Evaluator::parse_expression(const std::string expression){
-    Lexer lexer{expression};
-    const auto &tokens = lexer.extract_all_tokens();
-    if(!tokens) {
-        return std::unexpected{tokens.error()}; 
+const dv::MaybeCompiledFormula& dv::Evaluator::compiled_formula(std::size_t index){
+    auto found = compiled_formulas.find(index);
+    if(found == compiled_formulas.end())
+        found = compiled_formulas.emplace(index, compile_formula(get_formula_database()[index], *symbols)).first;
+    return found->second;
+}
+
+const std::expected<std::string, std::string>& dv::Evaluator::formula_latex(std::size_t index){
+    auto found = formula_latexes.find(index);
+    if(found == formula_latexes.end())
+        found = formula_latexes.emplace(index, dv::formula_latex(get_formula_database()[index])).first;
+    return found->second;
+}
+
+dv::Evaluator::MaybeEvaluated dv::Evaluator::run_formula(std::size_t index, std::span<const std::pair<dv::UnitVector, EValue>> derived){
+    const auto &db = get_formula_database();
+    if(index >= db.size()) return std::unexpected{std::format("No formula {}", index)};
+    const auto &compiled = compiled_formula(index);
+    if(!compiled) return std::unexpected{compiled.error()};
+
+    // Sheet variables are bound first. The planner derives a unit whenever the pool
+    // holds fewer values of it than the formula needs, so a derived value only fills
+    // the inputs of its unit the sheet leaves open.
+    const auto variables = db[index].variables();
+    std::vector<const EValue*> bound(compiled->inputs.size(), nullptr);
+    std::vector<SymbolId> used;
+    for(std::size_t at = 0; at < bound.size(); at++) {
+        const auto &variable = variables[compiled->inputs[at]];
+        auto usable = [&](SymbolId id) {
+            const auto *value = std::get_if<UnitValue>(evaluated_variables.get(id));
+            return value && value->unit == variable.units && std::ranges::find(used, id) == used.end();
+        };
+        std::optional<SymbolId> pick;
+        if(const auto named = symbols->find(variable.name); named && usable(*named)) pick = named;
+        for(SymbolId id = 0; !pick && id < symbols->size(); id++)
+            if(usable(id)) pick = id;
+        if(!pick) continue;
+        used.push_back(*pick);
+        bound[at] = evaluated_variables.get(*pick);
+    }
+    std::vector<EValue> args;
+    args.reserve(bound.size());
+    for(std::size_t at = 0; at < bound.size(); at++) {
+        const auto &variable = variables[compiled->inputs[at]];
+        if(!bound[at]) {
+            const auto from_step = std::ranges::find(derived, variable.units, &std::pair<dv::UnitVector, EValue>::first);
+            if(from_step == derived.end())
+                return std::unexpected{std::format("'{}' needs a value for {} ({})", db[index].name(), variable.name, variable.description)};
+            bound[at] = &from_step->second;
+        }
+        args.push_back(*bound[at]);
     }
-    Parser parser{tokens.value()};
+    return call(compiled->function, args, *this);
+}
+
+dv::Evaluator::MaybeEvaluated dv::Evaluator::evaluate_formula(std::size_t index){
+    return run_formula(index, {});
+}
+
+dv::Evaluator::MaybeEvaluated dv::Evaluator::evaluate_derivation(std::span<const Physics::FormulaMatch> steps){
+    if(steps.empty()) return std::unexpected{"Empty derivation"};
+    const auto &db = get_formula_database();
+    // Steps are in pre-order: the children of steps[at] are the steps one level deeper
+    // that follow it before the depth returns to its own
+    auto run = [&](auto &&self, std::size_t at, std::size_t &next) -> MaybeEvaluated {
+        std::vector<std::pair<dv::UnitVector, EValue>> derived;
+        next = at + 1;
+        while(next < steps.size() && steps[next].depth > steps[at].depth) {
+            const std::size_t child = next;
+            auto value = self(self, child, next);
+            if(!value) return value;
+            const auto *output = db[steps[child].index].output();
+            if(!output) return std::unexpected{std::format("'{}' does not say what it derives", db[steps[child].index].name())};
+            derived.emplace_back(output->units, std::move(*value));
+        }
+        return run_formula(steps[at].index, derived);
+    };
+    std::size_t next = 0;
+    return run(run, 0, next);
+}
+
+dv::Evaluator::MaybeEvaluated dv::Evaluator::evaluate_formula_chain(const dv::UnitVector &target, std::size_t index){
+    for(const auto &plan : searcher.plan_derivations(available_units(), target, formula_chain_options))
+        if(plan.steps.front().index == index) return evaluate_derivation(plan.steps);
+    return std::unexpected{std::format("No derivation of this unit ends in formula {}", index)};
+}
+
+dv::MaybeSharedCompiledExpression dv::Evaluator::parse_expression(const Expression expression){
+    return parse_expression(expression.get_single_expression());
+}
+
+dv::MaybeSharedCompiledExpression dv::Evaluator::parse_expression(const std::string expression){
+    if(const auto *cached = parse_cache.find(expression)) return *cached;
+    auto session = std::make_shared<ParseSession>();
+    auto parsed = session->parse(expression, get_units());
+    if(!parsed) return parse_cache.insert(expression, std::unexpected{parsed.error()});
 #ifdef EVAL_PRINT_AST
-    auto p = parser.parse();
-    std::println("{}", *p.value());
-    return p;
-#else
-    return parser.parse();
+    std::println("{}", *parsed.value().ast);
 #endif
-}
\ No newline at end of file
+    parsed->session = std::move(session);
+    auto compiled = std::make_shared<CompiledExpression>(CompiledExpression{std::move(parsed.value()), {}});
+    compiled->program = compile(*compiled->ast, *symbols);
+    return parse_cache.insert(expression, std::move(compiled));
+}
@@ -2,10 +2,20 @@
 
 #include "dimeval.hpp"
 #include "formula_finder.hpp"
+#include "formula_program.hpp"
+#include "formulas/formula_pack.hpp"
+#include "parse_cache.hpp"
+#include "symbol_table.hpp"
+#include "unit_registry.hpp"
+#include <cstdint>
 #include <map>
 #include <expected>
+#include <memory>
+#include <optional>
 #include <span>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace dv {
@@ -27,24 +37,122 @@ namespace dv {
         public:
         using MaybeEvaluated = std::expected<EValue, std::string>;
 
+        // How much of the last evaluate_expression_list call was actually recomputed
+        struct EvaluationStats {
+            std::size_t lines_evaluated = 0;
+            std::size_t lines_reused = 0;
+        };
+
+        // How often get_available_formulas answered from its cache
+        struct FormulaSuggestionStats {
+            std::size_t hits = 0;
+            std::size_t searches = 0;
+        };
+
         Evaluator();
         ~Evaluator();
 
         MaybeEvaluated evaluate_expression(const Expression &expression);
+        // Evaluates the lines in dependency order. Parsed lines and their results are kept
+        // between calls, so only edited lines and the lines downstream of them are re-evaluated.
         std::vector<MaybeEvaluated> evaluate_expression_list(const std::span<const Expression> expression_list);
         void insert_constant(const std::string name, const Expression &expression);
-        std::vector<Physics::Formula> get_available_formulas(const dv::UnitVector &target) const noexcept;
+        bool erase_constant(const std::string &name);
+        void clear_constants();
+        // Formulas for `target` from the units of the evaluated variables. Results are cached
+        // per target until the multiset of available units, the chain options or the database change.
+        std::vector<Physics::FormulaMatch> get_available_formulas(const dv::UnitVector &target) const noexcept;
+        const Physics::FormulaDatabase& get_formula_database() const noexcept { return searcher.database(); }
+        // Formula families matching free text such as "coulomb force charge", best first
+        std::vector<Physics::TextMatch> search_formulas(std::string_view query, std::size_t limit = 20) const {
+            return get_formula_database().search_text(query, limit);
+        }
+        // Runs formula `index` of get_formula_database() on the sheet's variables. Each input
+        // takes a variable of its own name and unit if there is one, otherwise the next unused
+        // variable of its unit. The formula is compiled on first use and kept.
+        MaybeEvaluated evaluate_formula(std::size_t index);
+        // Runs a derivation (DerivationPlan::steps order): every step's missing inputs come
+        // from the steps below it, the rest from the sheet, and steps[0] gives the result
+        MaybeEvaluated evaluate_derivation(std::span<const Physics::FormulaMatch> steps);
+        // Plans `target` from the sheet's units with formula_chain_options and runs the
+        // cheapest plan answered by formula `index`
+        MaybeEvaluated evaluate_formula_chain(const dv::UnitVector &target, std::size_t index);
+        // LaTeX of formula `index`; a derived rearrangement is solved on first use and kept
+        const std::expected<std::string, std::string>& formula_latex(std::size_t index);
+        // Searches `pack` instead of the built-in formulas; null switches back
+        void use_formula_pack(std::shared_ptr<const Physics::FormulaPack> pack);
+        // Registers a unit for this evaluator's sheets, such as add_unit("psi", 6894.757, DIM_PASCAL),
+        // and with `prefixable` its SI prefixed forms too. Lines are parsed again afterwards.
+        std::expected<void, std::string> add_unit(std::string_view symbol, Scalar factor, UnitVector unit, bool prefixable = false);
+        const UnitRegistry& get_units() const noexcept { return custom_units ? *custom_units : UnitRegistry::builtin(); }
+        const ParseCache& get_parse_cache() const noexcept { return parse_cache; }
+        SymbolTable& get_symbols() noexcept { return *symbols; }
 
         bool use_sig_figs = false;
+        ChainOptions formula_chain_options;
+        EvaluationStats last_evaluation_stats;
+        mutable FormulaSuggestionStats formula_suggestion_stats;
 
-        std::unordered_map<std::string, EValue> fixed_constants;
-        std::map<std::string, EValue> evaluated_variables;
-        std::vector<Physics::Formula> last_formula_results;
+    private:
+        // Declared ahead of the stores that index by it
+        std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    public:
+        VariableStore fixed_constants{symbols};
+        VariableStore evaluated_variables{symbols};
+        std::vector<Physics::FormulaMatch> last_formula_results; // index into get_formula_database()
         std::unordered_map<std::string, dv::Function> custom_functions;
         std::map<std::string, std::string> variable_source_expressions;
     private:
+        // One line of the sheet as it was last evaluated
+        struct SheetLine {
+            std::string source;                                 // get_single_expression() text
+            std::uint64_t id = 0;                               // stable identity across calls
+            SharedCompiledExpression parsed;                    // null when parsing failed
+            std::string parse_error;
+            std::string defines;                                // assigned variable/function name
+            std::unordered_set<std::string> reads;              // dependencies minus function parameters
+            bool is_function_definition = false;
+            bool is_formula_query = false;
+            bool stale = true;                                  // result is not up to date
+            std::vector<std::uint64_t> inputs;                  // ids of the lines read last time
+            MaybeEvaluated result = EValue{UnitValue{0.0}};
+            std::optional<dv::Function> defined_function;
+            std::vector<Physics::FormulaMatch> formula_results;
+        };
+        std::vector<SheetLine> sheet;
+        std::uint64_t next_line_id = 0;
+        std::uint64_t constants_generation = 0;
+        std::uint64_t sheet_constants_generation = 0;
+
+        SheetLine parse_sheet_line(std::string source);
+        void restore_line_bindings(const SheetLine &line);
+        // Interning never forgets a name, so bound locals and names no line uses any more
+        // pile up. Once the table reaches symbol_compaction_at, evaluate_expression_list
+        // drops everything compiled against it and starts a fresh table holding only the
+        // constants; the sheet is parsed again on that call.
+        void compact_symbols();
+        std::size_t symbol_compaction_at = 4096;
+
         FormulaSearcher searcher;
-        MaybeASTDependencies parse_expression(const Expression expression);
-        MaybeASTDependencies parse_expression(const std::string expression);
+        std::shared_ptr<const Physics::FormulaPack> formula_pack;
+        std::optional<UnitRegistry> custom_units;   // copy of the built-in units once one is added
+        // Search results for one pool of available units, sorted so it is a canonical multiset
+        struct FormulaSuggestionCache {
+            std::vector<dv::UnitVector> pool;
+            ChainOptions options;
+            std::unordered_map<std::uint64_t, std::vector<Physics::FormulaMatch>> by_target;   // by packed unit
+        };
+        mutable FormulaSuggestionCache suggestion_cache;
+        std::unordered_map<std::size_t, MaybeCompiledFormula> compiled_formulas;   // by database index
+        std::unordered_map<std::size_t, std::expected<std::string, std::string>> formula_latexes;   // by database index
+
+        // Units of the evaluated variables as a sorted multiset
+        std::vector<dv::UnitVector> available_units() const;
+        const MaybeCompiledFormula& compiled_formula(std::size_t index);
+        // Runs formula `index` on sheet values, with derived values for the inputs they leave open
+        MaybeEvaluated run_formula(std::size_t index, std::span<const std::pair<dv::UnitVector, EValue>> derived);
+        ParseCache parse_cache;
+        MaybeSharedCompiledExpression parse_expression(const Expression expression);
+        MaybeSharedCompiledExpression parse_expression(const std::string expression);
     };
 }
\ No newline at end of file
@@ -1,300 +1,240 @@
 #include "dimeval.hpp"
 #include "formulas/physics_formulas.hpp"
+#include "parallel.hpp"
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
-const auto formula_database = Physics::FormulaDatabase{};
+inline const Physics::FormulaDatabase formula_database{};
+
+// Limits and costs for chaining formulas: a formula whose inputs are not all
+// available can still be used if each missing input unit is itself derived
+struct ChainOptions {
+    int    max_depth         = 2;    // levels of derived inputs below the answering formula (<= 255)
+    int    max_missing_types = 3;    // input units one formula may leave to be derived
+    double formula_cost      = 1.0;  // every formula in a plan
+    double depth_cost        = 0.5;  // extra per level below the answer, so shallower chains win ties
+    unsigned threads         = 1;    // native builds: split large searches over threads, 0 = all cores
+
+    bool operator==(const ChainOptions&) const = default;
+};
+
+// One way to compute the target: steps[0] answers the query (depth 0) and every
+// step is followed by the steps deriving its missing inputs, one level deeper
+struct DerivationPlan {
+    std::vector<Physics::FormulaMatch> steps;
+    double cost;
+    double score;   // how well the formulas use the available units, higher is better
+};
 
 class FormulaSearcher {
 private:
-    const Physics::FormulaDatabase& db;
+    const Physics::FormulaDatabase* source;
 public:
-    FormulaSearcher() : db(formula_database) {}
-    FormulaSearcher(const Physics::FormulaDatabase& database) : db(database) {}
-    
-    // Search by unit signature (find what you can calculate)
-    // Returns exact matches first, then close matches (missing 1 unit) at the end.
-    // Deduplicates by formula name.
-std::vector<Physics::Formula> find_by_units(
+    FormulaSearcher() : source(&formula_database) {}
+    FormulaSearcher(const Physics::FormulaDatabase& database) : source(&database) {}
+    const Physics::FormulaDatabase& database() const noexcept { return *source; }
+    // The database must outlive the searcher (or the next call to this)
+    void use_database(const Physics::FormulaDatabase& database) noexcept { source = &database; }
+
+    // Every plan producing targetUnit from available_units within options, cheapest
+    // first (ties: higher score, then database order). One plan per answering formula.
+std::vector<DerivationPlan> plan_derivations(
     const std::vector<dv::UnitVector>& available_units,
-    const dv::UnitVector& targetUnit
+    const dv::UnitVector& targetUnit,
+    const ChainOptions& options = {}
 ) const {
 
-    const std::vector<Physics::Formula> all_formulas = db.get_formulas();
-    const int N = static_cast<int>(all_formulas.size());
+    const Physics::FormulaDatabase& db = *source;
 
     // -------------------------------------------------------------------------
-    // POOL HELPERS — everything is dv::UnitVec internally
+    // POOL MATCHING — every formula's inputs against the pool in one pass
     // -------------------------------------------------------------------------
 
-    std::vector<dv::UnitVec> available_pool;
-    for (const auto& u : available_units)
-        available_pool.push_back(u.vec);
-
-    auto count_in_pool = [](
-        const dv::UnitVec& needle,
-        const std::vector<dv::UnitVec>& pool
-    ) -> int {
-        int n = 0;
-        for (const auto& u : pool) if (u == needle) n++;
-        return n;
-    };
+    const std::vector<dv::UnitVector>& available_pool = available_units;
+    const Physics::PoolCoverage coverage = db.match_pool(available_pool, options.threads);
 
     // -------------------------------------------------------------------------
     // FORMULA HELPERS
     // -------------------------------------------------------------------------
 
-    // Output unit of formula[idx], or nullopt if solve_for var not found
-    auto output_of = [&](int idx) -> std::optional<dv::UnitVec> {
-        for (const auto& v : all_formulas[idx].variables)
-            if (v.name == all_formulas[idx].solve_for)
-                return v.units.vec;
-        return std::nullopt;
-    };
-
-    // Build a {unit → required_count} map for all non-constant non-output inputs
-    auto required_counts = [&](int idx)
-        -> std::vector<std::pair<dv::UnitVec, int>>
-    {
-        const auto& f = all_formulas[idx];
-        std::vector<std::pair<dv::UnitVec, int>> req;
-        for (const auto& v : f.variables) {
-            if (v.is_constant)         continue;
-            if (v.name == f.solve_for) continue;
-            bool found = false;
-            for (auto& [u, c] : req) {
-                if (u == v.units.vec) { c++; found = true; break; }
-            }
-            if (!found) req.push_back({ v.units.vec, 1 });
-        }
-        return req;
-    };
-
-    // Is formula[idx] fully satisfied by pool (respecting multiplicity)?
-    auto satisfied_by = [&](int idx, const std::vector<dv::UnitVec>& pool) -> bool {
-        for (const auto& [unit, req] : required_counts(idx))
-            if (count_in_pool(unit, pool) < req) return false;
+    // Unit types formula[idx] is missing from the pool, one bit per input slot (one
+    // derivation supplies every extra instance of a type, so each type counts once)
+    auto missing_count = [&](std::uint32_t idx) { return std::popcount(coverage.missing[idx]); };
+    auto for_each_missing = [&](std::uint32_t idx, auto&& fn) {
+        for (unsigned bits = coverage.missing[idx]; bits; bits &= bits - 1)
+            if (!fn(db.input_unit(idx, std::countr_zero(bits)))) return false;
         return true;
     };
 
-    // Unique unit types that formula[idx] is missing from pool (one entry per type,
-    // regardless of how many extra instances are needed)
-    auto missing_types = [&](int idx, const std::vector<dv::UnitVec>& pool)
-        -> std::vector<dv::UnitVec>
-    {
-        std::vector<dv::UnitVec> missing;
-        for (const auto& [unit, req] : required_counts(idx))
-            if (count_in_pool(unit, pool) < req)
-                missing.push_back(unit);
-        return missing;
-    };
-
-    // Score formula[idx] against pool — higher is better
-    auto score_of = [&](int idx, const std::vector<dv::UnitVec>& pool) -> double {
-        int matched = 0, total = 0;
-        for (const auto& [unit, req] : required_counts(idx)) {
-            total += req;
-            matched += std::min(count_in_pool(unit, pool), req);
-        }
-        const double coverage    = total > 0 ? (double)matched / total : 1.0;
-        const double utilization = !available_pool.empty()
-                                     ? (double)matched / available_pool.size() : 1.0;
-        const double simplicity  = 1.0 / (total + 1);
-        return coverage * 100.0 + utilization * 10.0 + simplicity;
+    // Score formula[idx] against the pool — higher is better
+    auto score_of = [&](std::uint32_t idx) -> double {
+        const int matched = coverage.matched[idx], total = db.input_total(idx);
+        const double input_coverage = total > 0 ? (double)matched / total : 1.0;
+        const double utilization    = !available_pool.empty()
+                                        ? (double)matched / available_pool.size() : 1.0;
+        const double simplicity     = 1.0 / (total + 1);
+        return input_coverage * 100.0 + utilization * 10.0 + simplicity;
     };
 
-    // Build a pool augmented with enough copies of `unit` to satisfy formula[idx]
-    auto augment_for = [&](
-        int idx,
-        const dv::UnitVec& unit,
-        const std::vector<dv::UnitVec>& pool
-    ) -> std::vector<dv::UnitVec> {
-        auto aug = pool;
-        for (const auto& [u, req] : required_counts(idx)) {
-            if (u != unit) continue;
-            int have = count_in_pool(u, pool);
-            for (int k = have; k < req; ++k)
-                aug.push_back(unit);
-        }
-        return aug;
-    };
+    // The memo key holds the level in one byte
+    const int max_depth = std::clamp(options.max_depth, 0, 255);
+    auto step_cost = [&](int level) { return options.formula_cost + options.depth_cost * level; };
 
     // -------------------------------------------------------------------------
-    // CAN_RESOLVE
+    // RESOLVE AND COLLECT — one plan per formula producing targetUnit whose
+    // missing inputs all resolve
     //
-    // Can we produce `target` unit from `available_pool` using at most:
-    //   - 1 sub formula (exact from available_pool), OR
-    //   - 1 sub formula + 1 subsub formula (subsub exact from available_pool,
-    //     sub exact from available_pool + subsub output)
+    // resolve(unit, level) is the cheapest way to produce `unit` with a formula at
+    // `level` (1 = an input of the answer) whose own missing inputs are resolved at
+    // level + 1, down to max_depth. The pool is fixed for the whole search, so the
+    // answer depends only on (unit, level) and is memoized; every unit is expanded
+    // at most once per level however many candidates need it.
     //
-    // Returns {sub_idx, subsub_idx} — subsub_idx == -1 if no subsub needed.
-    // Returns {-1, -1} if not resolvable.
-    // Picks the highest-scored valid pair.
+    // Producers are tried best-first by an optimistic bound (their own step plus
+    // the cheapest possible step for each missing input) and the scan stops once
+    // the bound exceeds the best complete plan found.
+    //
+    // Because a resolution depends only on (unit, level), large candidate lists
+    // are split into contiguous chunks that each keep their own memo; the plans
+    // are the same for any number of threads.
     // -------------------------------------------------------------------------
 
-    auto can_resolve = [&](const dv::UnitVec& target)
-        -> std::pair<int, int>
-    {
-        int    best_sub    = -1;
-        int    best_subsub = -1;
-        double best_score  = -1e9;
-
-        for (int i = 0; i < N; ++i) {
-            auto out = output_of(i);
-            if (!out || out.value() != target) continue;
-
-            auto mt = missing_types(i, available_pool);
-
-            if (mt.empty()) {
-                // Exact sub — no subsub needed
-                double s = score_of(i, available_pool);
-                if (s > best_score) {
-                    best_score  = s;
-                    best_sub    = i;
-                    best_subsub = -1;
-                }
-                continue;
+    auto collect = [&](std::span<const std::uint32_t> candidates, std::vector<DerivationPlan>& plans) {
+        struct Resolution {
+            std::uint32_t idx;
+            double cost;
+            double score;
+        };
+        std::unordered_map<std::uint64_t, std::optional<Resolution>> memo;
+        // The packed unit leaves the top byte free for the level
+        auto memo_key = [](const dv::UnitVector& unit, int level) {
+            return unit.packed() | (static_cast<std::uint64_t>(level) << 56);
+        };
+
+        auto resolve = [&](auto&& self, const dv::UnitVector& unit, int level) -> const std::optional<Resolution>& {
+            const auto key = memo_key(unit, level);
+            if (const auto found = memo.find(key); found != memo.end()) return found->second;
+
+            struct Option { std::uint32_t idx; double bound; };
+            std::vector<Option> producers;
+            for (const std::uint32_t i : db.producing(unit)) {
+                const int missing = missing_count(i);
+                if (missing > 0 && level >= max_depth) continue;
+                if (missing > options.max_missing_types) continue;
+                producers.push_back({ i, step_cost(level) + missing * step_cost(level + 1) });
             }
-
-            if (mt.size() == 1) {
-                // Sub needs one more unit — look for a subsub that produces it
-                // exactly from available_pool
-                const dv::UnitVec& sub_missing = mt[0];
-
-                for (int j = 0; j < N; ++j) {
-                    auto out2 = output_of(j);
-                    if (!out2 || out2.value() != sub_missing) continue;
-
-                    // Subsub must be fully satisfied by available_pool
-                    if (!satisfied_by(j, available_pool)) continue;
-
-                    // Now verify the sub is fully satisfied by
-                    // available_pool + enough copies of sub_missing
-                    auto aug = augment_for(i, sub_missing, available_pool);
-                    if (!satisfied_by(i, aug)) continue;
-
-                    double s = score_of(i, available_pool) + score_of(j, available_pool);
-                    if (s > best_score) {
-                        best_score  = s;
-                        best_sub    = i;
-                        best_subsub = j;
-                    }
-                }
-                continue;
+            std::stable_sort(producers.begin(), producers.end(),
+                [](const Option& a, const Option& b) { return a.bound < b.bound; });
+
+            std::optional<Resolution> best;
+            for (const auto& p : producers) {
+                if (best && p.bound > best->cost) break;
+                double cost = step_cost(level), score = score_of(p.idx);
+                const bool ok = for_each_missing(p.idx, [&](const dv::UnitVector& mu) {
+                    const auto& sub = self(self, mu, level + 1);
+                    if (!sub) return false;
+                    cost += sub->cost;
+                    score += sub->score;
+                    return true;
+                });
+                if (!ok) continue;
+                if (!best || cost < best->cost || (cost == best->cost && score > best->score))
+                    best = Resolution{ p.idx, cost, score };
             }
-
-            // mt.size() > 1 — too deep, skip
+            return memo.emplace(key, std::move(best)).first->second;
+        };
+
+        // Pre-order steps of the resolution of `unit` at `level`
+        auto append_steps = [&](auto&& self, std::vector<Physics::FormulaMatch>& steps,
+                                const dv::UnitVector& unit, int level) -> void {
+            const auto& r = *memo.at(memo_key(unit, level));
+            steps.push_back({ r.idx, level });
+            for_each_missing(r.idx, [&](const dv::UnitVector& mu) {
+                self(self, steps, mu, level + 1);
+                return true;
+            });
+        };
+
+        for (const std::uint32_t i : candidates) {
+            const int missing = missing_count(i);
+            if (missing > options.max_missing_types) continue;
+            if (missing > 0 && max_depth < 1) continue;
+
+            DerivationPlan plan{ { { i, 0 } }, step_cost(0), score_of(i) };
+            const bool ok = for_each_missing(i, [&](const dv::UnitVector& mu) {
+                const auto& sub = resolve(resolve, mu, 1);
+                if (!sub) return false;
+                plan.cost += sub->cost;
+                return true;
+            });
+            if (!ok) continue;
+            for_each_missing(i, [&](const dv::UnitVector& mu) {
+                append_steps(append_steps, plan.steps, mu, 1);
+                return true;
+            });
+            plans.push_back(std::move(plan));
         }
-
-        return { best_sub, best_subsub };
-    };
-
-    // -------------------------------------------------------------------------
-    // STEP 1 — COLLECT MAIN CANDIDATES
-    //
-    // A formula is a candidate if:
-    //   - it produces targetUnit
-    //   - it has at most 3 unique missing unit types from available_pool
-    //   - every missing type can be resolved by can_resolve
-    // -------------------------------------------------------------------------
-
-    struct SubSub { int idx; };
-    struct Sub    { int idx; std::vector<SubSub> subsubs; }; // 0 or 1
-    struct Candidate {
-        int              idx;
-        double           score;
-        std::vector<Sub> subs;  // 0–3
     };
 
-    std::vector<Candidate> candidates;
-
-    for (int i = 0; i < N; ++i) {
-        auto out = output_of(i);
-        if (!out || out.value() != targetUnit.vec) continue;
-
-        auto mt = missing_types(i, available_pool);
-
-        // Hard limit: at most 3 unique missing unit types
-        if (mt.size() > 3) continue;
-
-        std::vector<Sub> subs;
-        bool ok = true;
-
-        for (const auto& mu : mt) {
-            auto [sub_idx, subsub_idx] = can_resolve(mu);
-            if (sub_idx == -1) { ok = false; break; }
-
-            Sub sub{ sub_idx, {} };
-            if (subsub_idx != -1)
-                sub.subsubs.push_back({ subsub_idx });
-            subs.push_back(std::move(sub));
-        }
-
-        if (!ok) continue;
-
-        double score = score_of(i, available_pool)
-                     - static_cast<double>(subs.size()) * 5.0;
-
-        candidates.push_back({ i, score, std::move(subs) });
-    }
+    const std::span<const std::uint32_t> candidates = db.producing(targetUnit);
+    constexpr std::size_t GRAIN = 256;   // answering formulas per thread worth starting it for
+    std::vector<std::vector<DerivationPlan>> chunk_plans(
+        dv::parallel_thread_count(options.threads, candidates.size(), GRAIN));
+    dv::parallel_chunks(candidates.size(), chunk_plans.size(),
+        [&](unsigned chunk, std::size_t begin, std::size_t end) {
+            collect(candidates.subspan(begin, end - begin), chunk_plans[chunk]);
+        });
 
-    // -------------------------------------------------------------------------
-    // STEP 2 — SORT: fewest subs first, then score descending
-    // -------------------------------------------------------------------------
+    std::vector<DerivationPlan> plans = std::move(chunk_plans.front());
+    for (std::size_t chunk = 1; chunk < chunk_plans.size(); ++chunk)
+        std::ranges::move(chunk_plans[chunk], std::back_inserter(plans));
 
-    std::sort(candidates.begin(), candidates.end(),
-        [](const Candidate& a, const Candidate& b) {
-            if (a.subs.size() != b.subs.size())
-                return a.subs.size() < b.subs.size();
+    std::stable_sort(plans.begin(), plans.end(),
+        [](const DerivationPlan& a, const DerivationPlan& b) {
+            if (a.cost != b.cost) return a.cost < b.cost;
             return a.score > b.score;
         });
+    return plans;
+}
 
-    // -------------------------------------------------------------------------
-    // STEP 3 — FLATTEN
-    //
-    // [main]
-    //   [sub,    category="---"   ]
-    //     [subsub, category="------"]
-    //   [sub,    category="---"   ]
-    //     ...
-    //
-    // Global dedup: each formula name appears at most once.
-    // -------------------------------------------------------------------------
-
-    std::vector<Physics::Formula> result;
-    std::vector<std::string>      emitted;
-
-    auto is_emitted = [&](const std::string& name) {
-        return std::find(emitted.begin(), emitted.end(), name) != emitted.end();
-    };
-
-    for (const auto& cand : candidates) {
-        const auto& f = all_formulas[cand.idx];
-        if (is_emitted(f.name)) continue;
-        emitted.push_back(f.name);
-        result.push_back(f);
-
-        for (const auto& sub : cand.subs) {
-            const auto& sf = all_formulas[sub.idx];
-            if (is_emitted(sf.name)) continue;
-            emitted.push_back(sf.name);
-            Physics::Formula tagged = sf;
-            tagged.category = "---";
-            result.push_back(std::move(tagged));
-
-            for (const auto& ss : sub.subsubs) {
-                const auto& ssf = all_formulas[ss.idx];
-                if (is_emitted(ssf.name)) continue;
-                emitted.push_back(ssf.name);
-                Physics::Formula tagged2 = ssf;
-                tagged2.category = "------";
-                result.push_back(std::move(tagged2));
+    // Search by unit signature (find what you can calculate)
+    // Returns directly computable formulas first, then ones needing derived inputs,
+    // each followed by the formulas deriving them. Deduplicates by formula name;
+    // a formula already listed is not expanded again. Results index into database().
+std::vector<Physics::FormulaMatch> find_by_units(
+    const std::vector<dv::UnitVector>& available_units,
+    const dv::UnitVector& targetUnit,
+    const ChainOptions& options = {}
+) const {
+    const std::span<const Physics::Formula> all_formulas = source->get_formulas();
+
+    std::vector<Physics::FormulaMatch> result;
+    std::vector<std::string_view>      emitted;
+
+    for (const auto& plan : plan_derivations(available_units, targetUnit, options)) {
+        // Depth of the shallowest step skipped as a duplicate; its inputs are skipped too
+        int skip_below = std::numeric_limits<int>::max();
+        for (const auto& step : plan.steps) {
+            if (step.depth > skip_below) continue;
+            skip_below = std::numeric_limits<int>::max();
+            const std::string_view name = all_formulas[step.index].name();
+            if (std::find(emitted.begin(), emitted.end(), name) != emitted.end()) {
+                skip_below = step.depth;
+                continue;
             }
+            emitted.push_back(name);
+            result.push_back(step);
         }
     }
-
     return result;
 }
-};
\ No newline at end of file
+};
@@ -0,0 +1,181 @@
+#include "formula_program.hpp"
+#include "bytecode.hpp"
+#include "parse_session.hpp"
+#include "parser.hpp"
+#include "rearrange.hpp"
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace {
+    bool is_alpha(char c) noexcept { return std::isalpha(static_cast<unsigned char>(c)) != 0; }
+    bool is_digit(char c) noexcept { return std::isdigit(static_cast<unsigned char>(c)) != 0; }
+    bool is_alnum(char c) noexcept { return std::isalnum(static_cast<unsigned char>(c)) != 0; }
+
+    // Stands in for the variable a derived formula solves for
+    constexpr std::string_view target_param = "p_{t}";
+
+    // A variable to replace: every spelling of its name and the parameter it becomes
+    struct Rename {
+        std::vector<std::string> spellings;
+        std::string param;
+    };
+
+    // The name as written plus its other subscript form, so E_max also matches E_{max}
+    // and v_{0} also matches v_0
+    std::vector<std::string> spellings_of(std::string_view name) {
+        std::vector<std::string> spellings{std::string{name}};
+        const auto sub = name.find('_');
+        if(sub == std::string_view::npos || sub + 1 == name.size()) return spellings;
+        const auto head = name.substr(0, sub + 1), tail = name.substr(sub + 1);
+        if(tail.front() != '{') spellings.push_back(std::format("{}{{{}}}", head, tail));
+        else if(tail.size() == 3 && tail.back() == '}') spellings.push_back(std::format("{}{}", head, tail[1]));
+        return spellings;
+    }
+
+    // Whether `name` occurs at `at` in `text` as a whole variable. Letters that follow
+    // are a separate factor to the lexer (ma is m a), but a subscript, digit or longer
+    // command is not: m does not match m_1 or m2, nor \mu match \mus.
+    bool name_at(std::string_view text, std::size_t at, std::string_view name) noexcept {
+        if(!text.substr(at).starts_with(name)) return false;
+        const std::size_t end = at + name.size();
+        if(end == text.size()) return true;
+        const char next = text[end];
+        if(next == '_') return false;
+        if(is_digit(next)) return !is_alnum(name.back());
+        const bool command = name.front() == '\\' && std::ranges::all_of(name.substr(1), is_alpha);
+        return !(command && is_alpha(next));
+    }
+
+    // Replaces the variables in `text` by their parameters, trying longer names first
+    // so m_1 is replaced before m. A bracket after a variable multiplies it, so a(x - x_0)
+    // does not become a call. Commands and subscripts are copied whole so their letters
+    // are never taken for variables.
+    std::string substitute(std::string_view text, std::span<const Rename> renames) {
+        std::vector<std::pair<std::string_view, std::string_view>> by_length;
+        for(const auto &rename : renames)
+            for(const auto &spelling : rename.spellings) by_length.emplace_back(spelling, rename.param);
+        std::ranges::stable_sort(by_length, std::ranges::greater{}, [](const auto &entry) { return entry.first.size(); });
+
+        std::string source;
+        for(std::size_t at = 0; at < text.size();) {
+            const auto found = std::ranges::find_if(by_length, [&](const auto &entry) { return name_at(text, at, entry.first); });
+            if(found != by_length.end()) {
+                at += found->first.size();
+                const auto next = text.find_first_not_of(' ', at);
+                source += std::format(" {} ", found->second);
+                if(next < text.size() && (text[next] == '(' || text.substr(next).starts_with("\\left("))) source += "\\cdot ";
+                continue;
+            }
+            std::size_t end = at + 1;
+            if(text[at] == '\\')
+                end = std::max<std::size_t>(std::find_if_not(text.begin() + at + 1, text.end(), is_alpha) - text.begin(), at + 2);
+            else if(text[at] == '_' && at + 1 < text.size())
+                end = text[at + 1] == '{' ? std::min(text.find('}', at), text.size() - 1) + 1 : at + 2;
+            // \left( and \right) only size their bracket
+            const auto piece = text.substr(at, end - at);
+            if(piece != "\\left" && piece != "\\right") source.append(piece);
+            at = end;
+        }
+        return source;
+    }
+
+    dv::MaybeAST parse_side(dv::ParseSession &session, std::string_view text, std::span<const Rename> renames) {
+        while(!text.empty() && text.front() == ' ') text.remove_prefix(1);
+        if(text.starts_with("\\pm")) text.remove_prefix(3);
+        auto parsed = session.parse(substitute(text, renames));
+        if(!parsed) return std::unexpected{parsed.error()};
+        return std::move(parsed->ast);
+    }
+}
+
+dv::MaybeFormulaExpression dv::formula_expression(const Physics::Formula &formula) {
+    const std::string_view latex = formula.derived() ? formula.family->equation : formula.latex;
+    const auto equals = latex.find('=');
+    if(equals == std::string_view::npos)
+        return std::unexpected{std::format("Formula '{}' is not an equation", formula.name())};
+    if(formula.derived() && !formula.output())
+        return std::unexpected{std::format("Formula '{}' has no variable to solve for", formula.name())};
+
+    // Inputs become parameters p_{0}, p_{1}, ... in family order
+    const auto variables = formula.variables();
+    FormulaExpression expression;
+    expression.session = std::make_shared<ParseSession>();
+    std::vector<Rename> renames;
+    for(std::size_t i = 0; i < variables.size(); i++) {
+        if(i == formula.solve_for) {
+            if(formula.derived()) renames.push_back({spellings_of(variables[i].name), std::string{target_param}});
+            continue;
+        }
+        if(variables[i].is_constant) continue;
+        expression.inputs.push_back(static_cast<std::uint8_t>(i));
+        expression.params.push_back(std::format("p_{{{}}}", expression.params.size()));
+        renames.push_back({spellings_of(variables[i].name), expression.params.back()});
+    }
+
+    if(!formula.derived()) {
+        auto rhs = parse_side(*expression.session, latex.substr(equals + 1), renames);
+        if(!rhs) return std::unexpected{std::format("Cannot compile '{}': {}", formula.name(), rhs.error())};
+        expression.ast = std::move(*rhs);
+        return expression;
+    }
+    // Solve the family's equation for the target. A chain a = b = c is solved from the
+    // first part holding the target and the first part without it; parts that do not
+    // parse (\int \vec{B} \cdot d\vec{A}) are passed over.
+    std::vector<MaybeAST> parts;
+    for(std::size_t from = 0; from <= latex.size();) {
+        const auto to = std::min(latex.find('=', from), latex.size());
+        parts.push_back(parse_side(*expression.session, latex.substr(from, to - from), renames));
+        from = to + 1;
+    }
+    const AST *side = nullptr, *other = nullptr;
+    for(const auto &part : parts) {
+        if(!part) continue;
+        const bool has_target = count_identifier(**part, target_param) > 0;
+        if(has_target && !side) side = part->get();
+        else if(!has_target && !other) other = part->get();
+    }
+    if(!side || !other) {
+        const auto failed = std::ranges::find_if(parts, [](const MaybeAST &part) { return !part.has_value(); });
+        if(failed != parts.end()) return std::unexpected{std::format("Cannot compile '{}': {}", formula.name(), failed->error())};
+    }
+    auto isolated = side && other ? isolate(*side, *other, target_param) : isolate(*parts[0].value(), *parts[1].value(), target_param);
+    if(!isolated) return std::unexpected{std::format("Cannot solve '{}' for {}: {}", formula.name(), formula.output()->name, isolated.error())};
+    expression.ast = std::move(*isolated);
+    return expression;
+}
+
+dv::MaybeCompiledFormula dv::compile_formula(const Physics::Formula &formula, SymbolTable &symbols) {
+    auto expression = formula_expression(formula);
+    if(!expression) return std::unexpected{expression.error()};
+    CompiledFormula compiled;
+    compiled.inputs = std::move(expression->inputs);
+    compiled.function = make_function(std::string{formula.name()}, std::move(expression->params), *expression->ast, symbols);
+    return compiled;
+}
+
+std::expected<std::string, std::string> dv::formula_latex(const Physics::Formula &formula) {
+    if(!formula.derived()) return std::string{formula.latex};
+    if(!formula.output()) return std::unexpected{std::format("Formula '{}' has no variable to solve for", formula.name())};
+    const auto expression = formula_expression(formula);
+    if(!expression) return std::unexpected{expression.error()};
+
+    const auto variables = formula.variables();
+    const auto printed = to_latex(*expression->ast);
+    std::string latex = std::format("{} = ", formula.output()->name);
+    for(std::size_t at = 0; at < printed.size();) {
+        const auto param = std::ranges::find_if(expression->params, [&](const std::string &name) {
+            return printed.compare(at, name.size(), name) == 0;
+        });
+        if(param == expression->params.end()) {
+            latex += printed[at++];
+            continue;
+        }
+        latex += variables[expression->inputs[param - expression->params.begin()]].name;
+        at += param->size();
+    }
+    return latex;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "dimeval.hpp"
+#include "formulas/physics_formulas.hpp"
+#include "symbol_table.hpp"
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dv {
+    // The right-hand side of a catalogue formula as a tree over generated parameter names
+    // (AST is complete in formula_program.cpp, the only place one is built or destroyed)
+    struct FormulaExpression {
+        std::shared_ptr<ParseSession> session;  // owns the parsed nodes and text, so it comes first
+        std::unique_ptr<AST> ast;
+        std::vector<std::string> params;    // p_{0}, p_{1}, ... in `inputs` order
+        std::vector<std::uint8_t> inputs;   // family variable index of each parameter
+    };
+    using MaybeFormulaExpression = std::expected<FormulaExpression, std::string>;
+
+    // A catalogue formula compiled once into a function of its inputs, so it can be
+    // run against values without going back through the LaTeX text
+    struct CompiledFormula {
+        Function function;                  // parameters follow `inputs`
+        std::vector<std::uint8_t> inputs;   // family variable index of each parameter
+    };
+    using MaybeCompiledFormula = std::expected<CompiledFormula, std::string>;
+
+    // Parses the right-hand side of `formula`. The catalogue's variable names are not
+    // all Nero identifiers (E_max, \mu, \Delta x), so every non-constant input is
+    // replaced by a generated parameter before lexing; constants keep their names and
+    // resolve like any global (c, h, \pi, or a sheet variable such as g). A leading
+    // \pm takes the principal root. A derived formula has no text of its own: both
+    // sides of the family's equation are parsed and its variable isolated (dv::isolate).
+    MaybeFormulaExpression formula_expression(const Physics::Formula &formula);
+
+    // formula_expression() made into a function of the inputs
+    MaybeCompiledFormula compile_formula(const Physics::Formula &formula, SymbolTable &symbols);
+
+    // The formula as LaTeX: the catalogue text, or for a derived formula the isolated
+    // tree printed with the variable names put back
+    std::expected<std::string, std::string> formula_latex(const Physics::Formula &formula);
+}
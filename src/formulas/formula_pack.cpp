@@ -0,0 +1,166 @@
+#include "formula_pack.hpp"
+#include <bit>
+#include <cstring>
+#include <format>
+
+#ifndef __EMSCRIPTEN__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little, "formula packs are read in place as little-endian");
+
+namespace Physics {
+namespace {
+    constexpr std::uint64_t HEADER_BYTES = 32;
+    constexpr std::uint64_t GROUP_BYTES = 16;
+    constexpr std::uint64_t PRODUCER_BYTES = 4;
+    constexpr std::uint64_t VARIABLE_BYTES = 32;
+    constexpr std::uint64_t FAMILY_BYTES = 32;
+    constexpr std::uint64_t FORMULA_BYTES = 16;
+
+    constexpr std::uint64_t align8(std::uint64_t n) noexcept { return (n + 7) & ~std::uint64_t{7}; }
+
+    template <typename T>
+    T read(const std::byte *at) noexcept {
+        T value;
+        std::memcpy(&value, at, sizeof value);
+        return value;
+    }
+} // namespace
+
+    FormulaPack::MaybePack FormulaPack::map_file(const std::string &path) {
+#ifdef __EMSCRIPTEN__
+        return std::unexpected{std::format("Cannot map '{}': this build has no filesystem, use from_bytes", path)};
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return std::unexpected{std::format("Cannot open formula pack '{}'", path)};
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return std::unexpected{std::format("Formula pack '{}' is empty", path)};
+        }
+        void *mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) return std::unexpected{std::format("Cannot map formula pack '{}'", path)};
+
+        std::shared_ptr<FormulaPack> pack{new FormulaPack};
+        pack->mapping = mapped;
+        pack->data = static_cast<const std::byte*>(mapped);
+        pack->length = static_cast<std::size_t>(info.st_size);
+        if (auto error = pack->load()) return std::unexpected{std::format("{} in '{}'", *error, path)};
+        return pack;
+#endif
+    }
+
+    FormulaPack::MaybePack FormulaPack::from_bytes(std::vector<std::byte> bytes) {
+        std::shared_ptr<FormulaPack> pack{new FormulaPack};
+        pack->owned = std::move(bytes);
+        pack->data = pack->owned.data();
+        pack->length = pack->owned.size();
+        if (auto error = pack->load()) return std::unexpected{std::move(*error)};
+        return pack;
+    }
+
+    FormulaPack::~FormulaPack() {
+#ifndef __EMSCRIPTEN__
+        if (mapping) ::munmap(mapping, length);
+#endif
+    }
+
+    std::optional<std::string> FormulaPack::load() {
+        if (length < HEADER_BYTES) return "Formula pack is truncated";
+        std::uint32_t header[8];
+        for (std::size_t i = 0; i < 8; i++) header[i] = read<std::uint32_t>(data + 4 * i);
+        const auto [magic, version, string_bytes, variable_count, family_count,
+                    formula_count, group_count, producer_count] = header;
+        if (magic != MAGIC) return "Not a formula pack";
+        if (version != VERSION) return std::format("Unsupported formula pack version {}", version);
+
+        const std::uint64_t groups_at = HEADER_BYTES;
+        const std::uint64_t producers_at = groups_at + align8(group_count * GROUP_BYTES);
+        const std::uint64_t variables_at = producers_at + align8(producer_count * PRODUCER_BYTES);
+        const std::uint64_t families_at = variables_at + align8(variable_count * VARIABLE_BYTES);
+        const std::uint64_t formulas_at = families_at + align8(family_count * FAMILY_BYTES);
+        const std::uint64_t strings_at = formulas_at + align8(formula_count * FORMULA_BYTES);
+        if (strings_at + string_bytes > length) return "Formula pack is truncated";
+
+        const char *pool = reinterpret_cast<const char*>(data + strings_at);
+        bool strings_ok = true;
+        auto string_at = [&](const std::byte *at) -> std::string_view {
+            const auto offset = read<std::uint32_t>(at);
+            const auto size = read<std::uint32_t>(at + 4);
+            if (std::uint64_t{offset} + size > string_bytes) {
+                strings_ok = false;
+                return {};
+            }
+            return {pool + offset, size};
+        };
+
+        output_groups.reserve(group_count);
+        for (std::uint64_t i = 0; i < group_count; i++) {
+            const std::byte *at = data + groups_at + i * GROUP_BYTES;
+            const auto unit = dv::UnitVector::from_bits(read<std::uint64_t>(at));
+            const auto first = read<std::uint32_t>(at + 8);
+            const auto count = read<std::uint32_t>(at + 12);
+            if (std::uint64_t{first} + count > producer_count) return "Formula pack output group out of range";
+            if (!output_groups.empty() && output_groups.back().unit.packed() >= unit.packed())
+                return "Formula pack output groups are not sorted";
+            output_groups.push_back({unit, first, count});
+        }
+
+        producers.reserve(producer_count);
+        for (std::uint64_t i = 0; i < producer_count; i++) {
+            const auto formula = read<std::uint32_t>(data + producers_at + i * PRODUCER_BYTES);
+            if (formula >= formula_count) return "Formula pack producer out of range";
+            producers.push_back(formula);
+        }
+
+        variables.reserve(variable_count);
+        for (std::uint64_t i = 0; i < variable_count; i++) {
+            const std::byte *at = data + variables_at + i * VARIABLE_BYTES;
+            variables.push_back({
+                string_at(at + 8),
+                dv::UnitVector::from_bits(read<std::uint64_t>(at)),
+                string_at(at + 16),
+                read<std::uint32_t>(at + 24) != 0
+            });
+        }
+
+        families.reserve(family_count);
+        for (std::uint64_t i = 0; i < family_count; i++) {
+            const std::byte *at = data + families_at + i * FAMILY_BYTES;
+            const auto first = read<std::uint32_t>(at + 24);
+            const auto count = read<std::uint32_t>(at + 28);
+            if (std::uint64_t{first} + count > variable_count) return "Formula pack family variables out of range";
+            if (count > MAX_INPUT_TYPES) return std::format("Formula pack family has more than {} variables", MAX_INPUT_TYPES);
+            families.push_back({
+                string_at(at),
+                std::span<const Variable>{variables}.subspan(first, count),
+                string_at(at + 8),
+                string_at(at + 16)
+            });
+        }
+
+        formulas.reserve(formula_count);
+        for (std::uint64_t i = 0; i < formula_count; i++) {
+            const std::byte *at = data + formulas_at + i * FORMULA_BYTES;
+            const auto family = read<std::uint32_t>(at + 8);
+            const auto solve_for = read<std::uint32_t>(at + 12);
+            if (family >= family_count) return "Formula pack family index out of range";
+            if (solve_for != Formula::no_solve_for && solve_for >= families[family].variables.size())
+                return "Formula pack solve-for index out of range";
+            const auto latex = string_at(at);
+            // A derived formula is its family's equation solved for solve_for
+            if (latex.empty() && solve_for == Formula::no_solve_for)
+                return "Formula pack derived formula has no solve-for variable";
+            formulas.push_back({&families[family], latex, static_cast<std::uint8_t>(solve_for)});
+        }
+
+        if (!strings_ok) return "Formula pack string out of range";
+        db.emplace(FormulaCatalogue{formulas, output_groups, producers});
+        return std::nullopt;
+    }
+} // namespace Physics
@@ -0,0 +1,70 @@
+#ifndef FORMULA_PACK_HPP
+#define FORMULA_PACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "physics_formulas.hpp"
+
+namespace Physics {
+
+// A formula catalogue loaded at runtime from the binary pack written by
+// formula_gen/formulas_to_pack.ts, so formulas can change (or be cut down to one
+// domain) without rebuilding. All integers are little-endian; every section starts
+// on an 8-byte boundary, in this order:
+//
+//   header     u32 magic "NFPK", version, string_bytes, variable_count, family_count,
+//                  formula_count, group_count, producer_count
+//   groups     { u64 unit, u32 first, u32 count }            ascending by unit
+//   producers  u32 formula index                               ascending within a group
+//   variables  { u64 unit, str name, str description, u32 is_constant, u32 reserved }
+//   families   { str name, str category, str equation, u32 first_variable, u32 variable_count }
+//   formulas   { str latex, u32 family, u32 solve_for }             latex is empty when derived
+//   strings    UTF-8 pool
+//
+// where str is { u32 offset, u32 length } into the pool and a unit is
+// dv::UnitVector::packed(). Loading validates every index and builds the small
+// Variable/FormulaFamily/Formula arrays, whose strings view the pack's own bytes.
+class FormulaPack {
+public:
+    using MaybePack = std::expected<std::shared_ptr<const FormulaPack>, std::string>;
+
+    static constexpr std::uint32_t MAGIC = 0x4B50464E;    // "NFPK"
+    static constexpr std::uint32_t VERSION = 2;
+
+    // Maps the file read-only; native builds only
+    static MaybePack map_file(const std::string &path);
+    // Takes over bytes that are already in memory, e.g. fetched by the WASM host
+    static MaybePack from_bytes(std::vector<std::byte> bytes);
+
+    FormulaPack(const FormulaPack&) = delete;
+    FormulaPack& operator=(const FormulaPack&) = delete;
+    ~FormulaPack();
+
+    const FormulaDatabase& database() const noexcept { return *db; }
+
+private:
+    FormulaPack() = default;
+    // Error message if the bytes are not a well-formed pack
+    std::optional<std::string> load();
+
+    const std::byte *data = nullptr;
+    std::size_t length = 0;
+    std::vector<std::byte> owned;
+    void *mapping = nullptr;
+
+    std::vector<Variable> variables;
+    std::vector<FormulaFamily> families;
+    std::vector<Formula> formulas;
+    std::vector<OutputGroup> output_groups;
+    std::vector<std::uint32_t> producers;
+    std::optional<FormulaDatabase> db;
+};
+
+} // namespace Physics
+
+#endif // FORMULA_PACK_HPP
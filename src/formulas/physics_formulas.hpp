@@ -1,55 +1,168 @@
 #ifndef PHYSICS_FORMULAS_HPP
 #define PHYSICS_FORMULAS_HPP
 
+#include <cstdint>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "../dimeval.hpp"
 
 namespace Physics {
 
+// The built-in catalogue is constexpr data in read-only storage and a FormulaPack
+// is a mapped file, so these only hold views into one of them
 struct Variable {
-    std::string name;                    // "F", "q_1", "r", etc.
-    dv::UnitVector units;           // [m, s, kg, A, K, mol, cd]
-    std::string description;             // "Force", "Charge 1", "Distance"
+    std::string_view name;               // "F", "q_1", "r", etc.
+    dv::UnitVector units;                // [m, s, kg, A, K, mol, cd]
+    std::string_view description;        // "Force", "Charge 1", "Distance"
     bool is_constant;                    // true for k, G, epsilon_0, etc.
 };
 
+// The rearrangements of one equation share a family, so the variable table,
+// name, category and the equation itself are stored once
+struct FormulaFamily {
+    std::string_view name;               // "Coulomb's Law"
+    std::span<const Variable> variables; // All variables in the equation
+    std::string_view category;
+    std::string_view equation;           // As written; derived formulas are rearranged from it
+};
+
 struct Formula {
-    std::string name;                    // "Coulomb's Law"
-    std::string latex;                   // "F = k \\frac{q_1 q_2}{r^2}"
-    std::vector<Variable> variables;     // All variables in the equation
-    std::string solve_for;               // "F" (which variable this solves for)
-    std::string category;
+    static constexpr std::uint8_t no_solve_for = 0xFF;
+
+    const FormulaFamily* family;
+    std::string_view latex;              // "F = k \\frac{q_1 q_2}{r^2}", empty if derived
+    std::uint8_t solve_for;              // index into variables(), no_solve_for if the target isn't one of them
+
+    std::string_view name() const noexcept { return family->name; }
+    std::span<const Variable> variables() const noexcept { return family->variables; }
+    std::string_view category() const noexcept { return family->category; }
+    // A derived formula has no text of its own: it is the family's equation isolated
+    // for solve_for, worked out on first use (see dv::formula_expression)
+    bool derived() const noexcept { return latex.empty(); }
+    // The variable this rearrangement solves for, null if it is not in the table
+    const Variable* output() const noexcept {
+        return solve_for == no_solve_for ? nullptr : &family->variables[solve_for];
+    }
+};
+
+// Formulas producing one output unit: producers[first, first + count)
+struct OutputGroup {
+    dv::UnitVector unit;
+    std::uint32_t first;
+    std::uint32_t count;
+};
+
+// Everything a FormulaDatabase views: the formulas plus their output-unit index.
+// Backed either by the generated constexpr tables or by a loaded FormulaPack.
+struct FormulaCatalogue {
+    std::span<const Formula> formulas;
+    std::span<const OutputGroup> output_groups;   // ascending by unit.packed()
+    std::span<const std::uint32_t> producers;     // formula indices, ascending within a group
+};
+
+// Generated by formula_gen/formulas_to_cpp.ts; empty when built with NERO_EMBED_FORMULAS=OFF
+FormulaCatalogue builtin_catalogue() noexcept;
+
+// A search hit: position in the database plus how deep in a derivation chain it sits
+// (0 = answers the query, 1 = feeds a depth-0 formula, 2 = feeds a depth-1 formula)
+struct FormulaMatch {
+    std::size_t index;
+    int depth;
+};
+
+// A text search hit: the first formula of a matching family and its relevance
+struct TextMatch {
+    std::size_t index;
+    double score;
 };
 
+// Variables one formula may have, so also its most distinct input units. The catalogue
+// generator refuses families with more, the embedded table static_asserts it and
+// FormulaPack rejects packs that exceed it
+inline constexpr std::size_t MAX_INPUT_TYPES = 8;
+
+// How an available pool of units covers every formula's inputs, see FormulaDatabase::match_pool
+struct PoolCoverage {
+    std::vector<std::uint8_t> missing;   // per formula: bit k set if the pool is short of input slot k
+    std::vector<std::uint8_t> matched;   // per formula: inputs the pool covers, counting repeats
+};
+
+// Constructing one does no work; the input tables are built on the first match
+// and the text index on the first text search
 class FormulaDatabase {
 public:
-    FormulaDatabase();
-    const std::vector<Formula> get_formulas() const { return formulas; }
-    
+    FormulaDatabase() noexcept : catalogue(builtin_catalogue()) {}
+    explicit FormulaDatabase(const FormulaCatalogue &catalogue) noexcept : catalogue(catalogue) {}
+
+    std::span<const Formula> get_formulas() const noexcept { return catalogue.formulas; }
+    const Formula& operator[](std::size_t idx) const noexcept { return catalogue.formulas[idx]; }
+    std::size_t size() const noexcept { return catalogue.formulas.size(); }
+
+    // Indices of the formulas whose solve_for variable has `unit`, ascending
+    std::span<const std::uint32_t> producing(const dv::UnitVector &unit) const noexcept;
+
+    // Non-constant inputs of each formula are grouped by unit into slots, in
+    // first-seen order; slot k of formula idx needs input_count(idx, k) values
+    // (0 past the last slot) of input_unit(idx, k)
+    dv::UnitVector input_unit(std::size_t idx, std::size_t slot) const noexcept {
+        return tables().units[tables().slot_units[idx * MAX_INPUT_TYPES + slot]];
+    }
+    std::uint8_t input_count(std::size_t idx, std::size_t slot) const noexcept {
+        return tables().slot_counts[idx * MAX_INPUT_TYPES + slot];
+    }
+    // Total inputs of formula idx, counting repeats
+    std::uint8_t input_total(std::size_t idx) const noexcept { return tables().totals[idx]; }
+
+    // Matches `pool` against every formula at once: the pool becomes a count per
+    // dense unit id, is gathered into each formula's slots, and the shortfall and
+    // coverage of all slots are then one pass of byte compares and mins, split over
+    // `threads` (0: one per hardware thread) when the database is large enough
+    PoolCoverage match_pool(std::span<const dv::UnitVector> pool, unsigned threads = 1) const;
+
+    // Up to `limit` families whose name, category or variable descriptions match the
+    // words of `query`, best first. Each word matches index terms exactly or, failing
+    // that, by shared trigrams, so typos and unfinished words still match.
+    std::vector<TextMatch> search_text(std::string_view query, std::size_t limit = 20) const;
+
 private:
-    std::vector<Formula> formulas;
-    void batch_0();
-    void batch_1();
-    void batch_2();
-    void batch_3();
-    void batch_4();
-    void batch_5();
-    void batch_6();
-    void batch_7();
-    void batch_8();
-    void batch_9();
-    void batch_10();
-    void batch_11();
-    void batch_12();
-    void batch_13();
-    void batch_14();
-    void batch_15();
-    void batch_16();
-    void batch_17();
-    void batch_18();
-    void batch_19();
-    void batch_20();
+    // Slot tables, MAX_INPUT_TYPES entries per formula
+    struct InputTables {
+        std::vector<dv::UnitVector> units;              // dense id -> unit
+        std::unordered_map<dv::UnitVector, std::uint16_t> ids;
+        std::vector<std::uint16_t> slot_units;          // dense ids, 0 in unused slots
+        std::vector<std::uint8_t> slot_counts;          // 0 in unused slots
+        std::vector<std::uint8_t> totals;
+    };
+
+    // Inverted index over families (runs of formulas sharing one FormulaFamily)
+    struct TextIndex {
+        struct Posting {
+            std::uint32_t family;
+            float weight;       // field weight of the term in this family, times its idf
+        };
+        std::vector<std::uint32_t> families;                     // family -> first formula
+        std::unordered_map<std::string, std::uint32_t> terms;    // term -> id
+        std::vector<std::string> vocabulary;                     // id -> term
+        std::vector<std::vector<Posting>> postings;              // id -> families, ascending
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> trigrams;   // -> term ids
+    };
+
+    FormulaCatalogue catalogue;
+    mutable std::once_flag inputs_built;
+    mutable InputTables inputs;
+    mutable std::once_flag text_built;
+    mutable TextIndex text;
+
+    const InputTables& tables() const noexcept {
+        std::call_once(inputs_built, [this] { build_inputs(); });
+        return inputs;
+    }
+    void build_inputs() const;
+    void build_text() const;
 };
 
 } // namespace Physics
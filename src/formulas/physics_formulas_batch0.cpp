@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_0() {
-		this->formulas.emplace_back("Newton's Second Law", "F = m \\cdot a", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "F");
-		this->formulas.emplace_back("Newton's Second Law", "a = \\frac{F}{m}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "a");
-		this->formulas.emplace_back("Newton's Second Law", "m = \\frac{F}{a}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "m");
-		this->formulas.emplace_back("Weight", "W = m \\cdot g", std::vector<Variable>{{"W", {1, -2, 1, 0, 0, 0, 0}, "Weight force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "W");
-		this->formulas.emplace_back("Weight", "g = \\frac{W}{m}", std::vector<Variable>{{"W", {1, -2, 1, 0, 0, 0, 0}, "Weight force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Weight", "m = \\frac{W}{g}", std::vector<Variable>{{"W", {1, -2, 1, 0, 0, 0, 0}, "Weight force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "m");
-		this->formulas.emplace_back("Friction Force", "F_f = \\mu \\cdot N", std::vector<Variable>{{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},{"\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false},{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false}}, "F_f");
-		this->formulas.emplace_back("Friction Force", "N = \\frac{F_f}{\\mu}", std::vector<Variable>{{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},{"\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false},{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false}}, "N");
-		this->formulas.emplace_back("Friction Force", "\\mu = \\frac{F_f}{N}", std::vector<Variable>{{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},{"\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false},{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false}}, "\\mu");
-		this->formulas.emplace_back("Hooke's Law", "F = k \\cdot x", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring restoring force", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "F");
-		this->formulas.emplace_back("Hooke's Law", "k = \\frac{F}{x}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring restoring force", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "k");
-		this->formulas.emplace_back("Hooke's Law", "x = \\frac{F}{k}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring restoring force", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "x");
-		this->formulas.emplace_back("Spring Potential Energy", "U = \\frac{1}{2} k \\cdot x^{2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Elastic potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "U");
-		this->formulas.emplace_back("Spring Potential Energy", "k = \\frac{\\frac{U}{x^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Elastic potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "k");
-		this->formulas.emplace_back("Spring Potential Energy", "x = \\pm \\left(\\frac{U}{\\frac{1}{2} k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Elastic potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false}}, "x");
-		this->formulas.emplace_back("Centripetal Force", "F_c = \\frac{m \\cdot v^{2}}{r}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "F_c");
-		this->formulas.emplace_back("Centripetal Force", "m = \\frac{F_c \\cdot r}{v^{2}}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "m");
-		this->formulas.emplace_back("Centripetal Force", "r = \\frac{m \\cdot v^{2}}{F_c}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "r");
-		this->formulas.emplace_back("Centripetal Force", "v = \\pm \\left(\\frac{F_c \\cdot r}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "v");
-		this->formulas.emplace_back("Newton's Law of Gravitation", "F = G \\cdot \\frac{m_1 \\cdot m_2}{r^{2}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "F");
-		this->formulas.emplace_back("Newton's Law of Gravitation", "G = \\frac{F}{\\frac{m_1 \\cdot m_2}{r^{2}}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "G");
-		this->formulas.emplace_back("Newton's Law of Gravitation", "m_1 = \\frac{\\frac{F}{G} \\cdot r^{2}}{m_2}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "m_1");
-		this->formulas.emplace_back("Newton's Law of Gravitation", "m_2 = \\frac{\\frac{F}{G} \\cdot r^{2}}{m_1}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "m_2");
-		this->formulas.emplace_back("Newton's Law of Gravitation", "r = \\pm \\left(\\frac{m_1 \\cdot m_2}{\\frac{F}{G}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "r");
-		this->formulas.emplace_back("Gravitational Field Strength", "G = \\frac{g}{\\frac{M}{r^{2}}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational field strength", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the source body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "G");
-		this->formulas.emplace_back("Gravitational Field Strength", "M = \\frac{g}{G} \\cdot r^{2}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational field strength", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the source body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "M");
-		this->formulas.emplace_back("Gravitational Field Strength", "g = G \\cdot \\frac{M}{r^{2}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational field strength", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the source body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "g");
-		this->formulas.emplace_back("Gravitational Field Strength", "r = \\pm \\left(\\frac{M}{\\frac{g}{G}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational field strength", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the source body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "r");
-		this->formulas.emplace_back("Gravitational Potential Energy", "G = \\frac{U}{\\frac{m_1 \\cdot m_2}{r}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "G");
-		this->formulas.emplace_back("Gravitational Potential Energy", "U = G \\cdot \\frac{m_1 \\cdot m_2}{r}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "U");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_1 = \\frac{\\frac{U}{G} \\cdot r}{m_2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "m_1");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_2 = \\frac{\\frac{U}{G} \\cdot r}{m_1}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "m_2");
-		this->formulas.emplace_back("Gravitational Potential Energy", "r = \\frac{m_1 \\cdot m_2}{\\frac{U}{G}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false}}, "r");
-		this->formulas.emplace_back("Orbital Velocity", "G = \\frac{v^{2} \\cdot r}{M}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false}}, "G");
-		this->formulas.emplace_back("Orbital Velocity", "M = \\frac{v^{2} \\cdot r}{G}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false}}, "M");
-		this->formulas.emplace_back("Orbital Velocity", "r = \\frac{G \\cdot M}{v^{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false}}, "r");
-		this->formulas.emplace_back("Orbital Velocity", "v = \\left(\\frac{G \\cdot M}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false}}, "v");
-		this->formulas.emplace_back("Escape Velocity", "G = \\frac{\\frac{v_e^{2} \\cdot r}{M}}{2}", std::vector<Variable>{{"v_e", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body to escape from", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "G");
-		this->formulas.emplace_back("Escape Velocity", "M = \\frac{v_e^{2} \\cdot r}{2 G}", std::vector<Variable>{{"v_e", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body to escape from", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "M");
-		this->formulas.emplace_back("Escape Velocity", "r = \\frac{2 G \\cdot M}{v_e^{2}}", std::vector<Variable>{{"v_e", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body to escape from", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "r");
-		this->formulas.emplace_back("Escape Velocity", "v_e = \\left(\\frac{2 G \\cdot M}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v_e", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body to escape from", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false}}, "v_e");
-		this->formulas.emplace_back("Kepler's Third Law", "G = \\frac{\\frac{4 \\pi^{2} \\cdot r^{3}}{T^{2}}}{M}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false}}, "G");
-		this->formulas.emplace_back("Kepler's Third Law", "M = \\frac{\\frac{4 \\pi^{2} \\cdot r^{3}}{T^{2}}}{G}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false}}, "M");
-		this->formulas.emplace_back("Kepler's Third Law", "T = \\pm \\left(\\frac{4 \\pi^{2} \\cdot r^{3}}{G \\cdot M}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false}}, "T");
-		this->formulas.emplace_back("Kepler's Third Law", "\\pi = \\pm \\left(\\frac{\\frac{T^{2} \\cdot G \\cdot M}{r^{3}}}{4}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false}}, "\\pi");
-		this->formulas.emplace_back("Kepler's Third Law", "r = \\left(\\frac{T^{2} \\cdot G \\cdot M}{4 \\pi^{2}}\\right)^{\\frac{1}{3}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false}}, "r");
-		this->formulas.emplace_back("Gravitational Acceleration at Surface", "G = \\frac{g}{\\frac{M}{R^{2}}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration at surface", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of the body", false}}, "G");
-		this->formulas.emplace_back("Gravitational Acceleration at Surface", "M = \\frac{g}{G} \\cdot R^{2}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration at surface", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of the body", false}}, "M");
-		this->formulas.emplace_back("Gravitational Acceleration at Surface", "R = \\pm \\left(\\frac{M}{\\frac{g}{G}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration at surface", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of the body", false}}, "R");
-		this->formulas.emplace_back("Gravitational Acceleration at Surface", "g = G \\cdot \\frac{M}{R^{2}}", std::vector<Variable>{{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration at surface", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of the body", false}}, "g");
-		this->formulas.emplace_back("Mass-Energy Equivalence", "E = m \\cdot c^{2}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true}}, "E");
-		this->formulas.emplace_back("Mass-Energy Equivalence", "c = \\pm \\left(\\frac{E}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true}}, "c");
-		this->formulas.emplace_back("Mass-Energy Equivalence", "m = \\frac{E}{c^{2}}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true}}, "m");
-		this->formulas.emplace_back("Photon Energy", "E = h \\cdot f", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "E");
-		this->formulas.emplace_back("Photon Energy", "f = \\frac{E}{h}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "f");
-		this->formulas.emplace_back("Photon Energy", "h = \\frac{E}{f}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "h");
-		this->formulas.emplace_back("Photon Energy (Wavelength)", "E = \\frac{h \\cdot c}{\\lambda}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "E");
-		this->formulas.emplace_back("Photon Energy (Wavelength)", "\\lambda = \\frac{h \\cdot c}{E}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "\\lambda");
-		this->formulas.emplace_back("Photon Energy (Wavelength)", "c = \\frac{E \\cdot \\lambda}{h}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "c");
-		this->formulas.emplace_back("Photon Energy (Wavelength)", "h = \\frac{E \\cdot \\lambda}{c}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "h");
-		this->formulas.emplace_back("Photoelectric Effect", "E_max = \\frac{h \\cdot f - \\phi}{K}", std::vector<Variable>{{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false}}, "E_max");
-		this->formulas.emplace_back("Photoelectric Effect", "K = \\frac{h \\cdot f - \\phi}{E_max}", std::vector<Variable>{{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false}}, "K");
-		this->formulas.emplace_back("Photoelectric Effect", "\\phi = h \\cdot f - K \\cdot E_max", std::vector<Variable>{{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false}}, "\\phi");
-		this->formulas.emplace_back("Photoelectric Effect", "f = \\frac{K \\cdot E_max + \\phi}{h}", std::vector<Variable>{{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false}}, "f");
-		this->formulas.emplace_back("Photoelectric Effect", "h = \\frac{K \\cdot E_max + \\phi}{f}", std::vector<Variable>{{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false}}, "h");
-		this->formulas.emplace_back("de Broglie Wavelength", "\\lambda = \\frac{h}{m \\cdot v}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "\\lambda");
-		this->formulas.emplace_back("de Broglie Wavelength", "h = \\lambda \\cdot m \\cdot v", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "h");
-		this->formulas.emplace_back("de Broglie Wavelength", "m = \\frac{\\frac{h}{\\lambda}}{v}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "m");
-		this->formulas.emplace_back("de Broglie Wavelength", "v = \\frac{\\frac{h}{\\lambda}}{m}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("de Broglie Wavelength (Momentum)", "\\lambda = \\frac{h}{p}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false}}, "\\lambda");
-		this->formulas.emplace_back("de Broglie Wavelength (Momentum)", "h = \\lambda \\cdot p", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false}}, "h");
-		this->formulas.emplace_back("de Broglie Wavelength (Momentum)", "p = \\frac{h}{\\lambda}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false}}, "p");
-		this->formulas.emplace_back("Bohr Model Energy Levels", "E_1 = E_n \\cdot n^{2}", std::vector<Variable>{{"E_n", {2, -2, 1, 0, 0, 0, 0}, "Energy of level n", false},{"E_1", {2, -2, 1, 0, 0, 0, 0}, "Ground state energy", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false}}, "E_1");
-		this->formulas.emplace_back("Bohr Model Energy Levels", "E_n = \\frac{E_1}{n^{2}}", std::vector<Variable>{{"E_n", {2, -2, 1, 0, 0, 0, 0}, "Energy of level n", false},{"E_1", {2, -2, 1, 0, 0, 0, 0}, "Ground state energy", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false}}, "E_n");
-		this->formulas.emplace_back("Bohr Model Energy Levels", "n = \\pm \\left(\\frac{E_1}{E_n}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E_n", {2, -2, 1, 0, 0, 0, 0}, "Energy of level n", false},{"E_1", {2, -2, 1, 0, 0, 0, 0}, "Ground state energy", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false}}, "n");
-		this->formulas.emplace_back("Bohr Model Radius", "a_0 = \\frac{r_n}{n^{2}}", std::vector<Variable>{{"r_n", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false},{"a_0", {1, 0, 0, 0, 0, 0, 0}, "Bohr radius", true}}, "a_0");
-		this->formulas.emplace_back("Bohr Model Radius", "n = \\pm \\left(\\frac{r_n}{a_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r_n", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false},{"a_0", {1, 0, 0, 0, 0, 0, 0}, "Bohr radius", true}}, "n");
-		this->formulas.emplace_back("Bohr Model Radius", "r_n = n^{2} \\cdot a_0", std::vector<Variable>{{"r_n", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false},{"a_0", {1, 0, 0, 0, 0, 0, 0}, "Bohr radius", true}}, "r_n");
-		this->formulas.emplace_back("Radioactive Decay Law", "N = N_0 \\cdot e^{-\\lambda \\cdot t}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "N");
-		this->formulas.emplace_back("Radioactive Decay Law", "N_0 = \\frac{N}{e^{-\\lambda \\cdot t}}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "N_0");
-		this->formulas.emplace_back("Radioactive Decay Law", "\\lambda = -\\frac{\\frac{\\ln\\left(\\frac{N}{N_0}\\right)}{\\ln\\left(e\\right)}}{t}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\lambda");
-		this->formulas.emplace_back("Radioactive Decay Law", "e = \\left(\\frac{N}{N_0}\\right)^{\\frac{1}{-\\lambda \\cdot t}}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "e");
-		this->formulas.emplace_back("Radioactive Decay Law", "t = \\frac{\\frac{\\ln\\left(\\frac{N}{N_0}\\right)}{\\ln\\left(e\\right)}}{-\\lambda}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Half-Life", "\\lambda = \\frac{0.6931471805599453}{t_\\frac{1}{2}}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false}}, "\\lambda");
-		this->formulas.emplace_back("Half-Life", "t_\\frac{1}{2} = \\frac{0.6931471805599453}{\\lambda}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false}}, "t_\\frac{1}{2}");
-		this->formulas.emplace_back("Coulomb's Law", "F = k \\cdot \\frac{q_1 \\cdot q_2}{r^{2}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "F");
-		this->formulas.emplace_back("Coulomb's Law", "k = \\frac{F}{\\frac{q_1 \\cdot q_2}{r^{2}}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "k");
-		this->formulas.emplace_back("Coulomb's Law", "q_1 = \\frac{\\frac{F}{k} \\cdot r^{2}}{q_2}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "q_1");
-		this->formulas.emplace_back("Coulomb's Law", "q_2 = \\frac{\\frac{F}{k} \\cdot r^{2}}{q_1}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "q_2");
-		this->formulas.emplace_back("Coulomb's Law", "r = \\pm \\left(\\frac{q_1 \\cdot q_2}{\\frac{F}{k}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "r");
-		this->formulas.emplace_back("Electric Field from Force", "E = \\frac{F}{q}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Electric force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Test charge", false}}, "E");
-		this->formulas.emplace_back("Electric Field from Force", "F = E \\cdot q", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Electric force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Test charge", false}}, "F");
-		this->formulas.emplace_back("Electric Field from Force", "q = \\frac{F}{E}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Electric force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Test charge", false}}, "q");
-		this->formulas.emplace_back("Electric Field (Point Charge)", "E = k \\cdot \\frac{q}{r^{2}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "E");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_1() {
-		this->formulas.emplace_back("Electric Field (Point Charge)", "k = \\frac{E}{\\frac{q}{r^{2}}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "k");
-		this->formulas.emplace_back("Electric Field (Point Charge)", "q = \\frac{E}{k} \\cdot r^{2}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "q");
-		this->formulas.emplace_back("Electric Field (Point Charge)", "r = \\pm \\left(\\frac{q}{\\frac{E}{k}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "r");
-		this->formulas.emplace_back("Electric Potential (Point Charge)", "V = k \\cdot \\frac{q}{r}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "V");
-		this->formulas.emplace_back("Electric Potential (Point Charge)", "k = \\frac{V}{\\frac{q}{r}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "k");
-		this->formulas.emplace_back("Electric Potential (Point Charge)", "q = \\frac{V}{k} \\cdot r", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "q");
-		this->formulas.emplace_back("Electric Potential (Point Charge)", "r = \\frac{q}{\\frac{V}{k}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false}}, "r");
-		this->formulas.emplace_back("Electric Field from Potential", "E = \\frac{V}{d}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "E");
-		this->formulas.emplace_back("Electric Field from Potential", "V = E \\cdot d", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "V");
-		this->formulas.emplace_back("Electric Field from Potential", "d = \\frac{V}{E}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "d");
-		this->formulas.emplace_back("Electric Potential Energy", "U = k \\cdot \\frac{q_1 \\cdot q_2}{r}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "U");
-		this->formulas.emplace_back("Electric Potential Energy", "k = \\frac{U}{\\frac{q_1 \\cdot q_2}{r}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Energy", "q_1 = \\frac{\\frac{U}{k} \\cdot r}{q_2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "q_1");
-		this->formulas.emplace_back("Electric Potential Energy", "q_2 = \\frac{\\frac{U}{k} \\cdot r}{q_1}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "q_2");
-		this->formulas.emplace_back("Electric Potential Energy", "r = \\frac{q_1 \\cdot q_2}{\\frac{U}{k}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false}}, "r");
-		this->formulas.emplace_back("Electric Flux", "A = \\frac{\\Phi_E}{E}", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Electric Flux", "E = \\frac{\\Phi_E}{A}", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "E");
-		this->formulas.emplace_back("Electric Flux", "\\Phi_E = E \\cdot A", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "\\Phi_E");
-		this->formulas.emplace_back("Gauss's Law", "Q_enc = \\Phi_E \\cdot \\epsilon_0", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "Q_enc");
-		this->formulas.emplace_back("Gauss's Law", "\\Phi_E = \\frac{Q_enc}{\\epsilon_0}", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\Phi_E");
-		this->formulas.emplace_back("Gauss's Law", "\\epsilon_0 = \\frac{Q_enc}{\\Phi_E}", std::vector<Variable>{{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\epsilon_0");
-		this->formulas.emplace_back("Electric Field (Infinite Plane)", "E = \\frac{\\sigma}{2 \\epsilon_0}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "E");
-		this->formulas.emplace_back("Electric Field (Infinite Plane)", "\\epsilon_0 = \\frac{\\frac{\\sigma}{E}}{2}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\epsilon_0");
-		this->formulas.emplace_back("Electric Field (Infinite Plane)", "\\sigma = E \\cdot 2 \\epsilon_0", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\sigma");
-		this->formulas.emplace_back("Surface Charge Density", "A = \\frac{Q}{\\sigma}", std::vector<Variable>{{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Surface Charge Density", "Q = \\sigma \\cdot A", std::vector<Variable>{{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "Q");
-		this->formulas.emplace_back("Surface Charge Density", "\\sigma = \\frac{Q}{A}", std::vector<Variable>{{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "\\sigma");
-		this->formulas.emplace_back("Linear Charge Density", "L = \\frac{Q}{\\lambda}", std::vector<Variable>{{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Linear Charge Density", "Q = \\lambda \\cdot L", std::vector<Variable>{{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "Q");
-		this->formulas.emplace_back("Linear Charge Density", "\\lambda = \\frac{Q}{L}", std::vector<Variable>{{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "\\lambda");
-		this->formulas.emplace_back("Volume Charge Density", "Q = \\rho_q \\cdot V", std::vector<Variable>{{"\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "Q");
-		this->formulas.emplace_back("Volume Charge Density", "V = \\frac{Q}{\\rho_q}", std::vector<Variable>{{"\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "V");
-		this->formulas.emplace_back("Volume Charge Density", "\\rho_q = \\frac{Q}{V}", std::vector<Variable>{{"\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "\\rho_q");
-		this->formulas.emplace_back("Electric Dipole Moment", "d = \\frac{p}{q}", std::vector<Variable>{{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge magnitude", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false}}, "d");
-		this->formulas.emplace_back("Electric Dipole Moment", "p = q \\cdot d", std::vector<Variable>{{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge magnitude", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false}}, "p");
-		this->formulas.emplace_back("Electric Dipole Moment", "q = \\frac{p}{d}", std::vector<Variable>{{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge magnitude", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false}}, "q");
-		this->formulas.emplace_back("Electric Energy Density", "E = \\pm \\left(\\frac{u}{\\frac{1}{2} \\epsilon_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Electric energy density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Electric Energy Density", "\\epsilon_0 = \\frac{\\frac{u}{E^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Electric energy density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Electric Energy Density", "u = \\frac{1}{2} \\epsilon_0 \\cdot E^{2}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Electric energy density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "u");
-		this->formulas.emplace_back("Electric Field of Current Density with Resistivity", "E = J \\cdot \\rho", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "E");
-		this->formulas.emplace_back("Electric Field of Current Density with Resistivity", "J = \\frac{E}{\\rho}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "J");
-		this->formulas.emplace_back("Electric Field of Current Density with Resistivity", "\\rho = \\frac{E}{J}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "\\rho");
-		this->formulas.emplace_back("Electric Field of Charged Ring on Axis", "E = \\frac{k \\cdot Q \\cdot x}{\\left(x^{2} + R^{2}\\right)^{\\frac{3}{2}}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field on axis", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge on ring", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of ring", false}}, "E");
-		this->formulas.emplace_back("Electric Field of Charged Ring on Axis", "Q = \\frac{\\frac{E \\cdot \\left(x^{2} + R^{2}\\right)^{\\frac{3}{2}}}{x}}{k}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field on axis", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge on ring", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of ring", false}}, "Q");
-		this->formulas.emplace_back("Electric Field of Charged Ring on Axis", "R = \\pm \\left(\\left(\\frac{k \\cdot Q \\cdot x}{E}\\right)^{\\frac{2}{3}} - x^{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field on axis", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge on ring", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of ring", false}}, "R");
-		this->formulas.emplace_back("Electric Field of Charged Ring on Axis", "k = \\frac{\\frac{E \\cdot \\left(x^{2} + R^{2}\\right)^{\\frac{3}{2}}}{x}}{Q}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field on axis", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge on ring", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of ring", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Energy in Uniform Field", "E = \\frac{\\frac{U}{d}}{q}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "E");
-		this->formulas.emplace_back("Electric Potential Energy in Uniform Field", "U = q \\cdot E \\cdot d", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "U");
-		this->formulas.emplace_back("Electric Potential Energy in Uniform Field", "d = \\frac{U}{q \\cdot E}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "d");
-		this->formulas.emplace_back("Electric Potential Energy in Uniform Field", "q = \\frac{\\frac{U}{d}}{E}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "q");
-		this->formulas.emplace_back("Work Done by Electric Field", "E = \\frac{\\frac{W}{d}}{q}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "E");
-		this->formulas.emplace_back("Work Done by Electric Field", "W = q \\cdot E \\cdot d", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "W");
-		this->formulas.emplace_back("Work Done by Electric Field", "d = \\frac{W}{q \\cdot E}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "d");
-		this->formulas.emplace_back("Work Done by Electric Field", "q = \\frac{\\frac{W}{d}}{E}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "q");
-		this->formulas.emplace_back("Electric Field Between Parallel Plates", "E = \\frac{\\sigma}{\\epsilon_0}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field between plates", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "E");
-		this->formulas.emplace_back("Electric Field Between Parallel Plates", "\\epsilon_0 = \\frac{\\sigma}{E}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field between plates", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\epsilon_0");
-		this->formulas.emplace_back("Electric Field Between Parallel Plates", "\\sigma = E \\cdot \\epsilon_0", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field between plates", false},{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\sigma");
-		this->formulas.emplace_back("Electric Potential Due to Dipole", "V = \\frac{k \\cdot p \\cdot \\cos\\left(\\theta\\right)}{r^{2}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "V");
-		this->formulas.emplace_back("Electric Potential Due to Dipole", "\\theta = \\arccos\\left(\\frac{V \\cdot r^{2}}{k \\cdot p}\\right)", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "\\theta");
-		this->formulas.emplace_back("Electric Potential Due to Dipole", "k = \\frac{\\frac{V \\cdot r^{2}}{\\cos\\left(\\theta\\right)}}{p}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Due to Dipole", "p = \\frac{\\frac{V \\cdot r^{2}}{\\cos\\left(\\theta\\right)}}{k}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "p");
-		this->formulas.emplace_back("Electric Potential Due to Dipole", "r = \\pm \\left(\\frac{k \\cdot p \\cdot \\cos\\left(\\theta\\right)}{V}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "r");
-		this->formulas.emplace_back("Torque on Electric Dipole", "E = \\frac{\\tau}{p}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Torque on Electric Dipole", "\\tau = p \\cdot E", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\tau");
-		this->formulas.emplace_back("Torque on Electric Dipole", "p = \\frac{\\tau}{E}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "p");
-		this->formulas.emplace_back("Potential Energy of Electric Dipole", "E = \\frac{U}{p}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Potential Energy of Electric Dipole", "U = p \\cdot E", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "U");
-		this->formulas.emplace_back("Potential Energy of Electric Dipole", "p = \\frac{U}{E}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "p");
-		this->formulas.emplace_back("Electric Field from Infinite Line Charge", "E = \\frac{2 k \\cdot \\lambda}{r}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from line charge", false}}, "E");
-		this->formulas.emplace_back("Electric Field from Infinite Line Charge", "\\lambda = \\frac{E \\cdot r}{2 k}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from line charge", false}}, "\\lambda");
-		this->formulas.emplace_back("Electric Field from Infinite Line Charge", "k = \\frac{\\frac{E \\cdot r}{\\lambda}}{2}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from line charge", false}}, "k");
-		this->formulas.emplace_back("Electric Field from Infinite Line Charge", "r = \\frac{2 k \\cdot \\lambda}{E}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from line charge", false}}, "r");
-		this->formulas.emplace_back("Self-Inductance EMF", "I = \\frac{V \\cdot t}{L}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Induced voltage", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current change", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "I");
-		this->formulas.emplace_back("Self-Inductance EMF", "L = \\frac{V \\cdot t}{I}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Induced voltage", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current change", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "L");
-		this->formulas.emplace_back("Self-Inductance EMF", "V = \\frac{L \\cdot I}{t}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Induced voltage", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current change", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "V");
-		this->formulas.emplace_back("Self-Inductance EMF", "t = \\frac{L \\cdot I}{V}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Induced voltage", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current change", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "t");
-		this->formulas.emplace_back("Solenoid Inductance", "A = \\frac{\\frac{L}{l}}{\\mu_0 \\cdot n^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false}}, "A");
-		this->formulas.emplace_back("Solenoid Inductance", "L = \\mu_0 \\cdot n^{2} \\cdot A \\cdot l", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false}}, "L");
-		this->formulas.emplace_back("Solenoid Inductance", "\\mu_0 = \\frac{\\frac{\\frac{L}{l}}{A}}{n^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false}}, "\\mu_0");
-		this->formulas.emplace_back("Solenoid Inductance", "l = \\frac{L}{\\mu_0 \\cdot n^{2} \\cdot A}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false}}, "l");
-		this->formulas.emplace_back("Solenoid Inductance", "n = \\pm \\left(\\frac{\\frac{\\frac{L}{l}}{A}}{\\mu_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false}}, "n");
-		this->formulas.emplace_back("Energy Stored in Inductor", "I = \\pm \\left(\\frac{U}{\\frac{1}{2} L}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Energy Stored in Inductor", "L = \\frac{\\frac{U}{I^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "L");
-		this->formulas.emplace_back("Energy Stored in Inductor", "U = \\frac{1}{2} L \\cdot I^{2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "U");
-		this->formulas.emplace_back("RL Time Constant", "L = \\tau \\cdot R", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "L");
-		this->formulas.emplace_back("RL Time Constant", "R = \\frac{L}{\\tau}", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("RL Time Constant", "\\tau = \\frac{L}{R}", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "\\tau");
-		this->formulas.emplace_back("Mutual Inductance EMF", "E_2 = \\frac{M \\cdot I_1}{t}", std::vector<Variable>{{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in coil 2", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current change in coil 1", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "E_2");
-		this->formulas.emplace_back("Mutual Inductance EMF", "I_1 = \\frac{E_2 \\cdot t}{M}", std::vector<Variable>{{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in coil 2", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current change in coil 1", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "I_1");
-		this->formulas.emplace_back("Mutual Inductance EMF", "M = \\frac{E_2 \\cdot t}{I_1}", std::vector<Variable>{{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in coil 2", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current change in coil 1", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "M");
-		this->formulas.emplace_back("Mutual Inductance EMF", "t = \\frac{M \\cdot I_1}{E_2}", std::vector<Variable>{{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in coil 2", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current change in coil 1", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "t");
-		this->formulas.emplace_back("LC Oscillation Frequency", "C = \\frac{\\left(\\frac{\\frac{1}{f}}{2 \\pi}\\right)^{2}}{L}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("LC Oscillation Frequency", "L = \\frac{\\left(\\frac{\\frac{1}{f}}{2 \\pi}\\right)^{2}}{C}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "L");
-		this->formulas.emplace_back("LC Oscillation Frequency", "\\pi = \\frac{\\frac{\\frac{1}{f}}{\\left(L \\cdot C\\right)^{\\frac{1}{2}}}}{2}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\pi");
-    }
-} // namespace Physics
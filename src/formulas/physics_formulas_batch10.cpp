@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_10() {
-		this->formulas.emplace_back("Current from Drift Velocity", "v_d = \\frac{\\frac{I}{A}}{n \\cdot q}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "v_d");
-		this->formulas.emplace_back("Capacitors in Series", "C_1 = \\frac{1}{\\frac{1}{C_eq} - \\cdots - \\frac{1}{C_2}}", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_1");
-		this->formulas.emplace_back("Capacitors in Series", "C_2 = \\frac{1}{\\frac{1}{C_eq} - \\cdots - \\frac{1}{C_1}}", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_2");
-		this->formulas.emplace_back("Capacitors in Series", "C_eq = \\frac{1}{\\frac{1}{C_1} + \\frac{1}{C_2} + \\cdots}", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_eq");
-		this->formulas.emplace_back("Capacitors in Series", "\\cdots = \\frac{1}{C_eq} - \\left(\\frac{1}{C_1} + \\frac{1}{C_2}\\right)", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "\\cdots");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_1 = C_eq - \\cdots - C_2", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_1");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_2 = C_eq - \\cdots - C_1", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_2");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_eq = C_1 + C_2 + \\cdots", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_eq");
-		this->formulas.emplace_back("Capacitors in Parallel", "\\cdots = C_eq - \\left(C_1 + C_2\\right)", std::vector<Variable>{{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "\\cdots");
-		this->formulas.emplace_back("Parallel Plate Capacitance", "A = \\frac{C \\cdot d}{\\varepsilon_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "A");
-		this->formulas.emplace_back("Parallel Plate Capacitance", "C = \\frac{\\varepsilon_0 \\cdot A}{d}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "C");
-		this->formulas.emplace_back("Parallel Plate Capacitance", "\\varepsilon_0 = \\frac{C \\cdot d}{A}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "\\varepsilon_0");
-		this->formulas.emplace_back("Parallel Plate Capacitance", "d = \\frac{\\varepsilon_0 \\cdot A}{C}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "d");
-		this->formulas.emplace_back("Capacitance with Dielectric", "A = \\frac{\\frac{C}{\\kappa} \\cdot d}{\\varepsilon_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "A");
-		this->formulas.emplace_back("Capacitance with Dielectric", "C = \\kappa \\cdot \\frac{\\varepsilon_0 \\cdot A}{d}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "C");
-		this->formulas.emplace_back("Capacitance with Dielectric", "\\kappa = \\frac{C}{\\frac{\\varepsilon_0 \\cdot A}{d}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "\\kappa");
-		this->formulas.emplace_back("Capacitance with Dielectric", "\\varepsilon_0 = \\frac{\\frac{C}{\\kappa} \\cdot d}{A}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "\\varepsilon_0");
-		this->formulas.emplace_back("Capacitance with Dielectric", "d = \\frac{\\varepsilon_0 \\cdot A}{\\frac{C}{\\kappa}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false}}, "d");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "I = \\frac{\\frac{d \\cdot \\vec{B}}{\\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}} \\cdot 4 \\pi}{\\mu_0}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "I");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "\\hat{r} = \\frac{\\frac{d \\cdot \\vec{B}}{\\frac{\\mu_0 \\cdot I}{4 \\pi}} \\cdot r^{2}}{d \\cdot \\vec{l}}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "\\hat{r}");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "\\mu_0 = \\frac{\\frac{d \\cdot \\vec{B}}{\\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}} \\cdot 4 \\pi}{I}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "\\mu_0");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "\\pi = \\frac{\\frac{\\mu_0 \\cdot I}{\\frac{d \\cdot \\vec{B}}{\\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}}}}{4}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "\\pi");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "\\vec{B} = \\frac{\\frac{\\mu_0 \\cdot I}{4 \\pi} \\cdot \\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}}{d}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "\\vec{l} = \\frac{\\frac{\\frac{d \\cdot \\vec{B}}{\\frac{\\mu_0 \\cdot I}{4 \\pi}} \\cdot r^{2}}{\\hat{r}}}{d}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "\\vec{l}");
-		this->formulas.emplace_back("Biot-Savart Law (Differential Form)", "r = \\pm \\left(\\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{\\frac{d \\cdot \\vec{B}}{\\frac{\\mu_0 \\cdot I}{4 \\pi}}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false}}, "r");
-		this->formulas.emplace_back("Ampere's Law", "I_enc = \\frac{\\oint \\cdot \\vec{B} \\cdot d \\cdot \\vec{l}}{\\mu_0}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "I_enc");
-		this->formulas.emplace_back("Ampere's Law", "\\mu_0 = \\frac{\\oint \\cdot \\vec{B} \\cdot d \\cdot \\vec{l}}{I_enc}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "\\mu_0");
-		this->formulas.emplace_back("Ampere's Law", "\\oint = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_enc}{\\vec{l}}}{d}}{\\vec{B}}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "\\oint");
-		this->formulas.emplace_back("Ampere's Law", "\\vec{B} = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_enc}{\\vec{l}}}{d}}{\\oint}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Ampere's Law", "\\vec{l} = \\frac{\\mu_0 \\cdot I_enc}{\\oint \\cdot \\vec{B} \\cdot d}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "\\vec{l}");
-		this->formulas.emplace_back("Ampere's Law", "d = \\frac{\\frac{\\mu_0 \\cdot I_enc}{\\vec{l}}}{\\oint \\cdot \\vec{B}}", std::vector<Variable>{{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false}}, "d");
-		this->formulas.emplace_back("Magnetic Flux", "\\Phi_B = \\int \\cdot \\vec{B} \\cdot d \\cdot \\vec{A}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Magnetic Flux", "\\int = \\frac{\\frac{\\frac{\\Phi_B}{\\vec{A}}}{d}}{\\vec{B}}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\int");
-		this->formulas.emplace_back("Magnetic Flux", "\\vec{A} = \\frac{\\Phi_B}{\\int \\cdot \\vec{B} \\cdot d}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\vec{A}");
-		this->formulas.emplace_back("Magnetic Flux", "\\vec{B} = \\frac{\\frac{\\frac{\\Phi_B}{\\vec{A}}}{d}}{\\int}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Magnetic Flux", "d = \\frac{\\frac{\\Phi_B}{\\vec{A}}}{\\int \\cdot \\vec{B}}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "d");
-		this->formulas.emplace_back("Faraday's Law of Induction", "\\Phi_B = \\frac{-\\varepsilon \\cdot d \\cdot t}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Faraday's Law of Induction", "\\varepsilon = -\\frac{d \\cdot \\Phi_B}{d \\cdot t}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Faraday's Law of Induction", "t = \\frac{\\frac{d \\cdot \\Phi_B}{-\\varepsilon}}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Faraday's Law with N Turns", "N = -\\frac{\\varepsilon}{\\frac{d \\cdot \\Phi_B}{d \\cdot t}}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux through one turn", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law with N Turns", "\\Phi_B = \\frac{\\frac{\\varepsilon}{-N} \\cdot d \\cdot t}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux through one turn", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Faraday's Law with N Turns", "\\varepsilon = -N \\cdot \\frac{d \\cdot \\Phi_B}{d \\cdot t}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux through one turn", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Faraday's Law with N Turns", "t = \\frac{\\frac{d \\cdot \\Phi_B}{\\frac{\\varepsilon}{-N}}}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux through one turn", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Lenz's Law (Induced Current Direction)", "\\Phi_B = \\frac{-\\varepsilon_induced \\cdot d \\cdot t}{d}", std::vector<Variable>{{"\\varepsilon_{induced}", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (negative sign gives direction opposing change)", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Lenz's Law (Induced Current Direction)", "\\varepsilon_induced = -\\frac{d \\cdot \\Phi_B}{d \\cdot t}", std::vector<Variable>{{"\\varepsilon_{induced}", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (negative sign gives direction opposing change)", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\varepsilon_induced");
-		this->formulas.emplace_back("Lenz's Law (Induced Current Direction)", "t = \\frac{\\frac{d \\cdot \\Phi_B}{-\\varepsilon_induced}}{d}", std::vector<Variable>{{"\\varepsilon_{induced}", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (negative sign gives direction opposing change)", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Motional EMF", "B = \\frac{\\frac{\\varepsilon}{v}}{L}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Motional EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor moving through field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false}}, "B");
-		this->formulas.emplace_back("Motional EMF", "L = \\frac{\\frac{\\varepsilon}{v}}{B}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Motional EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor moving through field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false}}, "L");
-		this->formulas.emplace_back("Motional EMF", "\\varepsilon = B \\cdot L \\cdot v", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Motional EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor moving through field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Motional EMF", "v = \\frac{\\varepsilon}{B \\cdot L}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Motional EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor moving through field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false}}, "v");
-		this->formulas.emplace_back("Self-Inductance Definition", "I = \\frac{\\frac{\\varepsilon}{-L} \\cdot d \\cdot t}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (back-EMF)", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Self-inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "I");
-		this->formulas.emplace_back("Self-Inductance Definition", "L = -\\frac{\\varepsilon}{\\frac{d \\cdot I}{d \\cdot t}}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (back-EMF)", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Self-inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "L");
-		this->formulas.emplace_back("Self-Inductance Definition", "\\varepsilon = -L \\cdot \\frac{d \\cdot I}{d \\cdot t}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (back-EMF)", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Self-inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Self-Inductance Definition", "t = \\frac{\\frac{d \\cdot I}{\\frac{\\varepsilon}{-L}}}{d}", std::vector<Variable>{{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (back-EMF)", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Self-inductance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Inductance of a Solenoid", "L = \\mu_0 \\cdot n^{2} \\cdot V_vol", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance of solenoid", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\ell", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density (turns/length)", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of solenoid", false}}, "L");
-		this->formulas.emplace_back("Inductance of a Solenoid", "V_vol = \\frac{L}{\\mu_0 \\cdot n^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance of solenoid", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\ell", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density (turns/length)", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of solenoid", false}}, "V_vol");
-		this->formulas.emplace_back("Inductance of a Solenoid", "\\mu_0 = \\frac{\\frac{L}{V_vol}}{n^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance of solenoid", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\ell", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density (turns/length)", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of solenoid", false}}, "\\mu_0");
-		this->formulas.emplace_back("Inductance of a Solenoid", "n = \\pm \\left(\\frac{\\frac{L}{V_vol}}{\\mu_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance of solenoid", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\ell", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density (turns/length)", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of solenoid", false}}, "n");
-		this->formulas.emplace_back("Mutual Inductance", "I_1 = \\frac{\\frac{\\varepsilon_2}{-M} \\cdot d \\cdot t}{d}", std::vector<Variable>{{"\\varepsilon_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in secondary coil", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in primary coil", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "I_1");
-		this->formulas.emplace_back("Mutual Inductance", "M = -\\frac{\\varepsilon_2}{\\frac{d \\cdot I_1}{d \\cdot t}}", std::vector<Variable>{{"\\varepsilon_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in secondary coil", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in primary coil", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "M");
-		this->formulas.emplace_back("Mutual Inductance", "\\varepsilon_2 = -M \\cdot \\frac{d \\cdot I_1}{d \\cdot t}", std::vector<Variable>{{"\\varepsilon_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in secondary coil", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in primary coil", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\varepsilon_2");
-		this->formulas.emplace_back("Mutual Inductance", "t = \\frac{\\frac{d \\cdot I_1}{\\frac{\\varepsilon_2}{-M}}}{d}", std::vector<Variable>{{"\\varepsilon_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in secondary coil", false},{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in primary coil", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Magnetic Field Inside a Solenoid with Core", "B = \\mu_0 \\cdot \\mu_r \\cdot n \\cdot I", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field Inside a Solenoid with Core", "I = \\frac{B}{\\mu_0 \\cdot \\mu_r \\cdot n}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field Inside a Solenoid with Core", "\\mu_0 = \\frac{\\frac{\\frac{B}{I}}{n}}{\\mu_r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field Inside a Solenoid with Core", "\\mu_r = \\frac{\\frac{\\frac{B}{I}}{n}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu_r");
-		this->formulas.emplace_back("Magnetic Field Inside a Solenoid with Core", "n = \\frac{\\frac{B}{I}}{\\mu_0 \\cdot \\mu_r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "n");
-		this->formulas.emplace_back("Magnetic Energy Density", "B = \\pm \\left(u_B \\cdot 2 \\mu_0\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"u_B", {-1, -2, 1, 0, 0, 0, 0}, "Magnetic energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "B");
-		this->formulas.emplace_back("Magnetic Energy Density", "\\mu_0 = \\frac{\\frac{B^{2}}{u_B}}{2}", std::vector<Variable>{{"u_B", {-1, -2, 1, 0, 0, 0, 0}, "Magnetic energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Energy Density", "u_B = \\frac{B^{2}}{2 \\mu_0}", std::vector<Variable>{{"u_B", {-1, -2, 1, 0, 0, 0, 0}, "Magnetic energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "u_B");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "B = \\frac{\\mu_0 \\cdot I}{4 \\pi \\cdot r} \\cdot \\left(\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)\\right)", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "I = \\frac{\\frac{B}{\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)} \\cdot 4 \\pi \\cdot r}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "\\mu_0 = \\frac{\\frac{B}{\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)} \\cdot 4 \\pi \\cdot r}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I}{\\frac{B}{\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)}}}{r}}{4}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "\\theta_1 = \\arcsin\\left(\\frac{B}{\\frac{\\mu_0 \\cdot I}{4 \\pi \\cdot r}} - \\sin\\left(\\theta_2\\right)\\right)", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "\\theta_1");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "\\theta_2 = \\arcsin\\left(\\frac{B}{\\frac{\\mu_0 \\cdot I}{4 \\pi \\cdot r}} - \\sin\\left(\\theta_1\\right)\\right)", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "\\theta_2");
-		this->formulas.emplace_back("Magnetic Field of a Finite Straight Wire", "r = \\frac{\\frac{\\mu_0 \\cdot I}{\\frac{B}{\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)}}}{4 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false}}, "r");
-		this->formulas.emplace_back("Magnetic Force on a Moving Charge (Vector Form)", "\\vec{B} = \\frac{\\vec{F}}{q \\cdot \\vec{v}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on charge", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Magnetic Force on a Moving Charge (Vector Form)", "\\vec{F} = q \\cdot \\vec{v} \\cdot \\vec{B}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on charge", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{F}");
-		this->formulas.emplace_back("Magnetic Force on a Moving Charge (Vector Form)", "\\vec{v} = \\frac{\\frac{\\vec{F}}{\\vec{B}}}{q}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on charge", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{v}");
-		this->formulas.emplace_back("Magnetic Force on a Moving Charge (Vector Form)", "q = \\frac{\\frac{\\vec{F}}{\\vec{B}}}{\\vec{v}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on charge", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Lorentz Force (Electric + Magnetic)", "\\vec{B} = \\frac{\\frac{\\vec{F}}{q} - \\vec{E}}{\\vec{v}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Lorentz Force (Electric + Magnetic)", "\\vec{E} = \\frac{\\vec{F}}{q} - \\vec{v} \\cdot \\vec{B}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{E}");
-		this->formulas.emplace_back("Lorentz Force (Electric + Magnetic)", "\\vec{F} = q \\cdot \\left(\\vec{E} + \\vec{v} \\cdot \\vec{B}\\right)", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{F}");
-		this->formulas.emplace_back("Lorentz Force (Electric + Magnetic)", "\\vec{v} = \\frac{\\frac{\\vec{F}}{q} - \\vec{E}}{\\vec{B}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{v}");
-		this->formulas.emplace_back("Lorentz Force (Electric + Magnetic)", "q = \\frac{\\vec{F}}{\\vec{E} + \\vec{v} \\cdot \\vec{B}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Angular Frequency", "B = \\frac{\\omega \\cdot m}{q}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron angular frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Angular Frequency", "\\omega = \\frac{q \\cdot B}{m}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron angular frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "\\omega");
-		this->formulas.emplace_back("Cyclotron Angular Frequency", "m = \\frac{q \\cdot B}{\\omega}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron angular frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Angular Frequency", "q = \\frac{\\omega \\cdot m}{B}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron angular frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "q");
-		this->formulas.emplace_back("Magnetic Force on a Current-Carrying Wire (Vector)", "I = \\frac{\\frac{\\vec{F}}{\\vec{B}}}{\\vec{L}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on wire", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in wire", false},{"\\vec{L}", {1, 0, 0, 0, 0, 0, 0}, "Length vector of wire (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on a Current-Carrying Wire (Vector)", "\\vec{B} = \\frac{\\vec{F}}{I \\cdot \\vec{L}}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on wire", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in wire", false},{"\\vec{L}", {1, 0, 0, 0, 0, 0, 0}, "Length vector of wire (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Magnetic Force on a Current-Carrying Wire (Vector)", "\\vec{F} = I \\cdot \\vec{L} \\cdot \\vec{B}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on wire", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in wire", false},{"\\vec{L}", {1, 0, 0, 0, 0, 0, 0}, "Length vector of wire (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{F}");
-		this->formulas.emplace_back("Magnetic Force on a Current-Carrying Wire (Vector)", "\\vec{L} = \\frac{\\frac{\\vec{F}}{\\vec{B}}}{I}", std::vector<Variable>{{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on wire", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in wire", false},{"\\vec{L}", {1, 0, 0, 0, 0, 0, 0}, "Length vector of wire (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{L}");
-    }
-} // namespace Physics
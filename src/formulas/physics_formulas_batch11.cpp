@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_11() {
-		this->formulas.emplace_back("Magnetic Dipole Moment", "A = \\frac{\\mu}{N \\cdot I}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns in loop", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "A");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "I = \\frac{\\frac{\\mu}{A}}{N}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns in loop", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "I");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "N = \\frac{\\frac{\\mu}{A}}{I}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns in loop", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "N");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "\\mu = N \\cdot I \\cdot A", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns in loop", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "\\mu");
-		this->formulas.emplace_back("Torque on a Magnetic Dipole (Vector)", "\\vec{B} = \\frac{\\vec{\\tau}}{\\vec{\\mu}}", std::vector<Variable>{{"\\vec{\\tau}", {2, -2, 1, 0, 0, 0, 0}, "Torque on magnetic dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Torque on a Magnetic Dipole (Vector)", "\\vec{\\mu} = \\frac{\\vec{\\tau}}{\\vec{B}}", std::vector<Variable>{{"\\vec{\\tau}", {2, -2, 1, 0, 0, 0, 0}, "Torque on magnetic dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{\\mu}");
-		this->formulas.emplace_back("Torque on a Magnetic Dipole (Vector)", "\\vec{\\tau} = \\vec{\\mu} \\cdot \\vec{B}", std::vector<Variable>{{"\\vec{\\tau}", {2, -2, 1, 0, 0, 0, 0}, "Torque on magnetic dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{\\tau}");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "A = \\frac{\\frac{\\frac{\\tau}{\\sin\\left(\\theta\\right)}}{B}}{N \\cdot I}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "A");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "B = \\frac{\\frac{\\tau}{\\sin\\left(\\theta\\right)}}{N \\cdot I \\cdot A}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "B");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "I = \\frac{\\frac{\\frac{\\frac{\\tau}{\\sin\\left(\\theta\\right)}}{B}}{A}}{N}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "I");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "N = \\frac{\\frac{\\frac{\\frac{\\tau}{\\sin\\left(\\theta\\right)}}{B}}{A}}{I}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "N");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "\\tau = N \\cdot I \\cdot A \\cdot B \\cdot \\sin\\left(\\theta\\right)", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "\\tau");
-		this->formulas.emplace_back("Torque on a Current Loop (Scalar)", "\\theta = \\arcsin\\left(\\frac{\\tau}{N \\cdot I \\cdot A \\cdot B}\\right)", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false}}, "\\theta");
-		this->formulas.emplace_back("Potential Energy of Magnetic Dipole in Field", "U = -\\vec{\\mu} \\cdot \\vec{B}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between μ and B", false}}, "U");
-		this->formulas.emplace_back("Potential Energy of Magnetic Dipole in Field", "\\vec{B} = \\frac{U}{-\\vec{\\mu}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between μ and B", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Potential Energy of Magnetic Dipole in Field", "\\vec{\\mu} = -\\frac{U}{\\vec{B}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between μ and B", false}}, "\\vec{\\mu}");
-		this->formulas.emplace_back("Hall Voltage", "B = \\frac{V_H \\cdot n \\cdot q \\cdot t}{I}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "B");
-		this->formulas.emplace_back("Hall Voltage", "I = \\frac{V_H \\cdot n \\cdot q \\cdot t}{B}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "I");
-		this->formulas.emplace_back("Hall Voltage", "V_H = \\frac{I \\cdot B}{n \\cdot q \\cdot t}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "V_H");
-		this->formulas.emplace_back("Hall Voltage", "n = \\frac{\\frac{\\frac{I \\cdot B}{V_H}}{t}}{q}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "n");
-		this->formulas.emplace_back("Hall Voltage", "q = \\frac{\\frac{\\frac{I \\cdot B}{V_H}}{t}}{n}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "q");
-		this->formulas.emplace_back("Hall Voltage", "t = \\frac{\\frac{I \\cdot B}{V_H}}{n \\cdot q}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false}}, "t");
-		this->formulas.emplace_back("Pitch of Helical Motion in Magnetic Field", "T = \\frac{p}{v_\\parallel}", std::vector<Variable>{{"p", {1, 0, 0, 0, 0, 0, 0}, "Pitch of helix (distance along B per revolution)", false},{"v_{\\parallel}", {1, -1, 0, 0, 0, 0, 0}, "Velocity component parallel to B", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false}}, "T");
-		this->formulas.emplace_back("Pitch of Helical Motion in Magnetic Field", "p = v_\\parallel \\cdot T", std::vector<Variable>{{"p", {1, 0, 0, 0, 0, 0, 0}, "Pitch of helix (distance along B per revolution)", false},{"v_{\\parallel}", {1, -1, 0, 0, 0, 0, 0}, "Velocity component parallel to B", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false}}, "p");
-		this->formulas.emplace_back("Pitch of Helical Motion in Magnetic Field", "v_\\parallel = \\frac{p}{T}", std::vector<Variable>{{"p", {1, 0, 0, 0, 0, 0, 0}, "Pitch of helix (distance along B per revolution)", false},{"v_{\\parallel}", {1, -1, 0, 0, 0, 0, 0}, "Velocity component parallel to B", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false}}, "v_\\parallel");
-		this->formulas.emplace_back("Magnetic Force on a Differential Current Element", "I = \\frac{\\frac{\\frac{d \\cdot \\vec{F}}{\\vec{B}}}{\\vec{l}}}{d}", std::vector<Variable>{{"d\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Differential magnetic force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on a Differential Current Element", "\\vec{B} = \\frac{d \\cdot \\vec{F}}{I \\cdot d \\cdot \\vec{l}}", std::vector<Variable>{{"d\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Differential magnetic force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{B}");
-		this->formulas.emplace_back("Magnetic Force on a Differential Current Element", "\\vec{F} = \\frac{I \\cdot d \\cdot \\vec{l} \\cdot \\vec{B}}{d}", std::vector<Variable>{{"d\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Differential magnetic force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{F}");
-		this->formulas.emplace_back("Magnetic Force on a Differential Current Element", "\\vec{l} = \\frac{\\frac{d \\cdot \\vec{F}}{\\vec{B}}}{I \\cdot d}", std::vector<Variable>{{"d\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Differential magnetic force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element (in current direction)", false},{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\vec{l}");
-		this->formulas.emplace_back("Kinetic Energy of Particle in Cyclotron", "B = \\pm \\left(\\frac{\\frac{K \\cdot 2 m}{r^{2}}}{q^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "B");
-		this->formulas.emplace_back("Kinetic Energy of Particle in Cyclotron", "K = \\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{2 m}", std::vector<Variable>{{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "K");
-		this->formulas.emplace_back("Kinetic Energy of Particle in Cyclotron", "m = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{K}}{2}", std::vector<Variable>{{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "m");
-		this->formulas.emplace_back("Kinetic Energy of Particle in Cyclotron", "q = \\pm \\left(\\frac{\\frac{K \\cdot 2 m}{r^{2}}}{B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "q");
-		this->formulas.emplace_back("Kinetic Energy of Particle in Cyclotron", "r = \\pm \\left(\\frac{K \\cdot 2 m}{q^{2} \\cdot B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false}}, "r");
-		this->formulas.emplace_back("Magnetic Flux Through a Loop", "A = \\frac{\\frac{\\Phi_B}{\\cos\\left(\\theta\\right)}}{N \\cdot B}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "A");
-		this->formulas.emplace_back("Magnetic Flux Through a Loop", "B = \\frac{\\frac{\\frac{\\Phi_B}{\\cos\\left(\\theta\\right)}}{A}}{N}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "B");
-		this->formulas.emplace_back("Magnetic Flux Through a Loop", "N = \\frac{\\frac{\\frac{\\Phi_B}{\\cos\\left(\\theta\\right)}}{A}}{B}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "N");
-		this->formulas.emplace_back("Magnetic Flux Through a Loop", "\\Phi_B = N \\cdot B \\cdot A \\cdot \\cos\\left(\\theta\\right)", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Magnetic Flux Through a Loop", "\\theta = \\arccos\\left(\\frac{\\Phi_B}{N \\cdot B \\cdot A}\\right)", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false}}, "\\theta");
-		this->formulas.emplace_back("Electric Field in a Moving Conductor (Motional EMF per Length)", "B = \\frac{\\frac{\\frac{\\varepsilon}{L}}{\\sin\\left(\\theta\\right)}}{v}", std::vector<Variable>{{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false}}, "B");
-		this->formulas.emplace_back("Electric Field in a Moving Conductor (Motional EMF per Length)", "L = \\frac{\\varepsilon}{v \\cdot B \\cdot \\sin\\left(\\theta\\right)}", std::vector<Variable>{{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false}}, "L");
-		this->formulas.emplace_back("Electric Field in a Moving Conductor (Motional EMF per Length)", "\\theta = \\arcsin\\left(\\frac{\\frac{\\varepsilon}{L}}{v \\cdot B}\\right)", std::vector<Variable>{{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false}}, "\\theta");
-		this->formulas.emplace_back("Electric Field in a Moving Conductor (Motional EMF per Length)", "\\varepsilon = v \\cdot B \\cdot \\sin\\left(\\theta\\right) \\cdot L", std::vector<Variable>{{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Electric Field in a Moving Conductor (Motional EMF per Length)", "v = \\frac{\\frac{\\frac{\\varepsilon}{L}}{\\sin\\left(\\theta\\right)}}{B}", std::vector<Variable>{{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false}}, "v");
-		this->formulas.emplace_back("Force on a Magnetic Dipole in Non-Uniform Field", "B = \\frac{\\frac{F}{\\mu} \\cdot d \\cdot z}{d}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force on magnetic dipole", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment magnitude", false},{"dB/dz", {-1, -2, 1, -1, 0, 0, 0}, "Gradient of magnetic field along z-axis", false}}, "B");
-		this->formulas.emplace_back("Force on a Magnetic Dipole in Non-Uniform Field", "F = \\mu \\cdot \\frac{d \\cdot B}{d \\cdot z}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force on magnetic dipole", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment magnitude", false},{"dB/dz", {-1, -2, 1, -1, 0, 0, 0}, "Gradient of magnetic field along z-axis", false}}, "F");
-		this->formulas.emplace_back("Force on a Magnetic Dipole in Non-Uniform Field", "\\mu = \\frac{F}{\\frac{d \\cdot B}{d \\cdot z}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force on magnetic dipole", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment magnitude", false},{"dB/dz", {-1, -2, 1, -1, 0, 0, 0}, "Gradient of magnetic field along z-axis", false}}, "\\mu");
-		this->formulas.emplace_back("Force on a Magnetic Dipole in Non-Uniform Field", "z = \\frac{\\frac{d \\cdot B}{\\frac{F}{\\mu}}}{d}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force on magnetic dipole", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment magnitude", false},{"dB/dz", {-1, -2, 1, -1, 0, 0, 0}, "Gradient of magnetic field along z-axis", false}}, "z");
-		this->formulas.emplace_back("EMF Definition (Work per Charge)", "E = \\frac{d \\cdot W}{d \\cdot q}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"dW", {2, -2, 1, 0, 0, 0, 0}, "Differential work done on charge", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge moved", false}}, "E");
-		this->formulas.emplace_back("EMF Definition (Work per Charge)", "W = \\frac{E \\cdot d \\cdot q}{d}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"dW", {2, -2, 1, 0, 0, 0, 0}, "Differential work done on charge", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge moved", false}}, "W");
-		this->formulas.emplace_back("EMF Definition (Work per Charge)", "q = \\frac{\\frac{d \\cdot W}{E}}{d}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"dW", {2, -2, 1, 0, 0, 0, 0}, "Differential work done on charge", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge moved", false}}, "q");
-		this->formulas.emplace_back("Work Done by EMF Source on Charge", "E = \\frac{W_n}{q}", std::vector<Variable>{{"W_n", {2, -2, 1, 0, 0, 0, 0}, "Work done by EMF source on charge q", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge moved through EMF source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false}}, "E");
-		this->formulas.emplace_back("Work Done by EMF Source on Charge", "W_n = q \\cdot E", std::vector<Variable>{{"W_n", {2, -2, 1, 0, 0, 0, 0}, "Work done by EMF source on charge q", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge moved through EMF source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false}}, "W_n");
-		this->formulas.emplace_back("Work Done by EMF Source on Charge", "q = \\frac{W_n}{E}", std::vector<Variable>{{"W_n", {2, -2, 1, 0, 0, 0, 0}, "Work done by EMF source on charge q", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge moved through EMF source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false}}, "q");
-		this->formulas.emplace_back("Terminal Voltage of Ideal EMF Source", "E = V_ab", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of ideal source (no internal resistance)", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false}}, "E");
-		this->formulas.emplace_back("Terminal Voltage of Ideal EMF Source", "V_ab = E", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of ideal source (no internal resistance)", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false}}, "V_ab");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Discharging)", "E = V_ab + I \\cdot r", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "E");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Discharging)", "I = \\frac{E - V_ab}{r}", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "I");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Discharging)", "V_ab = E - I \\cdot r", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "V_ab");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Discharging)", "r = \\frac{E - V_ab}{I}", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "r");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Charging)", "E = V_ab - I \\cdot r", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage when source is being charged", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current driven into source (charging current)", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "E");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Charging)", "I = \\frac{V_ab - E}{r}", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage when source is being charged", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current driven into source (charging current)", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "I");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Charging)", "V_ab = E + I \\cdot r", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage when source is being charged", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current driven into source (charging current)", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "V_ab");
-		this->formulas.emplace_back("Terminal Voltage with Internal Resistance (Charging)", "r = \\frac{V_ab - E}{I}", std::vector<Variable>{{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage when source is being charged", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current driven into source (charging current)", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "r");
-		this->formulas.emplace_back("KVL with EMF and Internal Resistance", "E = I \\cdot R + I \\cdot r", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false}}, "E");
-		this->formulas.emplace_back("KVL with EMF and Internal Resistance", "I = -\\frac{E}{-r - R}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false}}, "I");
-		this->formulas.emplace_back("KVL with EMF and Internal Resistance", "R = \\frac{E - I \\cdot r}{I}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false}}, "R");
-		this->formulas.emplace_back("KVL with EMF and Internal Resistance", "r = \\frac{E - I \\cdot R}{I}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false}}, "r");
-		this->formulas.emplace_back("Current in a Simple EMF Circuit", "E = I \\cdot \\left(R + r\\right)", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "E");
-		this->formulas.emplace_back("Current in a Simple EMF Circuit", "I = \\frac{E}{R + r}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("Current in a Simple EMF Circuit", "R = \\frac{E}{I} - r", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "R");
-		this->formulas.emplace_back("Current in a Simple EMF Circuit", "r = \\frac{E}{I} - R", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Differential Charge from Current", "I = \\frac{\\frac{d \\cdot q}{t}}{d}", std::vector<Variable>{{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time interval", false}}, "I");
-		this->formulas.emplace_back("Differential Charge from Current", "q = \\frac{I \\cdot d \\cdot t}{d}", std::vector<Variable>{{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time interval", false}}, "q");
-		this->formulas.emplace_back("Differential Charge from Current", "t = \\frac{d \\cdot q}{I \\cdot d}", std::vector<Variable>{{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time interval", false}}, "t");
-		this->formulas.emplace_back("Change in Potential Energy of Charge Through Potential Drop", "U = \\frac{d \\cdot q \\cdot V_ab}{d}", std::vector<Variable>{{"dU", {2, -2, 1, 0, 0, 0, 0}, "Change in electric potential energy", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time", false}}, "U");
-		this->formulas.emplace_back("Change in Potential Energy of Charge Through Potential Drop", "V_ab = \\frac{d \\cdot U}{d \\cdot q}", std::vector<Variable>{{"dU", {2, -2, 1, 0, 0, 0, 0}, "Change in electric potential energy", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time", false}}, "V_ab");
-		this->formulas.emplace_back("Change in Potential Energy of Charge Through Potential Drop", "q = \\frac{\\frac{d \\cdot U}{V_ab}}{d}", std::vector<Variable>{{"dU", {2, -2, 1, 0, 0, 0, 0}, "Change in electric potential energy", false},{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time", false}}, "q");
-		this->formulas.emplace_back("Power Output of EMF Source (Net to External Circuit)", "E = \\frac{P_out + I^{2} \\cdot r}{I}", std::vector<Variable>{{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Net power delivered to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "E");
-		this->formulas.emplace_back("Power Output of EMF Source (Net to External Circuit)", "I = \\frac{E}{2 r} \\pm \\frac{\\left(E^{2} - 4 \\cdot r \\cdot P_out\\right)^{\\frac{1}{2}}}{2 r}", std::vector<Variable>{{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Net power delivered to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("Power Output of EMF Source (Net to External Circuit)", "P_out = E \\cdot I - I^{2} \\cdot r", std::vector<Variable>{{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Net power delivered to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "P_out");
-		this->formulas.emplace_back("Power Output of EMF Source (Net to External Circuit)", "r = \\frac{E \\cdot I - P_out}{I^{2}}", std::vector<Variable>{{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Net power delivered to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Power Dissipated in Internal Resistance", "I = \\pm \\left(\\frac{P_r}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"P_r", {2, -3, 1, 0, 0, 0, 0}, "Power lost as heat inside source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("Power Dissipated in Internal Resistance", "P_r = I^{2} \\cdot r", std::vector<Variable>{{"P_r", {2, -3, 1, 0, 0, 0, 0}, "Power lost as heat inside source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "P_r");
-		this->formulas.emplace_back("Power Dissipated in Internal Resistance", "r = \\frac{P_r}{I^{2}}", std::vector<Variable>{{"P_r", {2, -3, 1, 0, 0, 0, 0}, "Power lost as heat inside source", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Power Input to EMF Source Being Charged", "E = \\frac{P_in - I^{2} \\cdot r}{I}", std::vector<Variable>{{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Total electrical power input when charging source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source being charged", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Charging current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "E");
-		this->formulas.emplace_back("Power Input to EMF Source Being Charged", "I = \\frac{-E}{2 r} \\pm \\frac{\\left(E^{2} - 4 \\cdot r \\cdot -P_in\\right)^{\\frac{1}{2}}}{2 r}", std::vector<Variable>{{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Total electrical power input when charging source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source being charged", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Charging current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("Power Input to EMF Source Being Charged", "P_in = E \\cdot I + I^{2} \\cdot r", std::vector<Variable>{{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Total electrical power input when charging source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source being charged", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Charging current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "P_in");
-		this->formulas.emplace_back("Power Input to EMF Source Being Charged", "r = \\frac{P_in - E \\cdot I}{I^{2}}", std::vector<Variable>{{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Total electrical power input when charging source", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source being charged", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Charging current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Power Output from Terminal Voltage", "I = \\frac{P}{V_ab}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered to load", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Power Output from Terminal Voltage", "P = V_ab \\cdot I", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered to load", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "P");
-		this->formulas.emplace_back("Power Output from Terminal Voltage", "V_ab = \\frac{P}{I}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered to load", false},{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "V_ab");
-		this->formulas.emplace_back("Efficiency of EMF Source", "P_out = \\eta \\cdot P_total", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency of source (dimensionless)", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "P_out");
-		this->formulas.emplace_back("Efficiency of EMF Source", "P_total = \\frac{P_out}{\\eta}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency of source (dimensionless)", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "P_total");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_12() {
-		this->formulas.emplace_back("Efficiency of EMF Source", "\\eta = \\frac{P_out}{P_total}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency of source (dimensionless)", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power to external circuit", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "\\eta");
-		this->formulas.emplace_back("Maximum Power Transfer Condition", "R_load = r", std::vector<Variable>{{"R_{load}", {2, -3, 1, -2, 0, 0, 0}, "External load resistance for maximum power transfer", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "R_load");
-		this->formulas.emplace_back("Maximum Power Transfer Condition", "r = R_load", std::vector<Variable>{{"R_{load}", {2, -3, 1, -2, 0, 0, 0}, "External load resistance for maximum power transfer", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "r");
-		this->formulas.emplace_back("Maximum Power Delivered to External Load", "E = \\pm \\left(P_max \\cdot 4 r\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power deliverable to external load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "E");
-		this->formulas.emplace_back("Maximum Power Delivered to External Load", "P_max = \\frac{E^{2}}{4 r}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power deliverable to external load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "P_max");
-		this->formulas.emplace_back("Maximum Power Delivered to External Load", "r = \\frac{\\frac{E^{2}}{P_max}}{4}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power deliverable to external load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false}}, "r");
-		this->formulas.emplace_back("Drude Model: Electron Acceleration in E Field", "E = \\frac{a \\cdot m}{q}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration of electron in electric field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "E");
-		this->formulas.emplace_back("Drude Model: Electron Acceleration in E Field", "a = \\frac{q \\cdot E}{m}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration of electron in electric field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "a");
-		this->formulas.emplace_back("Drude Model: Electron Acceleration in E Field", "m = \\frac{q \\cdot E}{a}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration of electron in electric field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "m");
-		this->formulas.emplace_back("Drude Model: Electron Acceleration in E Field", "q = \\frac{a \\cdot m}{E}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration of electron in electric field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "q");
-		this->formulas.emplace_back("Drift Velocity from Mean Free Time", "E = \\frac{v_d}{\\frac{q \\cdot \\tau}{m}}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Drift Velocity from Mean Free Time", "\\tau = \\frac{\\frac{v_d}{E} \\cdot m}{q}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\tau");
-		this->formulas.emplace_back("Drift Velocity from Mean Free Time", "m = \\frac{q \\cdot \\tau}{\\frac{v_d}{E}}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "m");
-		this->formulas.emplace_back("Drift Velocity from Mean Free Time", "q = \\frac{\\frac{v_d}{E} \\cdot m}{\\tau}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "q");
-		this->formulas.emplace_back("Drift Velocity from Mean Free Time", "v_d = \\frac{q \\cdot \\tau}{m} \\cdot E", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "v_d");
-		this->formulas.emplace_back("Current Density from Drude Model", "E = \\frac{J}{\\frac{n \\cdot q^{2} \\cdot \\tau}{m}}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Current Density from Drude Model", "J = \\frac{n \\cdot q^{2} \\cdot \\tau}{m} \\cdot E", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "J");
-		this->formulas.emplace_back("Current Density from Drude Model", "\\tau = \\frac{\\frac{J}{E} \\cdot m}{n \\cdot q^{2}}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\tau");
-		this->formulas.emplace_back("Current Density from Drude Model", "m = \\frac{n \\cdot q^{2} \\cdot \\tau}{\\frac{J}{E}}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "m");
-		this->formulas.emplace_back("Current Density from Drude Model", "n = \\frac{\\frac{\\frac{J}{E} \\cdot m}{\\tau}}{q^{2}}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "n");
-		this->formulas.emplace_back("Current Density from Drude Model", "q = \\pm \\left(\\frac{\\frac{\\frac{J}{E} \\cdot m}{\\tau}}{n}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "q");
-		this->formulas.emplace_back("Resistivity from Drude Model", "\\rho = \\frac{m}{n \\cdot e^{2} \\cdot \\tau}", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false}}, "\\rho");
-		this->formulas.emplace_back("Resistivity from Drude Model", "\\tau = \\frac{\\frac{m}{\\rho}}{n \\cdot e^{2}}", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false}}, "\\tau");
-		this->formulas.emplace_back("Resistivity from Drude Model", "e = \\pm \\left(\\frac{\\frac{\\frac{m}{\\rho}}{\\tau}}{n}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false}}, "e");
-		this->formulas.emplace_back("Resistivity from Drude Model", "m = \\rho \\cdot n \\cdot e^{2} \\cdot \\tau", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false}}, "m");
-		this->formulas.emplace_back("Resistivity from Drude Model", "n = \\frac{\\frac{\\frac{m}{\\rho}}{\\tau}}{e^{2}}", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false}}, "n");
-		this->formulas.emplace_back("Conductivity from Drude Model", "\\sigma = \\frac{n \\cdot e^{2} \\cdot \\tau}{m}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "\\sigma");
-		this->formulas.emplace_back("Conductivity from Drude Model", "\\tau = \\frac{\\sigma \\cdot m}{n \\cdot e^{2}}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "\\tau");
-		this->formulas.emplace_back("Conductivity from Drude Model", "e = \\pm \\left(\\frac{\\frac{\\sigma \\cdot m}{\\tau}}{n}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "e");
-		this->formulas.emplace_back("Conductivity from Drude Model", "m = \\frac{n \\cdot e^{2} \\cdot \\tau}{\\sigma}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "m");
-		this->formulas.emplace_back("Conductivity from Drude Model", "n = \\frac{\\frac{\\sigma \\cdot m}{\\tau}}{e^{2}}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false}}, "n");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "E = \\frac{\\frac{v \\cdot t - v_0}{\\tau} \\cdot m}{q}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "E");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "\\tau = \\frac{v \\cdot t - v_0}{\\frac{q \\cdot E}{m}}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "\\tau");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "m = \\frac{q \\cdot E}{\\frac{v \\cdot t - v_0}{\\tau}}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "m");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "q = \\frac{\\frac{v \\cdot t - v_0}{\\tau} \\cdot m}{E}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "q");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "t = \\frac{v_0 + \\frac{q \\cdot E}{m} \\cdot \\tau}{v}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "t");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "v = \\frac{v_0 + \\frac{q \\cdot E}{m} \\cdot \\tau}{t}", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "v");
-		this->formulas.emplace_back("Electron Velocity at Time t After Collision (Drude)", "v_0 = v \\cdot t - \\frac{q \\cdot E}{m} \\cdot \\tau", std::vector<Variable>{{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false}}, "v_0");
-		this->formulas.emplace_back("Mean Free Path", "\\lambda = v_F \\cdot \\tau", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Mean free path of electrons", false},{"v_F", {1, -1, 0, 0, 0, 0, 0}, "Fermi velocity (average thermal speed of electrons)", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false}}, "\\lambda");
-		this->formulas.emplace_back("Mean Free Path", "\\tau = \\frac{\\lambda}{v_F}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Mean free path of electrons", false},{"v_F", {1, -1, 0, 0, 0, 0, 0}, "Fermi velocity (average thermal speed of electrons)", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false}}, "\\tau");
-		this->formulas.emplace_back("Mean Free Path", "v_F = \\frac{\\lambda}{\\tau}", std::vector<Variable>{{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Mean free path of electrons", false},{"v_F", {1, -1, 0, 0, 0, 0, 0}, "Fermi velocity (average thermal speed of electrons)", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false}}, "v_F");
-		this->formulas.emplace_back("Mobility of Charge Carriers", "\\mu_e = \\frac{q \\cdot \\tau}{m}", std::vector<Variable>{{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Electron mobility", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\mu_e");
-		this->formulas.emplace_back("Mobility of Charge Carriers", "\\tau = \\frac{\\mu_e \\cdot m}{q}", std::vector<Variable>{{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Electron mobility", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\tau");
-		this->formulas.emplace_back("Mobility of Charge Carriers", "m = \\frac{q \\cdot \\tau}{\\mu_e}", std::vector<Variable>{{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Electron mobility", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "m");
-		this->formulas.emplace_back("Mobility of Charge Carriers", "q = \\frac{\\mu_e \\cdot m}{\\tau}", std::vector<Variable>{{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Electron mobility", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "q");
-		this->formulas.emplace_back("Conductivity from Mobility", "\\mu_e = \\frac{\\sigma}{n \\cdot q}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Carrier mobility", false}}, "\\mu_e");
-		this->formulas.emplace_back("Conductivity from Mobility", "\\sigma = n \\cdot q \\cdot \\mu_e", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Carrier mobility", false}}, "\\sigma");
-		this->formulas.emplace_back("Conductivity from Mobility", "n = \\frac{\\frac{\\sigma}{\\mu_e}}{q}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Carrier mobility", false}}, "n");
-		this->formulas.emplace_back("Conductivity from Mobility", "q = \\frac{\\frac{\\sigma}{\\mu_e}}{n}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Carrier mobility", false}}, "q");
-		this->formulas.emplace_back("Potential Drop Across Internal Resistance", "I = -\\frac{\\Delta V_r}{r}", std::vector<Variable>{{"\\Delta V_r", {2, -3, 1, -1, 0, 0, 0}, "Potential drop across internal resistance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("Potential Drop Across Internal Resistance", "\\Delta V_r = -I \\cdot r", std::vector<Variable>{{"\\Delta V_r", {2, -3, 1, -1, 0, 0, 0}, "Potential drop across internal resistance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "\\Delta V_r");
-		this->formulas.emplace_back("Potential Drop Across Internal Resistance", "r = \\frac{\\Delta V_r}{-I}", std::vector<Variable>{{"\\Delta V_r", {2, -3, 1, -1, 0, 0, 0}, "Potential drop across internal resistance", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Net Change in Potential Around a Loop (KVL)", "\\Delta U_net = \\sum \\cdot \\Delta V", std::vector<Variable>{{"\\Delta U_{net}", {2, -2, 1, 0, 0, 0, 0}, "Net change in potential energy around a closed loop", false},{"\\Delta V", {2, -3, 1, -1, 0, 0, 0}, "Potential change across each element", false}}, "\\Delta U_net");
-		this->formulas.emplace_back("Net Change in Potential Around a Loop (KVL)", "\\Delta V = \\frac{\\Delta U_net}{\\sum}", std::vector<Variable>{{"\\Delta U_{net}", {2, -2, 1, 0, 0, 0, 0}, "Net change in potential energy around a closed loop", false},{"\\Delta V", {2, -3, 1, -1, 0, 0, 0}, "Potential change across each element", false}}, "\\Delta V");
-		this->formulas.emplace_back("Net Change in Potential Around a Loop (KVL)", "\\sum = \\frac{\\Delta U_net}{\\Delta V}", std::vector<Variable>{{"\\Delta U_{net}", {2, -2, 1, 0, 0, 0, 0}, "Net change in potential energy around a closed loop", false},{"\\Delta V", {2, -3, 1, -1, 0, 0, 0}, "Potential change across each element", false}}, "\\sum");
-		this->formulas.emplace_back("EMFs in Series (Aiding)", "E_1 = E_total - E_2", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total EMF of series combination", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "EMF of first source", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "EMF of second source", false}}, "E_1");
-		this->formulas.emplace_back("EMFs in Series (Aiding)", "E_2 = E_total - E_1", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total EMF of series combination", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "EMF of first source", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "EMF of second source", false}}, "E_2");
-		this->formulas.emplace_back("EMFs in Series (Aiding)", "E_total = E_1 + E_2", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total EMF of series combination", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "EMF of first source", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "EMF of second source", false}}, "E_total");
-		this->formulas.emplace_back("EMFs in Series (Opposing)", "E_1 = E_total + E_2", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Net EMF when sources oppose each other", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "Larger EMF", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Smaller opposing EMF", false}}, "E_1");
-		this->formulas.emplace_back("EMFs in Series (Opposing)", "E_2 = E_1 - E_total", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Net EMF when sources oppose each other", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "Larger EMF", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Smaller opposing EMF", false}}, "E_2");
-		this->formulas.emplace_back("EMFs in Series (Opposing)", "E_total = E_1 - E_2", std::vector<Variable>{{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Net EMF when sources oppose each other", false},{"E_1", {2, -3, 1, -1, 0, 0, 0}, "Larger EMF", false},{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Smaller opposing EMF", false}}, "E_total");
-		this->formulas.emplace_back("Total Internal Resistance of Batteries in Series", "\\cdots = r_total - \\left(r_1 + r_2\\right)", std::vector<Variable>{{"r_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total internal resistance", false},{"r_1", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 1", false},{"r_2", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 2", false}}, "\\cdots");
-		this->formulas.emplace_back("Total Internal Resistance of Batteries in Series", "r_1 = r_total - \\cdots - r_2", std::vector<Variable>{{"r_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total internal resistance", false},{"r_1", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 1", false},{"r_2", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 2", false}}, "r_1");
-		this->formulas.emplace_back("Total Internal Resistance of Batteries in Series", "r_2 = r_total - \\cdots - r_1", std::vector<Variable>{{"r_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total internal resistance", false},{"r_1", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 1", false},{"r_2", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 2", false}}, "r_2");
-		this->formulas.emplace_back("Total Internal Resistance of Batteries in Series", "r_total = r_1 + r_2 + \\cdots", std::vector<Variable>{{"r_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total internal resistance", false},{"r_1", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 1", false},{"r_2", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 2", false}}, "r_total");
-		this->formulas.emplace_back("pH and pOH Relationship", "H = -\\frac{-14}{\\text \\cdot p + \\text \\cdot p \\cdot O}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "H");
-		this->formulas.emplace_back("pH and pOH Relationship", "O = \\frac{\\frac{\\frac{14 - \\text \\cdot p \\cdot H}{\\text}}{H}}{p}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "O");
-		this->formulas.emplace_back("pH and pOH Relationship", "\\text = -\\frac{-14}{p \\cdot H + p \\cdot O \\cdot H}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "\\text");
-		this->formulas.emplace_back("pH and pOH Relationship", "p = -\\frac{-14}{\\text \\cdot H + \\text \\cdot H \\cdot O}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "p");
-		this->formulas.emplace_back("pH and pOH Relationship", "H = -\\frac{-14}{\\text \\cdot p \\cdot O + \\text \\cdot p}", std::vector<Variable>{{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false}}, "H");
-		this->formulas.emplace_back("pH and pOH Relationship", "\\text = -\\frac{-14}{p \\cdot O \\cdot H + p \\cdot H}", std::vector<Variable>{{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false}}, "\\text");
-		this->formulas.emplace_back("pH and pOH Relationship", "p = -\\frac{-14}{\\text \\cdot H \\cdot O + \\text \\cdot H}", std::vector<Variable>{{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false}}, "p");
-		this->formulas.emplace_back("pKa", "K = 0", std::vector<Variable>{{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false}}, "K");
-		this->formulas.emplace_back("pKa", "\\text = 0", std::vector<Variable>{{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false}}, "\\text");
-		this->formulas.emplace_back("pKa", "p = 0", std::vector<Variable>{{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false}}, "p");
-		this->formulas.emplace_back("pKa", "K = \\frac{\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{-\\text}}{p}", std::vector<Variable>{{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false}}, "K");
-		this->formulas.emplace_back("pKa", "K_a = 10^{-\\text \\cdot p \\cdot K}", std::vector<Variable>{{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false}}, "K_a");
-		this->formulas.emplace_back("pKa", "\\text = -\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{p \\cdot K}", std::vector<Variable>{{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false}}, "\\text");
-		this->formulas.emplace_back("pKa", "p = \\frac{\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{-\\text}}{K}", std::vector<Variable>{{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false}}, "p");
-		this->formulas.emplace_back("pKb", "K = \\frac{\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{-\\text}}{p}", std::vector<Variable>{{"K_b", {0, 0, 0, 0, 0, 0, 0}, "Base dissociation constant", false},{"\\\\text{pK}_b", {0, 0, 0, 0, 0, 0, 0}, "pKb", false}}, "K");
-		this->formulas.emplace_back("pKb", "K_b = 10^{-\\text \\cdot p \\cdot K}", std::vector<Variable>{{"K_b", {0, 0, 0, 0, 0, 0, 0}, "Base dissociation constant", false},{"\\\\text{pK}_b", {0, 0, 0, 0, 0, 0, 0}, "pKb", false}}, "K_b");
-		this->formulas.emplace_back("pKb", "\\text = -\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{p \\cdot K}", std::vector<Variable>{{"K_b", {0, 0, 0, 0, 0, 0, 0}, "Base dissociation constant", false},{"\\\\text{pK}_b", {0, 0, 0, 0, 0, 0, 0}, "pKb", false}}, "\\text");
-		this->formulas.emplace_back("pKb", "p = \\frac{\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{-\\text}}{K}", std::vector<Variable>{{"K_b", {0, 0, 0, 0, 0, 0, 0}, "Base dissociation constant", false},{"\\\\text{pK}_b", {0, 0, 0, 0, 0, 0, 0}, "pKb", false}}, "p");
-		this->formulas.emplace_back("Henderson-Hasselbalch", "H = \\frac{\\frac{\\text \\cdot p \\cdot K}{\\text}}{p}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},{"[A^-]", {-3, 0, 0, 0, 0, 1, 0}, "Conjugate base concentration", false},{"[HA]", {-3, 0, 0, 0, 0, 1, 0}, "Weak acid concentration", false}}, "H");
-		this->formulas.emplace_back("Henderson-Hasselbalch", "K = \\frac{\\frac{\\text \\cdot p \\cdot H}{\\text}}{p}", std::vector<Variable>{{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},{"[A^-]", {-3, 0, 0, 0, 0, 1, 0}, "Conjugate base concentration", false},{"[HA]", {-3, 0, 0, 0, 0, 1, 0}, "Weak acid concentration", false}}, "K");
-		this->formulas.emplace_back("Ideal Gas Law", "R = \\frac{\\frac{V \\cdot P}{T}}{n}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false}}, "R");
-		this->formulas.emplace_back("Ideal Gas Law", "T = \\frac{V \\cdot P}{n \\cdot R}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false}}, "T");
-		this->formulas.emplace_back("Ideal Gas Law", "n = \\frac{\\frac{V \\cdot P}{T}}{R}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false}}, "n");
-		this->formulas.emplace_back("Ideal Gas Law", "R = \\frac{\\frac{P \\cdot V}{n}}{T}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "R");
-		this->formulas.emplace_back("Ideal Gas Law", "T = \\frac{\\frac{P \\cdot V}{n}}{R}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "T");
-		this->formulas.emplace_back("Ideal Gas Law", "n = \\frac{P \\cdot V}{R \\cdot T}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "n");
-		this->formulas.emplace_back("Ideal Gas Law", "P = \\frac{T \\cdot n \\cdot R}{V}", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true}}, "P");
-		this->formulas.emplace_back("Ideal Gas Law", "V = \\frac{T \\cdot n \\cdot R}{P}", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true}}, "V");
-		this->formulas.emplace_back("Molar Mass", "m = M \\cdot n", std::vector<Variable>{{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false}}, "m");
-    }
-} // namespace Physics
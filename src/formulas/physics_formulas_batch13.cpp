@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_13() {
-		this->formulas.emplace_back("Density", "m = V \\cdot \\rho", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false}}, "m");
-		this->formulas.emplace_back("Percent Composition", "\\% = \\frac{m_component}{m_total} \\cdot 100", std::vector<Variable>{{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "\\%");
-		this->formulas.emplace_back("Percent Composition", "m_component = \\frac{\\%}{100} \\cdot m_total", std::vector<Variable>{{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "m_component");
-		this->formulas.emplace_back("Percent Composition", "m_total = \\frac{m_component}{\\frac{\\%}{100}}", std::vector<Variable>{{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "m_total");
-		this->formulas.emplace_back("Percent Composition", "\\% = \\frac{m_component \\cdot 100}{m_total}", std::vector<Variable>{{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "\\%");
-		this->formulas.emplace_back("Percent Composition", "m_component = \\frac{\\% \\cdot m_total}{100}", std::vector<Variable>{{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "m_component");
-		this->formulas.emplace_back("Percent Composition", "m_total = \\frac{m_component \\cdot 100}{\\%}", std::vector<Variable>{{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false}}, "m_total");
-		this->formulas.emplace_back("Percent Composition", "\\% = \\frac{100 m_component}{m_total}", std::vector<Variable>{{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false}}, "\\%");
-		this->formulas.emplace_back("Percent Composition", "m_component = \\frac{m_total \\cdot \\%}{100}", std::vector<Variable>{{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false}}, "m_component");
-		this->formulas.emplace_back("Percent Composition", "m_total = \\frac{100 m_component}{\\%}", std::vector<Variable>{{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false}}, "m_total");
-		this->formulas.emplace_back("Cell Potential", "E_anode = E_cathode - E_cell", std::vector<Variable>{{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false}}, "E_anode");
-		this->formulas.emplace_back("Cell Potential", "E_cathode = E_cell + E_anode", std::vector<Variable>{{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false}}, "E_cathode");
-		this->formulas.emplace_back("Cell Potential", "E_cell = E_cathode - E_anode", std::vector<Variable>{{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false}}, "E_cell");
-		this->formulas.emplace_back("Cell Potential", "E_cathode = E_anode + E_cell", std::vector<Variable>{{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false},{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false}}, "E_cathode");
-		this->formulas.emplace_back("Nernst Equation", "F = \\frac{\\frac{R \\cdot T}{\\frac{E^{\\circ} - E}{\\ln\\left(Q\\right)}}}{n}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "F");
-		this->formulas.emplace_back("Nernst Equation", "Q = \\exp\\left(\\frac{E^{\\circ} - E}{\\frac{R \\cdot T}{n \\cdot F}}\\right)", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "Q");
-		this->formulas.emplace_back("Nernst Equation", "R = \\frac{\\frac{E^{\\circ} - E}{\\ln\\left(Q\\right)} \\cdot n \\cdot F}{T}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "R");
-		this->formulas.emplace_back("Nernst Equation", "T = \\frac{\\frac{E^{\\circ} - E}{\\ln\\left(Q\\right)} \\cdot n \\cdot F}{R}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "T");
-		this->formulas.emplace_back("Nernst Equation", "\\circ = \\frac{\\ln\\left(E + \\frac{R \\cdot T}{n \\cdot F} \\cdot \\ln\\left(Q\\right)\\right)}{\\ln\\left(E\\right)}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "\\circ");
-		this->formulas.emplace_back("Nernst Equation", "n = \\frac{\\frac{R \\cdot T}{\\frac{E^{\\circ} - E}{\\ln\\left(Q\\right)}}}{F}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "n");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "F = \\frac{\\frac{Q \\cdot M}{m}}{n}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "F");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "M = \\frac{m \\cdot n \\cdot F}{Q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "M");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "Q = \\frac{m \\cdot n \\cdot F}{M}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "Q");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "m = \\frac{Q \\cdot M}{n \\cdot F}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "m");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "n = \\frac{\\frac{Q \\cdot M}{m}}{F}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "n");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "F = \\frac{Q \\cdot M}{m \\cdot n}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "F");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "m = \\frac{\\frac{Q \\cdot M}{F}}{n}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "m");
-		this->formulas.emplace_back("Faraday's Law of Electrolysis", "n = \\frac{\\frac{Q \\cdot M}{F}}{m}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "n");
-		this->formulas.emplace_back("Charge", "Q = t \\cdot I", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "Q");
-		this->formulas.emplace_back("Gibbs Free Energy from Cell Potential", "E = -\\frac{\\Delta G}{n \\cdot F}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "E");
-		this->formulas.emplace_back("Gibbs Free Energy from Cell Potential", "F = \\frac{\\frac{\\Delta G}{-E}}{n}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "F");
-		this->formulas.emplace_back("Gibbs Free Energy from Cell Potential", "\\Delta G = -E \\cdot n \\cdot F", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy from Cell Potential", "n = \\frac{\\frac{\\Delta G}{-E}}{F}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true}}, "n");
-		this->formulas.emplace_back("Kp and Kc Relationship", "K_c = \\frac{K_p}{\\left(R \\cdot T\\right)^{\\Delta n}}", std::vector<Variable>{{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false}}, "K_c");
-		this->formulas.emplace_back("Kp and Kc Relationship", "K_p = K_c \\cdot \\left(R \\cdot T\\right)^{\\Delta n}", std::vector<Variable>{{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false}}, "K_p");
-		this->formulas.emplace_back("Kp and Kc Relationship", "R = \\frac{\\left(\\frac{K_p}{K_c}\\right)^{\\frac{1}{\\Delta n}}}{T}", std::vector<Variable>{{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false}}, "R");
-		this->formulas.emplace_back("Kp and Kc Relationship", "T = \\frac{\\left(\\frac{K_p}{K_c}\\right)^{\\frac{1}{\\Delta n}}}{R}", std::vector<Variable>{{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false}}, "T");
-		this->formulas.emplace_back("Kp and Kc Relationship", "\\Delta n = \\frac{\\ln\\left(\\frac{K_p}{K_c}\\right)}{\\ln\\left(R \\cdot T\\right)}", std::vector<Variable>{{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false}}, "\\Delta n");
-		this->formulas.emplace_back("Arrhenius Equation Logarithmic", "A = \\exp\\left(\\ln\\left(k\\right) + \\frac{E_a}{R \\cdot T}\\right)", std::vector<Variable>{{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "A");
-		this->formulas.emplace_back("Arrhenius Equation Logarithmic", "E_a = \\left(\\ln\\left(A\\right) - \\ln\\left(k\\right)\\right) \\cdot R \\cdot T", std::vector<Variable>{{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "E_a");
-		this->formulas.emplace_back("Arrhenius Equation Logarithmic", "R = \\frac{\\frac{E_a}{\\ln\\left(A\\right) - \\ln\\left(k\\right)}}{T}", std::vector<Variable>{{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "R");
-		this->formulas.emplace_back("Arrhenius Equation Logarithmic", "T = \\frac{\\frac{E_a}{\\ln\\left(A\\right) - \\ln\\left(k\\right)}}{R}", std::vector<Variable>{{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "T");
-		this->formulas.emplace_back("Arrhenius Equation Logarithmic", "k = \\exp\\left(\\ln\\left(A\\right) - \\frac{E_a}{R \\cdot T}\\right)", std::vector<Variable>{{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "k");
-		this->formulas.emplace_back("First Order Half-Life", "k = \\frac{0.693}{t_\\frac{1}{2}}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant", false}}, "k");
-		this->formulas.emplace_back("First Order Half-Life", "t_\\frac{1}{2} = \\frac{0.693}{k}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant", false}}, "t_\\frac{1}{2}");
-		this->formulas.emplace_back("Second Order Half-Life", "k = \\frac{1}{t_\\frac{1}{2}}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"k", {3, -1, 0, 0, 0, -1, 0}, "Rate constant", false},{"[A]_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false}}, "k");
-		this->formulas.emplace_back("Second Order Half-Life", "t_\\frac{1}{2} = \\frac{1}{k}", std::vector<Variable>{{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},{"k", {3, -1, 0, 0, 0, -1, 0}, "Rate constant", false},{"[A]_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false}}, "t_\\frac{1}{2}");
-		this->formulas.emplace_back("Molarity", "n = V \\cdot M", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},{"M", {-3, 0, 0, 0, 0, 1, 0}, "Molarity", false}}, "n");
-		this->formulas.emplace_back("Dilution", "M_1 = \\frac{V_2 \\cdot M_2}{V_1}", std::vector<Variable>{{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false}}, "M_1");
-		this->formulas.emplace_back("Dilution", "V_1 = \\frac{V_2 \\cdot M_2}{M_1}", std::vector<Variable>{{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false}}, "V_1");
-		this->formulas.emplace_back("Dilution", "M_2 = \\frac{V_1 \\cdot M_1}{V_2}", std::vector<Variable>{{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false}}, "M_2");
-		this->formulas.emplace_back("Dilution", "V_2 = \\frac{V_1 \\cdot M_1}{M_2}", std::vector<Variable>{{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false}}, "V_2");
-		this->formulas.emplace_back("Mass Percent", "a = 0", std::vector<Variable>{{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false}}, "a");
-		this->formulas.emplace_back("Mass Percent", "m = 0", std::vector<Variable>{{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false}}, "m");
-		this->formulas.emplace_back("Mass Percent", "s = 0", std::vector<Variable>{{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false}}, "s");
-		this->formulas.emplace_back("Mass Percent", "\\text = \\frac{\\frac{100 m_solute}{m_solution}}{m \\cdot a \\cdot s \\cdot s}", std::vector<Variable>{{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false}}, "\\text");
-		this->formulas.emplace_back("Mass Percent", "a = \\frac{\\frac{\\frac{\\frac{\\frac{100 m_solute}{m_solution}}{\\text}}{s}}{s}}{m}", std::vector<Variable>{{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false}}, "a");
-		this->formulas.emplace_back("Mass Percent", "m = \\frac{\\frac{\\frac{\\frac{\\frac{100 m_solute}{m_solution}}{\\text}}{s}}{s}}{a}", std::vector<Variable>{{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false}}, "m");
-		this->formulas.emplace_back("Mass Percent", "m_solute = \\frac{m_solution \\cdot \\text \\cdot m \\cdot a \\cdot s \\cdot s}{100}", std::vector<Variable>{{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false}}, "m_solute");
-		this->formulas.emplace_back("Mass Percent", "m_solution = \\frac{100 m_solute}{\\text \\cdot m \\cdot a \\cdot s \\cdot s}", std::vector<Variable>{{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false}}, "m_solution");
-		this->formulas.emplace_back("Mole Fraction", "X_A = \\frac{n_A}{n_total}", std::vector<Variable>{{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false},{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false}}, "X_A");
-		this->formulas.emplace_back("Mole Fraction", "n_A = X_A \\cdot n_total", std::vector<Variable>{{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false},{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false}}, "n_A");
-		this->formulas.emplace_back("Mole Fraction", "n_total = \\frac{n_A}{X_A}", std::vector<Variable>{{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false},{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false}}, "n_total");
-		this->formulas.emplace_back("Mole Fraction", "n_A = n_total \\cdot X_A", std::vector<Variable>{{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false},{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false}}, "n_A");
-		this->formulas.emplace_back("Enthalpy Change", "H_products = \\Delta H + H_reactants", std::vector<Variable>{{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false}}, "H_products");
-		this->formulas.emplace_back("Enthalpy Change", "H_reactants = H_products - \\Delta H", std::vector<Variable>{{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false}}, "H_reactants");
-		this->formulas.emplace_back("Enthalpy Change", "\\Delta H = H_products - H_reactants", std::vector<Variable>{{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false}}, "\\Delta H");
-		this->formulas.emplace_back("Enthalpy Change", "H_products = H_reactants + \\Delta H", std::vector<Variable>{{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false},{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false}}, "H_products");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta H = T \\cdot \\Delta S + \\Delta G", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"\\\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false}}, "\\Delta H");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta G = \\Delta H - \\Delta S \\cdot T", std::vector<Variable>{{"\\\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta H = \\Delta S \\cdot T + \\Delta G", std::vector<Variable>{{"\\\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "\\Delta H");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "K = \\exp\\left(\\frac{\\Delta G}{-R \\cdot T}\\right)", std::vector<Variable>{{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "K");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "R = -\\frac{\\frac{\\Delta G}{\\ln\\left(K\\right)}}{T}", std::vector<Variable>{{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "R");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "T = \\frac{\\frac{\\Delta G}{\\ln\\left(K\\right)}}{-R}", std::vector<Variable>{{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "T");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "\\Delta G = -R \\cdot T \\cdot \\ln\\left(K\\right)", std::vector<Variable>{{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "K = e^{\\frac{-\\Delta G}{R} \\cdot T}", std::vector<Variable>{{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "K");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "R = \\frac{-\\Delta G}{\\frac{\\frac{\\ln\\left(K\\right)}{\\ln\\left(e\\right)}}{T}}", std::vector<Variable>{{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "R");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "T = \\frac{\\frac{\\ln\\left(K\\right)}{\\ln\\left(e\\right)}}{\\frac{-\\Delta G}{R}}", std::vector<Variable>{{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "T");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "\\Delta G = -\\frac{\\frac{\\ln\\left(K\\right)}{\\ln\\left(e\\right)}}{T} \\cdot R", std::vector<Variable>{{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "e = K^{\\frac{1}{\\frac{-\\Delta G}{R} \\cdot T}}", std::vector<Variable>{{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "e");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "K = \\exp\\left(\\frac{\\frac{\\Delta G}{-T}}{R}\\right)", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "K");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "R = \\frac{\\frac{\\Delta G}{-T}}{\\ln\\left(K\\right)}", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "R");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "T = -\\frac{\\Delta G}{R \\cdot \\ln\\left(K\\right)}", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "T");
-		this->formulas.emplace_back("Gibbs Free Energy and Equilibrium", "\\Delta G = -T \\cdot R \\cdot \\ln\\left(K\\right)", std::vector<Variable>{{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false}}, "\\Delta G");
-		this->formulas.emplace_back("Ohm's Law", "V = R \\cdot I", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "V");
-		this->formulas.emplace_back("Electric Power", "P = V \\cdot I", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "P");
-		this->formulas.emplace_back("Power from Current", "I = \\left(\\frac{P}{R}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "I");
-		this->formulas.emplace_back("Power from Current", "P = R \\cdot I^{2}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "P");
-		this->formulas.emplace_back("Power from Voltage", "V = \\left(P \\cdot R\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "V");
-		this->formulas.emplace_back("Power from Voltage", "V = \\pm \\left(R \\cdot P\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false}}, "V");
-		this->formulas.emplace_back("Resistors in Series", "R_total = R_2 + R_1", std::vector<Variable>{{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false}}, "R_total");
-		this->formulas.emplace_back("Resistors in Parallel", "R_1 = \\frac{1}{\\frac{1}{R_total} - \\frac{1}{R_2}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Resistors in Parallel", "R_2 = \\frac{1}{\\frac{1}{R_total} - \\frac{1}{R_1}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Resistors in Parallel", "R_total = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_total");
-    }
-} // namespace Physics
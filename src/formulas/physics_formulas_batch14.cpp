@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_14() {
-		this->formulas.emplace_back("Resistance from Resistivity", "A = \\frac{L}{\\frac{R}{\\rho}}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Resistance from Resistivity", "L = \\frac{R}{\\rho} \\cdot A", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "L");
-		this->formulas.emplace_back("Resistance from Resistivity", "R = \\rho \\cdot \\frac{L}{A}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "R");
-		this->formulas.emplace_back("Resistance from Resistivity", "\\rho = \\frac{R}{\\frac{L}{A}}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "\\rho");
-		this->formulas.emplace_back("Resistance from Resistivity", "A = \\frac{\\rho}{R} \\cdot L", std::vector<Variable>{{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "A");
-		this->formulas.emplace_back("Resistance from Resistivity", "L = \\frac{A}{\\frac{\\rho}{R}}", std::vector<Variable>{{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Resistance from Resistivity", "R = \\frac{\\rho}{\\frac{A}{L}}", std::vector<Variable>{{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "R");
-		this->formulas.emplace_back("Resistance from Resistivity", "\\rho = R \\cdot \\frac{A}{L}", std::vector<Variable>{{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "\\rho");
-		this->formulas.emplace_back("Resistance from Resistivity", "A = \\frac{L}{R} \\cdot \\rho", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "A");
-		this->formulas.emplace_back("Resistance from Resistivity", "L = R \\cdot \\frac{A}{\\rho}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "L");
-		this->formulas.emplace_back("Resistance from Resistivity", "R = \\frac{L}{\\frac{A}{\\rho}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "R");
-		this->formulas.emplace_back("Resistance from Resistivity", "\\rho = \\frac{A}{\\frac{L}{R}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "\\rho");
-		this->formulas.emplace_back("Resistance from Resistivity", "A = \\rho \\cdot \\frac{L}{R}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "A");
-		this->formulas.emplace_back("Resistance from Resistivity", "L = \\frac{A}{\\rho} \\cdot R", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "L");
-		this->formulas.emplace_back("Current Density", "I = A \\cdot J", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false}}, "I");
-		this->formulas.emplace_back("RC Time Constant", "\\tau = C \\cdot R", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "\\tau");
-		this->formulas.emplace_back("Energy Dissipated", "E = t \\cdot P", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false}}, "E");
-		this->formulas.emplace_back("Drift Velocity", "A = \\frac{\\frac{I}{v_d}}{n \\cdot q}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Drift Velocity", "I = v_d \\cdot n \\cdot q \\cdot A", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "I");
-		this->formulas.emplace_back("Drift Velocity", "n = \\frac{\\frac{\\frac{I}{v_d}}{A}}{q}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "n");
-		this->formulas.emplace_back("Drift Velocity", "q = \\frac{\\frac{\\frac{I}{v_d}}{A}}{n}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "q");
-		this->formulas.emplace_back("Drift Velocity", "v_d = \\frac{I}{n \\cdot q \\cdot A}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "v_d");
-		this->formulas.emplace_back("Drift Velocity", "A = \\frac{\\frac{I}{n}}{q \\cdot v_d}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Drift Velocity", "n = \\frac{I}{q \\cdot v_d \\cdot A}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "n");
-		this->formulas.emplace_back("Drift Velocity", "q = \\frac{\\frac{\\frac{I}{n}}{A}}{v_d}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "q");
-		this->formulas.emplace_back("Drift Velocity", "v_d = \\frac{\\frac{\\frac{I}{n}}{A}}{q}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "v_d");
-		this->formulas.emplace_back("Drift Velocity", "I = A \\cdot n \\cdot q \\cdot v_d", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false}}, "I");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "R = \\alpha \\cdot R_0 \\cdot \\Delta T + R_0", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "R");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "\\Delta T = \\frac{\\frac{R - R_0}{\\alpha}}{R_0}", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "\\alpha = \\frac{R - R_0}{R_0 \\cdot \\Delta T}", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\alpha");
-		this->formulas.emplace_back("Kirchhoff's Current Law", "I_in = \\frac{\\sum \\cdot I_out}{\\sum}", std::vector<Variable>{{"\\\\sum I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents entering", false},{"\\\\sum I_{out}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents leaving", false}}, "I_in");
-		this->formulas.emplace_back("Kirchhoff's Current Law", "I_out = \\frac{\\sum \\cdot I_in}{\\sum}", std::vector<Variable>{{"\\\\sum I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents entering", false},{"\\\\sum I_{out}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents leaving", false}}, "I_out");
-		this->formulas.emplace_back("Kirchhoff's Voltage Law", "V = 0", std::vector<Variable>{{"\\\\sum V", {2, -3, 1, -1, 0, 0, 0}, "Sum of voltage changes around loop", false}}, "V");
-		this->formulas.emplace_back("Kirchhoff's Voltage Law", "\\sum = 0", std::vector<Variable>{{"\\\\sum V", {2, -3, 1, -1, 0, 0, 0}, "Sum of voltage changes around loop", false}}, "\\sum");
-		this->formulas.emplace_back("EMF with Internal Resistance", "\\varepsilon = I \\cdot r + V", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "\\varepsilon");
-		this->formulas.emplace_back("EMF with Internal Resistance", "V = \\varepsilon - r \\cdot I", std::vector<Variable>{{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "V");
-		this->formulas.emplace_back("EMF with Internal Resistance", "\\varepsilon = r \\cdot I + V", std::vector<Variable>{{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\varepsilon");
-		this->formulas.emplace_back("RC Charging", "C = \\frac{\\frac{\\ln\\left(1 - \\frac{Q \\cdot t}{Q_max}\\right)}{\\ln\\left(e\\right)}}{\\frac{-t}{R}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("RC Charging", "Q = \\frac{Q_max \\cdot \\left(1 - e^{\\frac{-t}{R} \\cdot C}\\right)}{t}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q");
-		this->formulas.emplace_back("RC Charging", "Q_max = \\frac{Q \\cdot t}{1 - e^{\\frac{-t}{R} \\cdot C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q_max");
-		this->formulas.emplace_back("RC Charging", "R = \\frac{-t}{\\frac{\\frac{\\ln\\left(1 - \\frac{Q \\cdot t}{Q_max}\\right)}{\\ln\\left(e\\right)}}{C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "R");
-		this->formulas.emplace_back("RC Charging", "e = \\left(1 - \\frac{Q \\cdot t}{Q_max}\\right)^{\\frac{1}{\\frac{-t}{R} \\cdot C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "e");
-		this->formulas.emplace_back("RC Discharging", "C = \\frac{\\frac{\\ln\\left(\\frac{Q \\cdot t}{Q_0}\\right)}{\\ln\\left(e\\right)}}{\\frac{-t}{R}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("RC Discharging", "Q = \\frac{Q_0 \\cdot e^{\\frac{-t}{R} \\cdot C}}{t}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q");
-		this->formulas.emplace_back("RC Discharging", "Q_0 = \\frac{Q \\cdot t}{e^{\\frac{-t}{R} \\cdot C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q_0");
-		this->formulas.emplace_back("RC Discharging", "R = \\frac{-t}{\\frac{\\frac{\\ln\\left(\\frac{Q \\cdot t}{Q_0}\\right)}{\\ln\\left(e\\right)}}{C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "R");
-		this->formulas.emplace_back("RC Discharging", "e = \\left(\\frac{Q \\cdot t}{Q_0}\\right)^{\\frac{1}{\\frac{-t}{R} \\cdot C}}", std::vector<Variable>{{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "e");
-		this->formulas.emplace_back("Three Resistors in Series", "R_1 = R_total - R_3 - R_2", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_1");
-		this->formulas.emplace_back("Three Resistors in Series", "R_2 = R_total - R_3 - R_1", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_2");
-		this->formulas.emplace_back("Three Resistors in Series", "R_3 = R_total - \\left(R_1 + R_2\\right)", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_3");
-		this->formulas.emplace_back("Three Resistors in Series", "R_total = R_1 + R_2 + R_3", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_total");
-		this->formulas.emplace_back("Three Resistors in Parallel", "R_1 = \\frac{1}{\\frac{1}{R_total} - \\frac{1}{R_3} - \\frac{1}{R_2}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_1");
-		this->formulas.emplace_back("Three Resistors in Parallel", "R_2 = \\frac{1}{\\frac{1}{R_total} - \\frac{1}{R_3} - \\frac{1}{R_1}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_2");
-		this->formulas.emplace_back("Three Resistors in Parallel", "R_3 = \\frac{1}{\\frac{1}{R_total} - \\left(\\frac{1}{R_1} + \\frac{1}{R_2}\\right)}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_3");
-		this->formulas.emplace_back("Three Resistors in Parallel", "R_total = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2} + \\frac{1}{R_3}}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_total");
-		this->formulas.emplace_back("Wheatstone Bridge Balanced", "R_1 = \\frac{R_2 \\cdot R_3}{R_4}", std::vector<Variable>{{"R_4", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_1");
-		this->formulas.emplace_back("Wheatstone Bridge Balanced", "R_2 = \\frac{R_4 \\cdot R_1}{R_3}", std::vector<Variable>{{"R_4", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_2");
-		this->formulas.emplace_back("Wheatstone Bridge Balanced", "R_3 = \\frac{R_4 \\cdot R_1}{R_2}", std::vector<Variable>{{"R_4", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_3");
-		this->formulas.emplace_back("Wheatstone Bridge Balanced", "R_4 = \\frac{R_2 \\cdot R_3}{R_1}", std::vector<Variable>{{"R_4", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false}}, "R_4");
-		this->formulas.emplace_back("Angular Displacement", "\\theta = t \\cdot \\omega", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\theta");
-		this->formulas.emplace_back("Period from Angular Velocity", "T = \\frac{2 \\pi}{\\omega}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "T");
-		this->formulas.emplace_back("Period from Angular Velocity", "\\omega = \\frac{2 \\pi}{T}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Period from Angular Velocity", "\\pi = \\frac{T \\cdot \\omega}{2}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\pi");
-		this->formulas.emplace_back("Period from Angular Velocity", "\\pi = \\frac{\\omega \\cdot T}{2}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "\\pi");
-		this->formulas.emplace_back("Newton's Second Law", "F = a \\cdot m", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "F");
-		this->formulas.emplace_back("Friction Force", "F_f = N \\cdot \\mu", std::vector<Variable>{{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false},{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},{"\\\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false}}, "F_f");
-		this->formulas.emplace_back("Hooke's Law", "F = x \\cdot k", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring force", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "F");
-		this->formulas.emplace_back("Work", "W = d \\cdot F", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "W");
-		this->formulas.emplace_back("Centripetal Force", "F_c = \\frac{v^{2} \\cdot m}{r}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "F_c");
-		this->formulas.emplace_back("Centripetal Force", "r = \\frac{v^{2} \\cdot m}{F_c}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "r");
-		this->formulas.emplace_back("Centripetal Force", "v = \\left(\\frac{F_c \\cdot r}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "v");
-		this->formulas.emplace_back("Centripetal Force", "m = \\frac{r \\cdot F_c}{v^{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false}}, "m");
-		this->formulas.emplace_back("Centripetal Force", "v = \\pm \\left(\\frac{r \\cdot F_c}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false}}, "v");
-		this->formulas.emplace_back("Centripetal Acceleration", "v = \\left(a_c \\cdot r\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "v");
-		this->formulas.emplace_back("Centripetal Acceleration", "v = \\pm \\left(r \\cdot a_c\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false}}, "v");
-		this->formulas.emplace_back("Centripetal Force Angular", "F_c = m \\cdot \\omega^{2} \\cdot r", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "F_c");
-		this->formulas.emplace_back("Centripetal Force Angular", "\\omega = \\pm \\left(\\frac{\\frac{F_c}{r}}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\omega");
-		this->formulas.emplace_back("Centripetal Force Angular", "m = \\frac{\\frac{F_c}{r}}{\\omega^{2}}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "m");
-		this->formulas.emplace_back("Centripetal Force Angular", "r = \\frac{F_c}{m \\cdot \\omega^{2}}", std::vector<Variable>{{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Centripetal Force Angular", "\\omega = \\pm \\left(\\frac{\\frac{F_c}{m}}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\omega");
-		this->formulas.emplace_back("Centripetal Force Angular", "m = \\frac{F_c}{\\omega^{2} \\cdot r}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "m");
-		this->formulas.emplace_back("Centripetal Force Angular", "r = \\frac{\\frac{F_c}{m}}{\\omega^{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Centripetal Force Angular", "F_c = \\omega^{2} \\cdot m \\cdot r", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "F_c");
-		this->formulas.emplace_back("Centripetal Force Angular", "\\omega = \\left(\\frac{F_c}{m \\cdot r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\omega");
-		this->formulas.emplace_back("Centripetal Force Angular", "m = \\frac{\\frac{F_c}{\\omega^{2}}}{r}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "m");
-		this->formulas.emplace_back("Centripetal Force Angular", "r = \\frac{\\frac{F_c}{\\omega^{2}}}{m}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Centripetal Force Angular", "F_c = r \\cdot m \\cdot \\omega^{2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "F_c");
-		this->formulas.emplace_back("Impulse", "J = \\Delta t \\cdot F", std::vector<Variable>{{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "J");
-		this->formulas.emplace_back("Speed of Light", "\\lambda = \\frac{c}{f}", std::vector<Variable>{{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "\\lambda");
-		this->formulas.emplace_back("Speed of Light", "c = f \\cdot \\lambda", std::vector<Variable>{{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "c");
-		this->formulas.emplace_back("Speed of Light", "f = \\frac{c}{\\lambda}", std::vector<Variable>{{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "f");
-		this->formulas.emplace_back("Speed of Light", "c = \\lambda \\cdot f", std::vector<Variable>{{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "c");
-		this->formulas.emplace_back("EM Wave Speed in Medium", "c = v \\cdot n", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed in medium", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in vacuum", true},{"n", {0, 0, 0, 0, 0, 0, 0}, "Index of refraction", false}}, "c");
-		this->formulas.emplace_back("Coulomb's Law", "F = \\frac{q_1 \\cdot k \\cdot q_2}{r^{2}}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "F");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_15() {
-		this->formulas.emplace_back("Coulomb's Law", "k = \\frac{\\frac{F \\cdot r^{2}}{q_1}}{q_2}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "k");
-		this->formulas.emplace_back("Coulomb's Law", "q_1 = \\frac{F \\cdot r^{2}}{k \\cdot q_2}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "q_1");
-		this->formulas.emplace_back("Coulomb's Law", "q_2 = \\frac{\\frac{F \\cdot r^{2}}{q_1}}{k}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "q_2");
-		this->formulas.emplace_back("Coulomb's Law", "r = \\pm \\left(\\frac{q_1 \\cdot k \\cdot q_2}{F}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "r");
-		this->formulas.emplace_back("Coulomb's Law", "F = \\frac{q_2 \\cdot k \\cdot q_1}{r^{2}}", std::vector<Variable>{{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false}}, "F");
-		this->formulas.emplace_back("Coulomb's Law", "k = \\frac{\\frac{F \\cdot r^{2}}{q_2}}{q_1}", std::vector<Variable>{{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false}}, "k");
-		this->formulas.emplace_back("Coulomb's Law", "q_1 = \\frac{\\frac{F \\cdot r^{2}}{q_2}}{k}", std::vector<Variable>{{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false}}, "q_1");
-		this->formulas.emplace_back("Coulomb's Law", "q_2 = \\frac{F \\cdot r^{2}}{k \\cdot q_1}", std::vector<Variable>{{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false}}, "q_2");
-		this->formulas.emplace_back("Coulomb's Law", "r = \\pm \\left(\\frac{q_2 \\cdot k \\cdot q_1}{F}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false}}, "r");
-		this->formulas.emplace_back("Coulomb's Law", "F = \\frac{k \\cdot q_1 \\cdot q_2}{r^{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "F");
-		this->formulas.emplace_back("Coulomb's Law", "k = \\frac{\\frac{r^{2} \\cdot F}{q_2}}{q_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "k");
-		this->formulas.emplace_back("Coulomb's Law", "q_1 = \\frac{\\frac{r^{2} \\cdot F}{q_2}}{k}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "q_1");
-		this->formulas.emplace_back("Coulomb's Law", "q_2 = \\frac{r^{2} \\cdot F}{k \\cdot q_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "q_2");
-		this->formulas.emplace_back("Coulomb's Law", "r = \\left(\\frac{k \\cdot q_1 \\cdot q_2}{F}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "r");
-		this->formulas.emplace_back("Electric Field from Force", "F = q \\cdot E", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "F");
-		this->formulas.emplace_back("Electric Field Point Charge", "E = \\frac{q \\cdot k}{r^{2}}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "E");
-		this->formulas.emplace_back("Electric Field Point Charge", "k = \\frac{E \\cdot r^{2}}{q}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "k");
-		this->formulas.emplace_back("Electric Field Point Charge", "q = \\frac{E \\cdot r^{2}}{k}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "q");
-		this->formulas.emplace_back("Electric Field Point Charge", "r = \\pm \\left(\\frac{q \\cdot k}{E}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "r");
-		this->formulas.emplace_back("Electric Field Point Charge", "E = \\frac{k \\cdot q}{r^{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Electric Field Point Charge", "k = \\frac{r^{2} \\cdot E}{q}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "k");
-		this->formulas.emplace_back("Electric Field Point Charge", "q = \\frac{r^{2} \\cdot E}{k}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "q");
-		this->formulas.emplace_back("Electric Field Point Charge", "r = \\left(\\frac{k \\cdot q}{E}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "r");
-		this->formulas.emplace_back("Electric Potential Point Charge", "V = \\frac{q \\cdot k}{r}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "V");
-		this->formulas.emplace_back("Electric Potential Point Charge", "k = \\frac{V \\cdot r}{q}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "k");
-		this->formulas.emplace_back("Electric Potential Point Charge", "q = \\frac{V \\cdot r}{k}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "q");
-		this->formulas.emplace_back("Electric Potential Point Charge", "r = \\frac{q \\cdot k}{V}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true}}, "r");
-		this->formulas.emplace_back("Electric Potential Point Charge", "V = \\frac{k \\cdot q}{r}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false}}, "V");
-		this->formulas.emplace_back("Electric Potential Point Charge", "k = \\frac{r \\cdot V}{q}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Point Charge", "q = \\frac{r \\cdot V}{k}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false}}, "q");
-		this->formulas.emplace_back("Electric Potential Point Charge", "r = \\frac{k \\cdot q}{V}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false}}, "r");
-		this->formulas.emplace_back("Electric Field from Potential", "V = d \\cdot E", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "V");
-		this->formulas.emplace_back("Electric Potential Energy", "U = \\frac{q_1 \\cdot k \\cdot q_2}{r}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "U");
-		this->formulas.emplace_back("Electric Potential Energy", "k = \\frac{\\frac{U \\cdot r}{q_1}}{q_2}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Energy", "q_1 = \\frac{U \\cdot r}{k \\cdot q_2}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "q_1");
-		this->formulas.emplace_back("Electric Potential Energy", "q_2 = \\frac{\\frac{U \\cdot r}{q_1}}{k}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "q_2");
-		this->formulas.emplace_back("Electric Potential Energy", "r = \\frac{q_1 \\cdot k \\cdot q_2}{U}", std::vector<Variable>{{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false}}, "r");
-		this->formulas.emplace_back("Electric Potential Energy", "U = \\frac{q_1 \\cdot q_2}{\\frac{r}{k}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "U");
-		this->formulas.emplace_back("Electric Potential Energy", "k = \\frac{r}{\\frac{q_1 \\cdot q_2}{U}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "k");
-		this->formulas.emplace_back("Electric Potential Energy", "q_1 = \\frac{\\frac{r}{k} \\cdot U}{q_2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "q_1");
-		this->formulas.emplace_back("Electric Potential Energy", "q_2 = \\frac{\\frac{r}{k} \\cdot U}{q_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "q_2");
-		this->formulas.emplace_back("Electric Potential Energy", "r = k \\cdot \\frac{q_1 \\cdot q_2}{U}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "r");
-		this->formulas.emplace_back("Capacitance", "Q = V \\cdot C", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "A = \\frac{C \\cdot d}{\\epsilon_0}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "A");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "C = \\frac{A \\cdot \\epsilon_0}{d}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "C");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "\\epsilon_0 = \\frac{C \\cdot d}{A}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\epsilon_0");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "d = \\frac{A \\cdot \\epsilon_0}{C}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "d");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "A = \\frac{d}{\\epsilon_0} \\cdot C", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "A");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "C = \\frac{A}{\\frac{d}{\\epsilon_0}}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "\\epsilon_0 = \\frac{d}{\\frac{A}{C}}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "d = \\epsilon_0 \\cdot \\frac{A}{C}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "d");
-		this->formulas.emplace_back("Capacitor Energy", "C = \\frac{2 U}{V^{2}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "C");
-		this->formulas.emplace_back("Capacitor Energy", "U = \\frac{C \\cdot V^{2}}{2}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "U");
-		this->formulas.emplace_back("Capacitor Energy", "V = \\pm \\left(\\frac{2 U}{C}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "V");
-		this->formulas.emplace_back("Capacitor Energy", "U = \\frac{V^{2} \\cdot C}{2}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "U");
-		this->formulas.emplace_back("Capacitor Energy", "V = \\left(\\frac{2 U}{C}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "V");
-		this->formulas.emplace_back("Capacitor Energy from Charge", "C = \\frac{Q^{2}}{2 U}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("Capacitor Energy from Charge", "Q = \\left(2 U \\cdot C\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q");
-		this->formulas.emplace_back("Capacitor Energy from Charge", "U = \\frac{\\frac{Q^{2}}{C}}{2}", std::vector<Variable>{{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "U");
-		this->formulas.emplace_back("Capacitor Energy from Charge", "Q = \\pm \\left(C \\cdot 2 U\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false}}, "Q");
-		this->formulas.emplace_back("Capacitance with Dielectric", "C = C_0 \\cdot \\kappa", std::vector<Variable>{{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},{"\\\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false}}, "C");
-		this->formulas.emplace_back("Electric Field in Dielectric", "E_0 = \\kappa \\cdot E", std::vector<Variable>{{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},{"\\\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false}}, "E_0");
-		this->formulas.emplace_back("Electric Energy Density", "E = \\left(\\frac{2 u}{\\epsilon_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "E");
-		this->formulas.emplace_back("Electric Energy Density", "\\epsilon_0 = \\frac{2 u}{E^{2}}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "\\epsilon_0");
-		this->formulas.emplace_back("Electric Energy Density", "u = \\frac{E^{2} \\cdot \\epsilon_0}{2}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true}}, "u");
-		this->formulas.emplace_back("Electric Dipole Moment", "p = d \\cdot q", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"p", {1, 1, 0, 1, 0, 0, 0}, "Dipole moment", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "p");
-		this->formulas.emplace_back("Electric Flux", "\\Phi_E = A \\cdot E", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\Phi_E");
-		this->formulas.emplace_back("Gauss's Law", "Q_enc = \\epsilon_0 \\cdot \\Phi_E", std::vector<Variable>{{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"\\\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false}}, "Q_enc");
-		this->formulas.emplace_back("Surface Charge Density", "Q = A \\cdot \\sigma", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"\\\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false}}, "Q");
-		this->formulas.emplace_back("Linear Charge Density", "Q = L \\cdot \\lambda", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"\\\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false}}, "Q");
-		this->formulas.emplace_back("Volume Charge Density", "Q = V \\cdot \\rho_q", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"\\\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false}}, "Q");
-		this->formulas.emplace_back("Electric Field of Infinite Plane", "\\sigma = 2 \\epsilon_0 \\cdot E", std::vector<Variable>{{"\\\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\sigma");
-		this->formulas.emplace_back("Kinetic Energy", "E = \\frac{m \\cdot v^{2}}{2 K}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "E");
-		this->formulas.emplace_back("Kinetic Energy", "K = \\frac{\\frac{m \\cdot v^{2}}{E}}{2}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "K");
-		this->formulas.emplace_back("Kinetic Energy", "m = \\frac{2 K \\cdot E}{v^{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "m");
-		this->formulas.emplace_back("Kinetic Energy", "v = \\pm \\left(\\frac{2 K \\cdot E}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Kinetic Energy", "E = \\frac{v^{2} \\cdot m}{2 K}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "E");
-		this->formulas.emplace_back("Kinetic Energy", "K = \\frac{\\frac{v^{2} \\cdot m}{E}}{2}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "K");
-		this->formulas.emplace_back("Kinetic Energy", "v = \\left(\\frac{2 K \\cdot E}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "v");
-		this->formulas.emplace_back("Gravitational Potential Energy", "g = \\frac{\\frac{P \\cdot E}{m}}{h}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "g");
-		this->formulas.emplace_back("Gravitational Potential Energy", "h = \\frac{\\frac{P \\cdot E}{m}}{g}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m = \\frac{P \\cdot E}{g \\cdot h}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "m");
-		this->formulas.emplace_back("Gravitational Potential Energy", "E = \\frac{h \\cdot m \\cdot g}{P}", std::vector<Variable>{{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "E");
-		this->formulas.emplace_back("Gravitational Potential Energy", "P = \\frac{h \\cdot m \\cdot g}{E}", std::vector<Variable>{{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "P");
-		this->formulas.emplace_back("Elastic Potential Energy", "E = \\frac{\\frac{1}{2} k \\cdot x^{2}}{P}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "E");
-		this->formulas.emplace_back("Elastic Potential Energy", "P = \\frac{\\frac{1}{2} k \\cdot x^{2}}{E}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "P");
-		this->formulas.emplace_back("Elastic Potential Energy", "k = \\frac{\\frac{P \\cdot E}{x^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "k");
-		this->formulas.emplace_back("Elastic Potential Energy", "x = \\pm \\left(\\frac{P \\cdot E}{\\frac{1}{2} k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "x");
-		this->formulas.emplace_back("Elastic Potential Energy", "E = \\frac{k \\cdot x^{2}}{2 P}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "E");
-		this->formulas.emplace_back("Elastic Potential Energy", "P = \\frac{\\frac{k \\cdot x^{2}}{E}}{2}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "P");
-		this->formulas.emplace_back("Elastic Potential Energy", "k = \\frac{2 P \\cdot E}{x^{2}}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "k");
-		this->formulas.emplace_back("Elastic Potential Energy", "x = \\pm \\left(\\frac{2 P \\cdot E}{k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false}}, "x");
-		this->formulas.emplace_back("Elastic Potential Energy", "E = \\frac{x^{2} \\cdot k}{2 P}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "E");
-		this->formulas.emplace_back("Elastic Potential Energy", "P = \\frac{\\frac{x^{2} \\cdot k}{E}}{2}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "P");
-    }
-} // namespace Physics
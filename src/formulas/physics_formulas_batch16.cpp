@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_16() {
-		this->formulas.emplace_back("Elastic Potential Energy", "x = \\left(\\frac{2 P \\cdot E}{k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "x");
-		this->formulas.emplace_back("Mechanical Energy", "K = \\frac{E - P \\cdot E}{E}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Total mechanical energy", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "K");
-		this->formulas.emplace_back("Mechanical Energy", "P = \\frac{E - K \\cdot E}{E}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Total mechanical energy", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "P");
-		this->formulas.emplace_back("Power from Work", "W = t \\cdot P", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false}}, "W");
-		this->formulas.emplace_back("Power from Force", "P = v \\cdot F", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false}}, "P");
-		this->formulas.emplace_back("Efficiency", "W_out = W_in \\cdot \\eta", std::vector<Variable>{{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false},{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},{"\\\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false}}, "W_out");
-		this->formulas.emplace_back("Pressure", "F = A \\cdot P", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false}}, "F");
-		this->formulas.emplace_back("Hydrostatic Pressure", "\\rho = \\frac{P}{g \\cdot h}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "\\rho");
-		this->formulas.emplace_back("Hydrostatic Pressure", "g = \\frac{\\frac{P}{\\rho}}{h}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "g");
-		this->formulas.emplace_back("Hydrostatic Pressure", "h = \\frac{\\frac{P}{\\rho}}{g}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Hydrostatic Pressure", "P = h \\cdot \\rho \\cdot g", std::vector<Variable>{{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "P");
-		this->formulas.emplace_back("Buoyancy", "F_b = \\rho \\cdot V \\cdot g", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "F_b");
-		this->formulas.emplace_back("Buoyancy", "V = \\frac{\\frac{F_b}{g}}{\\rho}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "V");
-		this->formulas.emplace_back("Buoyancy", "\\rho = \\frac{\\frac{F_b}{g}}{V}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "\\rho");
-		this->formulas.emplace_back("Buoyancy", "g = \\frac{F_b}{\\rho \\cdot V}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Buoyancy", "V = \\frac{\\frac{F_b}{\\rho}}{g}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "V");
-		this->formulas.emplace_back("Buoyancy", "\\rho = \\frac{F_b}{V \\cdot g}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "\\rho");
-		this->formulas.emplace_back("Buoyancy", "g = \\frac{\\frac{F_b}{\\rho}}{V}", std::vector<Variable>{{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Buoyancy", "F_b = V \\cdot \\rho \\cdot g", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "F_b");
-		this->formulas.emplace_back("Continuity Equation", "A_1 = \\frac{A_2 \\cdot v_2}{v_1}", std::vector<Variable>{{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Area 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Area 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Velocity 1", false},{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Velocity 2", false}}, "A_1");
-		this->formulas.emplace_back("Continuity Equation", "v_1 = \\frac{A_2 \\cdot v_2}{A_1}", std::vector<Variable>{{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Area 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Area 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Velocity 1", false},{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Velocity 2", false}}, "v_1");
-		this->formulas.emplace_back("Flow Rate", "Q = v \\cdot A", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volume flow rate", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "Q");
-		this->formulas.emplace_back("Universal Gravitation", "F = \\frac{m_1 \\cdot G \\cdot m_2}{r^{2}}", std::vector<Variable>{{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false}}, "F");
-		this->formulas.emplace_back("Universal Gravitation", "G = \\frac{\\frac{F \\cdot r^{2}}{m_1}}{m_2}", std::vector<Variable>{{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false}}, "G");
-		this->formulas.emplace_back("Universal Gravitation", "m_1 = \\frac{F \\cdot r^{2}}{G \\cdot m_2}", std::vector<Variable>{{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false}}, "m_1");
-		this->formulas.emplace_back("Universal Gravitation", "m_2 = \\frac{\\frac{F \\cdot r^{2}}{m_1}}{G}", std::vector<Variable>{{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false}}, "m_2");
-		this->formulas.emplace_back("Universal Gravitation", "r = \\pm \\left(\\frac{m_1 \\cdot G \\cdot m_2}{F}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false}}, "r");
-		this->formulas.emplace_back("Universal Gravitation", "F = \\frac{G \\cdot m_1 \\cdot m_2}{r^{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false}}, "F");
-		this->formulas.emplace_back("Universal Gravitation", "G = \\frac{\\frac{r^{2} \\cdot F}{m_2}}{m_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false}}, "G");
-		this->formulas.emplace_back("Universal Gravitation", "m_1 = \\frac{\\frac{r^{2} \\cdot F}{m_2}}{G}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false}}, "m_1");
-		this->formulas.emplace_back("Universal Gravitation", "m_2 = \\frac{r^{2} \\cdot F}{G \\cdot m_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false}}, "m_2");
-		this->formulas.emplace_back("Universal Gravitation", "r = \\left(\\frac{G \\cdot m_1 \\cdot m_2}{F}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false}}, "r");
-		this->formulas.emplace_back("Gravitational Potential Energy", "G = -\\frac{U}{\\frac{m_1 \\cdot m_2}{r}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "G");
-		this->formulas.emplace_back("Gravitational Potential Energy", "U = -G \\cdot \\frac{m_1 \\cdot m_2}{r}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "U");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_1 = \\frac{\\frac{U}{-G} \\cdot r}{m_2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "m_1");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_2 = \\frac{\\frac{U}{-G} \\cdot r}{m_1}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "m_2");
-		this->formulas.emplace_back("Gravitational Potential Energy", "r = \\frac{m_1 \\cdot m_2}{\\frac{U}{-G}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "r");
-		this->formulas.emplace_back("Gravitational Potential Energy", "G = -\\frac{r}{\\frac{m_1 \\cdot m_2}{U}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "G");
-		this->formulas.emplace_back("Gravitational Potential Energy", "U = \\frac{m_1 \\cdot m_2}{\\frac{r}{-G}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "U");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_1 = \\frac{\\frac{r}{-G} \\cdot U}{m_2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "m_1");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m_2 = \\frac{\\frac{r}{-G} \\cdot U}{m_1}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "m_2");
-		this->formulas.emplace_back("Gravitational Potential Energy", "r = -G \\cdot \\frac{m_1 \\cdot m_2}{U}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false}}, "r");
-		this->formulas.emplace_back("Orbital Velocity", "r = \\frac{M \\cdot G}{v^{2}}", std::vector<Variable>{{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true}}, "r");
-		this->formulas.emplace_back("Orbital Velocity", "v = \\pm \\left(\\frac{M \\cdot G}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true}}, "v");
-		this->formulas.emplace_back("Orbital Velocity", "G = \\frac{r \\cdot v^{2}}{M}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false}}, "G");
-		this->formulas.emplace_back("Orbital Velocity", "M = \\frac{r \\cdot v^{2}}{G}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false}}, "M");
-		this->formulas.emplace_back("Orbital Velocity", "v = \\pm \\left(\\frac{G \\cdot M}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false}}, "v");
-		this->formulas.emplace_back("Escape Velocity", "G = \\frac{\\frac{v_esc^{2} \\cdot r}{M}}{2}", std::vector<Variable>{{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "G");
-		this->formulas.emplace_back("Escape Velocity", "M = \\frac{v_esc^{2} \\cdot r}{2 G}", std::vector<Variable>{{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "M");
-		this->formulas.emplace_back("Escape Velocity", "r = \\frac{2 G \\cdot M}{v_esc^{2}}", std::vector<Variable>{{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Escape Velocity", "v_esc = \\left(\\frac{2 G \\cdot M}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "v_esc");
-		this->formulas.emplace_back("Escape Velocity", "r = \\frac{M \\cdot 2 G}{v_esc^{2}}", std::vector<Variable>{{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true}}, "r");
-		this->formulas.emplace_back("Escape Velocity", "v_esc = \\pm \\left(\\frac{M \\cdot 2 G}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true}}, "v_esc");
-		this->formulas.emplace_back("Escape Velocity", "G = \\frac{\\frac{r \\cdot v_esc^{2}}{M}}{2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false}}, "G");
-		this->formulas.emplace_back("Escape Velocity", "M = \\frac{r \\cdot v_esc^{2}}{2 G}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false}}, "M");
-		this->formulas.emplace_back("Escape Velocity", "v_esc = \\pm \\left(\\frac{2 G \\cdot M}{r}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false}}, "v_esc");
-		this->formulas.emplace_back("Faraday's Law", "N = \\frac{\\varepsilon}{\\frac{\\Delta \\Phi}{\\Delta t}}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta \\Phi = \\frac{\\varepsilon}{N} \\cdot \\Delta t", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta \\Phi");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta t = \\frac{\\Delta \\Phi}{\\frac{\\varepsilon}{N}}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta t");
-		this->formulas.emplace_back("Faraday's Law", "\\varepsilon = N \\cdot \\frac{\\Delta \\Phi}{\\Delta t}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Faraday's Law", "N = \\frac{\\varepsilon \\cdot \\Delta t}{\\Delta \\Phi}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta \\Phi = \\frac{\\varepsilon \\cdot \\Delta t}{N}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false}}, "\\Delta \\Phi");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta t = \\frac{N \\cdot \\Delta \\Phi}{\\varepsilon}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false}}, "\\Delta t");
-		this->formulas.emplace_back("Faraday's Law", "\\varepsilon = \\frac{N \\cdot \\Delta \\Phi}{\\Delta t}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta t = \\frac{\\Delta \\Phi \\cdot N}{\\varepsilon}", std::vector<Variable>{{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false}}, "\\Delta t");
-		this->formulas.emplace_back("Faraday's Law", "\\varepsilon = \\frac{\\Delta \\Phi \\cdot N}{\\Delta t}", std::vector<Variable>{{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Faraday's Law", "N = \\frac{\\Delta t \\cdot \\varepsilon}{\\Delta \\Phi}", std::vector<Variable>{{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta \\Phi = \\frac{\\Delta t \\cdot \\varepsilon}{N}", std::vector<Variable>{{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false}}, "\\Delta \\Phi");
-		this->formulas.emplace_back("Motional EMF", "B = \\frac{\\varepsilon}{L \\cdot v}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "B");
-		this->formulas.emplace_back("Motional EMF", "L = \\frac{\\frac{\\varepsilon}{B}}{v}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "L");
-		this->formulas.emplace_back("Motional EMF", "v = \\frac{\\frac{\\varepsilon}{B}}{L}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Motional EMF", "B = \\frac{\\frac{\\varepsilon}{L}}{v}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "B");
-		this->formulas.emplace_back("Motional EMF", "L = \\frac{\\varepsilon}{B \\cdot v}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "L");
-		this->formulas.emplace_back("Motional EMF", "\\varepsilon = L \\cdot B \\cdot v", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Motional EMF", "v = \\frac{\\frac{\\varepsilon}{L}}{B}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Motional EMF", "\\varepsilon = v \\cdot B \\cdot L", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Inductance EMF", "L = \\frac{\\varepsilon}{\\frac{\\Delta I}{\\Delta t}}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "L");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta I = \\frac{\\varepsilon}{L} \\cdot \\Delta t", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta I");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta t = \\frac{\\Delta I}{\\frac{\\varepsilon}{L}}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta t");
-		this->formulas.emplace_back("Inductance EMF", "\\varepsilon = L \\cdot \\frac{\\Delta I}{\\Delta t}", std::vector<Variable>{{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Inductance EMF", "L = \\frac{\\varepsilon \\cdot \\Delta t}{\\Delta I}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false}}, "L");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta I = \\frac{\\varepsilon \\cdot \\Delta t}{L}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false}}, "\\Delta I");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta t = \\frac{L \\cdot \\Delta I}{\\varepsilon}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false}}, "\\Delta t");
-		this->formulas.emplace_back("Inductance EMF", "\\varepsilon = \\frac{L \\cdot \\Delta I}{\\Delta t}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta t = \\frac{\\Delta I \\cdot L}{\\varepsilon}", std::vector<Variable>{{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "\\Delta t");
-		this->formulas.emplace_back("Inductance EMF", "\\varepsilon = \\frac{\\Delta I \\cdot L}{\\Delta t}", std::vector<Variable>{{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "\\varepsilon");
-		this->formulas.emplace_back("Inductance EMF", "L = \\frac{\\Delta t \\cdot \\varepsilon}{\\Delta I}", std::vector<Variable>{{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false}}, "L");
-		this->formulas.emplace_back("Inductance EMF", "\\Delta I = \\frac{\\Delta t \\cdot \\varepsilon}{L}", std::vector<Variable>{{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false}}, "\\Delta I");
-		this->formulas.emplace_back("Inductor Energy", "I = \\pm \\left(\\frac{2 U}{L}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Inductor Energy", "L = \\frac{2 U}{I^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "L");
-		this->formulas.emplace_back("Inductor Energy", "U = \\frac{L \\cdot I^{2}}{2}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "U");
-		this->formulas.emplace_back("Inductor Energy", "I = \\left(\\frac{2 U}{L}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "I");
-		this->formulas.emplace_back("Inductor Energy", "U = \\frac{I^{2} \\cdot L}{2}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "U");
-		this->formulas.emplace_back("LR Time Constant", "L = R \\cdot \\tau", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false}}, "L");
-    }
-} // namespace Physics
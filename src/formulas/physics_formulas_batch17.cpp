@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_17() {
-		this->formulas.emplace_back("Solenoid Inductance", "A = \\frac{\\frac{\\frac{L}{n^{2}}}{l}}{\\mu_0}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "A");
-		this->formulas.emplace_back("Solenoid Inductance", "L = n^{2} \\cdot \\mu_0 \\cdot A \\cdot l", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Solenoid Inductance", "\\mu_0 = \\frac{\\frac{\\frac{L}{n^{2}}}{l}}{A}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "\\mu_0");
-		this->formulas.emplace_back("Solenoid Inductance", "l = \\frac{\\frac{L}{n^{2}}}{\\mu_0 \\cdot A}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "l");
-		this->formulas.emplace_back("Solenoid Inductance", "n = \\left(\\frac{L}{\\mu_0 \\cdot A \\cdot l}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "n");
-		this->formulas.emplace_back("Solenoid Inductance", "A = \\frac{L}{\\mu_0 \\cdot n^{2} \\cdot l}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "A");
-		this->formulas.emplace_back("Solenoid Inductance", "L = A \\cdot \\mu_0 \\cdot n^{2} \\cdot l", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Solenoid Inductance", "\\mu_0 = \\frac{\\frac{\\frac{L}{A}}{l}}{n^{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "\\mu_0");
-		this->formulas.emplace_back("Solenoid Inductance", "l = \\frac{\\frac{L}{A}}{\\mu_0 \\cdot n^{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "l");
-		this->formulas.emplace_back("Solenoid Inductance", "n = \\pm \\left(\\frac{\\frac{\\frac{L}{A}}{l}}{\\mu_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "n");
-		this->formulas.emplace_back("Solenoid Inductance", "L = l \\cdot \\mu_0 \\cdot n^{2} \\cdot A", std::vector<Variable>{{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "L");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "C = \\frac{\\frac{1}{L}}{\\omega^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "L = \\frac{1}{\\omega^{2} \\cdot C}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "L");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "\\omega = \\pm \\left(\\frac{\\frac{1}{L}}{C}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\omega");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "C = \\frac{1}{\\omega^{2} \\cdot L}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "C");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "L = \\frac{\\frac{1}{C}}{\\omega^{2}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "L");
-		this->formulas.emplace_back("LC Circuit Angular Frequency", "\\omega = \\pm \\left(\\frac{\\frac{1}{C}}{L}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "\\omega");
-		this->formulas.emplace_back("Velocity with Acceleration", "v = t \\cdot a + v_0", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v");
-		this->formulas.emplace_back("Velocity with Acceleration", "v_0 = v - t \\cdot a", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v_0");
-		this->formulas.emplace_back("Position with Acceleration", "a = \\frac{\\frac{x - v_0 \\cdot t - x_0}{t^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "a");
-		this->formulas.emplace_back("Position with Acceleration", "v_0 = \\frac{x - \\left(x_0 + \\frac{1}{2} a \\cdot t^{2}\\right)}{t}", std::vector<Variable>{{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v_0");
-		this->formulas.emplace_back("Position with Acceleration", "x = x_0 + \\frac{1}{2} a \\cdot t^{2} + v_0 \\cdot t", std::vector<Variable>{{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "x");
-		this->formulas.emplace_back("Position with Acceleration", "x_0 = x - v_0 \\cdot t - \\frac{1}{2} a \\cdot t^{2}", std::vector<Variable>{{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "x_0");
-		this->formulas.emplace_back("Position with Acceleration", "a = \\frac{2 \\cdot \\left(x - x_0 - v_0 \\cdot t\\right)}{t^{2}}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "a");
-		this->formulas.emplace_back("Position with Acceleration", "v_0 = \\frac{x - x_0 - \\frac{a \\cdot t^{2}}{2}}{t}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v_0");
-		this->formulas.emplace_back("Position with Acceleration", "x = \\frac{a \\cdot t^{2}}{2} + v_0 \\cdot t + x_0", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "x");
-		this->formulas.emplace_back("Position with Acceleration", "x_0 = x - \\left(\\frac{a \\cdot t^{2}}{2} + v_0 \\cdot t\\right)", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "x_0");
-		this->formulas.emplace_back("Velocity-Position Relation", "v_0 = \\left(v^{2} - 2 a \\cdot \\left(x - x_0\\right)\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "v_0");
-		this->formulas.emplace_back("Velocity-Position Relation", "a = \\frac{v^{2} - v_0^{2}}{2 \\cdot \\left(x - x_0\\right)}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "a");
-		this->formulas.emplace_back("Velocity-Position Relation", "v = \\pm \\left(a \\cdot 2 \\cdot \\left(x - x_0\\right) + v_0^{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "v");
-		this->formulas.emplace_back("Velocity-Position Relation", "v_0 = \\pm \\left(v^{2} - a \\cdot 2 \\cdot \\left(x - x_0\\right)\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "v_0");
-		this->formulas.emplace_back("Velocity-Position Relation", "x = \\frac{\\frac{v^{2} - v_0^{2}}{a}}{2} + x_0", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "x");
-		this->formulas.emplace_back("Velocity-Position Relation", "x_0 = x - \\frac{\\frac{v^{2} - v_0^{2}}{a}}{2}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "x_0");
-		this->formulas.emplace_back("Velocity-Position Relation", "v = \\pm \\left(\\left(x - x_0\\right) \\cdot 2 a + v_0^{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v");
-		this->formulas.emplace_back("Velocity-Position Relation", "v_0 = \\pm \\left(v^{2} - \\left(x - x_0\\right) \\cdot 2 a\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v_0");
-		this->formulas.emplace_back("Velocity-Position Relation", "x = x_0 + \\frac{v^{2} - v_0^{2}}{2 a}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "x");
-		this->formulas.emplace_back("Average Velocity", "t = \\frac{x - x_0}{v_avg}", std::vector<Variable>{{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Average Velocity", "v_avg = \\frac{x - x_0}{t}", std::vector<Variable>{{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v_avg");
-		this->formulas.emplace_back("Average Velocity", "x = v_avg \\cdot t + x_0", std::vector<Variable>{{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "x");
-		this->formulas.emplace_back("Average Velocity", "x_0 = x - v_avg \\cdot t", std::vector<Variable>{{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "x_0");
-		this->formulas.emplace_back("Average Velocity", "x = x_0 + v_avg \\cdot t", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "x");
-		this->formulas.emplace_back("Average Velocity", "x = t \\cdot v_avg + x_0", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false}}, "x");
-		this->formulas.emplace_back("Average Velocity", "x_0 = x - t \\cdot v_avg", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false}}, "x_0");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v = 2 v_avg - v_0", std::vector<Variable>{{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false}}, "v");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v_0 = 2 v_avg - v", std::vector<Variable>{{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false}}, "v_0");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v_avg = \\frac{v + v_0}{2}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false}}, "v_avg");
-		this->formulas.emplace_back("Free Fall Velocity", "v = t \\cdot g", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "v");
-		this->formulas.emplace_back("Free Fall Distance", "g = \\frac{2 y}{t^{2}}", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Free Fall Distance", "t = \\left(\\frac{2 y}{g}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "t");
-		this->formulas.emplace_back("Free Fall Distance", "y = \\frac{t^{2} \\cdot g}{2}", std::vector<Variable>{{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "y");
-		this->formulas.emplace_back("Free Fall Velocity-Distance", "v = \\pm \\left(y \\cdot 2 g\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Charge", "B = \\frac{\\frac{F}{q}}{v}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Charge", "q = \\frac{F}{v \\cdot B}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Magnetic Force on Charge", "v = \\frac{\\frac{F}{q}}{B}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Charge", "B = \\frac{\\frac{F}{v}}{q}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Charge", "F = v \\cdot q \\cdot B", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Charge", "q = \\frac{\\frac{F}{v}}{B}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Magnetic Force on Charge", "v = \\frac{F}{q \\cdot B}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Charge", "F = B \\cdot q \\cdot v", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Current", "B = \\frac{F}{I \\cdot L}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Current", "I = \\frac{\\frac{F}{B}}{L}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on Current", "L = \\frac{\\frac{F}{B}}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Magnetic Force on Current", "B = \\frac{\\frac{F}{I}}{L}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Current", "F = I \\cdot B \\cdot L", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Current", "I = \\frac{F}{B \\cdot L}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on Current", "L = \\frac{\\frac{F}{I}}{B}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Magnetic Force on Current", "F = L \\cdot B \\cdot I", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "F");
-		this->formulas.emplace_back("Magnetic Field of Wire", "B = \\frac{I \\cdot \\mu_0}{2 \\pi \\cdot r}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Wire", "I = \\frac{2 \\pi \\cdot r \\cdot B}{\\mu_0}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Wire", "\\mu_0 = \\frac{2 \\pi \\cdot r \\cdot B}{I}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Wire", "\\pi = \\frac{\\frac{\\frac{I \\cdot \\mu_0}{B}}{r}}{2}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field of Wire", "r = \\frac{\\frac{I \\cdot \\mu_0}{B}}{2 \\pi}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "r");
-		this->formulas.emplace_back("Magnetic Field of Wire", "B = \\frac{\\frac{\\mu_0 \\cdot I}{r}}{2 \\pi}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Wire", "I = \\frac{r \\cdot 2 \\pi \\cdot B}{\\mu_0}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Wire", "\\mu_0 = \\frac{r \\cdot 2 \\pi \\cdot B}{I}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Wire", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I}{r}}{B}}{2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field of Wire", "r = \\frac{\\mu_0 \\cdot I}{2 \\pi \\cdot B}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "B = n \\cdot \\mu_0 \\cdot I", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "I = \\frac{\\frac{B}{n}}{\\mu_0}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "\\mu_0 = \\frac{\\frac{B}{n}}{I}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "n = \\frac{B}{\\mu_0 \\cdot I}", std::vector<Variable>{{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "n");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "B = I \\cdot \\mu_0 \\cdot n", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Radius", "B = \\frac{m \\cdot v}{r \\cdot q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Radius", "q = \\frac{\\frac{m \\cdot v}{B}}{r}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Radius", "r = \\frac{\\frac{m \\cdot v}{B}}{q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "r");
-		this->formulas.emplace_back("Cyclotron Radius", "B = \\frac{v \\cdot m}{r \\cdot q}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Radius", "q = \\frac{\\frac{v \\cdot m}{B}}{r}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Radius", "r = \\frac{\\frac{v \\cdot m}{B}}{q}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "r");
-		this->formulas.emplace_back("Cyclotron Radius", "B = \\frac{\\frac{m \\cdot v}{q}}{r}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Radius", "m = \\frac{q \\cdot r \\cdot B}{v}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Radius", "q = \\frac{m \\cdot v}{r \\cdot B}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Radius", "r = \\frac{\\frac{m \\cdot v}{q}}{B}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "r");
-		this->formulas.emplace_back("Cyclotron Radius", "v = \\frac{q \\cdot r \\cdot B}{m}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Cyclotron Radius", "B = \\frac{m \\cdot v}{q \\cdot r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "B");
-    }
-} // namespace Physics
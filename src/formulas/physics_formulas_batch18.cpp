@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_18() {
-		this->formulas.emplace_back("Cyclotron Radius", "m = \\frac{B \\cdot q \\cdot r}{v}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Radius", "v = \\frac{B \\cdot q \\cdot r}{m}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "v");
-		this->formulas.emplace_back("Magnetic Flux", "A = \\frac{\\Phi}{B}", std::vector<Variable>{{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Magnetic Flux", "B = \\frac{\\Phi}{A}", std::vector<Variable>{{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "B");
-		this->formulas.emplace_back("Magnetic Flux", "\\Phi = B \\cdot A", std::vector<Variable>{{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "\\Phi");
-		this->formulas.emplace_back("Magnetic Flux", "\\Phi = A \\cdot B", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\Phi");
-		this->formulas.emplace_back("Cyclotron Frequency", "B = \\frac{2 \\pi \\cdot m \\cdot f}{q}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Frequency", "q = \\frac{2 \\pi \\cdot m \\cdot f}{B}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Frequency", "\\pi = \\frac{\\frac{\\frac{B \\cdot q}{f}}{m}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "\\pi");
-		this->formulas.emplace_back("Cyclotron Frequency", "f = \\frac{B \\cdot q}{2 \\pi \\cdot m}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "f");
-		this->formulas.emplace_back("Cyclotron Frequency", "m = \\frac{\\frac{B \\cdot q}{f}}{2 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Frequency", "B = \\frac{m \\cdot 2 \\pi \\cdot f}{q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Frequency", "\\pi = \\frac{\\frac{\\frac{q \\cdot B}{m}}{f}}{2}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "\\pi");
-		this->formulas.emplace_back("Cyclotron Frequency", "f = \\frac{\\frac{q \\cdot B}{m}}{2 \\pi}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "f");
-		this->formulas.emplace_back("Cyclotron Frequency", "m = \\frac{q \\cdot B}{2 \\pi \\cdot f}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Frequency", "q = \\frac{m \\cdot 2 \\pi \\cdot f}{B}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "q");
-		this->formulas.emplace_back("Magnetic Energy Density", "B = \\left(2 \\mu_0 \\cdot u\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false}}, "B");
-		this->formulas.emplace_back("Hall Voltage", "B = \\frac{n \\cdot q \\cdot V_H \\cdot t}{I}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "B");
-		this->formulas.emplace_back("Hall Voltage", "I = \\frac{n \\cdot q \\cdot V_H \\cdot t}{B}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "I");
-		this->formulas.emplace_back("Hall Voltage", "V_H = \\frac{\\frac{\\frac{I \\cdot B}{n}}{t}}{q}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "V_H");
-		this->formulas.emplace_back("Hall Voltage", "n = \\frac{I \\cdot B}{q \\cdot V_H \\cdot t}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "n");
-		this->formulas.emplace_back("Hall Voltage", "q = \\frac{\\frac{\\frac{I \\cdot B}{n}}{t}}{V_H}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "q");
-		this->formulas.emplace_back("Hall Voltage", "t = \\frac{\\frac{I \\cdot B}{n}}{q \\cdot V_H}", std::vector<Variable>{{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "t");
-		this->formulas.emplace_back("Hall Voltage", "V_H = \\frac{\\frac{B \\cdot I}{t}}{n \\cdot q}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "V_H");
-		this->formulas.emplace_back("Hall Voltage", "n = \\frac{\\frac{\\frac{B \\cdot I}{t}}{V_H}}{q}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "n");
-		this->formulas.emplace_back("Hall Voltage", "q = \\frac{\\frac{\\frac{B \\cdot I}{t}}{V_H}}{n}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "q");
-		this->formulas.emplace_back("Hall Voltage", "t = \\frac{B \\cdot I}{n \\cdot q \\cdot V_H}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "t");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "B = \\frac{\\mu_0 \\cdot I_enc}{2 \\pi \\cdot r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "B");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "I_enc = \\frac{B \\cdot 2 \\pi \\cdot r}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "I_enc");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "\\mu_0 = \\frac{B \\cdot 2 \\pi \\cdot r}{I_enc}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "\\mu_0");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_enc}{B}}{r}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "\\pi");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "r = \\frac{\\frac{\\mu_0 \\cdot I_enc}{B}}{2 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "r");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "B = \\frac{I_enc \\cdot \\mu_0}{2 \\pi \\cdot r}", std::vector<Variable>{{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "B");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "I_enc = \\frac{2 \\pi \\cdot r \\cdot B}{\\mu_0}", std::vector<Variable>{{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "I_enc");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "\\mu_0 = \\frac{2 \\pi \\cdot r \\cdot B}{I_enc}", std::vector<Variable>{{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\mu_0");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "\\pi = \\frac{\\frac{\\frac{I_enc \\cdot \\mu_0}{B}}{r}}{2}", std::vector<Variable>{{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\pi");
-		this->formulas.emplace_back("Ampere's Law for Circular Path", "r = \\frac{\\frac{I_enc \\cdot \\mu_0}{B}}{2 \\pi}", std::vector<Variable>{{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "r");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "A = \\frac{\\mu}{I}", std::vector<Variable>{{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "A");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "I = \\frac{\\mu}{A}", std::vector<Variable>{{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "I");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "\\mu = I \\cdot A", std::vector<Variable>{{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "\\mu");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "\\mu = A \\cdot I", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "B = \\frac{\\tau}{\\mu}", std::vector<Variable>{{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "\\mu = \\frac{\\tau}{B}", std::vector<Variable>{{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\mu");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "\\tau = \\mu \\cdot B", std::vector<Variable>{{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\tau");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "\\tau = B \\cdot \\mu", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false}}, "\\tau");
-		this->formulas.emplace_back("Magnetic Dipole Potential Energy", "B = \\frac{U}{-\\mu}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Dipole Potential Energy", "U = -\\mu \\cdot B", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "U");
-		this->formulas.emplace_back("Magnetic Dipole Potential Energy", "\\mu = -\\frac{U}{B}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\mu");
-		this->formulas.emplace_back("Force Between Parallel Currents", "F = \\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d} \\cdot L}{2 \\pi}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "F");
-		this->formulas.emplace_back("Force Between Parallel Currents", "I_1 = \\frac{\\frac{d \\cdot \\frac{2 \\pi \\cdot F}{L}}{I_2}}{\\mu_0}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "I_1");
-		this->formulas.emplace_back("Force Between Parallel Currents", "I_2 = \\frac{d \\cdot \\frac{2 \\pi \\cdot F}{L}}{\\mu_0 \\cdot I_1}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "I_2");
-		this->formulas.emplace_back("Force Between Parallel Currents", "L = \\frac{2 \\pi \\cdot F}{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d}}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "L");
-		this->formulas.emplace_back("Force Between Parallel Currents", "\\mu_0 = \\frac{\\frac{d \\cdot \\frac{2 \\pi \\cdot F}{L}}{I_2}}{I_1}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "\\mu_0");
-		this->formulas.emplace_back("Force Between Parallel Currents", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d} \\cdot L}{F}}{2}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "\\pi");
-		this->formulas.emplace_back("Force Between Parallel Currents", "d = \\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{\\frac{2 \\pi \\cdot F}{L}}", std::vector<Variable>{{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false}}, "d");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "B = \\frac{\\mu_0 \\cdot I}{2 r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "I = \\frac{B \\cdot 2 r}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "\\mu_0 = \\frac{B \\cdot 2 r}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "r = \\frac{\\frac{\\mu_0 \\cdot I}{B}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "B = \\frac{I \\cdot \\mu_0}{2 r}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "B");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "I = \\frac{2 r \\cdot B}{\\mu_0}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "I");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "\\mu_0 = \\frac{2 r \\cdot B}{I}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "r = \\frac{\\frac{I \\cdot \\mu_0}{B}}{2}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "r");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "B = \\frac{\\frac{\\mu_0 \\cdot I}{r}}{2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "I = \\frac{r \\cdot 2 B}{\\mu_0}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "\\mu_0 = \\frac{r \\cdot 2 B}{I}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field at Center of Loop", "r = \\frac{\\mu_0 \\cdot I}{2 B}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "r");
-		this->formulas.emplace_back("Biot-Savart Law", "B = \\frac{\\frac{\\mu_0 \\cdot I \\cdot d \\cdot l \\cdot \\sin\\left(\\theta\\right)}{4 \\pi \\cdot r^{2}}}{d}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "B");
-		this->formulas.emplace_back("Biot-Savart Law", "I = \\frac{\\frac{\\frac{\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\sin\\left(\\theta\\right)}}{l}}{d}}{\\mu_0}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "I");
-		this->formulas.emplace_back("Biot-Savart Law", "\\mu_0 = \\frac{\\frac{\\frac{\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\sin\\left(\\theta\\right)}}{l}}{d}}{I}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "\\mu_0");
-		this->formulas.emplace_back("Biot-Savart Law", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I \\cdot d \\cdot l \\cdot \\sin\\left(\\theta\\right)}{d \\cdot B}}{r^{2}}}{4}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "\\pi");
-		this->formulas.emplace_back("Biot-Savart Law", "\\theta = \\arcsin\\left(\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\mu_0 \\cdot I \\cdot d \\cdot l}\\right)", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "\\theta");
-		this->formulas.emplace_back("Biot-Savart Law", "l = \\frac{\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\sin\\left(\\theta\\right)}}{\\mu_0 \\cdot I \\cdot d}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "l");
-		this->formulas.emplace_back("Biot-Savart Law", "r = \\pm \\left(\\frac{\\frac{\\mu_0 \\cdot I \\cdot d \\cdot l \\cdot \\sin\\left(\\theta\\right)}{d \\cdot B}}{4 \\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false}}, "r");
-		this->formulas.emplace_back("Cyclotron Period", "B = \\frac{m \\cdot 2 \\pi}{T \\cdot q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Period", "T = \\frac{\\frac{m \\cdot 2 \\pi}{B}}{q}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "T");
-		this->formulas.emplace_back("Cyclotron Period", "q = \\frac{\\frac{m \\cdot 2 \\pi}{B}}{T}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Period", "B = \\frac{2 \\pi \\cdot m}{q \\cdot T}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Period", "T = \\frac{\\frac{2 \\pi \\cdot m}{B}}{q}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "T");
-		this->formulas.emplace_back("Cyclotron Period", "\\pi = \\frac{\\frac{B \\cdot q \\cdot T}{m}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "\\pi");
-		this->formulas.emplace_back("Cyclotron Period", "m = \\frac{B \\cdot q \\cdot T}{2 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Period", "q = \\frac{\\frac{2 \\pi \\cdot m}{B}}{T}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "q");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "B = \\frac{N \\cdot \\mu_0 \\cdot I}{2 \\pi \\cdot r}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "I = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{N}}{\\mu_0}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "N = \\frac{2 \\pi \\cdot r \\cdot B}{\\mu_0 \\cdot I}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "N");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "\\mu_0 = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{N}}{I}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "\\pi = \\frac{\\frac{\\frac{N \\cdot \\mu_0 \\cdot I}{B}}{r}}{2}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "r = \\frac{\\frac{N \\cdot \\mu_0 \\cdot I}{B}}{2 \\pi}", std::vector<Variable>{{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "B = \\frac{I \\cdot \\mu_0 \\cdot N}{2 \\pi \\cdot r}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "I = \\frac{2 \\pi \\cdot r \\cdot B}{\\mu_0 \\cdot N}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "N = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{I}}{\\mu_0}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "N");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "\\mu_0 = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{I}}{N}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "\\pi = \\frac{\\frac{\\frac{I \\cdot \\mu_0 \\cdot N}{B}}{r}}{2}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field in Toroid", "r = \\frac{\\frac{I \\cdot \\mu_0 \\cdot N}{B}}{2 \\pi}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false}}, "r");
-    }
-} // namespace Physics
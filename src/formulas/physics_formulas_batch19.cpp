@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_19() {
-		this->formulas.emplace_back("Velocity Selector", "E = B \\cdot v", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "E");
-		this->formulas.emplace_back("Mass Spectrometer", "B = \\pm \\left(\\frac{\\frac{m \\cdot 2 V}{r^{2}}}{q}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false}}, "B");
-		this->formulas.emplace_back("Mass Spectrometer", "V = \\frac{\\frac{q \\cdot B^{2} \\cdot r^{2}}{m}}{2}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false}}, "V");
-		this->formulas.emplace_back("Mass Spectrometer", "m = \\frac{q \\cdot B^{2} \\cdot r^{2}}{2 V}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false}}, "m");
-		this->formulas.emplace_back("Mass Spectrometer", "q = \\frac{\\frac{m \\cdot 2 V}{r^{2}}}{B^{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false}}, "q");
-		this->formulas.emplace_back("Mass Spectrometer", "r = \\pm \\left(\\frac{m \\cdot 2 V}{q \\cdot B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false}}, "r");
-		this->formulas.emplace_back("Mass Spectrometer", "B = \\pm \\left(\\frac{\\frac{2 m \\cdot V}{r^{2}}}{q}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Mass Spectrometer", "V = \\frac{r^{2} \\cdot q \\cdot B^{2}}{2 m}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "V");
-		this->formulas.emplace_back("Mass Spectrometer", "m = \\frac{\\frac{r^{2} \\cdot q \\cdot B^{2}}{V}}{2}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "m");
-		this->formulas.emplace_back("Mass Spectrometer", "q = \\frac{\\frac{2 m \\cdot V}{r^{2}}}{B^{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Mass Spectrometer", "r = \\left(\\frac{2 m \\cdot V}{q \\cdot B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "r");
-		this->formulas.emplace_back("Mass Spectrometer", "B = \\left(\\frac{2 m \\cdot V}{q \\cdot r^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false}}, "B");
-		this->formulas.emplace_back("Mass Spectrometer", "V = \\frac{B^{2} \\cdot q \\cdot r^{2}}{2 m}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false}}, "V");
-		this->formulas.emplace_back("Mass Spectrometer", "m = \\frac{\\frac{B^{2} \\cdot q \\cdot r^{2}}{V}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false}}, "m");
-		this->formulas.emplace_back("Mass Spectrometer", "q = \\frac{\\frac{2 m \\cdot V}{B^{2}}}{r^{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false}}, "q");
-		this->formulas.emplace_back("Mass Spectrometer", "r = \\pm \\left(\\frac{\\frac{2 m \\cdot V}{B^{2}}}{q}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false}}, "r");
-		this->formulas.emplace_back("Photoelectric Effect", "E_max = \\frac{f \\cdot h - \\phi}{K}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false},{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true}}, "E_max");
-		this->formulas.emplace_back("Photoelectric Effect", "K = \\frac{f \\cdot h - \\phi}{E_max}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false},{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true}}, "K");
-		this->formulas.emplace_back("Photoelectric Effect", "\\phi = f \\cdot h - K \\cdot E_max", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false},{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true}}, "\\phi");
-		this->formulas.emplace_back("Photoelectric Effect", "f = \\frac{\\phi + K \\cdot E_max}{h}", std::vector<Variable>{{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false}}, "f");
-		this->formulas.emplace_back("Photoelectric Effect", "h = \\frac{\\phi + K \\cdot E_max}{f}", std::vector<Variable>{{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false}}, "h");
-		this->formulas.emplace_back("Photon Energy", "E = f \\cdot h", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true}}, "E");
-		this->formulas.emplace_back("de Broglie Wavelength", "h = p \\cdot \\lambda", std::vector<Variable>{{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false},{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "h");
-		this->formulas.emplace_back("Momentum", "p = v \\cdot m", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "p");
-		this->formulas.emplace_back("Change in Momentum", "\\Delta p = m \\cdot \\Delta v", std::vector<Variable>{{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false}}, "\\Delta p");
-		this->formulas.emplace_back("Change in Momentum", "\\Delta v = \\frac{\\Delta p}{m}", std::vector<Variable>{{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false}}, "\\Delta v");
-		this->formulas.emplace_back("Change in Momentum", "m = \\frac{\\Delta p}{\\Delta v}", std::vector<Variable>{{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false}}, "m");
-		this->formulas.emplace_back("Change in Momentum", "\\Delta p = \\Delta v \\cdot m", std::vector<Variable>{{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false},{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "\\Delta p");
-		this->formulas.emplace_back("Conservation of Momentum", "p_f = p_i", std::vector<Variable>{{"p_f", {1, -1, 1, 0, 0, 0, 0}, "Final momentum", false},{"p_i", {1, -1, 1, 0, 0, 0, 0}, "Initial momentum", false}}, "p_f");
-		this->formulas.emplace_back("Conservation of Momentum", "p_i = p_f", std::vector<Variable>{{"p_f", {1, -1, 1, 0, 0, 0, 0}, "Final momentum", false},{"p_i", {1, -1, 1, 0, 0, 0, 0}, "Initial momentum", false}}, "p_i");
-		this->formulas.emplace_back("Perfectly Inelastic Collision", "v_1i = \\frac{v_f \\cdot \\left(m_1 + m_2\\right) - m_2 \\cdot v_2i}{m_1}", std::vector<Variable>{{"v_f", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"v_{1i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"v_{2i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 2", false}}, "v_1i");
-		this->formulas.emplace_back("Perfectly Inelastic Collision", "v_2i = \\frac{v_f \\cdot \\left(m_1 + m_2\\right) - m_1 \\cdot v_1i}{m_2}", std::vector<Variable>{{"v_f", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"v_{1i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"v_{2i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 2", false}}, "v_2i");
-		this->formulas.emplace_back("Perfectly Inelastic Collision", "v_f = \\frac{m_1 \\cdot v_1i + m_2 \\cdot v_2i}{m_1 + m_2}", std::vector<Variable>{{"v_f", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},{"v_{1i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 1", false},{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},{"v_{2i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 2", false}}, "v_f");
-		this->formulas.emplace_back("Magnification", "d_i = -m \\cdot d_o", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "d_i");
-		this->formulas.emplace_back("Magnification", "d_o = \\frac{d_i}{-m}", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "d_o");
-		this->formulas.emplace_back("Magnification", "m = -\\frac{d_i}{d_o}", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "m");
-		this->formulas.emplace_back("Magnification", "d_i = -d_o \\cdot m", std::vector<Variable>{{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false}}, "d_i");
-		this->formulas.emplace_back("Magnification", "d_o = -\\frac{d_i}{m}", std::vector<Variable>{{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false}}, "d_o");
-		this->formulas.emplace_back("Magnification", "m = \\frac{d_i}{-d_o}", std::vector<Variable>{{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false}}, "m");
-		this->formulas.emplace_back("Magnification from Height", "h_i = m \\cdot h_o", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "h_i");
-		this->formulas.emplace_back("Magnification from Height", "h_o = \\frac{h_i}{m}", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "h_o");
-		this->formulas.emplace_back("Magnification from Height", "m = \\frac{h_i}{h_o}", std::vector<Variable>{{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "m");
-		this->formulas.emplace_back("Magnification from Height", "h_i = h_o \\cdot m", std::vector<Variable>{{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false}}, "h_i");
-		this->formulas.emplace_back("SHM Angular Frequency", "\\omega = \\left(\\frac{k}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "\\omega");
-		this->formulas.emplace_back("SHM Angular Frequency", "k = \\omega^{2} \\cdot m", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "k");
-		this->formulas.emplace_back("SHM Angular Frequency", "m = \\frac{k}{\\omega^{2}}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "m");
-		this->formulas.emplace_back("SHM Angular Frequency", "\\omega = \\pm \\left(\\frac{k}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false}}, "\\omega");
-		this->formulas.emplace_back("SHM Angular Frequency", "k = m \\cdot \\omega^{2}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false}}, "k");
-		this->formulas.emplace_back("Mass-Spring Period", "T = \\pm \\left(\\frac{m \\cdot 4 \\pi^{2}}{k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "T");
-		this->formulas.emplace_back("Mass-Spring Period", "\\pi = \\pm \\left(\\frac{\\frac{k \\cdot T^{2}}{m}}{4}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "\\pi");
-		this->formulas.emplace_back("Mass-Spring Period", "k = \\frac{m \\cdot 4 \\pi^{2}}{T^{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "k");
-		this->formulas.emplace_back("Mass-Spring Period", "m = \\frac{k \\cdot T^{2}}{4 \\pi^{2}}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "m");
-		this->formulas.emplace_back("Mass-Spring Period", "T = \\pm \\left(\\frac{4 \\pi^{2} \\cdot m}{k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "T");
-		this->formulas.emplace_back("Mass-Spring Period", "k = \\frac{4 \\pi^{2} \\cdot m}{T^{2}}", std::vector<Variable>{{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "k");
-		this->formulas.emplace_back("Simple Pendulum Period", "L = \\frac{g \\cdot T^{2}}{4 \\pi^{2}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "L");
-		this->formulas.emplace_back("Simple Pendulum Period", "T = \\pm \\left(\\frac{L \\cdot 4 \\pi^{2}}{g}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "T");
-		this->formulas.emplace_back("Simple Pendulum Period", "\\pi = \\pm \\left(\\frac{\\frac{g \\cdot T^{2}}{L}}{4}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "\\pi");
-		this->formulas.emplace_back("Simple Pendulum Period", "g = \\frac{L \\cdot 4 \\pi^{2}}{T^{2}}", std::vector<Variable>{{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false}}, "g");
-		this->formulas.emplace_back("Angular Frequency", "\\omega = f \\cdot 2 \\pi", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false}}, "\\omega");
-		this->formulas.emplace_back("Torque", "\\tau = F \\cdot r", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\tau");
-		this->formulas.emplace_back("Rotational Second Law", "\\tau = \\alpha \\cdot I", std::vector<Variable>{{"\\\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false}}, "\\tau");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "E = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{K}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "E");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "I = \\frac{\\frac{K \\cdot E}{\\omega^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "I");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "K = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{E}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "K");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "\\omega = \\pm \\left(\\frac{K \\cdot E}{\\frac{1}{2} I}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "E = \\frac{I \\cdot \\omega^{2}}{2 K}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "E");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "I = \\frac{2 K \\cdot E}{\\omega^{2}}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "I");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "K = \\frac{\\frac{I \\cdot \\omega^{2}}{E}}{2}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "K");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "\\omega = \\pm \\left(\\frac{2 K \\cdot E}{I}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "E = \\frac{\\omega^{2} \\cdot I}{2 K}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false}}, "E");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "K = \\frac{\\frac{\\omega^{2} \\cdot I}{E}}{2}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false}}, "K");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "\\omega = \\left(\\frac{2 K \\cdot E}{I}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false}}, "\\omega");
-		this->formulas.emplace_back("Angular Momentum", "L = \\omega \\cdot I", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false}}, "L");
-		this->formulas.emplace_back("Linear-Angular Velocity", "v = \\omega \\cdot r", std::vector<Variable>{{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Linear velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "v");
-		this->formulas.emplace_back("Moment of Inertia Point Mass", "I = r^{2} \\cdot m", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "I");
-		this->formulas.emplace_back("Moment of Inertia Point Mass", "r = \\left(\\frac{I}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "r");
-		this->formulas.emplace_back("Heat Transfer", "\\Delta T = \\frac{\\frac{Q}{m}}{c}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Heat Transfer", "c = \\frac{\\frac{Q}{m}}{\\Delta T}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "c");
-		this->formulas.emplace_back("Heat Transfer", "m = \\frac{Q}{c \\cdot \\Delta T}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "m");
-		this->formulas.emplace_back("Heat Transfer", "Q = c \\cdot m \\cdot \\Delta T", std::vector<Variable>{{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "Q");
-		this->formulas.emplace_back("Heat Transfer", "\\Delta T = \\frac{\\frac{Q}{c}}{m}", std::vector<Variable>{{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Heat Transfer", "c = \\frac{Q}{m \\cdot \\Delta T}", std::vector<Variable>{{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "c");
-		this->formulas.emplace_back("Heat Transfer", "m = \\frac{\\frac{Q}{c}}{\\Delta T}", std::vector<Variable>{{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "m");
-		this->formulas.emplace_back("Heat Transfer", "Q = \\Delta T \\cdot m \\cdot c", std::vector<Variable>{{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false}}, "Q");
-		this->formulas.emplace_back("Latent Heat", "Q = L \\cdot m", std::vector<Variable>{{"L", {2, -2, 0, 0, 0, 0, 0}, "Latent heat", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "Q");
-		this->formulas.emplace_back("Linear Thermal Expansion", "L_0 = \\frac{\\frac{\\Delta L}{\\alpha}}{\\Delta T}", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"\\\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "L_0");
-		this->formulas.emplace_back("Linear Thermal Expansion", "\\Delta T = \\frac{\\frac{\\Delta L}{\\alpha}}{L_0}", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"\\\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Linear Thermal Expansion", "\\alpha = \\frac{\\Delta L}{L_0 \\cdot \\Delta T}", std::vector<Variable>{{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"\\\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\alpha");
-		this->formulas.emplace_back("First Law of Thermodynamics", "Q = W + \\Delta U", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added", false},{"\\\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false}}, "Q");
-		this->formulas.emplace_back("Carnot Efficiency", "T_c = T_h \\cdot \\left(1 - \\eta\\right)", std::vector<Variable>{{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false},{"\\\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false}}, "T_c");
-		this->formulas.emplace_back("Wave Velocity", "v = \\lambda \\cdot f", std::vector<Variable>{{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "v");
-		this->formulas.emplace_back("Wave Speed on String", "T = \\mu \\cdot v^{2}", std::vector<Variable>{{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},{"\\\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false}}, "T");
-		this->formulas.emplace_back("Wave Speed on String", "v = \\pm \\left(\\frac{T}{\\mu}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},{"\\\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false}}, "v");
-		this->formulas.emplace_back("Doppler Effect Moving Source", "f_obs = f_s \\cdot \\frac{v}{v \\pm v_s}", std::vector<Variable>{{"f_{obs}", {0, -1, 0, 0, 0, 0, 0}, "Observed frequency", false},{"f_s", {0, -1, 0, 0, 0, 0, 0}, "Source frequency", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false},{"v_s", {1, -1, 0, 0, 0, 0, 0}, "Source velocity", false}}, "f_obs");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_2() {
-		this->formulas.emplace_back("LC Oscillation Frequency", "f = \\frac{1}{2 \\pi \\cdot \\left(L \\cdot C\\right)^{\\frac{1}{2}}}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "f");
-		this->formulas.emplace_back("Inductance from Flux", "I = \\frac{N \\cdot \\Phi_B}{L}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Inductance from Flux", "L = \\frac{N \\cdot \\Phi_B}{I}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "L");
-		this->formulas.emplace_back("Inductance from Flux", "N = \\frac{L \\cdot I}{\\Phi_B}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "N");
-		this->formulas.emplace_back("Inductance from Flux", "\\Phi_B = \\frac{L \\cdot I}{N}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Toroid Inductance", "A = \\frac{L \\cdot 2 \\pi \\cdot r}{\\mu_0 \\cdot N^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "A");
-		this->formulas.emplace_back("Toroid Inductance", "L = \\frac{\\mu_0 \\cdot N^{2} \\cdot A}{2 \\pi \\cdot r}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "L");
-		this->formulas.emplace_back("Toroid Inductance", "N = \\pm \\left(\\frac{\\frac{L \\cdot 2 \\pi \\cdot r}{A}}{\\mu_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "N");
-		this->formulas.emplace_back("Toroid Inductance", "\\mu_0 = \\frac{\\frac{L \\cdot 2 \\pi \\cdot r}{A}}{N^{2}}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "\\mu_0");
-		this->formulas.emplace_back("Toroid Inductance", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot N^{2} \\cdot A}{L}}{r}}{2}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "\\pi");
-		this->formulas.emplace_back("Toroid Inductance", "r = \\frac{\\frac{\\mu_0 \\cdot N^{2} \\cdot A}{L}}{2 \\pi}", std::vector<Variable>{{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "r");
-		this->formulas.emplace_back("Mutual Inductance Relation", "L_1 = \\frac{\\left(\\frac{M}{k}\\right)^{2}}{L_2}", std::vector<Variable>{{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"k", {0, 0, 0, 0, 0, 0, 0}, "Coupling coefficient", false},{"L_1", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 1", false},{"L_2", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 2", false}}, "L_1");
-		this->formulas.emplace_back("Mutual Inductance Relation", "L_2 = \\frac{\\left(\\frac{M}{k}\\right)^{2}}{L_1}", std::vector<Variable>{{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"k", {0, 0, 0, 0, 0, 0, 0}, "Coupling coefficient", false},{"L_1", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 1", false},{"L_2", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 2", false}}, "L_2");
-		this->formulas.emplace_back("Mutual Inductance Relation", "M = k \\cdot \\left(L_1 \\cdot L_2\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"k", {0, 0, 0, 0, 0, 0, 0}, "Coupling coefficient", false},{"L_1", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 1", false},{"L_2", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 2", false}}, "M");
-		this->formulas.emplace_back("Mutual Inductance Relation", "k = \\frac{M}{\\left(L_1 \\cdot L_2\\right)^{\\frac{1}{2}}}", std::vector<Variable>{{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},{"k", {0, 0, 0, 0, 0, 0, 0}, "Coupling coefficient", false},{"L_1", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 1", false},{"L_2", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 2", false}}, "k");
-		this->formulas.emplace_back("LC Angular Frequency", "C = \\frac{\\left(\\frac{1}{\\omega}\\right)^{2}}{L}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("LC Angular Frequency", "L = \\frac{\\left(\\frac{1}{\\omega}\\right)^{2}}{C}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "L");
-		this->formulas.emplace_back("LC Angular Frequency", "\\omega = \\frac{1}{\\left(L \\cdot C\\right)^{\\frac{1}{2}}}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\omega");
-		this->formulas.emplace_back("Quality Factor", "L = \\frac{Q \\cdot R}{\\omega_0}", std::vector<Variable>{{"Q", {0, 0, 0, 0, 0, 0, 0}, "Quality factor", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "L");
-		this->formulas.emplace_back("Quality Factor", "Q = \\frac{\\omega_0 \\cdot L}{R}", std::vector<Variable>{{"Q", {0, 0, 0, 0, 0, 0, 0}, "Quality factor", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "Q");
-		this->formulas.emplace_back("Quality Factor", "R = \\frac{\\omega_0 \\cdot L}{Q}", std::vector<Variable>{{"Q", {0, 0, 0, 0, 0, 0, 0}, "Quality factor", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Quality Factor", "\\omega_0 = \\frac{Q \\cdot R}{L}", std::vector<Variable>{{"Q", {0, 0, 0, 0, 0, 0, 0}, "Quality factor", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant angular frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "\\omega_0");
-		this->formulas.emplace_back("Snell's Law", "\\theta_1 = \\arcsin\\left(\\frac{n_2 \\cdot \\sin\\left(\\theta_2\\right)}{n_1}\\right)", std::vector<Variable>{{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle of incidence", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle of refraction", false}}, "\\theta_1");
-		this->formulas.emplace_back("Snell's Law", "\\theta_2 = \\arcsin\\left(\\frac{n_1 \\cdot \\sin\\left(\\theta_1\\right)}{n_2}\\right)", std::vector<Variable>{{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle of incidence", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle of refraction", false}}, "\\theta_2");
-		this->formulas.emplace_back("Snell's Law", "n_1 = \\frac{n_2 \\cdot \\sin\\left(\\theta_2\\right)}{\\sin\\left(\\theta_1\\right)}", std::vector<Variable>{{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle of incidence", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle of refraction", false}}, "n_1");
-		this->formulas.emplace_back("Snell's Law", "n_2 = \\frac{n_1 \\cdot \\sin\\left(\\theta_1\\right)}{\\sin\\left(\\theta_2\\right)}", std::vector<Variable>{{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle of incidence", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle of refraction", false}}, "n_2");
-		this->formulas.emplace_back("Mirror/Lens Equation", "d_i = \\frac{1}{\\frac{1}{f} - \\frac{1}{d_o}}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false}}, "d_i");
-		this->formulas.emplace_back("Mirror/Lens Equation", "d_o = \\frac{1}{\\frac{1}{f} - \\frac{1}{d_i}}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false}}, "d_o");
-		this->formulas.emplace_back("Mirror/Lens Equation", "f = \\frac{1}{\\frac{1}{d_o} + \\frac{1}{d_i}}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false}}, "f");
-		this->formulas.emplace_back("Magnification", "M = \\frac{d_i}{d_o}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "M");
-		this->formulas.emplace_back("Magnification", "d_i = M \\cdot d_o", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "d_i");
-		this->formulas.emplace_back("Magnification", "d_o = \\frac{d_i}{M}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false}}, "d_o");
-		this->formulas.emplace_back("Magnification (Height)", "M = \\frac{h_i}{h_o}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "M");
-		this->formulas.emplace_back("Magnification (Height)", "h_i = M \\cdot h_o", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "h_i");
-		this->formulas.emplace_back("Magnification (Height)", "h_o = \\frac{h_i}{M}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false}}, "h_o");
-		this->formulas.emplace_back("Lensmaker's Equation", "R_1 = \\frac{1}{\\frac{\\frac{1}{f}}{n - 1} + \\frac{1}{R_2}}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"R_1", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 1", false},{"R_2", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 2", false}}, "R_1");
-		this->formulas.emplace_back("Lensmaker's Equation", "R_2 = \\frac{1}{\\frac{1}{R_1} - \\frac{\\frac{1}{f}}{n - 1}}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"R_1", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 1", false},{"R_2", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 2", false}}, "R_2");
-		this->formulas.emplace_back("Lensmaker's Equation", "f = \\frac{1}{\\left(n - 1\\right) \\cdot \\left(\\frac{1}{R_1} - \\frac{1}{R_2}\\right)}", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"R_1", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 1", false},{"R_2", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 2", false}}, "f");
-		this->formulas.emplace_back("Lensmaker's Equation", "n = \\frac{\\frac{1}{f}}{\\frac{1}{R_1} - \\frac{1}{R_2}} + 1", std::vector<Variable>{{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"R_1", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 1", false},{"R_2", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 2", false}}, "n");
-		this->formulas.emplace_back("Critical Angle", "\\theta_c = \\arcsin\\left(\\frac{n_2}{n_1}\\right)", std::vector<Variable>{{"\\theta_c", {0, 0, 0, 0, 0, 0, 0}, "Critical angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of less dense medium", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of denser medium", false}}, "\\theta_c");
-		this->formulas.emplace_back("Critical Angle", "n_1 = \\frac{n_2}{\\sin\\left(\\theta_c\\right)}", std::vector<Variable>{{"\\theta_c", {0, 0, 0, 0, 0, 0, 0}, "Critical angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of less dense medium", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of denser medium", false}}, "n_1");
-		this->formulas.emplace_back("Critical Angle", "n_2 = \\sin\\left(\\theta_c\\right) \\cdot n_1", std::vector<Variable>{{"\\theta_c", {0, 0, 0, 0, 0, 0, 0}, "Critical angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of less dense medium", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of denser medium", false}}, "n_2");
-		this->formulas.emplace_back("Brewster's Angle", "\\theta_B = \\arctan\\left(\\frac{n_2}{n_1}\\right)", std::vector<Variable>{{"\\theta_B", {0, 0, 0, 0, 0, 0, 0}, "Brewster's angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false}}, "\\theta_B");
-		this->formulas.emplace_back("Brewster's Angle", "n_1 = \\frac{n_2}{\\tan\\left(\\theta_B\\right)}", std::vector<Variable>{{"\\theta_B", {0, 0, 0, 0, 0, 0, 0}, "Brewster's angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false}}, "n_1");
-		this->formulas.emplace_back("Brewster's Angle", "n_2 = \\tan\\left(\\theta_B\\right) \\cdot n_1", std::vector<Variable>{{"\\theta_B", {0, 0, 0, 0, 0, 0, 0}, "Brewster's angle", false},{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false}}, "n_2");
-		this->formulas.emplace_back("Index of Refraction", "c = n \\cdot v", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"v", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in medium", false}}, "c");
-		this->formulas.emplace_back("Index of Refraction", "n = \\frac{c}{v}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"v", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in medium", false}}, "n");
-		this->formulas.emplace_back("Index of Refraction", "v = \\frac{c}{n}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},{"v", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in medium", false}}, "v");
-		this->formulas.emplace_back("Capacitance", "C = \\frac{Q}{V}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "C");
-		this->formulas.emplace_back("Capacitance", "Q = C \\cdot V", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "Q");
-		this->formulas.emplace_back("Capacitance", "V = \\frac{Q}{C}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "V");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "A = \\frac{C}{\\epsilon_0} \\cdot d", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "A");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "C = \\epsilon_0 \\cdot \\frac{A}{d}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "C");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "\\epsilon_0 = \\frac{C}{\\frac{A}{d}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Parallel Plate Capacitor", "d = \\frac{A}{\\frac{C}{\\epsilon_0}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "d");
-		this->formulas.emplace_back("Capacitor Energy (Voltage)", "C = \\frac{\\frac{U}{V^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "C");
-		this->formulas.emplace_back("Capacitor Energy (Voltage)", "U = \\frac{1}{2} C \\cdot V^{2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "U");
-		this->formulas.emplace_back("Capacitor Energy (Voltage)", "V = \\pm \\left(\\frac{U}{\\frac{1}{2} C}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "V");
-		this->formulas.emplace_back("Capacitor Energy (Charge)", "C = \\frac{\\frac{Q^{2}}{U}}{2}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("Capacitor Energy (Charge)", "Q = \\pm \\left(U \\cdot 2 C\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "Q");
-		this->formulas.emplace_back("Capacitor Energy (Charge)", "U = \\frac{Q^{2}}{2 C}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "U");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_1 = C_total - C_2", std::vector<Variable>{{"C_{total}", {-2, 4, -1, 2, 0, 0, 0}, "Total capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_1");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_2 = C_total - C_1", std::vector<Variable>{{"C_{total}", {-2, 4, -1, 2, 0, 0, 0}, "Total capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_2");
-		this->formulas.emplace_back("Capacitors in Parallel", "C_total = C_1 + C_2", std::vector<Variable>{{"C_{total}", {-2, 4, -1, 2, 0, 0, 0}, "Total capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_total");
-		this->formulas.emplace_back("Capacitance with Dielectric", "C = \\kappa \\cdot C_0", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false}}, "C");
-		this->formulas.emplace_back("Capacitance with Dielectric", "C_0 = \\frac{C}{\\kappa}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false}}, "C_0");
-		this->formulas.emplace_back("Capacitance with Dielectric", "\\kappa = \\frac{C}{C_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false}}, "\\kappa");
-		this->formulas.emplace_back("Electric Field in Dielectric", "E = \\frac{E_0}{\\kappa}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false},{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false}}, "E");
-		this->formulas.emplace_back("Electric Field in Dielectric", "E_0 = E \\cdot \\kappa", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false},{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false}}, "E_0");
-		this->formulas.emplace_back("Electric Field in Dielectric", "\\kappa = \\frac{E_0}{E}", std::vector<Variable>{{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false},{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false}}, "\\kappa");
-		this->formulas.emplace_back("Spherical Capacitor", "C = 4 \\pi \\cdot \\epsilon_0 \\cdot \\frac{r_a \\cdot r_b}{r_b - r_a}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "C");
-		this->formulas.emplace_back("Spherical Capacitor", "\\epsilon_0 = \\frac{\\frac{C}{\\frac{r_a \\cdot r_b}{r_b - r_a}}}{4 \\pi}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Spherical Capacitor", "\\pi = \\frac{\\frac{\\frac{C}{\\frac{r_a \\cdot r_b}{r_b - r_a}}}{\\epsilon_0}}{4}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "\\pi");
-		this->formulas.emplace_back("Cylindrical Capacitor", "C = \\frac{2 \\pi \\cdot \\epsilon_0 \\cdot L}{\\ln\\left(\\frac{r_b}{r_a}\\right)}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "C");
-		this->formulas.emplace_back("Cylindrical Capacitor", "L = \\frac{C \\cdot \\ln\\left(\\frac{r_b}{r_a}\\right)}{2 \\pi \\cdot \\epsilon_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "L");
-		this->formulas.emplace_back("Cylindrical Capacitor", "\\epsilon_0 = \\frac{\\frac{C \\cdot \\ln\\left(\\frac{r_b}{r_a}\\right)}{L}}{2 \\pi}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Cylindrical Capacitor", "\\pi = \\frac{\\frac{\\frac{C \\cdot \\ln\\left(\\frac{r_b}{r_a}\\right)}{L}}{\\epsilon_0}}{2}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "\\pi");
-		this->formulas.emplace_back("Cylindrical Capacitor", "r_a = \\frac{r_b}{\\exp\\left(\\frac{2 \\pi \\cdot \\epsilon_0 \\cdot L}{C}\\right)}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "r_a");
-		this->formulas.emplace_back("Cylindrical Capacitor", "r_b = \\exp\\left(\\frac{2 \\pi \\cdot \\epsilon_0 \\cdot L}{C}\\right) \\cdot r_a", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false}}, "r_b");
-		this->formulas.emplace_back("Capacitor Energy (QV Form)", "Q = \\frac{\\frac{U}{V}}{\\frac{1}{2}}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "Q");
-		this->formulas.emplace_back("Capacitor Energy (QV Form)", "U = \\frac{1}{2} Q \\cdot V", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "U");
-		this->formulas.emplace_back("Capacitor Energy (QV Form)", "V = \\frac{U}{\\frac{1}{2} Q}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "V");
-		this->formulas.emplace_back("Parallel Plate Capacitor with Dielectric", "A = \\frac{C}{\\kappa \\cdot \\epsilon_0} \\cdot d", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "A");
-		this->formulas.emplace_back("Parallel Plate Capacitor with Dielectric", "C = \\kappa \\cdot \\epsilon_0 \\cdot \\frac{A}{d}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "C");
-		this->formulas.emplace_back("Parallel Plate Capacitor with Dielectric", "\\epsilon_0 = \\frac{\\frac{C}{\\frac{A}{d}}}{\\kappa}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Parallel Plate Capacitor with Dielectric", "\\kappa = \\frac{\\frac{C}{\\frac{A}{d}}}{\\epsilon_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "\\kappa");
-		this->formulas.emplace_back("Parallel Plate Capacitor with Dielectric", "d = \\frac{A}{\\frac{C}{\\kappa \\cdot \\epsilon_0}}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false}}, "d");
-		this->formulas.emplace_back("Isolated Sphere Capacitance", "C = 4 \\pi \\cdot \\epsilon_0 \\cdot R", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of sphere", false}}, "C");
-		this->formulas.emplace_back("Isolated Sphere Capacitance", "R = \\frac{C}{4 \\pi \\cdot \\epsilon_0}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of sphere", false}}, "R");
-		this->formulas.emplace_back("Isolated Sphere Capacitance", "\\epsilon_0 = \\frac{\\frac{C}{R}}{4 \\pi}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of sphere", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Isolated Sphere Capacitance", "\\pi = \\frac{\\frac{\\frac{C}{R}}{\\epsilon_0}}{4}", std::vector<Variable>{{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of sphere", false}}, "\\pi");
-		this->formulas.emplace_back("Energy Density in Dielectric", "E = \\pm \\left(\\frac{u}{\\frac{1}{2} \\kappa \\cdot \\epsilon_0}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Energy Density in Dielectric", "\\epsilon_0 = \\frac{\\frac{u}{E^{2}}}{\\frac{1}{2} \\kappa}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\epsilon_0");
-		this->formulas.emplace_back("Energy Density in Dielectric", "\\kappa = \\frac{\\frac{\\frac{u}{E^{2}}}{\\epsilon_0}}{\\frac{1}{2}}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\kappa");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_3() {
-		this->formulas.emplace_back("Energy Density in Dielectric", "u = \\frac{1}{2} \\kappa \\cdot \\epsilon_0 \\cdot E^{2}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "u");
-		this->formulas.emplace_back("Capacitors in Series (Two)", "C_total = \\frac{C_1 \\cdot C_2}{C_1 + C_2}", std::vector<Variable>{{"C_{total}", {-2, 4, -1, 2, 0, 0, 0}, "Total capacitance", false},{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false}}, "C_total");
-		this->formulas.emplace_back("Kinetic Energy", "E = \\frac{\\frac{1}{2} m \\cdot v^{2}}{K}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "E");
-		this->formulas.emplace_back("Kinetic Energy", "K = \\frac{\\frac{1}{2} m \\cdot v^{2}}{E}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "K");
-		this->formulas.emplace_back("Kinetic Energy", "m = \\frac{\\frac{K \\cdot E}{v^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "m");
-		this->formulas.emplace_back("Kinetic Energy", "v = \\pm \\left(\\frac{K \\cdot E}{\\frac{1}{2} m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Gravitational Potential Energy", "E = \\frac{m \\cdot g \\cdot h}{P}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "E");
-		this->formulas.emplace_back("Gravitational Potential Energy", "P = \\frac{m \\cdot g \\cdot h}{E}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "P");
-		this->formulas.emplace_back("Gravitational Potential Energy", "g = \\frac{\\frac{P \\cdot E}{h}}{m}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "g");
-		this->formulas.emplace_back("Gravitational Potential Energy", "h = \\frac{P \\cdot E}{m \\cdot g}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Gravitational Potential Energy", "m = \\frac{\\frac{P \\cdot E}{h}}{g}", std::vector<Variable>{{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "m");
-		this->formulas.emplace_back("Work", "F = \\frac{W}{d}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance over which force is applied", false}}, "F");
-		this->formulas.emplace_back("Work", "W = F \\cdot d", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance over which force is applied", false}}, "W");
-		this->formulas.emplace_back("Work", "d = \\frac{W}{F}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance over which force is applied", false}}, "d");
-		this->formulas.emplace_back("Work-Energy Theorem", "E = \\frac{W}{\\Delta K}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Net work done on object", false},{"\\Delta KE", {2, -2, 1, 0, 0, 0, 0}, "Change in kinetic energy", false}}, "E");
-		this->formulas.emplace_back("Work-Energy Theorem", "W = \\Delta K \\cdot E", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Net work done on object", false},{"\\Delta KE", {2, -2, 1, 0, 0, 0, 0}, "Change in kinetic energy", false}}, "W");
-		this->formulas.emplace_back("Work-Energy Theorem", "\\Delta K = \\frac{W}{E}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Net work done on object", false},{"\\Delta KE", {2, -2, 1, 0, 0, 0, 0}, "Change in kinetic energy", false}}, "\\Delta K");
-		this->formulas.emplace_back("Power", "P = \\frac{W}{t}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "P");
-		this->formulas.emplace_back("Power", "W = P \\cdot t", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "W");
-		this->formulas.emplace_back("Power", "t = \\frac{W}{P}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Power (force-velocity)", "F = \\frac{P}{v}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "F");
-		this->formulas.emplace_back("Power (force-velocity)", "P = F \\cdot v", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "P");
-		this->formulas.emplace_back("Power (force-velocity)", "v = \\frac{P}{F}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Momentum", "m = \\frac{p}{v}", std::vector<Variable>{{"p", {1, -1, 1, 0, 0, 0, 0}, "Linear momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "m");
-		this->formulas.emplace_back("Momentum", "p = m \\cdot v", std::vector<Variable>{{"p", {1, -1, 1, 0, 0, 0, 0}, "Linear momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "p");
-		this->formulas.emplace_back("Momentum", "v = \\frac{p}{m}", std::vector<Variable>{{"p", {1, -1, 1, 0, 0, 0, 0}, "Linear momentum", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Impulse", "F = \\frac{J}{\\Delta t}", std::vector<Variable>{{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "F");
-		this->formulas.emplace_back("Impulse", "J = F \\cdot \\Delta t", std::vector<Variable>{{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "J");
-		this->formulas.emplace_back("Impulse", "\\Delta t = \\frac{J}{F}", std::vector<Variable>{{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta t");
-		this->formulas.emplace_back("Impulse-Momentum Theorem", "J = \\Delta p", std::vector<Variable>{{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false}}, "J");
-		this->formulas.emplace_back("Impulse-Momentum Theorem", "\\Delta p = J", std::vector<Variable>{{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},{"\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false}}, "\\Delta p");
-		this->formulas.emplace_back("Faraday's Law", "E = \\frac{N \\cdot \\Delta \\Phi_B}{\\Delta t}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "E");
-		this->formulas.emplace_back("Faraday's Law", "N = \\frac{E \\cdot \\Delta t}{\\Delta \\Phi_B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta \\Phi_B = \\frac{E \\cdot \\Delta t}{N}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta \\Phi_B");
-		this->formulas.emplace_back("Faraday's Law", "\\Delta t = \\frac{N \\cdot \\Delta \\Phi_B}{E}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false}}, "\\Delta t");
-		this->formulas.emplace_back("Faraday's Law (Area Form)", "A = \\frac{E \\cdot t}{N \\cdot B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "A");
-		this->formulas.emplace_back("Faraday's Law (Area Form)", "B = \\frac{\\frac{E \\cdot t}{A}}{N}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "B");
-		this->formulas.emplace_back("Faraday's Law (Area Form)", "E = \\frac{N \\cdot B \\cdot A}{t}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "E");
-		this->formulas.emplace_back("Faraday's Law (Area Form)", "N = \\frac{\\frac{E \\cdot t}{A}}{B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "N");
-		this->formulas.emplace_back("Faraday's Law (Area Form)", "t = \\frac{N \\cdot B \\cdot A}{E}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Motional EMF", "B = \\frac{\\frac{E}{v}}{L}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "B");
-		this->formulas.emplace_back("Motional EMF", "E = B \\cdot L \\cdot v", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "E");
-		this->formulas.emplace_back("Motional EMF", "L = \\frac{\\frac{E}{v}}{B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "L");
-		this->formulas.emplace_back("Motional EMF", "v = \\frac{E}{B \\cdot L}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false}}, "v");
-		this->formulas.emplace_back("Generator EMF", "A = \\frac{\\frac{E}{\\omega}}{N \\cdot B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "A");
-		this->formulas.emplace_back("Generator EMF", "B = \\frac{\\frac{\\frac{E}{\\omega}}{A}}{N}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "B");
-		this->formulas.emplace_back("Generator EMF", "E = N \\cdot B \\cdot A \\cdot \\omega", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "E");
-		this->formulas.emplace_back("Generator EMF", "N = \\frac{\\frac{\\frac{E}{\\omega}}{A}}{B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "N");
-		this->formulas.emplace_back("Generator EMF", "\\omega = \\frac{E}{N \\cdot B \\cdot A}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Transformer Voltage", "N_1 = \\frac{N_2}{\\frac{V_2}{V_1}}", std::vector<Variable>{{"V_2", {2, -3, 1, -1, 0, 0, 0}, "Secondary voltage", false},{"V_1", {2, -3, 1, -1, 0, 0, 0}, "Primary voltage", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false}}, "N_1");
-		this->formulas.emplace_back("Transformer Voltage", "N_2 = \\frac{V_2}{V_1} \\cdot N_1", std::vector<Variable>{{"V_2", {2, -3, 1, -1, 0, 0, 0}, "Secondary voltage", false},{"V_1", {2, -3, 1, -1, 0, 0, 0}, "Primary voltage", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false}}, "N_2");
-		this->formulas.emplace_back("Transformer Voltage", "V_1 = \\frac{V_2}{\\frac{N_2}{N_1}}", std::vector<Variable>{{"V_2", {2, -3, 1, -1, 0, 0, 0}, "Secondary voltage", false},{"V_1", {2, -3, 1, -1, 0, 0, 0}, "Primary voltage", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false}}, "V_1");
-		this->formulas.emplace_back("Transformer Voltage", "V_2 = V_1 \\cdot \\frac{N_2}{N_1}", std::vector<Variable>{{"V_2", {2, -3, 1, -1, 0, 0, 0}, "Secondary voltage", false},{"V_1", {2, -3, 1, -1, 0, 0, 0}, "Primary voltage", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false}}, "V_2");
-		this->formulas.emplace_back("Transformer Current", "I_1 = \\frac{I_2 \\cdot N_2}{N_1}", std::vector<Variable>{{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Secondary current", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Primary current", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false}}, "I_1");
-		this->formulas.emplace_back("Transformer Current", "I_2 = \\frac{I_1 \\cdot N_1}{N_2}", std::vector<Variable>{{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Secondary current", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Primary current", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false}}, "I_2");
-		this->formulas.emplace_back("Transformer Current", "N_1 = \\frac{I_2 \\cdot N_2}{I_1}", std::vector<Variable>{{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Secondary current", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Primary current", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false}}, "N_1");
-		this->formulas.emplace_back("Transformer Current", "N_2 = \\frac{I_1 \\cdot N_1}{I_2}", std::vector<Variable>{{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Secondary current", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Primary current", false},{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false}}, "N_2");
-		this->formulas.emplace_back("Motional EMF (Rotating Rod)", "B = \\frac{\\frac{\\frac{E}{L^{2}}}{\\omega}}{\\frac{1}{2}}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of rod", false}}, "B");
-		this->formulas.emplace_back("Motional EMF (Rotating Rod)", "E = \\frac{1}{2} B \\cdot \\omega \\cdot L^{2}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of rod", false}}, "E");
-		this->formulas.emplace_back("Motional EMF (Rotating Rod)", "L = \\pm \\left(\\frac{E}{\\frac{1}{2} B \\cdot \\omega}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of rod", false}}, "L");
-		this->formulas.emplace_back("Motional EMF (Rotating Rod)", "\\omega = \\frac{\\frac{E}{L^{2}}}{\\frac{1}{2} B}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of rod", false}}, "\\omega");
-		this->formulas.emplace_back("Magnetic Flux Change", "B = \\frac{\\Delta \\Phi_B}{\\Delta A}", std::vector<Variable>{{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\Delta A", {2, 0, 0, 0, 0, 0, 0}, "Change in area", false}}, "B");
-		this->formulas.emplace_back("Magnetic Flux Change", "\\Delta A = \\frac{\\Delta \\Phi_B}{B}", std::vector<Variable>{{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\Delta A", {2, 0, 0, 0, 0, 0, 0}, "Change in area", false}}, "\\Delta A");
-		this->formulas.emplace_back("Magnetic Flux Change", "\\Delta \\Phi_B = B \\cdot \\Delta A", std::vector<Variable>{{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\Delta A", {2, 0, 0, 0, 0, 0, 0}, "Change in area", false}}, "\\Delta \\Phi_B");
-		this->formulas.emplace_back("Period-Frequency Relationship", "T = \\frac{1}{f}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "T");
-		this->formulas.emplace_back("Period-Frequency Relationship", "f = \\frac{1}{T}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "f");
-		this->formulas.emplace_back("Angular Frequency", "\\omega = 2 \\pi \\cdot f", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "\\omega");
-		this->formulas.emplace_back("Angular Frequency", "\\pi = \\frac{\\frac{\\omega}{f}}{2}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "\\pi");
-		this->formulas.emplace_back("Angular Frequency", "f = \\frac{\\omega}{2 \\pi}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false}}, "f");
-		this->formulas.emplace_back("Wave Speed", "\\lambda = \\frac{v}{f}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "\\lambda");
-		this->formulas.emplace_back("Wave Speed", "f = \\frac{v}{\\lambda}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "f");
-		this->formulas.emplace_back("Wave Speed", "v = f \\cdot \\lambda", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false}}, "v");
-		this->formulas.emplace_back("Simple Pendulum Period", "L = \\left(\\frac{T}{2 \\pi}\\right)^{2} \\cdot g", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Pendulum length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "L");
-		this->formulas.emplace_back("Simple Pendulum Period", "T = 2 \\pi \\cdot \\left(\\frac{L}{g}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Pendulum length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "T");
-		this->formulas.emplace_back("Simple Pendulum Period", "\\pi = \\frac{\\frac{T}{\\left(\\frac{L}{g}\\right)^{\\frac{1}{2}}}}{2}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Pendulum length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "\\pi");
-		this->formulas.emplace_back("Simple Pendulum Period", "g = \\frac{L}{\\left(\\frac{T}{2 \\pi}\\right)^{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {1, 0, 0, 0, 0, 0, 0}, "Pendulum length", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Spring-Mass Period", "T = 2 \\pi \\cdot \\left(\\frac{m}{k}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "T");
-		this->formulas.emplace_back("Spring-Mass Period", "\\pi = \\frac{\\frac{T}{\\left(\\frac{m}{k}\\right)^{\\frac{1}{2}}}}{2}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "\\pi");
-		this->formulas.emplace_back("Spring-Mass Period", "k = \\frac{m}{\\left(\\frac{T}{2 \\pi}\\right)^{2}}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "k");
-		this->formulas.emplace_back("Spring-Mass Period", "m = \\left(\\frac{T}{2 \\pi}\\right)^{2} \\cdot k", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false}}, "m");
-		this->formulas.emplace_back("Wave Speed on String", "T = v^{2} \\cdot \\mu", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},{"\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false}}, "T");
-		this->formulas.emplace_back("Wave Speed on String", "\\mu = \\frac{T}{v^{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},{"\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false}}, "\\mu");
-		this->formulas.emplace_back("Wave Speed on String", "v = \\left(\\frac{T}{\\mu}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},{"\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false}}, "v");
-		this->formulas.emplace_back("Sound Intensity", "A = \\frac{P}{I}", std::vector<Variable>{{"I", {0, -3, 1, 0, 0, 0, 0}, "Intensity", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Sound Intensity", "I = \\frac{P}{A}", std::vector<Variable>{{"I", {0, -3, 1, 0, 0, 0, 0}, "Intensity", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "I");
-		this->formulas.emplace_back("Sound Intensity", "P = I \\cdot A", std::vector<Variable>{{"I", {0, -3, 1, 0, 0, 0, 0}, "Intensity", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "P");
-		this->formulas.emplace_back("Standing Wave Wavelength (Fixed Ends)", "L = \\frac{\\lambda_n \\cdot n}{2}", std::vector<Variable>{{"\\lambda_n", {1, 0, 0, 0, 0, 0, 0}, "nth harmonic wavelength", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "String length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Harmonic number", false}}, "L");
-		this->formulas.emplace_back("Standing Wave Wavelength (Fixed Ends)", "\\lambda_n = \\frac{2 L}{n}", std::vector<Variable>{{"\\lambda_n", {1, 0, 0, 0, 0, 0, 0}, "nth harmonic wavelength", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "String length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Harmonic number", false}}, "\\lambda_n");
-		this->formulas.emplace_back("Standing Wave Wavelength (Fixed Ends)", "n = \\frac{2 L}{\\lambda_n}", std::vector<Variable>{{"\\lambda_n", {1, 0, 0, 0, 0, 0, 0}, "nth harmonic wavelength", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "String length", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Harmonic number", false}}, "n");
-		this->formulas.emplace_back("Moles from Mass", "M = \\frac{m}{n}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "M");
-		this->formulas.emplace_back("Moles from Mass", "m = n \\cdot M", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "m");
-		this->formulas.emplace_back("Moles from Mass", "n = \\frac{m}{M}", std::vector<Variable>{{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false}}, "n");
-		this->formulas.emplace_back("Ideal Gas Law", "P = \\frac{n \\cdot R \\cdot T}{V}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "P");
-		this->formulas.emplace_back("Ideal Gas Law", "R = \\frac{\\frac{P \\cdot V}{T}}{n}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "R");
-    }
-} // namespace Physics
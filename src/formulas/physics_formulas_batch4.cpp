@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_4() {
-		this->formulas.emplace_back("Ideal Gas Law", "T = \\frac{P \\cdot V}{n \\cdot R}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "T");
-		this->formulas.emplace_back("Ideal Gas Law", "V = \\frac{n \\cdot R \\cdot T}{P}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "V");
-		this->formulas.emplace_back("Ideal Gas Law", "n = \\frac{\\frac{P \\cdot V}{T}}{R}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false}}, "n");
-		this->formulas.emplace_back("Dilution", "M_1 = \\frac{M_2 \\cdot V_2}{V_1}", std::vector<Variable>{{"M_1", {0, 0, 0, 0, 0, -3, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {0, 0, 0, 0, 0, -3, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false}}, "M_1");
-		this->formulas.emplace_back("Dilution", "M_2 = \\frac{M_1 \\cdot V_1}{V_2}", std::vector<Variable>{{"M_1", {0, 0, 0, 0, 0, -3, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {0, 0, 0, 0, 0, -3, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false}}, "M_2");
-		this->formulas.emplace_back("Dilution", "V_1 = \\frac{M_2 \\cdot V_2}{M_1}", std::vector<Variable>{{"M_1", {0, 0, 0, 0, 0, -3, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {0, 0, 0, 0, 0, -3, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false}}, "V_1");
-		this->formulas.emplace_back("Dilution", "V_2 = \\frac{M_1 \\cdot V_1}{M_2}", std::vector<Variable>{{"M_1", {0, 0, 0, 0, 0, -3, 0}, "Initial molarity", false},{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},{"M_2", {0, 0, 0, 0, 0, -3, 0}, "Final molarity", false},{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false}}, "V_2");
-		this->formulas.emplace_back("Molarity", "M = \\frac{n}{V}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, -3, 0}, "Molarity", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false}}, "M");
-		this->formulas.emplace_back("Molarity", "V = \\frac{n}{M}", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, -3, 0}, "Molarity", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false}}, "V");
-		this->formulas.emplace_back("Molarity", "n = M \\cdot V", std::vector<Variable>{{"M", {0, 0, 0, 0, 0, -3, 0}, "Molarity", false},{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false}}, "n");
-		this->formulas.emplace_back("pH + pOH", "H = -\\frac{-14}{p + p \\cdot O}", std::vector<Variable>{{"pH", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"pOH", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "H");
-		this->formulas.emplace_back("pH + pOH", "O = \\frac{\\frac{14 - p \\cdot H}{H}}{p}", std::vector<Variable>{{"pH", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"pOH", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "O");
-		this->formulas.emplace_back("pH + pOH", "p = -\\frac{-14}{H + H \\cdot O}", std::vector<Variable>{{"pH", {0, 0, 0, 0, 0, 0, 0}, "pH", false},{"pOH", {0, 0, 0, 0, 0, 0, 0}, "pOH", false}}, "p");
-		this->formulas.emplace_back("Gibbs Free Energy", "T = \\frac{\\Delta H - \\Delta G}{\\Delta S}", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false}}, "T");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta G = \\Delta H - T \\cdot \\Delta S", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta H = \\Delta G + T \\cdot \\Delta S", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false}}, "\\Delta H");
-		this->formulas.emplace_back("Gibbs Free Energy", "\\Delta S = \\frac{\\Delta H - \\Delta G}{T}", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false}}, "\\Delta S");
-		this->formulas.emplace_back("Nernst Equation", "E = 1 - \\frac{R \\cdot T}{n \\cdot F} \\cdot \\ln\\left(Q\\right)", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "E");
-		this->formulas.emplace_back("Nernst Equation", "F = \\frac{\\frac{R \\cdot T}{\\frac{1 - E}{\\ln\\left(Q\\right)}}}{n}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "F");
-		this->formulas.emplace_back("Nernst Equation", "Q = \\exp\\left(\\frac{1 - E}{\\frac{R \\cdot T}{n \\cdot F}}\\right)", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "Q");
-		this->formulas.emplace_back("Nernst Equation", "R = \\frac{\\frac{1 - E}{\\ln\\left(Q\\right)} \\cdot n \\cdot F}{T}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "R");
-		this->formulas.emplace_back("Nernst Equation", "T = \\frac{\\frac{1 - E}{\\ln\\left(Q\\right)} \\cdot n \\cdot F}{R}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "T");
-		this->formulas.emplace_back("Nernst Equation", "n = \\frac{\\frac{R \\cdot T}{\\frac{1 - E}{\\ln\\left(Q\\right)}}}{F}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false}}, "n");
-		this->formulas.emplace_back("Beer-Lambert Law", "A = \\epsilon \\cdot b \\cdot c", std::vector<Variable>{{"A", {0, 0, 0, 0, 0, 0, 0}, "Absorbance", false},{"\\epsilon", {2, 0, 0, 0, 0, -1, 0}, "Molar absorptivity", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Path length", false},{"c", {-3, 0, 0, 0, 0, 1, 0}, "Concentration", false}}, "A");
-		this->formulas.emplace_back("Beer-Lambert Law", "\\epsilon = \\frac{\\frac{A}{c}}{b}", std::vector<Variable>{{"A", {0, 0, 0, 0, 0, 0, 0}, "Absorbance", false},{"\\epsilon", {2, 0, 0, 0, 0, -1, 0}, "Molar absorptivity", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Path length", false},{"c", {-3, 0, 0, 0, 0, 1, 0}, "Concentration", false}}, "\\epsilon");
-		this->formulas.emplace_back("Beer-Lambert Law", "b = \\frac{\\frac{A}{c}}{\\epsilon}", std::vector<Variable>{{"A", {0, 0, 0, 0, 0, 0, 0}, "Absorbance", false},{"\\epsilon", {2, 0, 0, 0, 0, -1, 0}, "Molar absorptivity", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Path length", false},{"c", {-3, 0, 0, 0, 0, 1, 0}, "Concentration", false}}, "b");
-		this->formulas.emplace_back("Beer-Lambert Law", "c = \\frac{A}{\\epsilon \\cdot b}", std::vector<Variable>{{"A", {0, 0, 0, 0, 0, 0, 0}, "Absorbance", false},{"\\epsilon", {2, 0, 0, 0, 0, -1, 0}, "Molar absorptivity", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Path length", false},{"c", {-3, 0, 0, 0, 0, 1, 0}, "Concentration", false}}, "c");
-		this->formulas.emplace_back("Enthalpy of Reaction", "\\Delta T = \\frac{q}{m \\cdot c}", std::vector<Variable>{{"q", {2, -2, 1, 0, 0, 0, 0}, "Heat absorbed or released", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Enthalpy of Reaction", "c = \\frac{\\frac{q}{\\Delta T}}{m}", std::vector<Variable>{{"q", {2, -2, 1, 0, 0, 0, 0}, "Heat absorbed or released", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "c");
-		this->formulas.emplace_back("Enthalpy of Reaction", "m = \\frac{\\frac{q}{\\Delta T}}{c}", std::vector<Variable>{{"q", {2, -2, 1, 0, 0, 0, 0}, "Heat absorbed or released", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "m");
-		this->formulas.emplace_back("Enthalpy of Reaction", "q = m \\cdot c \\cdot \\Delta T", std::vector<Variable>{{"q", {2, -2, 1, 0, 0, 0, 0}, "Heat absorbed or released", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "q");
-		this->formulas.emplace_back("First-Order Rate Law", "A = A_0 \\cdot e^{-k \\cdot t}", std::vector<Variable>{{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "A");
-		this->formulas.emplace_back("First-Order Rate Law", "A_0 = \\frac{A}{e^{-k \\cdot t}}", std::vector<Variable>{{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "A_0");
-		this->formulas.emplace_back("First-Order Rate Law", "e = \\left(\\frac{A}{A_0}\\right)^{\\frac{1}{-k \\cdot t}}", std::vector<Variable>{{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "e");
-		this->formulas.emplace_back("First-Order Rate Law", "k = -\\frac{\\frac{\\ln\\left(\\frac{A}{A_0}\\right)}{\\ln\\left(e\\right)}}{t}", std::vector<Variable>{{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "k");
-		this->formulas.emplace_back("First-Order Rate Law", "t = \\frac{\\frac{\\ln\\left(\\frac{A}{A_0}\\right)}{\\ln\\left(e\\right)}}{-k}", std::vector<Variable>{{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Gibbs Free Energy and Cell Potential", "E = \\frac{\\Delta G}{-n \\cdot F}", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false}}, "E");
-		this->formulas.emplace_back("Gibbs Free Energy and Cell Potential", "F = \\frac{\\frac{\\Delta G}{E}}{-n}", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false}}, "F");
-		this->formulas.emplace_back("Gibbs Free Energy and Cell Potential", "\\Delta G = -n \\cdot F \\cdot E", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false}}, "\\Delta G");
-		this->formulas.emplace_back("Gibbs Free Energy and Cell Potential", "n = -\\frac{\\frac{\\Delta G}{E}}{F}", std::vector<Variable>{{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false}}, "n");
-		this->formulas.emplace_back("Normal Stress", "A = \\frac{F}{\\sigma}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Normal Stress", "F = \\sigma \\cdot A", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "F");
-		this->formulas.emplace_back("Normal Stress", "\\sigma = \\frac{F}{A}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "\\sigma");
-		this->formulas.emplace_back("Normal Strain", "L_0 = \\frac{\\Delta L}{\\epsilon}", std::vector<Variable>{{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false},{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Original length", false}}, "L_0");
-		this->formulas.emplace_back("Normal Strain", "\\Delta L = \\epsilon \\cdot L_0", std::vector<Variable>{{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false},{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Original length", false}}, "\\Delta L");
-		this->formulas.emplace_back("Normal Strain", "\\epsilon = \\frac{\\Delta L}{L_0}", std::vector<Variable>{{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false},{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Original length", false}}, "\\epsilon");
-		this->formulas.emplace_back("Young's Modulus", "E = \\frac{\\sigma}{\\epsilon}", std::vector<Variable>{{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false}}, "E");
-		this->formulas.emplace_back("Young's Modulus", "\\epsilon = \\frac{\\sigma}{E}", std::vector<Variable>{{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false}}, "\\epsilon");
-		this->formulas.emplace_back("Young's Modulus", "\\sigma = E \\cdot \\epsilon", std::vector<Variable>{{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false}}, "\\sigma");
-		this->formulas.emplace_back("Shear Stress", "A = \\frac{F}{\\tau}", std::vector<Variable>{{"\\tau", {-1, -2, 1, 0, 0, 0, 0}, "Shear stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Shear force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Shear Stress", "F = \\tau \\cdot A", std::vector<Variable>{{"\\tau", {-1, -2, 1, 0, 0, 0, 0}, "Shear stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Shear force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "F");
-		this->formulas.emplace_back("Shear Stress", "\\tau = \\frac{F}{A}", std::vector<Variable>{{"\\tau", {-1, -2, 1, 0, 0, 0, 0}, "Shear stress", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Shear force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "\\tau");
-		this->formulas.emplace_back("Beam Bending Stress", "I = \\frac{M \\cdot y}{\\sigma}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Bending stress", false},{"M", {2, -2, 1, 0, 0, 0, 0}, "Bending moment", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance from neutral axis", false},{"I", {4, 0, 0, 0, 0, 0, 0}, "Second moment of area", false}}, "I");
-		this->formulas.emplace_back("Beam Bending Stress", "M = \\frac{\\sigma \\cdot I}{y}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Bending stress", false},{"M", {2, -2, 1, 0, 0, 0, 0}, "Bending moment", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance from neutral axis", false},{"I", {4, 0, 0, 0, 0, 0, 0}, "Second moment of area", false}}, "M");
-		this->formulas.emplace_back("Beam Bending Stress", "\\sigma = \\frac{M \\cdot y}{I}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Bending stress", false},{"M", {2, -2, 1, 0, 0, 0, 0}, "Bending moment", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance from neutral axis", false},{"I", {4, 0, 0, 0, 0, 0, 0}, "Second moment of area", false}}, "\\sigma");
-		this->formulas.emplace_back("Beam Bending Stress", "y = \\frac{\\sigma \\cdot I}{M}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Bending stress", false},{"M", {2, -2, 1, 0, 0, 0, 0}, "Bending moment", false},{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance from neutral axis", false},{"I", {4, 0, 0, 0, 0, 0, 0}, "Second moment of area", false}}, "y");
-		this->formulas.emplace_back("Thermal Stress", "E = \\frac{\\frac{\\sigma}{\\Delta T}}{\\alpha}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Thermal stress", false},{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of thermal expansion", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "E");
-		this->formulas.emplace_back("Thermal Stress", "\\Delta T = \\frac{\\sigma}{E \\cdot \\alpha}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Thermal stress", false},{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of thermal expansion", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Thermal Stress", "\\alpha = \\frac{\\frac{\\sigma}{\\Delta T}}{E}", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Thermal stress", false},{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of thermal expansion", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\alpha");
-		this->formulas.emplace_back("Thermal Stress", "\\sigma = E \\cdot \\alpha \\cdot \\Delta T", std::vector<Variable>{{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Thermal stress", false},{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of thermal expansion", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\sigma");
-		this->formulas.emplace_back("Capacitive Reactance", "C = \\frac{\\frac{1}{X_C}}{2 \\pi \\cdot f}", std::vector<Variable>{{"X_C", {2, -3, 1, -2, 0, 0, 0}, "Capacitive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("Capacitive Reactance", "X_C = \\frac{1}{2 \\pi \\cdot f \\cdot C}", std::vector<Variable>{{"X_C", {2, -3, 1, -2, 0, 0, 0}, "Capacitive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "X_C");
-		this->formulas.emplace_back("Capacitive Reactance", "\\pi = \\frac{\\frac{\\frac{\\frac{1}{X_C}}{C}}{f}}{2}", std::vector<Variable>{{"X_C", {2, -3, 1, -2, 0, 0, 0}, "Capacitive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\pi");
-		this->formulas.emplace_back("Capacitive Reactance", "f = \\frac{\\frac{\\frac{1}{X_C}}{C}}{2 \\pi}", std::vector<Variable>{{"X_C", {2, -3, 1, -2, 0, 0, 0}, "Capacitive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "f");
-		this->formulas.emplace_back("Inductive Reactance", "L = \\frac{X_L}{2 \\pi \\cdot f}", std::vector<Variable>{{"X_L", {2, -3, 1, -2, 0, 0, 0}, "Inductive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "L");
-		this->formulas.emplace_back("Inductive Reactance", "X_L = 2 \\pi \\cdot f \\cdot L", std::vector<Variable>{{"X_L", {2, -3, 1, -2, 0, 0, 0}, "Inductive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "X_L");
-		this->formulas.emplace_back("Inductive Reactance", "\\pi = \\frac{\\frac{\\frac{X_L}{L}}{f}}{2}", std::vector<Variable>{{"X_L", {2, -3, 1, -2, 0, 0, 0}, "Inductive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "\\pi");
-		this->formulas.emplace_back("Inductive Reactance", "f = \\frac{\\frac{X_L}{L}}{2 \\pi}", std::vector<Variable>{{"X_L", {2, -3, 1, -2, 0, 0, 0}, "Inductive reactance", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false}}, "f");
-		this->formulas.emplace_back("RLC Resonant Frequency", "C = \\frac{\\left(\\frac{\\frac{1}{f_0}}{2 \\pi}\\right)^{2}}{L}", std::vector<Variable>{{"f_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("RLC Resonant Frequency", "L = \\frac{\\left(\\frac{\\frac{1}{f_0}}{2 \\pi}\\right)^{2}}{C}", std::vector<Variable>{{"f_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "L");
-		this->formulas.emplace_back("RLC Resonant Frequency", "\\pi = \\frac{\\frac{\\frac{1}{f_0}}{\\left(L \\cdot C\\right)^{\\frac{1}{2}}}}{2}", std::vector<Variable>{{"f_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\pi");
-		this->formulas.emplace_back("RLC Resonant Frequency", "f_0 = \\frac{1}{2 \\pi \\cdot \\left(L \\cdot C\\right)^{\\frac{1}{2}}}", std::vector<Variable>{{"f_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "f_0");
-		this->formulas.emplace_back("Hydraulic Press", "A_1 = \\frac{F_1 \\cdot A_2}{F_2}", std::vector<Variable>{{"F_2", {1, -2, 1, 0, 0, 0, 0}, "Output force", false},{"F_1", {1, -2, 1, 0, 0, 0, 0}, "Input force", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Output piston area", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Input piston area", false}}, "A_1");
-		this->formulas.emplace_back("Hydraulic Press", "A_2 = \\frac{F_2 \\cdot A_1}{F_1}", std::vector<Variable>{{"F_2", {1, -2, 1, 0, 0, 0, 0}, "Output force", false},{"F_1", {1, -2, 1, 0, 0, 0, 0}, "Input force", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Output piston area", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Input piston area", false}}, "A_2");
-		this->formulas.emplace_back("Hydraulic Press", "F_1 = \\frac{F_2 \\cdot A_1}{A_2}", std::vector<Variable>{{"F_2", {1, -2, 1, 0, 0, 0, 0}, "Output force", false},{"F_1", {1, -2, 1, 0, 0, 0, 0}, "Input force", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Output piston area", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Input piston area", false}}, "F_1");
-		this->formulas.emplace_back("Hydraulic Press", "F_2 = \\frac{F_1 \\cdot A_2}{A_1}", std::vector<Variable>{{"F_2", {1, -2, 1, 0, 0, 0, 0}, "Output force", false},{"F_1", {1, -2, 1, 0, 0, 0, 0}, "Input force", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Output piston area", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Input piston area", false}}, "F_2");
-		this->formulas.emplace_back("Reynolds Number", "D = \\frac{R \\cdot e \\cdot \\mu}{\\rho \\cdot v}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "D");
-		this->formulas.emplace_back("Reynolds Number", "R = \\frac{\\frac{\\rho \\cdot v \\cdot D}{\\mu}}{e}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "R");
-		this->formulas.emplace_back("Reynolds Number", "\\mu = \\frac{\\rho \\cdot v \\cdot D}{R \\cdot e}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "\\mu");
-		this->formulas.emplace_back("Reynolds Number", "\\rho = \\frac{\\frac{R \\cdot e \\cdot \\mu}{D}}{v}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "\\rho");
-		this->formulas.emplace_back("Reynolds Number", "e = \\frac{\\frac{\\rho \\cdot v \\cdot D}{\\mu}}{R}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "e");
-		this->formulas.emplace_back("Reynolds Number", "v = \\frac{\\frac{R \\cdot e \\cdot \\mu}{D}}{\\rho}", std::vector<Variable>{{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false}}, "v");
-		this->formulas.emplace_back("Efficiency", "W_in = \\frac{W_out}{\\eta}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false}}, "W_in");
-		this->formulas.emplace_back("Efficiency", "W_out = \\eta \\cdot W_in", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false}}, "W_out");
-		this->formulas.emplace_back("Efficiency", "\\eta = \\frac{W_out}{W_in}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false}}, "\\eta");
-		this->formulas.emplace_back("Power Efficiency", "P_in = \\frac{P_out}{\\eta}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power output", false},{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Power input", false}}, "P_in");
-		this->formulas.emplace_back("Power Efficiency", "P_out = \\eta \\cdot P_in", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power output", false},{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Power input", false}}, "P_out");
-		this->formulas.emplace_back("Power Efficiency", "\\eta = \\frac{P_out}{P_in}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power output", false},{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Power input", false}}, "\\eta");
-		this->formulas.emplace_back("Average Velocity", "d = v_avg \\cdot t", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "d");
-		this->formulas.emplace_back("Average Velocity", "t = \\frac{d}{v_avg}", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Average Velocity", "v_avg = \\frac{d}{t}", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v_avg");
-		this->formulas.emplace_back("Acceleration", "a = \\frac{v - v_0}{t}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "a");
-		this->formulas.emplace_back("Acceleration", "t = \\frac{v - v_0}{a}", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Acceleration", "v = a \\cdot t + v_0", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v");
-    }
-} // namespace Physics
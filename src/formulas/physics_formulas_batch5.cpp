@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_5() {
-		this->formulas.emplace_back("Acceleration", "v_0 = v - a \\cdot t", std::vector<Variable>{{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v_0");
-		this->formulas.emplace_back("Velocity with Acceleration", "v = v_0 + a \\cdot t", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v");
-		this->formulas.emplace_back("Position with Acceleration", "a = \\frac{\\frac{x - \\left(x_0 + v_0 \\cdot t\\right)}{t^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "a");
-		this->formulas.emplace_back("Position with Acceleration", "t = \\frac{-v_0}{a} \\pm \\frac{\\left(v_0^{2} - 4 \\cdot \\frac{1}{2} a \\cdot \\left(x_0 - x\\right)\\right)^{\\frac{1}{2}}}{a}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "t");
-		this->formulas.emplace_back("Position with Acceleration", "v_0 = \\frac{x - \\frac{1}{2} a \\cdot t^{2} - x_0}{t}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "v_0");
-		this->formulas.emplace_back("Position with Acceleration", "x = x_0 + v_0 \\cdot t + \\frac{1}{2} a \\cdot t^{2}", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "x");
-		this->formulas.emplace_back("Position with Acceleration", "x_0 = x - \\frac{1}{2} a \\cdot t^{2} - v_0 \\cdot t", std::vector<Variable>{{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false}}, "x_0");
-		this->formulas.emplace_back("Velocity-Position", "a = \\frac{\\frac{v^{2} - v_0^{2}}{x - x_0}}{2}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "a");
-		this->formulas.emplace_back("Velocity-Position", "v = \\pm \\left(v_0^{2} + 2 a \\cdot \\left(x - x_0\\right)\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "v");
-		this->formulas.emplace_back("Velocity-Position", "v_0 = \\pm \\left(v^{2} - 2 a \\cdot \\left(x - x_0\\right)\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "v_0");
-		this->formulas.emplace_back("Velocity-Position", "x = \\frac{v^{2} - v_0^{2}}{2 a} + x_0", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "x");
-		this->formulas.emplace_back("Velocity-Position", "x_0 = x - \\frac{v^{2} - v_0^{2}}{2 a}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false}}, "x_0");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v = v_avg \\cdot 2 - v_0", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false}}, "v");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v_0 = v_avg \\cdot 2 - v", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false}}, "v_0");
-		this->formulas.emplace_back("Average Velocity from Endpoints", "v_avg = \\frac{v_0 + v}{2}", std::vector<Variable>{{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false}}, "v_avg");
-		this->formulas.emplace_back("Free Fall Velocity", "g = \\frac{v}{t}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "g");
-		this->formulas.emplace_back("Free Fall Velocity", "t = \\frac{v}{g}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Free Fall Velocity", "v = g \\cdot t", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "v");
-		this->formulas.emplace_back("Free Fall Distance", "g = \\frac{\\frac{y}{t^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "g");
-		this->formulas.emplace_back("Free Fall Distance", "t = \\pm \\left(\\frac{y}{\\frac{1}{2} g}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Free Fall Distance", "y = \\frac{1}{2} g \\cdot t^{2}", std::vector<Variable>{{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "y");
-		this->formulas.emplace_back("Free Fall Velocity-Distance", "g = \\frac{\\frac{v^{2}}{y}}{2}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false}}, "g");
-		this->formulas.emplace_back("Free Fall Velocity-Distance", "v = \\pm \\left(2 g \\cdot y\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false}}, "v");
-		this->formulas.emplace_back("Free Fall Velocity-Distance", "y = \\frac{v^{2}}{2 g}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false}}, "y");
-		this->formulas.emplace_back("Projectile Range", "R = \\frac{v_0^{2} \\cdot \\sin\\left(2 \\theta\\right)}{g}", std::vector<Variable>{{"R", {1, 0, 0, 0, 0, 0, 0}, "Horizontal range", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"theta", {0, 0, 0, 0, 0, 0, 0}, "Launch angle", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "R");
-		this->formulas.emplace_back("Projectile Range", "\\theta = \\frac{\\arcsin\\left(\\frac{R \\cdot g}{v_0^{2}}\\right)}{2}", std::vector<Variable>{{"R", {1, 0, 0, 0, 0, 0, 0}, "Horizontal range", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"theta", {0, 0, 0, 0, 0, 0, 0}, "Launch angle", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "\\theta");
-		this->formulas.emplace_back("Projectile Range", "g = \\frac{v_0^{2} \\cdot \\sin\\left(2 \\theta\\right)}{R}", std::vector<Variable>{{"R", {1, 0, 0, 0, 0, 0, 0}, "Horizontal range", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"theta", {0, 0, 0, 0, 0, 0, 0}, "Launch angle", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "g");
-		this->formulas.emplace_back("Projectile Range", "v_0 = \\pm \\left(\\frac{R \\cdot g}{\\sin\\left(2 \\theta\\right)}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"R", {1, 0, 0, 0, 0, 0, 0}, "Horizontal range", false},{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},{"theta", {0, 0, 0, 0, 0, 0, 0}, "Launch angle", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true}}, "v_0");
-		this->formulas.emplace_back("Centripetal Acceleration", "a_c = \\frac{v^{2}}{r}", std::vector<Variable>{{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "a_c");
-		this->formulas.emplace_back("Centripetal Acceleration", "r = \\frac{v^{2}}{a_c}", std::vector<Variable>{{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "r");
-		this->formulas.emplace_back("Centripetal Acceleration", "v = \\pm \\left(a_c \\cdot r\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false}}, "v");
-		this->formulas.emplace_back("Torque", "F = \\frac{\\tau}{r}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Moment arm (radius)", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Applied force", false}}, "F");
-		this->formulas.emplace_back("Torque", "\\tau = r \\cdot F", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Moment arm (radius)", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Applied force", false}}, "\\tau");
-		this->formulas.emplace_back("Torque", "r = \\frac{\\tau}{F}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Moment arm (radius)", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Applied force", false}}, "r");
-		this->formulas.emplace_back("Torque from Moment of Inertia", "I = \\frac{\\tau}{\\alpha}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "I");
-		this->formulas.emplace_back("Torque from Moment of Inertia", "\\alpha = \\frac{\\tau}{I}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\alpha");
-		this->formulas.emplace_back("Torque from Moment of Inertia", "\\tau = I \\cdot \\alpha", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\tau");
-		this->formulas.emplace_back("Angular Velocity", "\\omega = \\frac{\\theta}{t}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\omega");
-		this->formulas.emplace_back("Angular Velocity", "\\theta = \\omega \\cdot t", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\theta");
-		this->formulas.emplace_back("Angular Velocity", "t = \\frac{\\theta}{\\omega}", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Angular Acceleration", "\\alpha = \\frac{\\omega - \\omega_0}{t}", std::vector<Variable>{{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\alpha");
-		this->formulas.emplace_back("Angular Acceleration", "\\omega = \\alpha \\cdot t + \\omega_0", std::vector<Variable>{{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\omega");
-		this->formulas.emplace_back("Angular Acceleration", "\\omega_0 = \\omega - \\alpha \\cdot t", std::vector<Variable>{{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\omega_0");
-		this->formulas.emplace_back("Angular Acceleration", "t = \\frac{\\omega - \\omega_0}{\\alpha}", std::vector<Variable>{{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Rotational Velocity with Acceleration", "\\omega = \\omega_0 + \\alpha \\cdot t", std::vector<Variable>{{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "\\omega");
-		this->formulas.emplace_back("Rotational Displacement with Acceleration", "\\alpha = \\frac{\\frac{\\theta - \\omega_0 \\cdot t}{t^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\alpha");
-		this->formulas.emplace_back("Rotational Displacement with Acceleration", "\\omega_0 = \\frac{\\theta - \\frac{1}{2} \\alpha \\cdot t^{2}}{t}", std::vector<Variable>{{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\omega_0");
-		this->formulas.emplace_back("Rotational Displacement with Acceleration", "\\theta = \\omega_0 \\cdot t + \\frac{1}{2} \\alpha \\cdot t^{2}", std::vector<Variable>{{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\theta");
-		this->formulas.emplace_back("Rotational Displacement with Acceleration", "t = \\frac{-\\omega_0}{\\alpha} \\pm \\frac{\\left(\\omega_0^{2} - 4 \\cdot \\frac{1}{2} \\alpha \\cdot -\\theta\\right)^{\\frac{1}{2}}}{\\alpha}", std::vector<Variable>{{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "t");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "E_rot = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{K}", std::vector<Variable>{{"KE_rot", {2, -2, 1, 0, 0, 0, 0}, "Rotational kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "E_rot");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "I = \\frac{\\frac{K \\cdot E_rot}{\\omega^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"KE_rot", {2, -2, 1, 0, 0, 0, 0}, "Rotational kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "I");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "K = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{E_rot}", std::vector<Variable>{{"KE_rot", {2, -2, 1, 0, 0, 0, 0}, "Rotational kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "K");
-		this->formulas.emplace_back("Rotational Kinetic Energy", "\\omega = \\pm \\left(\\frac{K \\cdot E_rot}{\\frac{1}{2} I}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE_rot", {2, -2, 1, 0, 0, 0, 0}, "Rotational kinetic energy", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Angular Momentum", "I = \\frac{L}{\\omega}", std::vector<Variable>{{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "I");
-		this->formulas.emplace_back("Angular Momentum", "L = I \\cdot \\omega", std::vector<Variable>{{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "L");
-		this->formulas.emplace_back("Angular Momentum", "\\omega = \\frac{L}{I}", std::vector<Variable>{{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Moment of Inertia (Point Mass)", "I = m \\cdot r^{2}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius from axis of rotation", false}}, "I");
-		this->formulas.emplace_back("Moment of Inertia (Point Mass)", "m = \\frac{I}{r^{2}}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius from axis of rotation", false}}, "m");
-		this->formulas.emplace_back("Moment of Inertia (Point Mass)", "r = \\pm \\left(\\frac{I}{m}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius from axis of rotation", false}}, "r");
-		this->formulas.emplace_back("Tangential Velocity", "\\omega = \\frac{v}{r}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "\\omega");
-		this->formulas.emplace_back("Tangential Velocity", "r = \\frac{v}{\\omega}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "r");
-		this->formulas.emplace_back("Tangential Velocity", "v = r \\cdot \\omega", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false}}, "v");
-		this->formulas.emplace_back("Tangential Acceleration", "\\alpha = \\frac{a_t}{r}", std::vector<Variable>{{"a_t", {1, -2, 0, 0, 0, 0, 0}, "Tangential acceleration", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "\\alpha");
-		this->formulas.emplace_back("Tangential Acceleration", "a_t = r \\cdot \\alpha", std::vector<Variable>{{"a_t", {1, -2, 0, 0, 0, 0, 0}, "Tangential acceleration", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "a_t");
-		this->formulas.emplace_back("Tangential Acceleration", "r = \\frac{a_t}{\\alpha}", std::vector<Variable>{{"a_t", {1, -2, 0, 0, 0, 0, 0}, "Tangential acceleration", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false}}, "r");
-		this->formulas.emplace_back("Ohm's Law", "I = \\frac{V}{R}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "I");
-		this->formulas.emplace_back("Ohm's Law", "R = \\frac{V}{I}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Ohm's Law", "V = I \\cdot R", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "V");
-		this->formulas.emplace_back("Resistance from Resistivity", "A = \\frac{\\rho \\cdot L}{R}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Resistance from Resistivity", "L = \\frac{R \\cdot A}{\\rho}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "L");
-		this->formulas.emplace_back("Resistance from Resistivity", "R = \\frac{\\rho \\cdot L}{A}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "R");
-		this->formulas.emplace_back("Resistance from Resistivity", "\\rho = \\frac{R \\cdot A}{L}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "\\rho");
-		this->formulas.emplace_back("Current", "I = \\frac{Q}{t}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "I");
-		this->formulas.emplace_back("Current", "Q = I \\cdot t", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "Q");
-		this->formulas.emplace_back("Current", "t = \\frac{Q}{I}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Current Density", "A = \\frac{I}{J}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Current Density", "I = J \\cdot A", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "I");
-		this->formulas.emplace_back("Current Density", "J = \\frac{I}{A}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "J");
-		this->formulas.emplace_back("Drift Velocity", "J = v_d \\cdot n \\cdot e", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "J");
-		this->formulas.emplace_back("Drift Velocity", "e = \\frac{\\frac{J}{v_d}}{n}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "e");
-		this->formulas.emplace_back("Drift Velocity", "n = \\frac{\\frac{J}{v_d}}{e}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "n");
-		this->formulas.emplace_back("Drift Velocity", "v_d = \\frac{J}{n \\cdot e}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "v_d");
-		this->formulas.emplace_back("Electrical Power (IV)", "I = \\frac{P}{V}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "I");
-		this->formulas.emplace_back("Electrical Power (IV)", "P = I \\cdot V", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "P");
-		this->formulas.emplace_back("Electrical Power (IV)", "V = \\frac{P}{I}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false}}, "V");
-		this->formulas.emplace_back("Electrical Power (I²R)", "I = \\pm \\left(\\frac{P}{R}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "I");
-		this->formulas.emplace_back("Electrical Power (I²R)", "P = I^{2} \\cdot R", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "P");
-		this->formulas.emplace_back("Electrical Power (I²R)", "R = \\frac{P}{I^{2}}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Electrical Power (V²/R)", "P = \\frac{V^{2}}{R}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "P");
-		this->formulas.emplace_back("Electrical Power (V²/R)", "R = \\frac{V^{2}}{P}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Electrical Power (V²/R)", "V = \\pm \\left(P \\cdot R\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "V");
-		this->formulas.emplace_back("Conductivity", "\\rho = \\frac{1}{\\sigma}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "\\rho");
-		this->formulas.emplace_back("Conductivity", "\\sigma = \\frac{1}{\\rho}", std::vector<Variable>{{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false}}, "\\sigma");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "R = R_0 \\cdot \\left(1 + \\alpha \\cdot \\Delta T\\right)", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistance", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "R");
-    }
-} // namespace Physics
@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_6() {
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "R_0 = \\frac{R}{1 + \\alpha \\cdot \\Delta T}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistance", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "R_0");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "\\Delta T = \\frac{\\frac{R}{R_0} - 1}{\\alpha}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistance", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Temperature Dependence of Resistance", "\\alpha = \\frac{\\frac{R}{R_0} - 1}{\\Delta T}", std::vector<Variable>{{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistance", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\alpha");
-		this->formulas.emplace_back("Current Density from Electric Field", "E = \\frac{J}{\\sigma}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "E");
-		this->formulas.emplace_back("Current Density from Electric Field", "J = \\sigma \\cdot E", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "J");
-		this->formulas.emplace_back("Current Density from Electric Field", "\\sigma = \\frac{J}{E}", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false}}, "\\sigma");
-		this->formulas.emplace_back("Drift Velocity (Direct)", "A = \\frac{\\frac{\\frac{I}{v_d}}{e}}{n}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "A");
-		this->formulas.emplace_back("Drift Velocity (Direct)", "I = v_d \\cdot n \\cdot A \\cdot e", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "I");
-		this->formulas.emplace_back("Drift Velocity (Direct)", "e = \\frac{\\frac{I}{v_d}}{n \\cdot A}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "e");
-		this->formulas.emplace_back("Drift Velocity (Direct)", "n = \\frac{\\frac{\\frac{I}{v_d}}{e}}{A}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "n");
-		this->formulas.emplace_back("Drift Velocity (Direct)", "v_d = \\frac{I}{n \\cdot A \\cdot e}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true}}, "v_d");
-		this->formulas.emplace_back("Energy Dissipated", "E = P \\cdot t", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "E");
-		this->formulas.emplace_back("Energy Dissipated", "P = \\frac{E}{t}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "P");
-		this->formulas.emplace_back("Energy Dissipated", "t = \\frac{E}{P}", std::vector<Variable>{{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("EMF as Work per Charge", "E = \\frac{W}{q}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "E");
-		this->formulas.emplace_back("EMF as Work per Charge", "W = E \\cdot q", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "W");
-		this->formulas.emplace_back("EMF as Work per Charge", "q = \\frac{W}{E}", std::vector<Variable>{{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false}}, "q");
-		this->formulas.emplace_back("Current Density from Drift Velocity", "J = n \\cdot e \\cdot v_d", std::vector<Variable>{{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false}}, "J");
-		this->formulas.emplace_back("Density", "V = \\frac{m}{\\rho}", std::vector<Variable>{{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "V");
-		this->formulas.emplace_back("Density", "\\rho = \\frac{m}{V}", std::vector<Variable>{{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "\\rho");
-		this->formulas.emplace_back("Density", "m = \\rho \\cdot V", std::vector<Variable>{{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "m");
-		this->formulas.emplace_back("Pressure", "A = \\frac{F}{P}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Pressure", "F = P \\cdot A", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "F");
-		this->formulas.emplace_back("Pressure", "P = \\frac{F}{A}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "P");
-		this->formulas.emplace_back("Hydrostatic Pressure", "P = \\rho \\cdot g \\cdot h", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Hydrostatic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Depth below surface", false}}, "P");
-		this->formulas.emplace_back("Hydrostatic Pressure", "\\rho = \\frac{\\frac{P}{h}}{g}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Hydrostatic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Depth below surface", false}}, "\\rho");
-		this->formulas.emplace_back("Hydrostatic Pressure", "g = \\frac{\\frac{P}{h}}{\\rho}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Hydrostatic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Depth below surface", false}}, "g");
-		this->formulas.emplace_back("Hydrostatic Pressure", "h = \\frac{P}{\\rho \\cdot g}", std::vector<Variable>{{"P", {-1, -2, 1, 0, 0, 0, 0}, "Hydrostatic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"h", {1, 0, 0, 0, 0, 0, 0}, "Depth below surface", false}}, "h");
-		this->formulas.emplace_back("Buoyant Force", "F_b = \\rho \\cdot g \\cdot V", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"V", {3, 0, 0, 0, 0, 0, 0}, "Displaced fluid volume", false}}, "F_b");
-		this->formulas.emplace_back("Buoyant Force", "V = \\frac{F_b}{\\rho \\cdot g}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"V", {3, 0, 0, 0, 0, 0, 0}, "Displaced fluid volume", false}}, "V");
-		this->formulas.emplace_back("Buoyant Force", "\\rho = \\frac{\\frac{F_b}{V}}{g}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"V", {3, 0, 0, 0, 0, 0, 0}, "Displaced fluid volume", false}}, "\\rho");
-		this->formulas.emplace_back("Buoyant Force", "g = \\frac{\\frac{F_b}{V}}{\\rho}", std::vector<Variable>{{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},{"V", {3, 0, 0, 0, 0, 0, 0}, "Displaced fluid volume", false}}, "g");
-		this->formulas.emplace_back("Continuity Equation", "A_1 = \\frac{v_2 \\cdot A_2}{v_1}", std::vector<Variable>{{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 1", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 2", false}}, "A_1");
-		this->formulas.emplace_back("Continuity Equation", "A_2 = \\frac{A_1 \\cdot v_1}{v_2}", std::vector<Variable>{{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 1", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 2", false}}, "A_2");
-		this->formulas.emplace_back("Continuity Equation", "v_1 = \\frac{v_2 \\cdot A_2}{A_1}", std::vector<Variable>{{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 1", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 2", false}}, "v_1");
-		this->formulas.emplace_back("Continuity Equation", "v_2 = \\frac{A_1 \\cdot v_1}{A_2}", std::vector<Variable>{{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 2", false},{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 1", false},{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 1", false},{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 2", false}}, "v_2");
-		this->formulas.emplace_back("Dynamic Pressure", "\\rho = \\frac{\\frac{q}{v^{2}}}{\\frac{1}{2}}", std::vector<Variable>{{"q", {-1, -2, 1, 0, 0, 0, 0}, "Dynamic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "\\rho");
-		this->formulas.emplace_back("Dynamic Pressure", "q = \\frac{1}{2} \\rho \\cdot v^{2}", std::vector<Variable>{{"q", {-1, -2, 1, 0, 0, 0, 0}, "Dynamic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "q");
-		this->formulas.emplace_back("Dynamic Pressure", "v = \\pm \\left(\\frac{q}{\\frac{1}{2} \\rho}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"q", {-1, -2, 1, 0, 0, 0, 0}, "Dynamic pressure", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "v");
-		this->formulas.emplace_back("Volume Flow Rate", "A = \\frac{Q}{v}", std::vector<Variable>{{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volumetric flow rate", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "A");
-		this->formulas.emplace_back("Volume Flow Rate", "Q = A \\cdot v", std::vector<Variable>{{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volumetric flow rate", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "Q");
-		this->formulas.emplace_back("Volume Flow Rate", "v = \\frac{Q}{A}", std::vector<Variable>{{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volumetric flow rate", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "v");
-		this->formulas.emplace_back("Mass Flow Rate", "A = \\frac{\\frac{\\dot{m}}{v}}{\\rho}", std::vector<Variable>{{"\\dot{m}", {0, -1, 1, 0, 0, 0, 0}, "Mass flow rate", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "A");
-		this->formulas.emplace_back("Mass Flow Rate", "\\dot{m} = \\rho \\cdot A \\cdot v", std::vector<Variable>{{"\\dot{m}", {0, -1, 1, 0, 0, 0, 0}, "Mass flow rate", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "\\dot{m}");
-		this->formulas.emplace_back("Mass Flow Rate", "\\rho = \\frac{\\frac{\\dot{m}}{v}}{A}", std::vector<Variable>{{"\\dot{m}", {0, -1, 1, 0, 0, 0, 0}, "Mass flow rate", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "\\rho");
-		this->formulas.emplace_back("Mass Flow Rate", "v = \\frac{\\dot{m}}{\\rho \\cdot A}", std::vector<Variable>{{"\\dot{m}", {0, -1, 1, 0, 0, 0, 0}, "Mass flow rate", false},{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false}}, "v");
-		this->formulas.emplace_back("Magnetic Field of Long Straight Wire", "B = \\frac{\\mu_0 \\cdot I}{2 \\pi \\cdot r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Long Straight Wire", "I = \\frac{B \\cdot 2 \\pi \\cdot r}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Long Straight Wire", "\\mu_0 = \\frac{B \\cdot 2 \\pi \\cdot r}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Long Straight Wire", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I}{B}}{r}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field of Long Straight Wire", "r = \\frac{\\frac{\\mu_0 \\cdot I}{B}}{2 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "B = \\mu_0 \\cdot n \\cdot I", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "I = \\frac{B}{\\mu_0 \\cdot n}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "\\mu_0 = \\frac{\\frac{B}{I}}{n}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Solenoid", "n = \\frac{\\frac{B}{I}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "n");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "B = \\frac{\\mu_0 \\cdot N \\cdot I}{2 \\pi \\cdot r}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "I = \\frac{B \\cdot 2 \\pi \\cdot r}{\\mu_0 \\cdot N}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "N = \\frac{\\frac{B \\cdot 2 \\pi \\cdot r}{I}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "N");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "\\mu_0 = \\frac{\\frac{B \\cdot 2 \\pi \\cdot r}{I}}{N}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot N \\cdot I}{B}}{r}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field of Toroid", "r = \\frac{\\frac{\\mu_0 \\cdot N \\cdot I}{B}}{2 \\pi}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field at Center of Circular Loop", "B = \\frac{\\mu_0 \\cdot I}{2 R}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field at Center of Circular Loop", "I = \\frac{B \\cdot 2 R}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field at Center of Circular Loop", "R = \\frac{\\frac{\\mu_0 \\cdot I}{B}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "R");
-		this->formulas.emplace_back("Magnetic Field at Center of Circular Loop", "\\mu_0 = \\frac{B \\cdot 2 R}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false}}, "\\mu_0");
-		this->formulas.emplace_back("Force Between Parallel Currents", "F = \\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{2 \\pi \\cdot d} \\cdot L", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "F");
-		this->formulas.emplace_back("Force Between Parallel Currents", "I_1 = \\frac{\\frac{\\frac{F}{L} \\cdot 2 \\pi \\cdot d}{I_2}}{\\mu_0}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "I_1");
-		this->formulas.emplace_back("Force Between Parallel Currents", "I_2 = \\frac{\\frac{F}{L} \\cdot 2 \\pi \\cdot d}{\\mu_0 \\cdot I_1}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "I_2");
-		this->formulas.emplace_back("Force Between Parallel Currents", "L = \\frac{F}{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{2 \\pi \\cdot d}}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "L");
-		this->formulas.emplace_back("Force Between Parallel Currents", "\\mu_0 = \\frac{\\frac{\\frac{F}{L} \\cdot 2 \\pi \\cdot d}{I_2}}{I_1}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "\\mu_0");
-		this->formulas.emplace_back("Force Between Parallel Currents", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{\\frac{F}{L}}}{d}}{2}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "\\pi");
-		this->formulas.emplace_back("Force Between Parallel Currents", "d = \\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{\\frac{F}{L}}}{2 \\pi}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false}}, "d");
-		this->formulas.emplace_back("Magnetic Energy Density", "B = \\pm \\left(u \\cdot 2 \\mu_0\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "B");
-		this->formulas.emplace_back("Magnetic Energy Density", "\\mu_0 = \\frac{\\frac{B^{2}}{u}}{2}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Energy Density", "u = \\frac{B^{2}}{2 \\mu_0}", std::vector<Variable>{{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true}}, "u");
-		this->formulas.emplace_back("Magnetic Field on Axis of Circular Loop", "B = \\frac{\\mu_0 \\cdot I \\cdot R^{2}}{2 \\cdot \\left(R^{2} + x^{2}\\right)^{\\frac{3}{2}}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field on Axis of Circular Loop", "I = \\frac{\\frac{B \\cdot 2 \\cdot \\left(R^{2} + x^{2}\\right)^{\\frac{3}{2}}}{R^{2}}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field on Axis of Circular Loop", "\\mu_0 = \\frac{\\frac{B \\cdot 2 \\cdot \\left(R^{2} + x^{2}\\right)^{\\frac{3}{2}}}{R^{2}}}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field on Axis of Circular Loop", "x = \\pm \\left(\\left(\\frac{\\frac{\\mu_0 \\cdot I \\cdot R^{2}}{B}}{2}\\right)^{\\frac{2}{3}} - R^{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false}}, "x");
-		this->formulas.emplace_back("Magnetic Field of Solenoid (Total Turns)", "B = \\frac{\\mu_0 \\cdot N \\cdot I}{L}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Solenoid (Total Turns)", "I = \\frac{B \\cdot L}{\\mu_0 \\cdot N}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field of Solenoid (Total Turns)", "L = \\frac{\\mu_0 \\cdot N \\cdot I}{B}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false}}, "L");
-		this->formulas.emplace_back("Magnetic Field of Solenoid (Total Turns)", "N = \\frac{\\frac{B \\cdot L}{I}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false}}, "N");
-		this->formulas.emplace_back("Magnetic Field of Solenoid (Total Turns)", "\\mu_0 = \\frac{\\frac{B \\cdot L}{I}}{N}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "B = \\frac{\\mu_0 \\cdot I \\cdot r}{2 \\pi \\cdot R^{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "I = \\frac{\\frac{B \\cdot 2 \\pi \\cdot R^{2}}{r}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "I");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "R = \\pm \\left(\\frac{\\frac{\\mu_0 \\cdot I \\cdot r}{B}}{2 \\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "R");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "\\mu_0 = \\frac{\\frac{B \\cdot 2 \\pi \\cdot R^{2}}{r}}{I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I \\cdot r}{B}}{R^{2}}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "\\pi");
-		this->formulas.emplace_back("Magnetic Field Inside Wire", "r = \\frac{B \\cdot 2 \\pi \\cdot R^{2}}{\\mu_0 \\cdot I}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false}}, "r");
-		this->formulas.emplace_back("Magnetic Field of Dipole on Axis", "B = \\frac{\\mu_0 \\cdot \\mu}{2 \\pi \\cdot r^{3}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "B");
-		this->formulas.emplace_back("Magnetic Field of Dipole on Axis", "\\mu = \\frac{B \\cdot 2 \\pi \\cdot r^{3}}{\\mu_0}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "\\mu");
-		this->formulas.emplace_back("Magnetic Field of Dipole on Axis", "\\mu_0 = \\frac{B \\cdot 2 \\pi \\cdot r^{3}}{\\mu}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "\\mu_0");
-		this->formulas.emplace_back("Magnetic Field of Dipole on Axis", "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot \\mu}{B}}{r^{3}}}{2}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "\\pi");
-    }
-} // namespace Physics
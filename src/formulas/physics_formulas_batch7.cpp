@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_7() {
-		this->formulas.emplace_back("Magnetic Field of Dipole on Axis", "r = \\left(\\frac{\\frac{\\mu_0 \\cdot \\mu}{B}}{2 \\pi}\\right)^{\\frac{1}{3}}", std::vector<Variable>{{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false}}, "r");
-		this->formulas.emplace_back("Heat Transfer", "Q = m \\cdot c \\cdot \\Delta T", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "Q");
-		this->formulas.emplace_back("Heat Transfer", "\\Delta T = \\frac{Q}{m \\cdot c}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Heat Transfer", "c = \\frac{\\frac{Q}{\\Delta T}}{m}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "c");
-		this->formulas.emplace_back("Heat Transfer", "m = \\frac{\\frac{Q}{\\Delta T}}{c}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "m");
-		this->formulas.emplace_back("Latent Heat", "L = \\frac{Q}{m}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"L", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat", false}}, "L");
-		this->formulas.emplace_back("Latent Heat", "Q = m \\cdot L", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"L", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat", false}}, "Q");
-		this->formulas.emplace_back("Latent Heat", "m = \\frac{Q}{L}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"L", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat", false}}, "m");
-		this->formulas.emplace_back("Linear Thermal Expansion", "L_0 = \\frac{\\frac{\\Delta L}{\\Delta T}}{\\alpha}", std::vector<Variable>{{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "L_0");
-		this->formulas.emplace_back("Linear Thermal Expansion", "\\Delta L = \\alpha \\cdot L_0 \\cdot \\Delta T", std::vector<Variable>{{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta L");
-		this->formulas.emplace_back("Linear Thermal Expansion", "\\Delta T = \\frac{\\Delta L}{\\alpha \\cdot L_0}", std::vector<Variable>{{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\Delta T");
-		this->formulas.emplace_back("Linear Thermal Expansion", "\\alpha = \\frac{\\frac{\\Delta L}{\\Delta T}}{L_0}", std::vector<Variable>{{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false}}, "\\alpha");
-		this->formulas.emplace_back("Fourier's Law of Conduction", "A = \\frac{\\frac{P \\cdot d}{\\Delta T}}{k}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "A");
-		this->formulas.emplace_back("Fourier's Law of Conduction", "P = \\frac{k \\cdot A \\cdot \\Delta T}{d}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "P");
-		this->formulas.emplace_back("Fourier's Law of Conduction", "\\Delta T = \\frac{P \\cdot d}{k \\cdot A}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "\\Delta T");
-		this->formulas.emplace_back("Fourier's Law of Conduction", "d = \\frac{k \\cdot A \\cdot \\Delta T}{P}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "d");
-		this->formulas.emplace_back("Fourier's Law of Conduction", "k = \\frac{\\frac{P \\cdot d}{\\Delta T}}{A}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false}}, "k");
-		this->formulas.emplace_back("Stefan-Boltzmann Law", "A = \\frac{\\frac{P}{T^{4}}}{\\sigma}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Radiated power", false},{"\\sigma", {0, -3, 1, 0, -4, 0, 0}, "Stefan-Boltzmann constant", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Surface area", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "A");
-		this->formulas.emplace_back("Stefan-Boltzmann Law", "P = \\sigma \\cdot A \\cdot T^{4}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Radiated power", false},{"\\sigma", {0, -3, 1, 0, -4, 0, 0}, "Stefan-Boltzmann constant", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Surface area", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "P");
-		this->formulas.emplace_back("Stefan-Boltzmann Law", "T = \\pm \\left(\\frac{P}{\\sigma \\cdot A}\\right)^{\\frac{1}{4}}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Radiated power", false},{"\\sigma", {0, -3, 1, 0, -4, 0, 0}, "Stefan-Boltzmann constant", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Surface area", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "T");
-		this->formulas.emplace_back("Stefan-Boltzmann Law", "\\sigma = \\frac{\\frac{P}{T^{4}}}{A}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Radiated power", false},{"\\sigma", {0, -3, 1, 0, -4, 0, 0}, "Stefan-Boltzmann constant", true},{"A", {2, 0, 0, 0, 0, 0, 0}, "Surface area", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "\\sigma");
-		this->formulas.emplace_back("First Law of Thermodynamics", "Q = \\Delta U + W", std::vector<Variable>{{"\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added to system", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false}}, "Q");
-		this->formulas.emplace_back("First Law of Thermodynamics", "W = Q - \\Delta U", std::vector<Variable>{{"\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added to system", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false}}, "W");
-		this->formulas.emplace_back("First Law of Thermodynamics", "\\Delta U = Q - W", std::vector<Variable>{{"\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added to system", false},{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false}}, "\\Delta U");
-		this->formulas.emplace_back("Carnot Efficiency", "T_c = \\left(1 - \\eta\\right) \\cdot T_h", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Carnot efficiency", false},{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false}}, "T_c");
-		this->formulas.emplace_back("Carnot Efficiency", "T_h = \\frac{T_c}{1 - \\eta}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Carnot efficiency", false},{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false}}, "T_h");
-		this->formulas.emplace_back("Carnot Efficiency", "\\eta = 1 - \\frac{T_c}{T_h}", std::vector<Variable>{{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Carnot efficiency", false},{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false}}, "\\eta");
-		this->formulas.emplace_back("Entropy Change", "Q = \\Delta S \\cdot T", std::vector<Variable>{{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat transferred", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "Q");
-		this->formulas.emplace_back("Entropy Change", "T = \\frac{Q}{\\Delta S}", std::vector<Variable>{{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat transferred", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "T");
-		this->formulas.emplace_back("Entropy Change", "\\Delta S = \\frac{Q}{T}", std::vector<Variable>{{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat transferred", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "\\Delta S");
-		this->formulas.emplace_back("Work by Gas (Isobaric)", "P = \\frac{W}{\\Delta V}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by gas", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"\\Delta V", {3, 0, 0, 0, 0, 0, 0}, "Change in volume", false}}, "P");
-		this->formulas.emplace_back("Work by Gas (Isobaric)", "W = P \\cdot \\Delta V", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by gas", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"\\Delta V", {3, 0, 0, 0, 0, 0, 0}, "Change in volume", false}}, "W");
-		this->formulas.emplace_back("Work by Gas (Isobaric)", "\\Delta V = \\frac{W}{P}", std::vector<Variable>{{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by gas", false},{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},{"\\Delta V", {3, 0, 0, 0, 0, 0, 0}, "Change in volume", false}}, "\\Delta V");
-		this->formulas.emplace_back("Boltzmann Average Kinetic Energy", "E = \\frac{\\frac{3}{2} k_B \\cdot T}{K}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Average kinetic energy", false},{"k_B", {2, -2, 1, 0, -1, 0, 0}, "Boltzmann constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "E");
-		this->formulas.emplace_back("Boltzmann Average Kinetic Energy", "K = \\frac{\\frac{3}{2} k_B \\cdot T}{E}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Average kinetic energy", false},{"k_B", {2, -2, 1, 0, -1, 0, 0}, "Boltzmann constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "K");
-		this->formulas.emplace_back("Boltzmann Average Kinetic Energy", "T = \\frac{K \\cdot E}{\\frac{3}{2} k_B}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Average kinetic energy", false},{"k_B", {2, -2, 1, 0, -1, 0, 0}, "Boltzmann constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "T");
-		this->formulas.emplace_back("Boltzmann Average Kinetic Energy", "k_B = \\frac{\\frac{K \\cdot E}{T}}{\\frac{3}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Average kinetic energy", false},{"k_B", {2, -2, 1, 0, -1, 0, 0}, "Boltzmann constant", true},{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false}}, "k_B");
-		this->formulas.emplace_back("Resistors in Series", "R_1 = R_total - R_2", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Resistors in Series", "R_2 = R_total - R_1", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Resistors in Series", "R_total = R_1 + R_2", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_total");
-		this->formulas.emplace_back("Resistors in Parallel (Two)", "R_total = \\frac{R_1 \\cdot R_2}{R_1 + R_2}", std::vector<Variable>{{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_total");
-		this->formulas.emplace_back("Voltage Divider", "R_1 = \\frac{R_2}{\\frac{V_out}{V_in}} - R_2", std::vector<Variable>{{"V_{out}", {2, -3, 1, -1, 0, 0, 0}, "Output voltage", false},{"V_{in}", {2, -3, 1, -1, 0, 0, 0}, "Input voltage", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Voltage Divider", "V_in = \\frac{V_out}{\\frac{R_2}{R_1 + R_2}}", std::vector<Variable>{{"V_{out}", {2, -3, 1, -1, 0, 0, 0}, "Output voltage", false},{"V_{in}", {2, -3, 1, -1, 0, 0, 0}, "Input voltage", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "V_in");
-		this->formulas.emplace_back("Voltage Divider", "V_out = V_in \\cdot \\frac{R_2}{R_1 + R_2}", std::vector<Variable>{{"V_{out}", {2, -3, 1, -1, 0, 0, 0}, "Output voltage", false},{"V_{in}", {2, -3, 1, -1, 0, 0, 0}, "Input voltage", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "V_out");
-		this->formulas.emplace_back("EMF with Internal Resistance", "E = V + I \\cdot r", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "E");
-		this->formulas.emplace_back("EMF with Internal Resistance", "I = \\frac{E - V}{r}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("EMF with Internal Resistance", "V = E - I \\cdot r", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "V");
-		this->formulas.emplace_back("EMF with Internal Resistance", "r = \\frac{E - V}{I}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("RC Time Constant", "C = \\frac{\\tau}{R}", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "C");
-		this->formulas.emplace_back("RC Time Constant", "R = \\frac{\\tau}{C}", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "R");
-		this->formulas.emplace_back("RC Time Constant", "\\tau = R \\cdot C", std::vector<Variable>{{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false}}, "\\tau");
-		this->formulas.emplace_back("Kirchhoff's Junction Rule (Two Currents)", "I_1 = I_in - I_2", std::vector<Variable>{{"I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering junction", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 2", false}}, "I_1");
-		this->formulas.emplace_back("Kirchhoff's Junction Rule (Two Currents)", "I_2 = I_in - I_1", std::vector<Variable>{{"I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering junction", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 2", false}}, "I_2");
-		this->formulas.emplace_back("Kirchhoff's Junction Rule (Two Currents)", "I_in = I_1 + I_2", std::vector<Variable>{{"I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering junction", false},{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 1", false},{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 2", false}}, "I_in");
-		this->formulas.emplace_back("Wheatstone Bridge Balance", "R_1 = \\frac{R_2}{\\frac{R_x}{R_3}}", std::vector<Variable>{{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 3", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 2", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 1", false}}, "R_1");
-		this->formulas.emplace_back("Wheatstone Bridge Balance", "R_2 = \\frac{R_x}{R_3} \\cdot R_1", std::vector<Variable>{{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 3", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 2", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 1", false}}, "R_2");
-		this->formulas.emplace_back("Wheatstone Bridge Balance", "R_3 = \\frac{R_x}{\\frac{R_2}{R_1}}", std::vector<Variable>{{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 3", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 2", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 1", false}}, "R_3");
-		this->formulas.emplace_back("Wheatstone Bridge Balance", "R_x = R_3 \\cdot \\frac{R_2}{R_1}", std::vector<Variable>{{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 3", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 2", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 1", false}}, "R_x");
-		this->formulas.emplace_back("Current Divider", "I_1 = I_total \\cdot \\frac{R_2}{R_1 + R_2}", std::vector<Variable>{{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current through branch 1", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "I_1");
-		this->formulas.emplace_back("Current Divider", "I_total = \\frac{I_1}{\\frac{R_2}{R_1 + R_2}}", std::vector<Variable>{{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current through branch 1", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "I_total");
-		this->formulas.emplace_back("Current Divider", "R_1 = \\frac{R_2}{\\frac{I_1}{I_total}} - R_2", std::vector<Variable>{{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current through branch 1", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Maximum Power Transfer", "E = \\pm \\left(P_max \\cdot 4 R\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power delivered to load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "E");
-		this->formulas.emplace_back("Maximum Power Transfer", "P_max = \\frac{E^{2}}{4 R}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power delivered to load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "P_max");
-		this->formulas.emplace_back("Maximum Power Transfer", "R = \\frac{\\frac{E^{2}}{P_max}}{4}", std::vector<Variable>{{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power delivered to load", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Power Delivered by EMF", "E = \\frac{P}{I}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "E");
-		this->formulas.emplace_back("Power Delivered by EMF", "I = \\frac{P}{E}", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "I");
-		this->formulas.emplace_back("Power Delivered by EMF", "P = E \\cdot I", std::vector<Variable>{{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered", false},{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false}}, "P");
-		this->formulas.emplace_back("Rectangle Area", "A = l \\cdot w", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false}}, "A");
-		this->formulas.emplace_back("Rectangle Area", "l = \\frac{A}{w}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false}}, "l");
-		this->formulas.emplace_back("Rectangle Area", "w = \\frac{A}{l}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false}}, "w");
-		this->formulas.emplace_back("Triangle Area", "A = \\frac{1}{2} b \\cdot h", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "A");
-		this->formulas.emplace_back("Triangle Area", "b = \\frac{\\frac{A}{h}}{\\frac{1}{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "b");
-		this->formulas.emplace_back("Triangle Area", "h = \\frac{A}{\\frac{1}{2} b}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Circle Area", "A = \\pi \\cdot r^{2}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "A");
-		this->formulas.emplace_back("Circle Area", "\\pi = \\frac{A}{r^{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\pi");
-		this->formulas.emplace_back("Circle Area", "r = \\pm \\left(\\frac{A}{\\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Trapezoid Area", "A = \\frac{1}{2} \\cdot \\left(a + b\\right) \\cdot h", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"a", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 1", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 2", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "A");
-		this->formulas.emplace_back("Trapezoid Area", "a = \\frac{\\frac{A}{h}}{\\frac{1}{2}} - b", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"a", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 1", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 2", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "a");
-		this->formulas.emplace_back("Trapezoid Area", "b = \\frac{\\frac{A}{h}}{\\frac{1}{2}} - a", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"a", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 1", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 2", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "b");
-		this->formulas.emplace_back("Trapezoid Area", "h = \\frac{A}{\\frac{1}{2} \\cdot \\left(a + b\\right)}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"a", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 1", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 2", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Parallelogram Area", "A = b \\cdot h", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "A");
-		this->formulas.emplace_back("Parallelogram Area", "b = \\frac{A}{h}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "b");
-		this->formulas.emplace_back("Parallelogram Area", "h = \\frac{A}{b}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Ellipse Area", "A = \\pi \\cdot a \\cdot b", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-major Axis", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-minor Axis", false}}, "A");
-		this->formulas.emplace_back("Ellipse Area", "\\pi = \\frac{\\frac{A}{b}}{a}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-major Axis", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-minor Axis", false}}, "\\pi");
-		this->formulas.emplace_back("Ellipse Area", "a = \\frac{\\frac{A}{b}}{\\pi}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-major Axis", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-minor Axis", false}}, "a");
-		this->formulas.emplace_back("Ellipse Area", "b = \\frac{A}{\\pi \\cdot a}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-major Axis", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-minor Axis", false}}, "b");
-		this->formulas.emplace_back("Sphere Surface Area", "S = 4 \\pi \\cdot r^{2}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "S");
-		this->formulas.emplace_back("Sphere Surface Area", "\\pi = \\frac{\\frac{S}{r^{2}}}{4}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\pi");
-		this->formulas.emplace_back("Sphere Surface Area", "r = \\pm \\left(\\frac{S}{4 \\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Cylinder Total Surface Area", "S = 2 \\pi \\cdot r \\cdot \\left(r + h\\right)", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "S");
-		this->formulas.emplace_back("Cylinder Total Surface Area", "\\pi = \\frac{\\frac{\\frac{S}{r + h}}{r}}{2}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "\\pi");
-		this->formulas.emplace_back("Cylinder Total Surface Area", "h = \\frac{S}{2 \\pi \\cdot r} - r", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Cylinder Total Surface Area", "r = \\frac{-2 \\pi \\cdot h}{4 \\pi} \\pm \\frac{\\left(\\left(2 \\pi \\cdot h\\right)^{2} - 4 \\cdot 2 \\pi \\cdot -S\\right)^{\\frac{1}{2}}}{4 \\pi}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "r");
-    }
-} // namespace Physics
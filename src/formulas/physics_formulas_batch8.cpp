@@ -1,100 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_8() {
-		this->formulas.emplace_back("Cone Total Surface Area", "S = \\pi \\cdot r \\cdot \\left(r + l\\right)", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Slant Height", false}}, "S");
-		this->formulas.emplace_back("Cone Total Surface Area", "\\pi = \\frac{\\frac{S}{r + l}}{r}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Slant Height", false}}, "\\pi");
-		this->formulas.emplace_back("Cone Total Surface Area", "l = \\frac{S}{\\pi \\cdot r} - r", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Slant Height", false}}, "l");
-		this->formulas.emplace_back("Cone Total Surface Area", "r = \\frac{-\\pi \\cdot l}{2 \\pi} \\pm \\frac{\\left(\\left(\\pi \\cdot l\\right)^{2} - 4 \\cdot \\pi \\cdot -S\\right)^{\\frac{1}{2}}}{2 \\pi}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Slant Height", false}}, "r");
-		this->formulas.emplace_back("Cube Surface Area", "S = 6 s^{2}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false}}, "S");
-		this->formulas.emplace_back("Cube Surface Area", "s = \\pm \\left(\\frac{S}{6}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false}}, "s");
-		this->formulas.emplace_back("Sphere Volume", "V = \\frac{4}{3} \\pi \\cdot r^{3}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "V");
-		this->formulas.emplace_back("Sphere Volume", "\\pi = \\frac{\\frac{V}{r^{3}}}{\\frac{4}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "\\pi");
-		this->formulas.emplace_back("Sphere Volume", "r = \\left(\\frac{V}{\\frac{4}{3} \\pi}\\right)^{\\frac{1}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false}}, "r");
-		this->formulas.emplace_back("Cylinder Volume", "V = \\pi \\cdot r^{2} \\cdot h", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "V");
-		this->formulas.emplace_back("Cylinder Volume", "\\pi = \\frac{\\frac{V}{h}}{r^{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "\\pi");
-		this->formulas.emplace_back("Cylinder Volume", "h = \\frac{V}{\\pi \\cdot r^{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Cylinder Volume", "r = \\pm \\left(\\frac{\\frac{V}{h}}{\\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "r");
-		this->formulas.emplace_back("Cone Volume", "V = \\frac{1}{3} \\pi \\cdot r^{2} \\cdot h", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "V");
-		this->formulas.emplace_back("Cone Volume", "\\pi = \\frac{\\frac{\\frac{V}{h}}{r^{2}}}{\\frac{1}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "\\pi");
-		this->formulas.emplace_back("Cone Volume", "h = \\frac{V}{\\frac{1}{3} \\pi \\cdot r^{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Cone Volume", "r = \\pm \\left(\\frac{\\frac{V}{h}}{\\frac{1}{3} \\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "r");
-		this->formulas.emplace_back("Cube Volume", "V = s^{3}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false}}, "V");
-		this->formulas.emplace_back("Cube Volume", "s = V^{\\frac{1}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false}}, "s");
-		this->formulas.emplace_back("Rectangular Prism Volume", "V = l \\cdot w \\cdot h", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "V");
-		this->formulas.emplace_back("Rectangular Prism Volume", "h = \\frac{V}{l \\cdot w}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Rectangular Prism Volume", "l = \\frac{\\frac{V}{h}}{w}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "l");
-		this->formulas.emplace_back("Rectangular Prism Volume", "w = \\frac{\\frac{V}{h}}{l}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "w");
-		this->formulas.emplace_back("Pyramid Volume", "B = \\frac{\\frac{V}{h}}{\\frac{1}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"B", {2, 0, 0, 0, 0, 0, 0}, "Base Area", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "B");
-		this->formulas.emplace_back("Pyramid Volume", "V = \\frac{1}{3} B \\cdot h", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"B", {2, 0, 0, 0, 0, 0, 0}, "Base Area", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "V");
-		this->formulas.emplace_back("Pyramid Volume", "h = \\frac{V}{\\frac{1}{3} B}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"B", {2, 0, 0, 0, 0, 0, 0}, "Base Area", false},{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false}}, "h");
-		this->formulas.emplace_back("Ellipsoid Volume", "V = \\frac{4}{3} \\pi \\cdot a \\cdot b \\cdot c", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false}}, "V");
-		this->formulas.emplace_back("Ellipsoid Volume", "\\pi = \\frac{\\frac{\\frac{\\frac{V}{c}}{b}}{a}}{\\frac{4}{3}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false}}, "\\pi");
-		this->formulas.emplace_back("Ellipsoid Volume", "a = \\frac{\\frac{\\frac{V}{c}}{b}}{\\frac{4}{3} \\pi}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false}}, "a");
-		this->formulas.emplace_back("Ellipsoid Volume", "b = \\frac{\\frac{V}{c}}{\\frac{4}{3} \\pi \\cdot a}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false}}, "b");
-		this->formulas.emplace_back("Ellipsoid Volume", "c = \\frac{V}{\\frac{4}{3} \\pi \\cdot a \\cdot b}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false}}, "c");
-		this->formulas.emplace_back("Torus Volume", "R = \\frac{\\frac{V}{r^{2}}}{2 \\pi^{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Major Radius (center to tube center)", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Minor Radius (tube radius)", false}}, "R");
-		this->formulas.emplace_back("Torus Volume", "V = 2 \\pi^{2} \\cdot R \\cdot r^{2}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Major Radius (center to tube center)", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Minor Radius (tube radius)", false}}, "V");
-		this->formulas.emplace_back("Torus Volume", "\\pi = \\pm \\left(\\frac{\\frac{\\frac{V}{r^{2}}}{R}}{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Major Radius (center to tube center)", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Minor Radius (tube radius)", false}}, "\\pi");
-		this->formulas.emplace_back("Torus Volume", "r = \\pm \\left(\\frac{V}{2 \\pi^{2} \\cdot R}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"R", {1, 0, 0, 0, 0, 0, 0}, "Major Radius (center to tube center)", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Minor Radius (tube radius)", false}}, "r");
-		this->formulas.emplace_back("Magnetic Force on Moving Charge", "B = \\frac{F}{q \\cdot v}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Moving Charge", "F = q \\cdot v \\cdot B", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Moving Charge", "q = \\frac{\\frac{F}{B}}{v}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Magnetic Force on Moving Charge", "v = \\frac{\\frac{F}{B}}{q}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Current-Carrying Wire", "B = \\frac{\\frac{F}{L}}{I}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Current-Carrying Wire", "F = B \\cdot I \\cdot L", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Current-Carrying Wire", "I = \\frac{\\frac{F}{L}}{B}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on Current-Carrying Wire", "L = \\frac{F}{B \\cdot I}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false}}, "L");
-		this->formulas.emplace_back("Cyclotron Radius", "B = \\frac{\\frac{m \\cdot v}{r}}{q}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Radius", "m = \\frac{r \\cdot q \\cdot B}{v}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Radius", "q = \\frac{\\frac{m \\cdot v}{r}}{B}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Radius", "r = \\frac{m \\cdot v}{q \\cdot B}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "r");
-		this->formulas.emplace_back("Cyclotron Radius", "v = \\frac{r \\cdot q \\cdot B}{m}", std::vector<Variable>{{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Cyclotron Frequency", "B = \\frac{f \\cdot 2 \\pi \\cdot m}{q}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Frequency", "\\pi = \\frac{\\frac{\\frac{q \\cdot B}{f}}{m}}{2}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "\\pi");
-		this->formulas.emplace_back("Cyclotron Frequency", "f = \\frac{q \\cdot B}{2 \\pi \\cdot m}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "f");
-		this->formulas.emplace_back("Cyclotron Frequency", "m = \\frac{\\frac{q \\cdot B}{f}}{2 \\pi}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Frequency", "q = \\frac{f \\cdot 2 \\pi \\cdot m}{B}", std::vector<Variable>{{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Period", "B = \\frac{\\frac{2 \\pi \\cdot m}{T}}{q}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Period", "T = \\frac{2 \\pi \\cdot m}{q \\cdot B}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "T");
-		this->formulas.emplace_back("Cyclotron Period", "\\pi = \\frac{\\frac{T \\cdot q \\cdot B}{m}}{2}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\pi");
-		this->formulas.emplace_back("Cyclotron Period", "m = \\frac{T \\cdot q \\cdot B}{2 \\pi}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "m");
-		this->formulas.emplace_back("Cyclotron Period", "q = \\frac{\\frac{2 \\pi \\cdot m}{T}}{B}", std::vector<Variable>{{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "q");
-		this->formulas.emplace_back("Magnetic Flux", "A = \\frac{\\Phi_B}{B}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "A");
-		this->formulas.emplace_back("Magnetic Flux", "B = \\frac{\\Phi_B}{A}", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "B");
-		this->formulas.emplace_back("Magnetic Flux", "\\Phi_B = B \\cdot A", std::vector<Variable>{{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false}}, "\\Phi_B");
-		this->formulas.emplace_back("Hall Voltage", "B = \\frac{\\frac{V_H \\cdot n \\cdot q \\cdot t}{d}}{I}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "B");
-		this->formulas.emplace_back("Hall Voltage", "I = \\frac{\\frac{V_H \\cdot n \\cdot q \\cdot t}{d}}{B}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "I");
-		this->formulas.emplace_back("Hall Voltage", "V_H = \\frac{B \\cdot I \\cdot d}{n \\cdot q \\cdot t}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "V_H");
-		this->formulas.emplace_back("Hall Voltage", "d = \\frac{V_H \\cdot n \\cdot q \\cdot t}{B \\cdot I}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "d");
-		this->formulas.emplace_back("Hall Voltage", "n = \\frac{\\frac{\\frac{B \\cdot I \\cdot d}{V_H}}{t}}{q}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "n");
-		this->formulas.emplace_back("Hall Voltage", "q = \\frac{\\frac{\\frac{B \\cdot I \\cdot d}{V_H}}{t}}{n}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "q");
-		this->formulas.emplace_back("Hall Voltage", "t = \\frac{\\frac{B \\cdot I \\cdot d}{V_H}}{n \\cdot q}", std::vector<Variable>{{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false}}, "t");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "A = \\frac{\\frac{\\tau}{B}}{n \\cdot I}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "A");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "B = \\frac{\\tau}{n \\cdot I \\cdot A}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "I = \\frac{\\frac{\\frac{\\tau}{B}}{A}}{n}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "I");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "\\tau = n \\cdot I \\cdot A \\cdot B", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\tau");
-		this->formulas.emplace_back("Torque on Magnetic Dipole", "n = \\frac{\\frac{\\frac{\\tau}{B}}{A}}{I}", std::vector<Variable>{{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "n");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "A = \\frac{\\mu}{n \\cdot I}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "A");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "I = \\frac{\\frac{\\mu}{A}}{n}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "I");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "\\mu = n \\cdot I \\cdot A", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "\\mu");
-		this->formulas.emplace_back("Magnetic Dipole Moment", "n = \\frac{\\frac{\\mu}{A}}{I}", std::vector<Variable>{{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false}}, "n");
-		this->formulas.emplace_back("Velocity Selector", "B = \\frac{E}{v}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Selected velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Velocity Selector", "E = v \\cdot B", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Selected velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "E");
-		this->formulas.emplace_back("Velocity Selector", "v = \\frac{E}{B}", std::vector<Variable>{{"v", {1, -1, 0, 0, 0, 0, 0}, "Selected velocity", false},{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Charge (with Angle)", "B = \\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{q \\cdot v}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Charge (with Angle)", "F = q \\cdot v \\cdot B \\cdot \\sin\\left(\\theta\\right)", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Charge (with Angle)", "\\theta = \\arcsin\\left(\\frac{F}{q \\cdot v \\cdot B}\\right)", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false}}, "\\theta");
-		this->formulas.emplace_back("Magnetic Force on Charge (with Angle)", "q = \\frac{\\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{B}}{v}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false}}, "q");
-		this->formulas.emplace_back("Magnetic Force on Charge (with Angle)", "v = \\frac{\\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{B}}{q}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false}}, "v");
-		this->formulas.emplace_back("Magnetic Force on Wire (with Angle)", "B = \\frac{\\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{L}}{I}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Force on Wire (with Angle)", "F = B \\cdot I \\cdot L \\cdot \\sin\\left(\\theta\\right)", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false}}, "F");
-		this->formulas.emplace_back("Magnetic Force on Wire (with Angle)", "I = \\frac{\\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{L}}{B}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false}}, "I");
-		this->formulas.emplace_back("Magnetic Force on Wire (with Angle)", "L = \\frac{\\frac{F}{\\sin\\left(\\theta\\right)}}{B \\cdot I}", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false}}, "L");
-		this->formulas.emplace_back("Magnetic Force on Wire (with Angle)", "\\theta = \\arcsin\\left(\\frac{F}{B \\cdot I \\cdot L}\\right)", std::vector<Variable>{{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false}}, "\\theta");
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "B = \\pm \\left(\\frac{\\frac{K \\cdot E \\cdot 2 m}{r^{2}}}{q^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "B");
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "E = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{2 m}}{K}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "E");
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "K = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{2 m}}{E}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "K");
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "m = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{K \\cdot E}}{2}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "m");
-    }
-} // namespace Physics
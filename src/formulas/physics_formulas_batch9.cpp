@@ -1,101 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    void FormulaDatabase::batch_9() {
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "q = \\pm \\left(\\frac{\\frac{K \\cdot E \\cdot 2 m}{r^{2}}}{B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "q");
-		this->formulas.emplace_back("Cyclotron Kinetic Energy", "r = \\pm \\left(\\frac{K \\cdot E \\cdot 2 m}{q^{2} \\cdot B^{2}}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false}}, "r");
-		this->formulas.emplace_back("Magnetic Potential Energy of Dipole", "B = \\frac{U}{\\mu}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "B");
-		this->formulas.emplace_back("Magnetic Potential Energy of Dipole", "U = \\mu \\cdot B", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "U");
-		this->formulas.emplace_back("Magnetic Potential Energy of Dipole", "\\mu = \\frac{U}{B}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false}}, "\\mu");
-		this->formulas.emplace_back("Hall Coefficient", "R_H = \\frac{1}{n \\cdot q}", std::vector<Variable>{{"R_H", {3, -1, 0, -1, 0, 0, 0}, "Hall coefficient", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "R_H");
-		this->formulas.emplace_back("Hall Coefficient", "n = \\frac{\\frac{1}{R_H}}{q}", std::vector<Variable>{{"R_H", {3, -1, 0, -1, 0, 0, 0}, "Hall coefficient", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "n");
-		this->formulas.emplace_back("Hall Coefficient", "q = \\frac{\\frac{1}{R_H}}{n}", std::vector<Variable>{{"R_H", {3, -1, 0, -1, 0, 0, 0}, "Hall coefficient", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "q");
-		this->formulas.emplace_back("Conductance Definition", "G = \\frac{1}{R}", std::vector<Variable>{{"G", {-2, 3, -1, 2, 0, 0, 0}, "Conductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "G");
-		this->formulas.emplace_back("Conductance Definition", "R = \\frac{1}{G}", std::vector<Variable>{{"G", {-2, 3, -1, 2, 0, 0, 0}, "Conductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("Resistivity Temperature Dependence", "\\rho = \\rho_0", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at temperature T", false},{"\\rho_0", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at reference temperature T_0", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistivity", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"T_0", {0, 0, 0, 0, 1, 0, 0}, "Reference temperature", false}}, "\\rho");
-		this->formulas.emplace_back("Resistivity Temperature Dependence", "\\rho_0 = \\rho", std::vector<Variable>{{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at temperature T", false},{"\\rho_0", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at reference temperature T_0", false},{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistivity", false},{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},{"T_0", {0, 0, 0, 0, 1, 0, 0}, "Reference temperature", false}}, "\\rho_0");
-		this->formulas.emplace_back("Electrical Energy", "P = \\frac{U}{t}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electrical energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "P");
-		this->formulas.emplace_back("Electrical Energy", "U = P \\cdot t", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electrical energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "U");
-		this->formulas.emplace_back("Electrical Energy", "t = \\frac{U}{P}", std::vector<Variable>{{"U", {2, -2, 1, 0, 0, 0, 0}, "Electrical energy dissipated", false},{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("Charge from Current", "I = \\frac{q}{t}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Electric current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "I");
-		this->formulas.emplace_back("Charge from Current", "q = I \\cdot t", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Electric current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "q");
-		this->formulas.emplace_back("Charge from Current", "t = \\frac{q}{I}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Electric current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false}}, "t");
-		this->formulas.emplace_back("EMF with Internal Resistance", "I = \\frac{\\varepsilon - V}{r}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "I");
-		this->formulas.emplace_back("EMF with Internal Resistance", "V = \\varepsilon - I \\cdot r", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "V");
-		this->formulas.emplace_back("EMF with Internal Resistance", "\\varepsilon = V + I \\cdot r", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "\\varepsilon");
-		this->formulas.emplace_back("EMF with Internal Resistance", "r = \\frac{\\varepsilon - V}{I}", std::vector<Variable>{{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false}}, "r");
-		this->formulas.emplace_back("Resistors in Series", "R_1 = R_eq - R_n - \\cdots - R_2", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Resistors in Series", "R_2 = R_eq - R_n - \\cdots - R_1", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Resistors in Series", "R_eq = R_1 + R_2 + \\cdots + R_n", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_eq");
-		this->formulas.emplace_back("Resistors in Series", "R_n = R_eq - \\left(R_1 + R_2 + \\cdots\\right)", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_n");
-		this->formulas.emplace_back("Resistors in Series", "\\cdots = R_eq - R_n - \\left(R_1 + R_2\\right)", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "\\cdots");
-		this->formulas.emplace_back("Resistors in Parallel", "R_1 = \\frac{1}{\\frac{1}{R_eq} - \\frac{1}{R_n} - \\cdots - \\frac{1}{R_2}}", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Resistors in Parallel", "R_2 = \\frac{1}{\\frac{1}{R_eq} - \\frac{1}{R_n} - \\cdots - \\frac{1}{R_1}}", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Resistors in Parallel", "R_eq = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2} + \\cdots + \\frac{1}{R_n}}", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_eq");
-		this->formulas.emplace_back("Resistors in Parallel", "R_n = \\frac{1}{\\frac{1}{R_eq} - \\left(\\frac{1}{R_1} + \\frac{1}{R_2} + \\cdots\\right)}", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_n");
-		this->formulas.emplace_back("Resistors in Parallel", "\\cdots = \\frac{1}{R_eq} - \\frac{1}{R_n} - \\left(\\frac{1}{R_1} + \\frac{1}{R_2}\\right)", std::vector<Variable>{{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "\\cdots");
-		this->formulas.emplace_back("Voltage Divider", "R_1 = \\frac{R_x}{\\frac{V_x}{V_total}} - R_2", std::vector<Variable>{{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Voltage Divider", "R_2 = \\frac{R_x}{\\frac{V_x}{V_total}} - R_1", std::vector<Variable>{{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Voltage Divider", "R_x = \\frac{V_x}{V_total} \\cdot \\left(R_1 + R_2\\right)", std::vector<Variable>{{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_x");
-		this->formulas.emplace_back("Voltage Divider", "V_total = \\frac{V_x}{\\frac{R_x}{R_1 + R_2}}", std::vector<Variable>{{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "V_total");
-		this->formulas.emplace_back("Voltage Divider", "V_x = V_total \\cdot \\frac{R_x}{R_1 + R_2}", std::vector<Variable>{{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "V_x");
-		this->formulas.emplace_back("Current Divider", "I_total = \\frac{I_x}{\\frac{R_other}{R_1 + R_2}}", std::vector<Variable>{{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "I_total");
-		this->formulas.emplace_back("Current Divider", "I_x = I_total \\cdot \\frac{R_other}{R_1 + R_2}", std::vector<Variable>{{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "I_x");
-		this->formulas.emplace_back("Current Divider", "R_1 = \\frac{R_other}{\\frac{I_x}{I_total}} - R_2", std::vector<Variable>{{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_1");
-		this->formulas.emplace_back("Current Divider", "R_2 = \\frac{R_other}{\\frac{I_x}{I_total}} - R_1", std::vector<Variable>{{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_2");
-		this->formulas.emplace_back("Current Divider", "R_other = \\frac{I_x}{I_total} \\cdot \\left(R_1 + R_2\\right)", std::vector<Variable>{{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false}}, "R_other");
-		this->formulas.emplace_back("Capacitor Charge-Voltage Relation", "C = \\frac{q}{V}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge on capacitor", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage across capacitor", false}}, "C");
-		this->formulas.emplace_back("Capacitor Charge-Voltage Relation", "V = \\frac{q}{C}", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge on capacitor", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage across capacitor", false}}, "V");
-		this->formulas.emplace_back("Capacitor Charge-Voltage Relation", "q = C \\cdot V", std::vector<Variable>{{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge on capacitor", false},{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage across capacitor", false}}, "q");
-		this->formulas.emplace_back("RC Circuit Charging (Charge)", "Q_max = \\frac{q \\cdot t}{1 - e^{\\frac{-t}{\\tau}}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge (= C·ε)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "Q_max");
-		this->formulas.emplace_back("RC Circuit Charging (Charge)", "\\tau = \\frac{-t}{\\frac{\\ln\\left(1 - \\frac{q \\cdot t}{Q_max}\\right)}{\\ln\\left(e\\right)}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge (= C·ε)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "\\tau");
-		this->formulas.emplace_back("RC Circuit Charging (Charge)", "e = \\left(1 - \\frac{q \\cdot t}{Q_max}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge (= C·ε)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "e");
-		this->formulas.emplace_back("RC Circuit Charging (Charge)", "q = \\frac{Q_max \\cdot \\left(1 - e^{\\frac{-t}{\\tau}}\\right)}{t}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge (= C·ε)", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "q");
-		this->formulas.emplace_back("RC Circuit Discharging (Charge)", "Q_0 = \\frac{q \\cdot t}{e^{\\frac{-t}{\\tau}}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge on capacitor", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "Q_0");
-		this->formulas.emplace_back("RC Circuit Discharging (Charge)", "\\tau = \\frac{-t}{\\frac{\\ln\\left(\\frac{q \\cdot t}{Q_0}\\right)}{\\ln\\left(e\\right)}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge on capacitor", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "\\tau");
-		this->formulas.emplace_back("RC Circuit Discharging (Charge)", "e = \\left(\\frac{q \\cdot t}{Q_0}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge on capacitor", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "e");
-		this->formulas.emplace_back("RC Circuit Discharging (Charge)", "q = \\frac{Q_0 \\cdot e^{\\frac{-t}{\\tau}}}{t}", std::vector<Variable>{{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge on capacitor", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "q");
-		this->formulas.emplace_back("RC Circuit Charging (Current)", "I = \\frac{\\frac{\\varepsilon}{R} \\cdot e^{\\frac{-t}{\\tau}}}{t}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "I");
-		this->formulas.emplace_back("RC Circuit Charging (Current)", "R = \\frac{\\varepsilon}{\\frac{I \\cdot t}{e^{\\frac{-t}{\\tau}}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "R");
-		this->formulas.emplace_back("RC Circuit Charging (Current)", "\\tau = \\frac{-t}{\\frac{\\ln\\left(\\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)}{\\ln\\left(e\\right)}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "\\tau");
-		this->formulas.emplace_back("RC Circuit Charging (Current)", "\\varepsilon = \\frac{I \\cdot t}{e^{\\frac{-t}{\\tau}}} \\cdot R", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "\\varepsilon");
-		this->formulas.emplace_back("RC Circuit Charging (Current)", "e = \\left(\\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false}}, "e");
-		this->formulas.emplace_back("RL Time Constant", "L = \\tau_L \\cdot R", std::vector<Variable>{{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "L");
-		this->formulas.emplace_back("RL Time Constant", "R = \\frac{L}{\\tau_L}", std::vector<Variable>{{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "R");
-		this->formulas.emplace_back("RL Time Constant", "\\tau_L = \\frac{L}{R}", std::vector<Variable>{{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false}}, "\\tau_L");
-		this->formulas.emplace_back("RL Circuit Current Growth", "I = \\frac{\\frac{\\varepsilon}{R} \\cdot \\left(1 - e^{\\frac{-t}{\\tau_L}}\\right)}{t}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "I");
-		this->formulas.emplace_back("RL Circuit Current Growth", "R = \\frac{\\varepsilon}{\\frac{I \\cdot t}{1 - e^{\\frac{-t}{\\tau_L}}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "R");
-		this->formulas.emplace_back("RL Circuit Current Growth", "\\tau_L = \\frac{-t}{\\frac{\\ln\\left(1 - \\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)}{\\ln\\left(e\\right)}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "\\tau_L");
-		this->formulas.emplace_back("RL Circuit Current Growth", "\\varepsilon = \\frac{I \\cdot t}{1 - e^{\\frac{-t}{\\tau_L}}} \\cdot R", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "\\varepsilon");
-		this->formulas.emplace_back("RL Circuit Current Growth", "e = \\left(1 - \\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)^{\\frac{1}{\\frac{-t}{\\tau_L}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "e");
-		this->formulas.emplace_back("RL Circuit Current Decay", "I = \\frac{I_0 \\cdot e^{\\frac{-t}{\\tau_L}}}{t}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during decay", false},{"I_0", {0, 0, 0, 1, 0, 0, 0}, "Initial current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "I");
-		this->formulas.emplace_back("RL Circuit Current Decay", "I_0 = \\frac{I \\cdot t}{e^{\\frac{-t}{\\tau_L}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during decay", false},{"I_0", {0, 0, 0, 1, 0, 0, 0}, "Initial current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "I_0");
-		this->formulas.emplace_back("RL Circuit Current Decay", "\\tau_L = \\frac{-t}{\\frac{\\ln\\left(\\frac{I \\cdot t}{I_0}\\right)}{\\ln\\left(e\\right)}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during decay", false},{"I_0", {0, 0, 0, 1, 0, 0, 0}, "Initial current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "\\tau_L");
-		this->formulas.emplace_back("RL Circuit Current Decay", "e = \\left(\\frac{I \\cdot t}{I_0}\\right)^{\\frac{1}{\\frac{-t}{\\tau_L}}}", std::vector<Variable>{{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during decay", false},{"I_0", {0, 0, 0, 1, 0, 0, 0}, "Initial current", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false}}, "e");
-		this->formulas.emplace_back("Annular Cross-Sectional Area", "A = \\pi \\cdot \\left(r_2^{2} - r_1^{2}\\right)", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area of annular ring", false},{"r_2", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},{"r_1", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false}}, "A");
-		this->formulas.emplace_back("Annular Cross-Sectional Area", "\\pi = \\frac{A}{r_2^{2} - r_1^{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area of annular ring", false},{"r_2", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},{"r_1", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false}}, "\\pi");
-		this->formulas.emplace_back("Annular Cross-Sectional Area", "r_1 = \\pm \\left(r_2^{2} - \\frac{A}{\\pi}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area of annular ring", false},{"r_2", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},{"r_1", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false}}, "r_1");
-		this->formulas.emplace_back("Annular Cross-Sectional Area", "r_2 = \\pm \\left(\\frac{A}{\\pi} + r_1^{2}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area of annular ring", false},{"r_2", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},{"r_1", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false}}, "r_2");
-		this->formulas.emplace_back("Volume of a Cylinder", "A = \\frac{V_vol}{L}", std::vector<Variable>{{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of cylinder", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "A");
-		this->formulas.emplace_back("Volume of a Cylinder", "L = \\frac{V_vol}{A}", std::vector<Variable>{{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of cylinder", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "L");
-		this->formulas.emplace_back("Volume of a Cylinder", "V_vol = A \\cdot L", std::vector<Variable>{{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of cylinder", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false}}, "V_vol");
-		this->formulas.emplace_back("Mass from Density", "V_vol = \\frac{m}{\\rho_d}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\rho_{d}", {-3, 0, 1, 0, 0, 0, 0}, "Mass density", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "V_vol");
-		this->formulas.emplace_back("Mass from Density", "\\rho_d = \\frac{m}{V_vol}", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\rho_{d}", {-3, 0, 1, 0, 0, 0, 0}, "Mass density", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "\\rho_d");
-		this->formulas.emplace_back("Mass from Density", "m = \\rho_d \\cdot V_vol", std::vector<Variable>{{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},{"\\rho_{d}", {-3, 0, 1, 0, 0, 0, 0}, "Mass density", false},{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume", false}}, "m");
-		this->formulas.emplace_back("Heat of Transformation (Phase Change)", "L_v = \\frac{Q}{m}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy required for phase change", false},{"L_v", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat of vaporization", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of substance", false}}, "L_v");
-		this->formulas.emplace_back("Heat of Transformation (Phase Change)", "Q = L_v \\cdot m", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy required for phase change", false},{"L_v", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat of vaporization", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of substance", false}}, "Q");
-		this->formulas.emplace_back("Heat of Transformation (Phase Change)", "m = \\frac{Q}{L_v}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy required for phase change", false},{"L_v", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat of vaporization", false},{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of substance", false}}, "m");
-		this->formulas.emplace_back("Joule Heating Energy", "I = \\pm \\left(\\frac{\\frac{Q}{t}}{R}\\right)^{\\frac{1}{2}}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy generated", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time duration", false}}, "I");
-		this->formulas.emplace_back("Joule Heating Energy", "Q = I^{2} \\cdot R \\cdot t", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy generated", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time duration", false}}, "Q");
-		this->formulas.emplace_back("Joule Heating Energy", "R = \\frac{\\frac{Q}{t}}{I^{2}}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy generated", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time duration", false}}, "R");
-		this->formulas.emplace_back("Joule Heating Energy", "t = \\frac{Q}{I^{2} \\cdot R}", std::vector<Variable>{{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy generated", false},{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},{"t", {0, 1, 0, 0, 0, 0, 0}, "Time duration", false}}, "t");
-		this->formulas.emplace_back("Drift Velocity of Charge Carriers", "J = v_d \\cdot n \\cdot q", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "J");
-		this->formulas.emplace_back("Drift Velocity of Charge Carriers", "n = \\frac{\\frac{J}{v_d}}{q}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "n");
-		this->formulas.emplace_back("Drift Velocity of Charge Carriers", "q = \\frac{\\frac{J}{v_d}}{n}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "q");
-		this->formulas.emplace_back("Drift Velocity of Charge Carriers", "v_d = \\frac{J}{n \\cdot q}", std::vector<Variable>{{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false}}, "v_d");
-		this->formulas.emplace_back("Current from Drift Velocity", "A = \\frac{I}{n \\cdot q \\cdot v_d}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "A");
-		this->formulas.emplace_back("Current from Drift Velocity", "I = n \\cdot q \\cdot v_d \\cdot A", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "I");
-		this->formulas.emplace_back("Current from Drift Velocity", "n = \\frac{\\frac{\\frac{I}{A}}{v_d}}{q}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "n");
-		this->formulas.emplace_back("Current from Drift Velocity", "q = \\frac{\\frac{\\frac{I}{A}}{v_d}}{n}", std::vector<Variable>{{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false}}, "q");
-    }
-} // namespace Physics
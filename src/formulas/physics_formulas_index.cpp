@@ -0,0 +1,76 @@
+#include "physics_formulas.hpp"
+#include "../parallel.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace Physics {
+    std::span<const std::uint32_t> FormulaDatabase::producing(const dv::UnitVector &unit) const noexcept {
+        const auto groups = catalogue.output_groups;
+        const auto found = std::ranges::lower_bound(groups, unit.packed(), {},
+            [](const OutputGroup &group) { return group.unit.packed(); });
+        if (found == groups.end() || found->unit != unit) return {};
+        return catalogue.producers.subspan(found->first, found->count);
+    }
+
+    // Groups every formula's inputs into count slots once and numbers the distinct
+    // input units densely, so matching a pool is array indexing rather than unit scans
+    void FormulaDatabase::build_inputs() const {
+        auto& [units, ids, slot_units, slot_counts, totals] = inputs;
+        units.push_back({});    // id 0 fills unused slots, whose count is 0
+        slot_units.assign(size() * MAX_INPUT_TYPES, 0);
+        slot_counts.assign(size() * MAX_INPUT_TYPES, 0);
+        totals.assign(size(), 0);
+
+        for (std::size_t idx = 0; idx < size(); ++idx) {
+            const auto& f = catalogue.formulas[idx];
+            const Variable* out = f.output();
+            std::size_t used = 0;
+            for (const auto& v : f.variables()) {
+                if (&v == out || v.is_constant) continue;
+                auto [id, added] = ids.try_emplace(v.units, static_cast<std::uint16_t>(units.size()));
+                if (added) units.push_back(v.units);
+                std::size_t slot = 0;
+                while (slot < used && slot_units[idx * MAX_INPUT_TYPES + slot] != id->second) slot++;
+                // Catalogues cap families at MAX_INPUT_TYPES variables (static_assert in the
+                // generated table, FormulaPack on load); an unchecked one must not spill its
+                // extra units into the next formula's slots
+                assert(slot < MAX_INPUT_TYPES && "formula has more distinct input units than MAX_INPUT_TYPES");
+                if (slot == MAX_INPUT_TYPES) continue;
+                if (slot == used) slot_units[idx * MAX_INPUT_TYPES + used++] = id->second;
+                slot_counts[idx * MAX_INPUT_TYPES + slot]++;
+                totals[idx]++;
+            }
+        }
+    }
+
+    PoolCoverage FormulaDatabase::match_pool(std::span<const dv::UnitVector> pool, unsigned threads) const {
+        const auto& [units, ids, slot_units, slot_counts, totals] = tables();
+
+        std::vector<std::uint8_t> have(units.size(), 0);
+        for (const auto& unit : pool) {
+            const auto found = ids.find(unit);
+            if (found != ids.end() && have[found->second] < 0xFF) have[found->second]++;
+        }
+
+        // Each chunk gathers and compares its own formulas, writing disjoint ranges
+        PoolCoverage coverage{ std::vector<std::uint8_t>(size()), std::vector<std::uint8_t>(size()) };
+        constexpr std::size_t GRAIN = 4096;   // formulas per thread worth starting it for
+        dv::parallel_chunks(size(), dv::parallel_thread_count(threads, size(), GRAIN),
+            [&](unsigned, std::size_t begin, std::size_t end) {
+                std::uint8_t got[MAX_INPUT_TYPES];
+                for (std::size_t idx = begin; idx < end; ++idx) {
+                    const std::uint16_t* slots = &slot_units[idx * MAX_INPUT_TYPES];
+                    const std::uint8_t* need = &slot_counts[idx * MAX_INPUT_TYPES];
+                    for (std::size_t k = 0; k < MAX_INPUT_TYPES; ++k) got[k] = have[slots[k]];
+                    std::uint8_t missing = 0, matched = 0;
+                    for (std::size_t k = 0; k < MAX_INPUT_TYPES; ++k) {
+                        missing |= static_cast<std::uint8_t>((got[k] < need[k]) << k);
+                        matched += std::min(got[k], need[k]);
+                    }
+                    coverage.missing[idx] = missing;
+                    coverage.matched[idx] = matched;
+                }
+            });
+        return coverage;
+    }
+} // namespace Physics
@@ -1,28 +0,0 @@
-#include "physics_formulas.hpp"
-
-namespace Physics {
-    FormulaDatabase::FormulaDatabase() {
-        this->formulas.reserve(2000);
-		batch_0();
-		batch_1();
-		batch_2();
-		batch_3();
-		batch_4();
-		batch_5();
-		batch_6();
-		batch_7();
-		batch_8();
-		batch_9();
-		batch_10();
-		batch_11();
-		batch_12();
-		batch_13();
-		batch_14();
-		batch_15();
-		batch_16();
-		batch_17();
-		batch_18();
-		batch_19();
-		batch_20();
-    }
-} // namespace Physics
@@ -0,0 +1,4757 @@
+// Generated by formula_gen/formulas_to_cpp.ts, do not edit
+#include "physics_formulas.hpp"
+#include <algorithm>
+
+namespace Physics {
+#ifdef NERO_NO_EMBEDDED_FORMULAS
+    FormulaCatalogue builtin_catalogue() noexcept { return {}; }
+#else
+namespace {
+    constexpr Variable variables[] = {
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"W", {1, -2, 1, 0, 0, 0, 0}, "Weight force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},
+		{"\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false},
+		{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring restoring force", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Elastic potential energy", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement from equilibrium", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational field strength", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the source body", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass of first body", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass of second body", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between centers of mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},
+		{"v_e", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body to escape from", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of mass", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Orbital period", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius (semi-major axis)", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the central body", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration at surface", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Universal gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass of the body", false},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of the body", false},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Photon energy", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},
+		{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy of photoelectrons", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency of incident light", false},
+		{"\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},
+		{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "de Broglie wavelength", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false},
+		{"E_n", {2, -2, 1, 0, 0, 0, 0}, "Energy of level n", false},
+		{"E_1", {2, -2, 1, 0, 0, 0, 0}, "Ground state energy", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false},
+		{"r_n", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Principal quantum number", false},
+		{"a_0", {1, 0, 0, 0, 0, 0, 0}, "Bohr radius", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of remaining nuclei", false},
+		{"N_0", {0, 0, 0, 0, 0, 0, 0}, "Initial number of nuclei", false},
+		{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},
+		{"\\lambda", {0, -1, 0, 0, 0, 0, 0}, "Decay constant", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Electrostatic force", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Electric force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Test charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Source charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "First charge", false},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Second charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance between charges", false},
+		{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},
+		{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge magnitude", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},
+		{"u", {-1, -2, 1, 0, 0, 0, 0}, "Electric energy density", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field on axis", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge on ring", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of ring", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Electric potential energy", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field between plates", false},
+		{"\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle from dipole axis", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false},
+		{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on dipole", false},
+		{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},
+		{"p", {1, 1, 0, 1, 0, 0, 0}, "Electric dipole moment", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from line charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Induced voltage", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current change", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Solenoid length", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in coil 2", false},
+		{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current change in coil 1", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false},
+		{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},
+		{"k", {0, 0, 0, 0, 0, 0, 0}, "Coupling coefficient", false},
+		{"L_1", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 1", false},
+		{"L_2", {2, -2, 1, -2, 0, 0, 0}, "Inductance of coil 2", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"Q", {0, 0, 0, 0, 0, 0, 0}, "Quality factor", false},
+		{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant angular frequency", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},
+		{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle of incidence", false},
+		{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},
+		{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle of refraction", false},
+		{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},
+		{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},
+		{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},
+		{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},
+		{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},
+		{"M", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},
+		{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false},
+		{"f", {1, 0, 0, 0, 0, 0, 0}, "Focal length", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},
+		{"R_1", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 1", false},
+		{"R_2", {1, 0, 0, 0, 0, 0, 0}, "Radius of curvature 2", false},
+		{"\\theta_c", {0, 0, 0, 0, 0, 0, 0}, "Critical angle", false},
+		{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of less dense medium", false},
+		{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of denser medium", false},
+		{"\\theta_B", {0, 0, 0, 0, 0, 0, 0}, "Brewster's angle", false},
+		{"n_2", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 2", false},
+		{"n_1", {0, 0, 0, 0, 0, 0, 0}, "Refractive index of medium 1", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Refractive index", false},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in medium", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"C_{total}", {-2, 4, -1, 2, 0, 0, 0}, "Total capacitance", false},
+		{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},
+		{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},
+		{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false},
+		{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},
+		{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},
+		{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"r_a", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},
+		{"r_b", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy stored", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Plate separation", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of sphere", false},
+		{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},
+		{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Gravitational potential energy", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance over which force is applied", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Net work done on object", false},
+		{"\\Delta KE", {2, -2, 1, 0, 0, 0, 0}, "Change in kinetic energy", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"p", {1, -1, 1, 0, 0, 0, 0}, "Linear momentum", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force applied", false},
+		{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},
+		{"\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Peak EMF", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of coil", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"V_2", {2, -3, 1, -1, 0, 0, 0}, "Secondary voltage", false},
+		{"V_1", {2, -3, 1, -1, 0, 0, 0}, "Primary voltage", false},
+		{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},
+		{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},
+		{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Secondary current", false},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Primary current", false},
+		{"N_1", {0, 0, 0, 0, 0, 0, 0}, "Primary turns", false},
+		{"N_2", {0, 0, 0, 0, 0, 0, 0}, "Secondary turns", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of rod", false},
+		{"\\Delta\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\Delta A", {2, 0, 0, 0, 0, 0, 0}, "Change in area", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Pendulum length", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed", false},
+		{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},
+		{"\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false},
+		{"I", {0, -3, 1, 0, 0, 0, 0}, "Intensity", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\lambda_n", {1, 0, 0, 0, 0, 0, 0}, "nth harmonic wavelength", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "String length", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Harmonic number", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Amount of substance", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"M_1", {0, 0, 0, 0, 0, -3, 0}, "Initial molarity", false},
+		{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},
+		{"M_2", {0, 0, 0, 0, 0, -3, 0}, "Final molarity", false},
+		{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},
+		{"M", {0, 0, 0, 0, 0, -3, 0}, "Molarity", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false},
+		{"pH", {0, 0, 0, 0, 0, 0, 0}, "pH", false},
+		{"pOH", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},
+		{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"E^0", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false},
+		{"A", {0, 0, 0, 0, 0, 0, 0}, "Absorbance", false},
+		{"\\epsilon", {2, 0, 0, 0, 0, -1, 0}, "Molar absorptivity", false},
+		{"b", {1, 0, 0, 0, 0, 0, 0}, "Path length", false},
+		{"c", {-3, 0, 0, 0, 0, 1, 0}, "Concentration", false},
+		{"q", {2, -2, 1, 0, 0, 0, 0}, "Heat absorbed or released", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"A", {-3, 0, 0, 0, 0, 1, 0}, "Concentration at time t", false},
+		{"A_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},
+		{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant (first order)", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false},
+		{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},
+		{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Original length", false},
+		{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},
+		{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Stress", false},
+		{"\\epsilon", {0, 0, 0, 0, 0, 0, 0}, "Strain", false},
+		{"\\tau", {-1, -2, 1, 0, 0, 0, 0}, "Shear stress", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Shear force", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Bending stress", false},
+		{"M", {2, -2, 1, 0, 0, 0, 0}, "Bending moment", false},
+		{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance from neutral axis", false},
+		{"I", {4, 0, 0, 0, 0, 0, 0}, "Second moment of area", false},
+		{"\\sigma", {-1, -2, 1, 0, 0, 0, 0}, "Thermal stress", false},
+		{"E", {-1, -2, 1, 0, 0, 0, 0}, "Young's modulus", false},
+		{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of thermal expansion", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"X_C", {2, -3, 1, -2, 0, 0, 0}, "Capacitive reactance", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"X_L", {2, -3, 1, -2, 0, 0, 0}, "Inductive reactance", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"f_0", {0, -1, 0, 0, 0, 0, 0}, "Resonant frequency", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"F_2", {1, -2, 1, 0, 0, 0, 0}, "Output force", false},
+		{"F_1", {1, -2, 1, 0, 0, 0, 0}, "Input force", false},
+		{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Output piston area", false},
+		{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Input piston area", false},
+		{"Re", {0, 0, 0, 0, 0, 0, 0}, "Reynolds number", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Flow velocity", false},
+		{"D", {1, 0, 0, 0, 0, 0, 0}, "Characteristic diameter", false},
+		{"\\mu", {-1, -1, 1, 0, 0, 0, 0}, "Dynamic viscosity", false},
+		{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},
+		{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},
+		{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false},
+		{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},
+		{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power output", false},
+		{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Power input", false},
+		{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v_avg", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"y", {1, 0, 0, 0, 0, 0, 0}, "Vertical distance fallen", false},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Horizontal range", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"theta", {0, 0, 0, 0, 0, 0, 0}, "Launch angle", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of circular path", false},
+		{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Moment arm (radius)", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Applied force", false},
+		{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},
+		{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Final angular velocity", false},
+		{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},
+		{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},
+		{"\\omega_0", {0, -1, 0, 0, 0, 0, 0}, "Initial angular velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"KE_rot", {2, -2, 1, 0, 0, 0, 0}, "Rotational kinetic energy", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius from axis of rotation", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Tangential velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"a_t", {1, -2, 0, 0, 0, 0, 0}, "Tangential acceleration", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},
+		{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},
+		{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},
+		{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},
+		{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistance", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Conductivity", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy dissipated", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},
+		{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Hydrostatic pressure", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Depth below surface", false},
+		{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Displaced fluid volume", false},
+		{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 2", false},
+		{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 1", false},
+		{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity at section 1", false},
+		{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area at section 2", false},
+		{"q", {-1, -2, 1, 0, 0, 0, 0}, "Dynamic pressure", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false},
+		{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volumetric flow rate", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false},
+		{"\\dot{m}", {0, -1, 1, 0, 0, 0, 0}, "Mass flow rate", false},
+		{"\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Fluid velocity", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of toroid", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of wire", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},
+		{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance between wires", false},
+		{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Distance from center along axis", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field inside wire", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from center of wire", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Radius of wire", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field on axis of dipole", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from dipole", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"L", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat", false},
+		{"\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},
+		{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},
+		{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power (rate of heat transfer)", false},
+		{"k", {1, -3, 1, 0, -1, 0, 0}, "Thermal conductivity", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature difference", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Radiated power", false},
+		{"\\sigma", {0, -3, 1, 0, -4, 0, 0}, "Stefan-Boltzmann constant", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Surface area", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false},
+		{"\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added to system", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false},
+		{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Carnot efficiency", false},
+		{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},
+		{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false},
+		{"\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat transferred", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by gas", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"\\Delta V", {3, 0, 0, 0, 0, 0, 0}, "Change in volume", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Average kinetic energy", false},
+		{"k_B", {2, -2, 1, 0, -1, 0, 0}, "Boltzmann constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Absolute temperature", false},
+		{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"V_{out}", {2, -3, 1, -1, 0, 0, 0}, "Output voltage", false},
+		{"V_{in}", {2, -3, 1, -1, 0, 0, 0}, "Input voltage", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering junction", false},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 1", false},
+		{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current in branch 2", false},
+		{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},
+		{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 3", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 2", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Known resistance 1", false},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current through branch 1", false},
+		{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power delivered to load", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"b", {1, 0, 0, 0, 0, 0, 0}, "Base", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"a", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 1", false},
+		{"b", {1, 0, 0, 0, 0, 0, 0}, "Parallel Side 2", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-major Axis", false},
+		{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-minor Axis", false},
+		{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"S", {2, 0, 0, 0, 0, 0, 0}, "Total Surface Area", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Slant Height", false},
+		{"S", {2, 0, 0, 0, 0, 0, 0}, "Surface Area", false},
+		{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"s", {1, 0, 0, 0, 0, 0, 0}, "Side Length", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"w", {1, 0, 0, 0, 0, 0, 0}, "Width", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"B", {2, 0, 0, 0, 0, 0, 0}, "Base Area", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"a", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis a", false},
+		{"b", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis b", false},
+		{"c", {1, 0, 0, 0, 0, 0, 0}, "Semi-axis c", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"R", {1, 0, 0, 0, 0, 0, 0}, "Major Radius (center to tube center)", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Minor Radius (tube radius)", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron frequency", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},
+		{"\\pi", {0, 0, 0, 0, 0, 0, 0}, "Pi", true},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Width of conductor", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor", false},
+		{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Selected velocity", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between velocity and field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Wire length", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between wire and field", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Cyclotron radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"R_H", {3, -1, 0, -1, 0, 0, 0}, "Hall coefficient", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"G", {-2, 3, -1, 2, 0, 0, 0}, "Conductance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at temperature T", false},
+		{"\\rho_0", {3, -3, 1, -2, 0, 0, 0}, "Resistivity at reference temperature T_0", false},
+		{"\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient of resistivity", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"T_0", {0, 0, 0, 0, 1, 0, 0}, "Reference temperature", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Electrical energy dissipated", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Electric current", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"R_{eq}", {2, -3, 1, -2, 0, 0, 0}, "Equivalent resistance", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"V_x", {2, -3, 1, -1, 0, 0, 0}, "Voltage across resistor R_x", false},
+		{"V_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total source voltage", false},
+		{"R_x", {2, -3, 1, -2, 0, 0, 0}, "Resistance of interest", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"I_x", {0, 0, 0, 1, 0, 0, 0}, "Current through branch of interest", false},
+		{"I_{total}", {0, 0, 0, 1, 0, 0, 0}, "Total current entering node", false},
+		{"R_{other}", {2, -3, 1, -2, 0, 0, 0}, "Resistance of the other parallel branch", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge on capacitor", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage across capacitor", false},
+		{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},
+		{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge (= C·ε)", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false},
+		{"q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},
+		{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge on capacitor", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false},
+		{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during charging", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "RC time constant", false},
+		{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},
+		{"I(t)", {0, 0, 0, 1, 0, 0, 0}, "Current at time t during decay", false},
+		{"I_0", {0, 0, 0, 1, 0, 0, 0}, "Initial current", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\tau_L", {0, 1, 0, 0, 0, 0, 0}, "RL time constant", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area of annular ring", false},
+		{"r_2", {1, 0, 0, 0, 0, 0, 0}, "Outer radius", false},
+		{"r_1", {1, 0, 0, 0, 0, 0, 0}, "Inner radius", false},
+		{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of cylinder", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\rho_{d}", {-3, 0, 1, 0, 0, 0, 0}, "Mass density", false},
+		{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy required for phase change", false},
+		{"L_v", {2, -2, 0, 0, 0, 0, 0}, "Specific latent heat of vaporization", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of substance", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat energy generated", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time duration", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of charge carriers", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"C_{eq}", {-2, 4, -1, 2, 0, 0, 0}, "Equivalent capacitance", false},
+		{"C_1", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 1", false},
+		{"C_2", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance 2", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant (relative permittivity)", false},
+		{"\\varepsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Plate area", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation between plates", false},
+		{"d\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Differential magnetic field contribution", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in conductor", false},
+		{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element of conductor", false},
+		{"\\hat{r}", {0, 0, 0, 0, 0, 0, 0}, "Unit vector from element to field point", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from element to field point", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential path element", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Total enclosed current", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field magnitude", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of surface", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux through one turn", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\varepsilon_{induced}", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (negative sign gives direction opposing change)", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Motional EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length of conductor moving through field", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},
+		{"\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF (back-EMF)", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Self-inductance", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance of solenoid", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\ell", {1, 0, 0, 0, 0, 0, 0}, "Length of solenoid", false},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density (turns/length)", false},
+		{"V_{vol}", {3, 0, 0, 0, 0, 0, 0}, "Volume of solenoid", false},
+		{"\\varepsilon_2", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF in secondary coil", false},
+		{"M", {2, -2, 1, -2, 0, 0, 0}, "Mutual inductance", false},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current in primary coil", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"\\mu_r", {0, 0, 0, 0, 0, 0, 0}, "Relative permeability of core material", false},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turn density", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"u_B", {-1, -2, 1, 0, 0, 0, 0}, "Magnetic energy density", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Perpendicular distance from wire", false},
+		{"\\theta_1", {0, 0, 0, 0, 0, 0, 0}, "Angle to one end of wire", false},
+		{"\\theta_2", {0, 0, 0, 0, 0, 0, 0}, "Angle to other end of wire", false},
+		{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on charge", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},
+		{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Total electromagnetic force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electric charge", false},
+		{"\\vec{E}", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"\\vec{v}", {1, -1, 0, 0, 0, 0, 0}, "Velocity of charge", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\omega", {0, -1, 0, 0, 0, 0, 0}, "Cyclotron angular frequency", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},
+		{"\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Magnetic force on wire", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in wire", false},
+		{"\\vec{L}", {1, 0, 0, 0, 0, 0, 0}, "Length vector of wire (in current direction)", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns in loop", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"\\vec{\\tau}", {2, -2, 1, 0, 0, 0, 0}, "Torque on magnetic dipole", false},
+		{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque on current loop", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between magnetic moment and B", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy of dipole", false},
+		{"\\vec{\\mu}", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between μ and B", false},
+		{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through conductor", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier number density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness of conductor in B direction", false},
+		{"p", {1, 0, 0, 0, 0, 0, 0}, "Pitch of helix (distance along B per revolution)", false},
+		{"v_{\\parallel}", {1, -1, 0, 0, 0, 0, 0}, "Velocity component parallel to B", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Cyclotron period", false},
+		{"d\\vec{F}", {1, -2, 1, 0, 0, 0, 0}, "Differential magnetic force", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"d\\vec{l}", {1, 0, 0, 0, 0, 0, 0}, "Differential length element (in current direction)", false},
+		{"\\vec{B}", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"K", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy of particle", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge of particle", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass of particle", false},
+		{"\\Phi_B", {2, -2, 1, -1, 0, 0, 0}, "Total magnetic flux linkage", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of each loop", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between B and area normal", false},
+		{"\\varepsilon/L", {1, -3, 1, -1, 0, 0, 0}, "EMF per unit length (equivalent to E field along conductor)", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity of conductor", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle between v and B", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force on magnetic dipole", false},
+		{"\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment magnitude", false},
+		{"dB/dz", {-1, -2, 1, -1, 0, 0, 0}, "Gradient of magnetic field along z-axis", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force (EMF)", false},
+		{"dW", {2, -2, 1, 0, 0, 0, 0}, "Differential work done on charge", false},
+		{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge moved", false},
+		{"W_n", {2, -2, 1, 0, 0, 0, 0}, "Work done by EMF source on charge q", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge moved through EMF source", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Electromotive force", false},
+		{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of ideal source (no internal resistance)", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage of source", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current through source", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false},
+		{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage when source is being charged", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current driven into source (charging current)", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in loop", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current in circuit", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "External resistance", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time interval", false},
+		{"dU", {2, -2, 1, 0, 0, 0, 0}, "Change in electric potential energy", false},
+		{"dq", {0, 1, 0, 1, 0, 0, 0}, "Differential charge", false},
+		{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"dt", {0, 1, 0, 0, 0, 0, 0}, "Differential time", false},
+		{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Net power delivered to external circuit", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"P_r", {2, -3, 1, 0, 0, 0, 0}, "Power lost as heat inside source", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"P_{in}", {2, -3, 1, 0, 0, 0, 0}, "Total electrical power input when charging source", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source being charged", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Charging current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power delivered to load", false},
+		{"V_{ab}", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency of source (dimensionless)", false},
+		{"P_{out}", {2, -3, 1, 0, 0, 0, 0}, "Power to external circuit", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"R_{load}", {2, -3, 1, -2, 0, 0, 0}, "External load resistance for maximum power transfer", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false},
+		{"P_{max}", {2, -3, 1, 0, 0, 0, 0}, "Maximum power deliverable to external load", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "EMF of source", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration of electron in electric field", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity of electrons", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"\\rho", {3, -3, 1, -2, 0, 0, 0}, "Electrical resistivity of metal", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},
+		{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between electron collisions", false},
+		{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Number density of conduction electrons", false},
+		{"e", {0, 1, 0, 1, 0, 0, 0}, "Elementary charge", true},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"v(t)", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just before next collision", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Electron velocity just after previous collision (random)", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},
+		{"\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Mean free path of electrons", false},
+		{"v_F", {1, -1, 0, 0, 0, 0, 0}, "Fermi velocity (average thermal speed of electrons)", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time between collisions", false},
+		{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Electron mobility", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Electron charge magnitude", false},
+		{"\\tau", {0, 1, 0, 0, 0, 0, 0}, "Mean free time", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Electron mass", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"\\sigma", {-3, 3, -1, 2, 0, 0, 0}, "Electrical conductivity", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"\\mu_e", {0, 2, -1, 1, 0, 0, 0}, "Carrier mobility", false},
+		{"\\Delta V_r", {2, -3, 1, -1, 0, 0, 0}, "Potential drop across internal resistance", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"\\Delta U_{net}", {2, -2, 1, 0, 0, 0, 0}, "Net change in potential energy around a closed loop", false},
+		{"\\Delta V", {2, -3, 1, -1, 0, 0, 0}, "Potential change across each element", false},
+		{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Total EMF of series combination", false},
+		{"E_1", {2, -3, 1, -1, 0, 0, 0}, "EMF of first source", false},
+		{"E_2", {2, -3, 1, -1, 0, 0, 0}, "EMF of second source", false},
+		{"E_{total}", {2, -3, 1, -1, 0, 0, 0}, "Net EMF when sources oppose each other", false},
+		{"E_1", {2, -3, 1, -1, 0, 0, 0}, "Larger EMF", false},
+		{"E_2", {2, -3, 1, -1, 0, 0, 0}, "Smaller opposing EMF", false},
+		{"r_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total internal resistance", false},
+		{"r_1", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 1", false},
+		{"r_2", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance of source 2", false},
+		{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},
+		{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},
+		{"\\\\text{pOH}", {0, 0, 0, 0, 0, 0, 0}, "pOH", false},
+		{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},
+		{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},
+		{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},
+		{"K_a", {0, 0, 0, 0, 0, 0, 0}, "Acid dissociation constant", false},
+		{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},
+		{"K_b", {0, 0, 0, 0, 0, 0, 0}, "Base dissociation constant", false},
+		{"\\\\text{pK}_b", {0, 0, 0, 0, 0, 0, 0}, "pKb", false},
+		{"\\\\text{pH}", {0, 0, 0, 0, 0, 0, 0}, "pH", false},
+		{"\\\\text{pK}_a", {0, 0, 0, 0, 0, 0, 0}, "pKa", false},
+		{"[A^-]", {-3, 0, 0, 0, 0, 1, 0}, "Conjugate base concentration", false},
+		{"[HA]", {-3, 0, 0, 0, 0, 1, 0}, "Weak acid concentration", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},
+		{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},
+		{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},
+		{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},
+		{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},
+		{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},
+		{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},
+		{"m_{total}", {0, 0, 1, 0, 0, 0, 0}, "Total mass", false},
+		{"m_{component}", {0, 0, 1, 0, 0, 0, 0}, "Component mass", false},
+		{"\\\\%", {0, 0, 0, 0, 0, 0, 0}, "Percent", false},
+		{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},
+		{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false},
+		{"E_{anode}", {2, -3, 1, -1, 0, 0, 0}, "Anode potential", false},
+		{"E_{cathode}", {2, -3, 1, -1, 0, 0, 0}, "Cathode potential", false},
+		{"E_{cell}", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"E^\\\\circ", {2, -3, 1, -1, 0, 0, 0}, "Standard cell potential", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons transferred", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"Q", {0, 0, 0, 0, 0, 0, 0}, "Reaction quotient", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},
+		{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Total charge", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass deposited", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"M", {0, 0, 1, 0, 0, -1, 0}, "Molar mass", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"E", {2, -3, 1, -1, 0, 0, 0}, "Cell potential", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Number of electrons", false},
+		{"F", {0, 1, 0, 1, 0, -1, 0}, "Faraday constant", true},
+		{"K_p", {0, 0, 0, 0, 0, 0, 0}, "Pressure equilibrium constant", false},
+		{"K_c", {0, 0, 0, 0, 0, 0, 0}, "Concentration equilibrium constant", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"\\\\Delta n", {0, 0, 0, 0, 0, 0, 0}, "Change in moles of gas", false},
+		{"\\\\ln k", {0, 0, 0, 0, 0, 0, 0}, "Natural log of rate constant", false},
+		{"\\\\ln A", {0, 0, 0, 0, 0, 0, 0}, "Natural log of frequency factor", false},
+		{"E_a", {2, -2, 1, 0, 0, 0, 0}, "Activation energy", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},
+		{"k", {0, -1, 0, 0, 0, 0, 0}, "Rate constant", false},
+		{"t_{1/2}", {0, 1, 0, 0, 0, 0, 0}, "Half-life", false},
+		{"k", {3, -1, 0, 0, 0, -1, 0}, "Rate constant", false},
+		{"[A]_0", {-3, 0, 0, 0, 0, 1, 0}, "Initial concentration", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume of solution", false},
+		{"n", {0, 0, 0, 0, 0, 1, 0}, "Moles of solute", false},
+		{"M", {-3, 0, 0, 0, 0, 1, 0}, "Molarity", false},
+		{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},
+		{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false},
+		{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},
+		{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false},
+		{"V_1", {3, 0, 0, 0, 0, 0, 0}, "Initial volume", false},
+		{"M_2", {-3, 0, 0, 0, 0, 1, 0}, "Final molarity", false},
+		{"V_2", {3, 0, 0, 0, 0, 0, 0}, "Final volume", false},
+		{"M_1", {-3, 0, 0, 0, 0, 1, 0}, "Initial molarity", false},
+		{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false},
+		{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},
+		{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},
+		{"m_{solution}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solution", false},
+		{"m_{solute}", {0, 0, 1, 0, 0, 0, 0}, "Mass of solute", false},
+		{"\\\\text{mass\\\\%}", {0, 0, 0, 0, 0, 0, 0}, "Mass percent", false},
+		{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false},
+		{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},
+		{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false},
+		{"n_{total}", {0, 0, 0, 0, 0, 1, 0}, "Total moles", false},
+		{"n_A", {0, 0, 0, 0, 0, 1, 0}, "Moles of A", false},
+		{"X_A", {0, 0, 0, 0, 0, 0, 0}, "Mole fraction of A", false},
+		{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},
+		{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},
+		{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false},
+		{"H_{reactants}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of reactants", false},
+		{"H_{products}", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy of products", false},
+		{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"\\\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},
+		{"\\\\Delta S", {2, -2, 1, 0, -1, 0, 0}, "Entropy change", false},
+		{"\\\\Delta H", {2, -2, 1, 0, 0, 0, 0}, "Enthalpy change", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},
+		{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"T", {0, 0, 0, 0, 1, 0, 0}, "Temperature", false},
+		{"\\\\Delta G", {2, -2, 1, 0, 0, 0, 0}, "Gibbs free energy change", false},
+		{"R", {2, -2, 1, 0, -1, -1, 0}, "Gas constant", true},
+		{"K", {0, 0, 0, 0, 0, 0, 0}, "Equilibrium constant", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"\\\\rho", {3, -3, 1, -2, 0, 0, 0}, "Resistivity", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"J", {-2, 0, 0, 1, 0, 0, 0}, "Current density", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"v_d", {1, -1, 0, 0, 0, 0, 0}, "Drift velocity", false},
+		{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Temperature coefficient", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance at temperature T", false},
+		{"R_0", {2, -3, 1, -2, 0, 0, 0}, "Resistance at reference temperature", false},
+		{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"\\\\sum I_{in}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents entering", false},
+		{"\\\\sum I_{out}", {0, 0, 0, 1, 0, 0, 0}, "Sum of currents leaving", false},
+		{"\\\\sum V", {2, -3, 1, -1, 0, 0, 0}, "Sum of voltage changes around loop", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"r", {2, -3, 1, -2, 0, 0, 0}, "Internal resistance", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "EMF", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Terminal voltage", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},
+		{"Q_{max}", {0, 1, 0, 1, 0, 0, 0}, "Maximum charge", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"Q(t)", {0, 1, 0, 1, 0, 0, 0}, "Charge at time t", false},
+		{"Q_0", {0, 1, 0, 1, 0, 0, 0}, "Initial charge", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"R_{total}", {2, -3, 1, -2, 0, 0, 0}, "Total resistance", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false},
+		{"R_4", {2, -3, 1, -2, 0, 0, 0}, "Unknown resistance", false},
+		{"R_1", {2, -3, 1, -2, 0, 0, 0}, "Resistance 1", false},
+		{"R_2", {2, -3, 1, -2, 0, 0, 0}, "Resistance 2", false},
+		{"R_3", {2, -3, 1, -2, 0, 0, 0}, "Resistance 3", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angular displacement", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"N", {1, -2, 1, 0, 0, 0, 0}, "Normal force", false},
+		{"F_f", {1, -2, 1, 0, 0, 0, 0}, "Friction force", false},
+		{"\\\\mu", {0, 0, 0, 0, 0, 0, 0}, "Coefficient of friction", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Spring force", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"a_c", {1, -2, 0, 0, 0, 0, 0}, "Centripetal acceleration", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"F_c", {1, -2, 1, 0, 0, 0, 0}, "Centripetal force", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"J", {1, -1, 1, 0, 0, 0, 0}, "Impulse", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave speed in medium", false},
+		{"c", {1, -1, 0, 0, 0, 0, 0}, "Speed of light in vacuum", true},
+		{"n", {0, 0, 0, 0, 0, 0, 0}, "Index of refraction", false},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Electric potential", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Potential difference", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"k", {3, -4, 1, -2, 0, 0, 0}, "Coulomb's constant", true},
+		{"q_1", {0, 1, 0, 1, 0, 0, 0}, "Charge 1", false},
+		{"q_2", {0, 1, 0, 1, 0, 0, 0}, "Charge 2", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Voltage", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"C_0", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance without dielectric", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance with dielectric", false},
+		{"\\\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"E_0", {1, -3, 1, -1, 0, 0, 0}, "Electric field in vacuum", false},
+		{"\\\\kappa", {0, 0, 0, 0, 0, 0, 0}, "Dielectric constant", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field in dielectric", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},
+		{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},
+		{"p", {1, 1, 0, 1, 0, 0, 0}, "Dipole moment", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"Q_{enc}", {0, 1, 0, 1, 0, 0, 0}, "Enclosed charge", false},
+		{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"\\\\Phi_E", {3, -3, 1, -1, 0, 0, 0}, "Electric flux", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"\\\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"\\\\lambda", {-1, 1, 0, 1, 0, 0, 0}, "Linear charge density", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"Q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"\\\\rho_q", {-3, 1, 0, 1, 0, 0, 0}, "Volume charge density", false},
+		{"\\\\sigma", {-2, 1, 0, 1, 0, 0, 0}, "Surface charge density", false},
+		{"\\\\epsilon_0", {-3, 4, -1, 2, 0, 0, 0}, "Permittivity of free space", true},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Displacement", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Total mechanical energy", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"PE", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"P", {2, -3, 1, 0, 0, 0, 0}, "Power", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"W_{in}", {2, -2, 1, 0, 0, 0, 0}, "Work input", false},
+		{"W_{out}", {2, -2, 1, 0, 0, 0, 0}, "Work output", false},
+		{"\\\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"h", {1, 0, 0, 0, 0, 0, 0}, "Height", false},
+		{"P", {-1, -2, 1, 0, 0, 0, 0}, "Pressure", false},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Density", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"V", {3, 0, 0, 0, 0, 0, 0}, "Volume", false},
+		{"F_b", {1, -2, 1, 0, 0, 0, 0}, "Buoyant force", false},
+		{"\\\\rho", {-3, 0, 1, 0, 0, 0, 0}, "Fluid density", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"A_2", {2, 0, 0, 0, 0, 0, 0}, "Area 2", false},
+		{"A_1", {2, 0, 0, 0, 0, 0, 0}, "Area 1", false},
+		{"v_1", {1, -1, 0, 0, 0, 0, 0}, "Velocity 1", false},
+		{"v_2", {1, -1, 0, 0, 0, 0, 0}, "Velocity 2", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"Q", {3, -1, 0, 0, 0, 0, 0}, "Volume flow rate", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Gravitational force", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Orbital radius", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Central mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Orbital velocity", false},
+		{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"G", {3, -2, -1, 0, 0, 0, 0}, "Gravitational constant", true},
+		{"M", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v_{esc}", {1, -1, 0, 0, 0, 0, 0}, "Escape velocity", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Number of turns", false},
+		{"\\\\Delta \\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Change in magnetic flux", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},
+		{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\Delta t", {0, 1, 0, 0, 0, 0, 0}, "Time interval", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\Delta I", {0, 0, 0, 1, 0, 0, 0}, "Change in current", false},
+		{"\\\\varepsilon", {2, -3, 1, -1, 0, 0, 0}, "Induced EMF", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"R", {2, -3, 1, -2, 0, 0, 0}, "Resistance", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\tau", {0, 1, 0, 0, 0, 0, 0}, "Time constant", false},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"l", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Cross-sectional area", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"C", {-2, 4, -1, 2, 0, 0, 0}, "Capacitance", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"L", {2, -2, 1, -2, 0, 0, 0}, "Inductance", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"a", {1, -2, 0, 0, 0, 0, 0}, "Acceleration", false},
+		{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"x", {1, 0, 0, 0, 0, 0, 0}, "Final position", false},
+		{"x_0", {1, 0, 0, 0, 0, 0, 0}, "Initial position", false},
+		{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"v_{avg}", {1, -1, 0, 0, 0, 0, 0}, "Average velocity", false},
+		{"v_0", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity", false},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"t", {0, 1, 0, 0, 0, 0, 0}, "Time", false},
+		{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"y", {1, 0, 0, 0, 0, 0, 0}, "Distance fallen", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"n", {-1, 0, 0, 0, 0, 0, 0}, "Turns per unit length", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area", false},
+		{"\\\\Phi", {2, -2, 1, -1, 0, 0, 0}, "Magnetic flux", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"u", {-1, -2, 1, 0, 0, 0, 0}, "Energy density", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},
+		{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"n", {-3, 0, 0, 0, 0, 0, 0}, "Charge carrier density", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge per carrier", false},
+		{"V_H", {2, -3, 1, -1, 0, 0, 0}, "Hall voltage", false},
+		{"t", {1, 0, 0, 0, 0, 0, 0}, "Thickness", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},
+		{"I_{enc}", {0, 0, 0, 1, 0, 0, 0}, "Enclosed current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance from wire", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"A", {2, 0, 0, 0, 0, 0, 0}, "Area of loop", false},
+		{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"U", {2, -2, 1, 0, 0, 0, 0}, "Potential energy", false},
+		{"\\\\mu", {2, 0, 0, 1, 0, 0, 0}, "Magnetic dipole moment", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"d", {1, 0, 0, 0, 0, 0, 0}, "Separation distance", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I_1", {0, 0, 0, 1, 0, 0, 0}, "Current 1", false},
+		{"I_2", {0, 0, 0, 1, 0, 0, 0}, "Current 2", false},
+		{"F/L", {0, -2, 1, 0, 0, 0, 0}, "Force per unit length", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of loop", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"dB", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field element", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"dl", {1, 0, 0, 0, 0, 0, 0}, "Current element length", false},
+		{"\\\\theta", {0, 0, 0, 0, 0, 0, 0}, "Angle", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Distance", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"I", {0, 0, 0, 1, 0, 0, 0}, "Current", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius to point", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"\\\\mu_0", {1, -2, 1, -2, 0, 0, 0}, "Permeability of free space", true},
+		{"N", {0, 0, 0, 0, 0, 0, 0}, "Total number of turns", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"E", {1, -3, 1, -1, 0, 0, 0}, "Electric field", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"B", {0, -2, 1, -1, 0, 0, 0}, "Magnetic field", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"V", {2, -3, 1, -1, 0, 0, 0}, "Accelerating voltage", false},
+		{"q", {0, 1, 0, 1, 0, 0, 0}, "Charge", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius of path", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false},
+		{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"\\\\phi", {2, -2, 1, 0, 0, 0, 0}, "Work function", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"KE_{max}", {2, -2, 1, 0, 0, 0, 0}, "Maximum kinetic energy", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"E", {2, -2, 1, 0, 0, 0, 0}, "Energy", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false},
+		{"h", {2, -1, 1, 0, 0, 0, 0}, "Planck's constant", true},
+		{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Velocity", false},
+		{"p", {1, -1, 1, 0, 0, 0, 0}, "Momentum", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false},
+		{"\\\\Delta v", {1, -1, 0, 0, 0, 0, 0}, "Change in velocity", false},
+		{"\\\\Delta p", {1, -1, 1, 0, 0, 0, 0}, "Change in momentum", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"p_f", {1, -1, 1, 0, 0, 0, 0}, "Final momentum", false},
+		{"p_i", {1, -1, 1, 0, 0, 0, 0}, "Initial momentum", false},
+		{"v_f", {1, -1, 0, 0, 0, 0, 0}, "Final velocity", false},
+		{"m_1", {0, 0, 1, 0, 0, 0, 0}, "Mass 1", false},
+		{"v_{1i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 1", false},
+		{"m_2", {0, 0, 1, 0, 0, 0, 0}, "Mass 2", false},
+		{"v_{2i}", {1, -1, 0, 0, 0, 0, 0}, "Initial velocity 2", false},
+		{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},
+		{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},
+		{"d_o", {1, 0, 0, 0, 0, 0, 0}, "Object distance", false},
+		{"d_i", {1, 0, 0, 0, 0, 0, 0}, "Image distance", false},
+		{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},
+		{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false},
+		{"h_o", {1, 0, 0, 0, 0, 0, 0}, "Object height", false},
+		{"h_i", {1, 0, 0, 0, 0, 0, 0}, "Image height", false},
+		{"m", {0, 0, 0, 0, 0, 0, 0}, "Magnification", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"k", {0, -2, 1, 0, 0, 0, 0}, "Spring constant", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"L", {1, 0, 0, 0, 0, 0, 0}, "Length", false},
+		{"g", {1, -2, 0, 0, 0, 0, 0}, "Gravitational acceleration", true},
+		{"T", {0, 1, 0, 0, 0, 0, 0}, "Period", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular frequency", false},
+		{"F", {1, -2, 1, 0, 0, 0, 0}, "Force", false},
+		{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"\\\\alpha", {0, -2, 0, 0, 0, 0, 0}, "Angular acceleration", false},
+		{"\\\\tau", {2, -2, 1, 0, 0, 0, 0}, "Torque", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"KE", {2, -2, 1, 0, 0, 0, 0}, "Kinetic energy", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"L", {2, -1, 1, 0, 0, 0, 0}, "Angular momentum", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"\\\\omega", {0, -1, 0, 0, 0, 0, 0}, "Angular velocity", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Linear velocity", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"r", {1, 0, 0, 0, 0, 0, 0}, "Radius", false},
+		{"I", {2, 0, 1, 0, 0, 0, 0}, "Moment of inertia", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},
+		{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"c", {2, -2, 0, 0, -1, 0, 0}, "Specific heat capacity", false},
+		{"L", {2, -2, 0, 0, 0, 0, 0}, "Latent heat", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat", false},
+		{"m", {0, 0, 1, 0, 0, 0, 0}, "Mass", false},
+		{"\\\\alpha", {0, 0, 0, 0, -1, 0, 0}, "Coefficient of linear expansion", false},
+		{"\\\\Delta L", {1, 0, 0, 0, 0, 0, 0}, "Change in length", false},
+		{"L_0", {1, 0, 0, 0, 0, 0, 0}, "Initial length", false},
+		{"\\\\Delta T", {0, 0, 0, 0, 1, 0, 0}, "Temperature change", false},
+		{"W", {2, -2, 1, 0, 0, 0, 0}, "Work done by system", false},
+		{"Q", {2, -2, 1, 0, 0, 0, 0}, "Heat added", false},
+		{"\\\\Delta U", {2, -2, 1, 0, 0, 0, 0}, "Change in internal energy", false},
+		{"T_c", {0, 0, 0, 0, 1, 0, 0}, "Cold reservoir temperature", false},
+		{"T_h", {0, 0, 0, 0, 1, 0, 0}, "Hot reservoir temperature", false},
+		{"\\\\eta", {0, 0, 0, 0, 0, 0, 0}, "Efficiency", false},
+		{"\\\\lambda", {1, 0, 0, 0, 0, 0, 0}, "Wavelength", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false},
+		{"f", {0, -1, 0, 0, 0, 0, 0}, "Frequency", false},
+		{"T", {1, -2, 1, 0, 0, 0, 0}, "Tension", false},
+		{"\\\\mu", {-1, 0, 1, 0, 0, 0, 0}, "Linear mass density", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false},
+		{"f_{obs}", {0, -1, 0, 0, 0, 0, 0}, "Observed frequency", false},
+		{"f_s", {0, -1, 0, 0, 0, 0, 0}, "Source frequency", false},
+		{"v", {1, -1, 0, 0, 0, 0, 0}, "Wave velocity", false},
+		{"v_s", {1, -1, 0, 0, 0, 0, 0}, "Source velocity", false},
+    };
+
+    constexpr FormulaFamily families[] = {
+		{"Newton's Second Law", {variables + 0, 3}, {}, "F = ma"},
+		{"Weight", {variables + 3, 3}, {}, "W = mg"},
+		{"Friction Force", {variables + 6, 3}, {}, "F_f = \\mu N"},
+		{"Hooke's Law", {variables + 9, 3}, {}, "F = kx"},
+		{"Spring Potential Energy", {variables + 12, 3}, {}, "U = \\frac{1}{2}kx^2"},
+		{"Centripetal Force", {variables + 15, 4}, {}, "F_c = \\frac{mv^2}{r}"},
+		{"Newton's Law of Gravitation", {variables + 19, 5}, {}, "F = G\\frac{m_1 m_2}{r^2}"},
+		{"Gravitational Field Strength", {variables + 24, 4}, {}, "g = G\\frac{M}{r^2}"},
+		{"Gravitational Potential Energy", {variables + 28, 5}, {}, "U = G\\frac{m_1 m_2}{r}"},
+		{"Orbital Velocity", {variables + 33, 4}, {}, "v = \\sqrt{\\frac{GM}{r}}"},
+		{"Escape Velocity", {variables + 37, 4}, {}, "v_e = \\sqrt{\\frac{2GM}{r}}"},
+		{"Kepler's Third Law", {variables + 41, 5}, {}, "T^2 = \\frac{4\\pi^2 r^3}{GM}"},
+		{"Gravitational Acceleration at Surface", {variables + 46, 4}, {}, "g = G\\frac{M}{R^2}"},
+		{"Mass-Energy Equivalence", {variables + 50, 3}, {}, "E = mc^2"},
+		{"Photon Energy", {variables + 53, 3}, {}, "E = hf"},
+		{"Photon Energy (Wavelength)", {variables + 56, 4}, {}, "E = \\frac{hc}{\\lambda}"},
+		{"Photoelectric Effect", {variables + 60, 4}, {}, "KE_{max} = hf - \\phi"},
+		{"de Broglie Wavelength", {variables + 64, 4}, {}, "\\lambda = \\frac{h}{mv}"},
+		{"de Broglie Wavelength (Momentum)", {variables + 68, 3}, {}, "\\lambda = \\frac{h}{p}"},
+		{"Bohr Model Energy Levels", {variables + 71, 3}, {}, "E_n = \\frac{E_1}{n^2}"},
+		{"Bohr Model Radius", {variables + 74, 3}, {}, "r_n = n^2 a_0"},
+		{"Radioactive Decay Law", {variables + 77, 4}, {}, "N = N_0 e^{-\\lambda t}"},
+		{"Half-Life", {variables + 81, 2}, {}, "t_{1/2} = \\frac{\\ln(2)}{\\lambda}"},
+		{"Coulomb's Law", {variables + 83, 5}, {}, "F = k\\frac{q_1 q_2}{r^2}"},
+		{"Electric Field from Force", {variables + 88, 3}, {}, "E = \\frac{F}{q}"},
+		{"Electric Field (Point Charge)", {variables + 91, 4}, {}, "E = k\\frac{q}{r^2}"},
+		{"Electric Potential (Point Charge)", {variables + 95, 4}, {}, "V = k\\frac{q}{r}"},
+		{"Electric Field from Potential", {variables + 99, 3}, {}, "E = \\frac{V}{d}"},
+		{"Electric Potential Energy", {variables + 102, 5}, {}, "U = k\\frac{q_1 q_2}{r}"},
+		{"Electric Flux", {variables + 107, 3}, {}, "\\Phi_E = EA"},
+		{"Gauss's Law", {variables + 110, 3}, {}, "\\Phi_E = \\frac{Q_{enc}}{\\epsilon_0}"},
+		{"Electric Field (Infinite Plane)", {variables + 113, 3}, {}, "E = \\frac{\\sigma}{2\\epsilon_0}"},
+		{"Surface Charge Density", {variables + 116, 3}, {}, "\\sigma = \\frac{Q}{A}"},
+		{"Linear Charge Density", {variables + 119, 3}, {}, "\\lambda = \\frac{Q}{L}"},
+		{"Volume Charge Density", {variables + 122, 3}, {}, "\\rho_q = \\frac{Q}{V}"},
+		{"Electric Dipole Moment", {variables + 125, 3}, {}, "p = qd"},
+		{"Electric Energy Density", {variables + 128, 3}, {}, "u = \\frac{1}{2}\\epsilon_0 E^2"},
+		{"Electric Field of Current Density with Resistivity", {variables + 131, 3}, {}, "E = J \\rho"},
+		{"Electric Field of Charged Ring on Axis", {variables + 134, 5}, {}, "E = \\frac{kQx}{(x^2 + R^2)^{3/2}}"},
+		{"Electric Potential Energy in Uniform Field", {variables + 139, 4}, {}, "U = qEd"},
+		{"Work Done by Electric Field", {variables + 143, 4}, {}, "W = qEd"},
+		{"Electric Field Between Parallel Plates", {variables + 147, 3}, {}, "E = \\frac{\\sigma}{\\epsilon_0}"},
+		{"Electric Potential Due to Dipole", {variables + 150, 5}, {}, "V = \\frac{kp\\cos(\\theta)}{r^2}"},
+		{"Torque on Electric Dipole", {variables + 155, 3}, {}, "\\tau = pE"},
+		{"Potential Energy of Electric Dipole", {variables + 158, 3}, {}, "U = pE"},
+		{"Electric Field from Infinite Line Charge", {variables + 161, 4}, {}, "E = \\frac{2k\\lambda}{r}"},
+		{"Self-Inductance EMF", {variables + 165, 4}, {}, "V = \\frac{LI}{t}"},
+		{"Solenoid Inductance", {variables + 169, 5}, {}, "L = \\mu_0 n^2 A l"},
+		{"Energy Stored in Inductor", {variables + 174, 3}, {}, "U = \\frac{1}{2}LI^2"},
+		{"RL Time Constant", {variables + 177, 3}, {}, "\\tau = \\frac{L}{R}"},
+		{"Mutual Inductance EMF", {variables + 180, 4}, {}, "E_2 = \\frac{MI_1}{t}"},
+		{"LC Oscillation Frequency", {variables + 184, 4}, {}, "f = \\frac{1}{2\\pi\\sqrt{LC}}"},
+		{"Inductance from Flux", {variables + 188, 4}, {}, "L = \\frac{N\\Phi_B}{I}"},
+		{"Toroid Inductance", {variables + 192, 6}, {}, "L = \\frac{\\mu_0 N^2 A}{2\\pi r}"},
+		{"Mutual Inductance Relation", {variables + 198, 4}, {}, "M = k\\sqrt{L_1 L_2}"},
+		{"LC Angular Frequency", {variables + 202, 3}, {}, "\\omega = \\frac{1}{\\sqrt{LC}}"},
+		{"Quality Factor", {variables + 205, 4}, {}, "Q = \\frac{\\omega_0 L}{R}"},
+		{"Snell's Law", {variables + 209, 4}, {}, "n_1 \\sin(\\theta_1) = n_2 \\sin(\\theta_2)"},
+		{"Mirror/Lens Equation", {variables + 213, 3}, {}, "\\frac{1}{f} = \\frac{1}{d_o} + \\frac{1}{d_i}"},
+		{"Magnification", {variables + 216, 3}, {}, "M = \\frac{d_i}{d_o}"},
+		{"Magnification (Height)", {variables + 219, 3}, {}, "M = \\frac{h_i}{h_o}"},
+		{"Lensmaker's Equation", {variables + 222, 4}, {}, "\\frac{1}{f} = (n - 1)\\left(\\frac{1}{R_1} - \\frac{1}{R_2}\\right)"},
+		{"Critical Angle", {variables + 226, 3}, {}, "\\sin(\\theta_c) = \\frac{n_2}{n_1}"},
+		{"Brewster's Angle", {variables + 229, 3}, {}, "\\tan(\\theta_B) = \\frac{n_2}{n_1}"},
+		{"Index of Refraction", {variables + 232, 3}, {}, "n = \\frac{c}{v}"},
+		{"Capacitance", {variables + 235, 3}, {}, "C = \\frac{Q}{V}"},
+		{"Parallel Plate Capacitor", {variables + 238, 4}, {}, "C = \\epsilon_0 \\frac{A}{d}"},
+		{"Capacitor Energy (Voltage)", {variables + 242, 3}, {}, "U = \\frac{1}{2}CV^2"},
+		{"Capacitor Energy (Charge)", {variables + 245, 3}, {}, "U = \\frac{Q^2}{2C}"},
+		{"Capacitors in Parallel", {variables + 248, 3}, {}, "C_{total} = C_1 + C_2"},
+		{"Capacitance with Dielectric", {variables + 251, 3}, {}, "C = \\kappa C_0"},
+		{"Electric Field in Dielectric", {variables + 254, 3}, {}, "E = \\frac{E_0}{\\kappa}"},
+		{"Spherical Capacitor", {variables + 257, 5}, {}, "C = 4\\pi\\epsilon_0 \\frac{r_a r_b}{r_b - r_a}"},
+		{"Cylindrical Capacitor", {variables + 262, 6}, {}, "C = \\frac{2\\pi\\epsilon_0 L}{\\ln(r_b/r_a)}"},
+		{"Capacitor Energy (QV Form)", {variables + 268, 3}, {}, "U = \\frac{1}{2}QV"},
+		{"Parallel Plate Capacitor with Dielectric", {variables + 271, 5}, {}, "C = \\kappa\\epsilon_0\\frac{A}{d}"},
+		{"Isolated Sphere Capacitance", {variables + 276, 4}, {}, "C = 4\\pi\\epsilon_0 R"},
+		{"Energy Density in Dielectric", {variables + 280, 4}, {}, "u = \\frac{1}{2}\\kappa\\epsilon_0 E^2"},
+		{"Capacitors in Series (Two)", {variables + 248, 3}, {}, "C_{total} = \\frac{C_1 C_2}{C_1 + C_2}"},
+		{"Kinetic Energy", {variables + 284, 3}, {}, "KE = \\frac{1}{2}mv^2"},
+		{"Gravitational Potential Energy", {variables + 287, 4}, {}, "PE = mgh"},
+		{"Work", {variables + 291, 3}, {}, "W = Fd"},
+		{"Work-Energy Theorem", {variables + 294, 2}, {}, "W = \\Delta KE"},
+		{"Power", {variables + 296, 3}, {}, "P = \\frac{W}{t}"},
+		{"Power (force-velocity)", {variables + 299, 3}, {}, "P = Fv"},
+		{"Momentum", {variables + 302, 3}, {}, "p = mv"},
+		{"Impulse", {variables + 305, 3}, {}, "J = F\\Delta t"},
+		{"Impulse-Momentum Theorem", {variables + 308, 2}, {}, "J = \\Delta p"},
+		{"Faraday's Law", {variables + 310, 4}, {}, "E = \\frac{N\\Delta\\Phi_B}{\\Delta t}"},
+		{"Faraday's Law (Area Form)", {variables + 314, 5}, {}, "E = \\frac{NBA}{t}"},
+		{"Motional EMF", {variables + 319, 4}, {}, "E = BLv"},
+		{"Generator EMF", {variables + 323, 5}, {}, "E = NBA\\omega"},
+		{"Transformer Voltage", {variables + 328, 4}, {}, "V_2 = V_1\\frac{N_2}{N_1}"},
+		{"Transformer Current", {variables + 332, 4}, {}, "I_2 = \\frac{I_1 N_1}{N_2}"},
+		{"Motional EMF (Rotating Rod)", {variables + 336, 4}, {}, "E = \\frac{1}{2}B\\omega L^2"},
+		{"Magnetic Flux Change", {variables + 340, 3}, {}, "\\Delta\\Phi_B = B\\Delta A"},
+		{"Period-Frequency Relationship", {variables + 343, 2}, {}, "T = \\frac{1}{f}"},
+		{"Angular Frequency", {variables + 345, 3}, {}, "\\omega = 2\\pi f"},
+		{"Wave Speed", {variables + 348, 3}, {}, "v = f\\lambda"},
+		{"Simple Pendulum Period", {variables + 351, 4}, {}, "T = 2\\pi\\sqrt{\\frac{L}{g}}"},
+		{"Spring-Mass Period", {variables + 355, 4}, {}, "T = 2\\pi\\sqrt{\\frac{m}{k}}"},
+		{"Wave Speed on String", {variables + 359, 3}, {}, "v = \\sqrt{\\frac{T}{\\mu}}"},
+		{"Sound Intensity", {variables + 362, 3}, {}, "I = \\frac{P}{A}"},
+		{"Standing Wave Wavelength (Fixed Ends)", {variables + 365, 3}, {}, "\\lambda_n = \\frac{2L}{n}"},
+		{"Moles from Mass", {variables + 368, 3}, {}, "n = \\frac{m}{M}"},
+		{"Ideal Gas Law", {variables + 371, 5}, {}, "PV = nRT"},
+		{"Dilution", {variables + 376, 4}, {}, "M_1 V_1 = M_2 V_2"},
+		{"Molarity", {variables + 380, 3}, {}, "M = \\frac{n}{V}"},
+		{"pH + pOH", {variables + 383, 2}, {}, "pH + pOH = 14"},
+		{"Gibbs Free Energy", {variables + 385, 4}, {}, "\\Delta G = \\Delta H - T\\Delta S"},
+		{"Nernst Equation", {variables + 389, 7}, {}, "E = E^0 - \\frac{RT}{nF}\\ln(Q)"},
+		{"Beer-Lambert Law", {variables + 396, 4}, {}, "A = \\epsilon b c"},
+		{"Enthalpy of Reaction", {variables + 400, 4}, {}, "q = mc\\Delta T"},
+		{"First-Order Rate Law", {variables + 404, 4}, {}, "A = A_0 e^{-kt}"},
+		{"Gibbs Free Energy and Cell Potential", {variables + 408, 4}, {}, "\\Delta G = -nFE"},
+		{"Normal Stress", {variables + 412, 3}, {}, "\\sigma = \\frac{F}{A}"},
+		{"Normal Strain", {variables + 415, 3}, {}, "\\epsilon = \\frac{\\Delta L}{L_0}"},
+		{"Young's Modulus", {variables + 418, 3}, {}, "E = \\frac{\\sigma}{\\epsilon}"},
+		{"Shear Stress", {variables + 421, 3}, {}, "\\tau = \\frac{F}{A}"},
+		{"Beam Bending Stress", {variables + 424, 4}, {}, "\\sigma = \\frac{My}{I}"},
+		{"Thermal Stress", {variables + 428, 4}, {}, "\\sigma = E\\alpha\\Delta T"},
+		{"Capacitive Reactance", {variables + 432, 4}, {}, "X_C = \\frac{1}{2\\pi fC}"},
+		{"Inductive Reactance", {variables + 436, 4}, {}, "X_L = 2\\pi fL"},
+		{"RLC Resonant Frequency", {variables + 440, 4}, {}, "f_0 = \\frac{1}{2\\pi\\sqrt{LC}}"},
+		{"Hydraulic Press", {variables + 444, 4}, {}, "F_2 = \\frac{F_1 A_2}{A_1}"},
+		{"Reynolds Number", {variables + 448, 5}, {}, "Re = \\frac{\\rho vD}{\\mu}"},
+		{"Efficiency", {variables + 453, 3}, {}, "\\eta = \\frac{W_{out}}{W_{in}}"},
+		{"Power Efficiency", {variables + 456, 3}, {}, "\\eta = \\frac{P_{out}}{P_{in}}"},
+		{"Average Velocity", {variables + 459, 3}, {}, "v_{avg} = \\frac{d}{t}"},
+		{"Acceleration", {variables + 462, 4}, {}, "a = \\frac{v - v_0}{t}"},
+		{"Velocity with Acceleration", {variables + 466, 4}, {}, "v = v_0 + at"},
+		{"Position with Acceleration", {variables + 470, 5}, {}, "x = x_0 + v_0 t + \\frac{1}{2}at^2"},
+		{"Velocity-Position", {variables + 475, 5}, {}, "v^2 = v_0^2 + 2a(x - x_0)"},
+		{"Average Velocity from Endpoints", {variables + 480, 3}, {}, "v_{avg} = \\frac{v_0 + v}{2}"},
+		{"Free Fall Velocity", {variables + 483, 3}, {}, "v = gt"},
+		{"Free Fall Distance", {variables + 486, 3}, {}, "y = \\frac{1}{2}gt^2"},
+		{"Free Fall Velocity-Distance", {variables + 489, 3}, {}, "v^2 = 2gy"},
+		{"Projectile Range", {variables + 492, 4}, {}, "R = \\frac{v_0^2 \\sin(2\\theta)}{g}"},
+		{"Centripetal Acceleration", {variables + 496, 3}, {}, "a_c = \\frac{v^2}{r}"},
+		{"Torque", {variables + 499, 3}, {}, "\\tau = rF"},
+		{"Torque from Moment of Inertia", {variables + 502, 3}, {}, "\\tau = I\\alpha"},
+		{"Angular Velocity", {variables + 505, 3}, {}, "\\omega = \\frac{\\theta}{t}"},
+		{"Angular Acceleration", {variables + 508, 4}, {}, "\\alpha = \\frac{\\omega - \\omega_0}{t}"},
+		{"Rotational Velocity with Acceleration", {variables + 512, 4}, {}, "\\omega = \\omega_0 + \\alpha t"},
+		{"Rotational Displacement with Acceleration", {variables + 516, 4}, {}, "\\theta = \\omega_0 t + \\frac{1}{2}\\alpha t^2"},
+		{"Rotational Kinetic Energy", {variables + 520, 3}, {}, "KE_{rot} = \\frac{1}{2}I\\omega^2"},
+		{"Angular Momentum", {variables + 523, 3}, {}, "L = I\\omega"},
+		{"Moment of Inertia (Point Mass)", {variables + 526, 3}, {}, "I = mr^2"},
+		{"Tangential Velocity", {variables + 529, 3}, {}, "v = r\\omega"},
+		{"Tangential Acceleration", {variables + 532, 3}, {}, "a_t = r\\alpha"},
+		{"Ohm's Law", {variables + 535, 3}, {}, "V = IR"},
+		{"Resistance from Resistivity", {variables + 538, 4}, {}, "R = \\frac{\\rho L}{A}"},
+		{"Current", {variables + 542, 3}, {}, "I = \\frac{Q}{t}"},
+		{"Current Density", {variables + 545, 3}, {}, "J = \\frac{I}{A}"},
+		{"Drift Velocity", {variables + 548, 4}, {}, "v_d = \\frac{J}{ne}"},
+		{"Electrical Power (IV)", {variables + 552, 3}, {}, "P = IV"},
+		{"Electrical Power (I²R)", {variables + 555, 3}, {}, "P = I^2 R"},
+		{"Electrical Power (V²/R)", {variables + 558, 3}, {}, "P = \\frac{V^2}{R}"},
+		{"Conductivity", {variables + 561, 2}, {}, "\\sigma = \\frac{1}{\\rho}"},
+		{"Temperature Dependence of Resistance", {variables + 563, 4}, {}, "R = R_0(1 + \\alpha\\Delta T)"},
+		{"Current Density from Electric Field", {variables + 567, 3}, {}, "J = \\sigma E"},
+		{"Drift Velocity (Direct)", {variables + 570, 5}, {}, "v_d = \\frac{I}{nAe}"},
+		{"Energy Dissipated", {variables + 575, 3}, {}, "E = Pt"},
+		{"EMF as Work per Charge", {variables + 578, 3}, {}, "E = \\frac{W}{q}"},
+		{"Current Density from Drift Velocity", {variables + 581, 4}, {}, "J = nev_d"},
+		{"Density", {variables + 585, 3}, {}, "\\rho = \\frac{m}{V}"},
+		{"Pressure", {variables + 588, 3}, {}, "P = \\frac{F}{A}"},
+		{"Hydrostatic Pressure", {variables + 591, 4}, {}, "P = \\rho g h"},
+		{"Buoyant Force", {variables + 595, 4}, {}, "F_b = \\rho g V"},
+		{"Continuity Equation", {variables + 599, 4}, {}, "v_2 = \\frac{A_1 v_1}{A_2}"},
+		{"Dynamic Pressure", {variables + 603, 3}, {}, "q = \\frac{1}{2}\\rho v^2"},
+		{"Volume Flow Rate", {variables + 606, 3}, {}, "Q = Av"},
+		{"Mass Flow Rate", {variables + 609, 4}, {}, "\\dot{m} = \\rho A v"},
+		{"Magnetic Field of Long Straight Wire", {variables + 613, 5}, {}, "B = \\frac{\\mu_0 I}{2\\pi r}"},
+		{"Magnetic Field of Solenoid", {variables + 618, 4}, {}, "B = \\mu_0 nI"},
+		{"Magnetic Field of Toroid", {variables + 622, 6}, {}, "B = \\frac{\\mu_0 NI}{2\\pi r}"},
+		{"Magnetic Field at Center of Circular Loop", {variables + 628, 4}, {}, "B = \\frac{\\mu_0 I}{2R}"},
+		{"Force Between Parallel Currents", {variables + 632, 7}, {}, "\\frac{F}{L} = \\frac{\\mu_0 I_1 I_2}{2\\pi d}"},
+		{"Magnetic Energy Density", {variables + 639, 3}, {}, "u = \\frac{B^2}{2\\mu_0}"},
+		{"Magnetic Field on Axis of Circular Loop", {variables + 642, 5}, {}, "B = \\frac{\\mu_0 IR^2}{2(R^2 + x^2)^{3/2}}"},
+		{"Magnetic Field of Solenoid (Total Turns)", {variables + 647, 5}, {}, "B = \\frac{\\mu_0 NI}{L}"},
+		{"Magnetic Field Inside Wire", {variables + 652, 6}, {}, "B = \\frac{\\mu_0 Ir}{2\\pi R^2}"},
+		{"Magnetic Field of Dipole on Axis", {variables + 658, 5}, {}, "B = \\frac{\\mu_0 \\mu}{2\\pi r^3}"},
+		{"Heat Transfer", {variables + 663, 4}, {}, "Q = mc\\Delta T"},
+		{"Latent Heat", {variables + 667, 3}, {}, "Q = mL"},
+		{"Linear Thermal Expansion", {variables + 670, 4}, {}, "\\Delta L = \\alpha L_0 \\Delta T"},
+		{"Fourier's Law of Conduction", {variables + 674, 5}, {}, "P = \\frac{kA\\Delta T}{d}"},
+		{"Stefan-Boltzmann Law", {variables + 679, 4}, {}, "P = \\sigma A T^4"},
+		{"First Law of Thermodynamics", {variables + 683, 3}, {}, "\\Delta U = Q - W"},
+		{"Carnot Efficiency", {variables + 686, 3}, {}, "\\eta = 1 - \\frac{T_c}{T_h}"},
+		{"Entropy Change", {variables + 689, 3}, {}, "\\Delta S = \\frac{Q}{T}"},
+		{"Work by Gas (Isobaric)", {variables + 692, 3}, {}, "W = P\\Delta V"},
+		{"Boltzmann Average Kinetic Energy", {variables + 695, 3}, {}, "KE = \\frac{3}{2}k_B T"},
+		{"Resistors in Series", {variables + 698, 3}, {}, "R_{total} = R_1 + R_2"},
+		{"Resistors in Parallel (Two)", {variables + 698, 3}, {}, "R_{total} = \\frac{R_1 R_2}{R_1 + R_2}"},
+		{"Voltage Divider", {variables + 701, 4}, {}, "V_{out} = V_{in} \\frac{R_2}{R_1 + R_2}"},
+		{"EMF with Internal Resistance", {variables + 705, 4}, {}, "V = E - Ir"},
+		{"RC Time Constant", {variables + 709, 3}, {}, "\\tau = RC"},
+		{"Kirchhoff's Junction Rule (Two Currents)", {variables + 712, 3}, {}, "I_{in} = I_1 + I_2"},
+		{"Wheatstone Bridge Balance", {variables + 715, 4}, {}, "R_x = R_3 \\frac{R_2}{R_1}"},
+		{"Current Divider", {variables + 719, 4}, {}, "I_1 = I_{total}\\frac{R_2}{R_1 + R_2}"},
+		{"Maximum Power Transfer", {variables + 723, 3}, {}, "P_{max} = \\frac{E^2}{4R}"},
+		{"Power Delivered by EMF", {variables + 726, 3}, {}, "P = EI"},
+		{"Rectangle Area", {variables + 729, 3}, {}, "A = lw"},
+		{"Triangle Area", {variables + 732, 3}, {}, "A = \\frac{1}{2}bh"},
+		{"Circle Area", {variables + 735, 3}, {}, "A = \\pi r^2"},
+		{"Trapezoid Area", {variables + 738, 4}, {}, "A = \\frac{1}{2}(a + b)h"},
+		{"Parallelogram Area", {variables + 732, 3}, {}, "A = bh"},
+		{"Ellipse Area", {variables + 742, 4}, {}, "A = \\pi a b"},
+		{"Sphere Surface Area", {variables + 746, 3}, {}, "S = 4\\pi r^2"},
+		{"Cylinder Total Surface Area", {variables + 749, 4}, {}, "S = 2\\pi r(r + h)"},
+		{"Cone Total Surface Area", {variables + 753, 4}, {}, "S = \\pi r(r + l)"},
+		{"Cube Surface Area", {variables + 757, 2}, {}, "S = 6s^2"},
+		{"Sphere Volume", {variables + 759, 3}, {}, "V = \\frac{4}{3}\\pi r^3"},
+		{"Cylinder Volume", {variables + 762, 4}, {}, "V = \\pi r^2 h"},
+		{"Cone Volume", {variables + 762, 4}, {}, "V = \\frac{1}{3}\\pi r^2 h"},
+		{"Cube Volume", {variables + 766, 2}, {}, "V = s^3"},
+		{"Rectangular Prism Volume", {variables + 768, 4}, {}, "V = lwh"},
+		{"Pyramid Volume", {variables + 772, 3}, {}, "V = \\frac{1}{3}Bh"},
+		{"Ellipsoid Volume", {variables + 775, 5}, {}, "V = \\frac{4}{3}\\pi a b c"},
+		{"Torus Volume", {variables + 780, 4}, {}, "V = 2\\pi^2 R r^2"},
+		{"Magnetic Force on Moving Charge", {variables + 784, 4}, {}, "F = qvB"},
+		{"Magnetic Force on Current-Carrying Wire", {variables + 788, 4}, {}, "F = BIL"},
+		{"Cyclotron Radius", {variables + 792, 5}, {}, "r = \\frac{mv}{qB}"},
+		{"Cyclotron Frequency", {variables + 797, 5}, {}, "f = \\frac{qB}{2\\pi m}"},
+		{"Cyclotron Period", {variables + 802, 5}, {}, "T = \\frac{2\\pi m}{qB}"},
+		{"Magnetic Flux", {variables + 807, 3}, {}, "\\Phi_B = BA"},
+		{"Hall Voltage", {variables + 810, 7}, {}, "V_H = \\frac{BId}{nqt}"},
+		{"Torque on Magnetic Dipole", {variables + 817, 5}, {}, "\\tau = nIAB"},
+		{"Magnetic Dipole Moment", {variables + 822, 4}, {}, "\\mu = nIA"},
+		{"Velocity Selector", {variables + 826, 3}, {}, "v = \\frac{E}{B}"},
+		{"Magnetic Force on Charge (with Angle)", {variables + 829, 5}, {}, "F = qvB\\sin(\\theta)"},
+		{"Magnetic Force on Wire (with Angle)", {variables + 834, 5}, {}, "F = BIL\\sin(\\theta)"},
+		{"Cyclotron Kinetic Energy", {variables + 839, 5}, {}, "KE = \\frac{q^2 B^2 r^2}{2m}"},
+		{"Magnetic Potential Energy of Dipole", {variables + 844, 3}, {}, "U = \\mu B"},
+		{"Hall Coefficient", {variables + 847, 3}, {}, "R_H = \\frac{1}{nq}"},
+		{"Conductance Definition", {variables + 850, 2}, {}, "G = \\frac{1}{R}"},
+		{"Resistivity Temperature Dependence", {variables + 852, 5}, {}, "\\rho = \\rho_0 \\left[1 + \\alpha (T - T_0)\\right]"},
+		{"Electrical Energy", {variables + 857, 3}, {}, "U = P t"},
+		{"Charge from Current", {variables + 860, 3}, {}, "q = I t"},
+		{"EMF with Internal Resistance", {variables + 863, 4}, {}, "V = \\varepsilon - I r"},
+		{"Resistors in Series", {variables + 867, 3}, {}, "R_{eq} = R_1 + R_2 + \\cdots + R_n"},
+		{"Resistors in Parallel", {variables + 867, 3}, {}, "\\frac{1}{R_{eq}} = \\frac{1}{R_1} + \\frac{1}{R_2} + \\cdots + \\frac{1}{R_n}"},
+		{"Voltage Divider", {variables + 870, 5}, {}, "V_x = V_{total} \\frac{R_x}{R_1 + R_2}"},
+		{"Current Divider", {variables + 875, 5}, {}, "I_x = I_{total} \\frac{R_{other}}{R_1 + R_2}"},
+		{"Capacitor Charge-Voltage Relation", {variables + 880, 3}, {}, "q = CV"},
+		{"RC Circuit Charging (Charge)", {variables + 883, 4}, {}, "q(t) = Q_{max}\\left(1 - e^{-t/\\tau}\\right)"},
+		{"RC Circuit Discharging (Charge)", {variables + 887, 4}, {}, "q(t) = Q_0 \\, e^{-t/\\tau}"},
+		{"RC Circuit Charging (Current)", {variables + 891, 5}, {}, "I(t) = \\frac{\\varepsilon}{R} e^{-t/\\tau}"},
+		{"RL Time Constant", {variables + 896, 3}, {}, "\\tau_L = \\frac{L}{R}"},
+		{"RL Circuit Current Growth", {variables + 899, 5}, {}, "I(t) = \\frac{\\varepsilon}{R}\\left(1 - e^{-t/\\tau_L}\\right)"},
+		{"RL Circuit Current Decay", {variables + 904, 4}, {}, "I(t) = I_0 \\, e^{-t/\\tau_L}"},
+		{"Annular Cross-Sectional Area", {variables + 908, 3}, {}, "A = \\pi \\left(r_2^2 - r_1^2\\right)"},
+		{"Volume of a Cylinder", {variables + 911, 3}, {}, "V_{vol} = A \\cdot L"},
+		{"Mass from Density", {variables + 914, 3}, {}, "m = \\rho_{d} \\cdot V_{vol}"},
+		{"Heat of Transformation (Phase Change)", {variables + 917, 3}, {}, "Q = L_v \\cdot m"},
+		{"Joule Heating Energy", {variables + 920, 4}, {}, "Q = I^2 R \\, t"},
+		{"Drift Velocity of Charge Carriers", {variables + 924, 4}, {}, "v_d = \\frac{J}{n q}"},
+		{"Current from Drift Velocity", {variables + 928, 5}, {}, "I = n q v_d A"},
+		{"Capacitors in Series", {variables + 933, 3}, {}, "\\frac{1}{C_{eq}} = \\frac{1}{C_1} + \\frac{1}{C_2} + \\cdots"},
+		{"Capacitors in Parallel", {variables + 933, 3}, {}, "C_{eq} = C_1 + C_2 + \\cdots"},
+		{"Parallel Plate Capacitance", {variables + 936, 4}, {}, "C = \\frac{\\varepsilon_0 A}{d}"},
+		{"Capacitance with Dielectric", {variables + 940, 5}, {}, "C = \\kappa \\frac{\\varepsilon_0 A}{d}"},
+		{"Biot-Savart Law (Differential Form)", {variables + 945, 6}, {}, "d\\vec{B} = \\frac{\\mu_0 I}{4\\pi} \\frac{d\\vec{l} \\times \\hat{r}}{r^2}"},
+		{"Ampere's Law", {variables + 951, 4}, {}, "\\oint \\vec{B} \\cdot d\\vec{l} = \\mu_0 I_{enc}"},
+		{"Magnetic Flux", {variables + 955, 4}, {}, "\\Phi_B = \\int \\vec{B} \\cdot d\\vec{A} = BA\\cos\\theta"},
+		{"Faraday's Law of Induction", {variables + 959, 3}, {}, "\\varepsilon = -\\frac{d\\Phi_B}{dt}"},
+		{"Faraday's Law with N Turns", {variables + 962, 4}, {}, "\\varepsilon = -N\\frac{d\\Phi_B}{dt}"},
+		{"Lenz's Law (Induced Current Direction)", {variables + 966, 3}, {}, "\\varepsilon_{induced} = -\\frac{d\\Phi_B}{dt}"},
+		{"Motional EMF", {variables + 969, 4}, {}, "\\varepsilon = BLv"},
+		{"Self-Inductance Definition", {variables + 973, 4}, {}, "\\varepsilon = -L \\frac{dI}{dt}"},
+		{"Inductance of a Solenoid", {variables + 977, 7}, {}, "L = \\mu_0 n^2 V_{vol} = \\frac{\\mu_0 N^2 A}{\\ell}"},
+		{"Mutual Inductance", {variables + 984, 4}, {}, "\\varepsilon_2 = -M \\frac{dI_1}{dt}"},
+		{"Magnetic Field Inside a Solenoid with Core", {variables + 988, 5}, {}, "B = \\mu_0 \\mu_r n I"},
+		{"Magnetic Energy Density", {variables + 993, 3}, {}, "u_B = \\frac{B^2}{2\\mu_0}"},
+		{"Magnetic Field of a Finite Straight Wire", {variables + 996, 6}, {}, "B = \\frac{\\mu_0 I}{4\\pi r}(\\sin\\theta_1 + \\sin\\theta_2)"},
+		{"Magnetic Force on a Moving Charge (Vector Form)", {variables + 1002, 4}, {}, "\\vec{F} = q \\vec{v} \\times \\vec{B}"},
+		{"Lorentz Force (Electric + Magnetic)", {variables + 1006, 5}, {}, "\\vec{F} = q(\\vec{E} + \\vec{v} \\times \\vec{B})"},
+		{"Cyclotron Angular Frequency", {variables + 1011, 4}, {}, "\\omega = \\frac{|q| B}{m}"},
+		{"Magnetic Force on a Current-Carrying Wire (Vector)", {variables + 1015, 4}, {}, "\\vec{F} = I \\vec{L} \\times \\vec{B}"},
+		{"Magnetic Dipole Moment", {variables + 1019, 4}, {}, "\\mu = N I A"},
+		{"Torque on a Magnetic Dipole (Vector)", {variables + 1023, 3}, {}, "\\vec{\\tau} = \\vec{\\mu} \\times \\vec{B}"},
+		{"Torque on a Current Loop (Scalar)", {variables + 1026, 6}, {}, "\\tau = N I A B \\sin\\theta"},
+		{"Potential Energy of Magnetic Dipole in Field", {variables + 1032, 4}, {}, "U = -\\vec{\\mu} \\cdot \\vec{B} = -\\mu B \\cos\\theta"},
+		{"Hall Voltage", {variables + 1036, 6}, {}, "V_H = \\frac{I B}{n q t}"},
+		{"Pitch of Helical Motion in Magnetic Field", {variables + 1042, 6}, {}, "p = v_{\\parallel} T = \\frac{2\\pi m v_{\\parallel}}{|q| B}"},
+		{"Magnetic Force on a Differential Current Element", {variables + 1048, 4}, {}, "d\\vec{F} = I \\, d\\vec{l} \\times \\vec{B}"},
+		{"Kinetic Energy of Particle in Cyclotron", {variables + 1052, 5}, {}, "K = \\frac{q^2 B^2 r^2}{2m}"},
+		{"Magnetic Flux Through a Loop", {variables + 1057, 5}, {}, "\\Phi_B = NBA\\cos\\theta"},
+		{"Electric Field in a Moving Conductor (Motional EMF per Length)", {variables + 1062, 4}, {}, "\\frac{\\varepsilon}{L} = vB\\sin\\theta"},
+		{"Force on a Magnetic Dipole in Non-Uniform Field", {variables + 1066, 3}, {}, "F = \\mu \\frac{dB}{dz}"},
+		{"EMF Definition (Work per Charge)", {variables + 1069, 3}, {}, "E = \\frac{dW}{dq}"},
+		{"Work Done by EMF Source on Charge", {variables + 1072, 3}, {}, "W_n = q E"},
+		{"Terminal Voltage of Ideal EMF Source", {variables + 1075, 2}, {}, "V_{ab} = E"},
+		{"Terminal Voltage with Internal Resistance (Discharging)", {variables + 1077, 4}, {}, "V_{ab} = E - Ir"},
+		{"Terminal Voltage with Internal Resistance (Charging)", {variables + 1081, 4}, {}, "V_{ab} = E + Ir"},
+		{"KVL with EMF and Internal Resistance", {variables + 1085, 4}, {}, "E - Ir - IR = 0"},
+		{"Current in a Simple EMF Circuit", {variables + 1089, 4}, {}, "I = \\frac{E}{R + r}"},
+		{"Differential Charge from Current", {variables + 1093, 3}, {}, "dq = I \\, dt"},
+		{"Change in Potential Energy of Charge Through Potential Drop", {variables + 1096, 5}, {}, "dU = dq \\cdot V_{ab} = I \\, V_{ab} \\, dt"},
+		{"Power Output of EMF Source (Net to External Circuit)", {variables + 1101, 4}, {}, "P_{out} = E I - I^2 r"},
+		{"Power Dissipated in Internal Resistance", {variables + 1105, 3}, {}, "P_r = I^2 r"},
+		{"Power Input to EMF Source Being Charged", {variables + 1108, 4}, {}, "P_{in} = E I + I^2 r"},
+		{"Power Output from Terminal Voltage", {variables + 1112, 3}, {}, "P = V_{ab} I"},
+		{"Efficiency of EMF Source", {variables + 1115, 5}, {}, "\\eta = \\frac{P_{out}}{P_{total}} = \\frac{E I - I^2 r}{E I} = 1 - \\frac{Ir}{E}"},
+		{"Maximum Power Transfer Condition", {variables + 1120, 2}, {}, "R_{load} = r"},
+		{"Maximum Power Delivered to External Load", {variables + 1122, 3}, {}, "P_{max} = \\frac{E^2}{4r}"},
+		{"Drude Model: Electron Acceleration in E Field", {variables + 1125, 4}, {}, "a = \\frac{qE}{m}"},
+		{"Drift Velocity from Mean Free Time", {variables + 1129, 5}, {}, "v_d = \\frac{q \\tau}{m} E"},
+		{"Current Density from Drude Model", {variables + 1134, 6}, {}, "J = \\frac{n q^2 \\tau}{m} E"},
+		{"Resistivity from Drude Model", {variables + 1140, 5}, {}, "\\rho = \\frac{m}{n e^2 \\tau}"},
+		{"Conductivity from Drude Model", {variables + 1145, 5}, {}, "\\sigma = \\frac{n e^2 \\tau}{m}"},
+		{"Electron Velocity at Time t After Collision (Drude)", {variables + 1150, 6}, {}, "v(t) = v_0 + \\frac{qE}{m} \\tau"},
+		{"Mean Free Path", {variables + 1156, 3}, {}, "\\lambda = v_F \\tau"},
+		{"Mobility of Charge Carriers", {variables + 1159, 6}, {}, "\\mu_e = \\frac{|q| \\tau}{m} = \\frac{v_d}{E}"},
+		{"Conductivity from Mobility", {variables + 1165, 4}, {}, "\\sigma = n q \\mu_e"},
+		{"Potential Drop Across Internal Resistance", {variables + 1169, 3}, {}, "\\Delta V_r = -Ir"},
+		{"Net Change in Potential Around a Loop (KVL)", {variables + 1172, 2}, {}, "\\Delta U_{net} = \\sum \\Delta V = 0"},
+		{"EMFs in Series (Aiding)", {variables + 1174, 3}, {}, "E_{total} = E_1 + E_2"},
+		{"EMFs in Series (Opposing)", {variables + 1177, 3}, {}, "E_{total} = E_1 - E_2"},
+		{"Total Internal Resistance of Batteries in Series", {variables + 1180, 3}, {}, "r_{total} = r_1 + r_2 + \\cdots"},
+		{"pH and pOH Relationship", {variables + 1183, 2}, {}, "\\text{pH} = 14 - \\text{pOH}"},
+		{"pH and pOH Relationship", {variables + 1185, 2}, {}, "\\text{pOH} = 14 - \\text{pH}"},
+		{"pKa", {variables + 1187, 2}, {}, "\\text{pK}_a = -\\log K_a"},
+		{"pKa", {variables + 1189, 2}, {}, "K_a = 10^{-\\text{pK}_a}"},
+		{"pKb", {variables + 1191, 2}, {}, "K_b = 10^{-\\text{pK}_b}"},
+		{"Henderson-Hasselbalch", {variables + 1193, 4}, {}, "\\text{pH} = \\text{pK}_a + \\log\\frac{[A^-]}{[HA]}"},
+		{"Ideal Gas Law", {variables + 1197, 5}, {}, "V = \\frac{nRT}{P}"},
+		{"Ideal Gas Law", {variables + 1202, 5}, {}, "n = \\frac{PV}{RT}"},
+		{"Ideal Gas Law", {variables + 1207, 5}, {}, "T = \\frac{PV}{nR}"},
+		{"Molar Mass", {variables + 1212, 3}, {}, "M = \\frac{m}{n}"},
+		{"Density", {variables + 1215, 3}, {}, "V = \\frac{m}{\\rho}"},
+		{"Percent Composition", {variables + 1218, 3}, {}, "\\% = \\frac{m_{component}}{m_{total}} \\times 100"},
+		{"Percent Composition", {variables + 1221, 3}, {}, "m_{component} = \\frac{\\% \\times m_{total}}{100}"},
+		{"Percent Composition", {variables + 1224, 3}, {}, "m_{total} = \\frac{100 \\times m_{component}}{\\%}"},
+		{"Cell Potential", {variables + 1227, 3}, {}, "E_{cell} = E_{cathode} - E_{anode}"},
+		{"Cell Potential", {variables + 1230, 3}, {}, "E_{anode} = E_{cathode} - E_{cell}"},
+		{"Nernst Equation", {variables + 1233, 7}, {}, "E = E^\\circ - \\frac{RT}{nF}\\ln Q"},
+		{"Faraday's Law of Electrolysis", {variables + 1240, 5}, {}, "m = \\frac{QM}{nF}"},
+		{"Faraday's Law of Electrolysis", {variables + 1245, 5}, {}, "Q = \\frac{mnF}{M}"},
+		{"Charge", {variables + 1250, 3}, {}, "t = \\frac{Q}{I}"},
+		{"Gibbs Free Energy from Cell Potential", {variables + 1253, 4}, {}, "E = -\\frac{\\Delta G}{nF}"},
+		{"Kp and Kc Relationship", {variables + 1257, 5}, {}, "K_p = K_c(RT)^{\\Delta n}"},
+		{"Arrhenius Equation Logarithmic", {variables + 1262, 5}, {}, "\\ln k = \\ln A - \\frac{E_a}{RT}"},
+		{"First Order Half-Life", {variables + 1267, 2}, {}, "t_{1/2} = \\frac{0.693}{k}"},
+		{"Second Order Half-Life", {variables + 1269, 3}, {}, "t_{1/2} = \\frac{1}{k[A]_0}"},
+		{"Molarity", {variables + 1272, 3}, {}, "V = \\frac{n}{M}"},
+		{"Dilution", {variables + 1275, 4}, {}, "V_2 = \\frac{M_1 V_1}{M_2}"},
+		{"Dilution", {variables + 1279, 4}, {}, "V_1 = \\frac{M_2 V_2}{M_1}"},
+		{"Mass Percent", {variables + 1283, 3}, {}, "\\text{mass\\%} = \\frac{m_{solute}}{m_{solution}} \\times 100"},
+		{"Mass Percent", {variables + 1286, 3}, {}, "m_{solution} = \\frac{100 \\times m_{solute}}{\\text{mass\\%}}"},
+		{"Mole Fraction", {variables + 1289, 3}, {}, "X_A = \\frac{n_A}{n_{total}}"},
+		{"Mole Fraction", {variables + 1292, 3}, {}, "n_{total} = \\frac{n_A}{X_A}"},
+		{"Enthalpy Change", {variables + 1295, 3}, {}, "\\Delta H = H_{products} - H_{reactants}"},
+		{"Enthalpy Change", {variables + 1298, 3}, {}, "H_{reactants} = H_{products} - \\Delta H"},
+		{"Gibbs Free Energy", {variables + 1301, 4}, {}, "T = \\frac{\\Delta H - \\Delta G}{\\Delta S}"},
+		{"Gibbs Free Energy", {variables + 1305, 4}, {}, "\\Delta S = \\frac{\\Delta H - \\Delta G}{T}"},
+		{"Gibbs Free Energy and Equilibrium", {variables + 1309, 4}, {}, "\\Delta G = -RT\\ln K"},
+		{"Gibbs Free Energy and Equilibrium", {variables + 1313, 4}, {}, "K = e^{-\\Delta G / RT}"},
+		{"Gibbs Free Energy and Equilibrium", {variables + 1317, 4}, {}, "T = -\\frac{\\Delta G}{R\\ln K}"},
+		{"Ohm's Law", {variables + 1321, 3}, {}, "R = \\frac{V}{I}"},
+		{"Electric Power", {variables + 1324, 3}, {}, "V = \\frac{P}{I}"},
+		{"Power from Current", {variables + 1327, 3}, {}, "I = \\sqrt{\\frac{P}{R}}"},
+		{"Power from Current", {variables + 1330, 3}, {}, "R = \\frac{P}{I^2}"},
+		{"Power from Voltage", {variables + 1333, 3}, {}, "V = \\sqrt{PR}"},
+		{"Power from Voltage", {variables + 1336, 3}, {}, "R = \\frac{V^2}{P}"},
+		{"Resistors in Series", {variables + 1339, 3}, {}, "R_2 = R_{total} - R_1"},
+		{"Resistors in Parallel", {variables + 698, 3}, {}, "\\frac{1}{R_{total}} = \\frac{1}{R_1} + \\frac{1}{R_2}"},
+		{"Resistance from Resistivity", {variables + 1342, 4}, {}, "R = \\rho \\frac{L}{A}"},
+		{"Resistance from Resistivity", {variables + 1346, 4}, {}, "\\rho = R \\frac{A}{L}"},
+		{"Resistance from Resistivity", {variables + 1350, 4}, {}, "L = R \\frac{A}{\\rho}"},
+		{"Resistance from Resistivity", {variables + 1354, 4}, {}, "A = \\rho \\frac{L}{R}"},
+		{"Current Density", {variables + 1358, 3}, {}, "A = \\frac{I}{J}"},
+		{"RC Time Constant", {variables + 1361, 3}, {}, "C = \\frac{\\tau}{R}"},
+		{"Energy Dissipated", {variables + 1364, 3}, {}, "t = \\frac{E}{P}"},
+		{"Drift Velocity", {variables + 1367, 5}, {}, "v_d = \\frac{I}{nqA}"},
+		{"Drift Velocity", {variables + 1372, 5}, {}, "n = \\frac{I}{qv_d A}"},
+		{"Drift Velocity", {variables + 1377, 5}, {}, "A = \\frac{I}{nqv_d}"},
+		{"Temperature Dependence of Resistance", {variables + 1382, 4}, {}, "\\alpha = \\frac{R - R_0}{R_0 \\Delta T}"},
+		{"Kirchhoff's Current Law", {variables + 1386, 2}, {}, "\\sum I_{in} = \\sum I_{out}"},
+		{"Kirchhoff's Voltage Law", {variables + 1388, 1}, {}, "\\sum V = 0"},
+		{"EMF with Internal Resistance", {variables + 1389, 4}, {}, "I = \\frac{\\varepsilon - V}{r}"},
+		{"EMF with Internal Resistance", {variables + 1393, 4}, {}, "r = \\frac{\\varepsilon - V}{I}"},
+		{"RC Charging", {variables + 1397, 5}, {}, "Q(t) = Q_{max}(1 - e^{-t/RC})"},
+		{"RC Discharging", {variables + 1402, 5}, {}, "Q(t) = Q_0 e^{-t/RC}"},
+		{"Three Resistors in Series", {variables + 1407, 4}, {}, "R_{total} = R_1 + R_2 + R_3"},
+		{"Three Resistors in Parallel", {variables + 1407, 4}, {}, "\\frac{1}{R_{total}} = \\frac{1}{R_1} + \\frac{1}{R_2} + \\frac{1}{R_3}"},
+		{"Wheatstone Bridge Balanced", {variables + 1411, 4}, {}, "R_4 = \\frac{R_2 R_3}{R_1}"},
+		{"Angular Displacement", {variables + 1415, 3}, {}, "t = \\frac{\\theta}{\\omega}"},
+		{"Period from Angular Velocity", {variables + 1418, 2}, {}, "T = \\frac{2\\pi}{\\omega}"},
+		{"Period from Angular Velocity", {variables + 1420, 2}, {}, "\\omega = \\frac{2\\pi}{T}"},
+		{"Newton's Second Law", {variables + 1422, 3}, {}, "a = \\frac{F}{m}"},
+		{"Friction Force", {variables + 1425, 3}, {}, "N = \\frac{F_f}{\\mu}"},
+		{"Hooke's Law", {variables + 1428, 3}, {}, "x = \\frac{F}{k}"},
+		{"Work", {variables + 1431, 3}, {}, "d = \\frac{W}{F}"},
+		{"Centripetal Force", {variables + 1434, 4}, {}, "v = \\sqrt{\\frac{F_c r}{m}}"},
+		{"Centripetal Force", {variables + 1438, 4}, {}, "r = \\frac{mv^2}{F_c}"},
+		{"Centripetal Acceleration", {variables + 1442, 3}, {}, "v = \\sqrt{a_c r}"},
+		{"Centripetal Acceleration", {variables + 1445, 3}, {}, "r = \\frac{v^2}{a_c}"},
+		{"Centripetal Force Angular", {variables + 1448, 4}, {}, "F_c = m\\omega^2 r"},
+		{"Centripetal Force Angular", {variables + 1452, 4}, {}, "m = \\frac{F_c}{\\omega^2 r}"},
+		{"Centripetal Force Angular", {variables + 1456, 4}, {}, "\\omega = \\sqrt{\\frac{F_c}{mr}}"},
+		{"Centripetal Force Angular", {variables + 1460, 4}, {}, "r = \\frac{F_c}{m\\omega^2}"},
+		{"Impulse", {variables + 1464, 3}, {}, "\\Delta t = \\frac{J}{F}"},
+		{"Speed of Light", {variables + 1467, 3}, {}, "c = f\\lambda"},
+		{"Speed of Light", {variables + 1470, 3}, {}, "\\lambda = \\frac{c}{f}"},
+		{"EM Wave Speed in Medium", {variables + 1473, 3}, {}, "v = \\frac{c}{n}"},
+		{"Coulomb's Law", {variables + 1476, 5}, {}, "q_1 = \\frac{F r^2}{k q_2}"},
+		{"Coulomb's Law", {variables + 1481, 5}, {}, "q_2 = \\frac{F r^2}{k q_1}"},
+		{"Coulomb's Law", {variables + 1486, 5}, {}, "r = \\sqrt{\\frac{k q_1 q_2}{F}}"},
+		{"Electric Field from Force", {variables + 1491, 3}, {}, "q = \\frac{F}{E}"},
+		{"Electric Field Point Charge", {variables + 1494, 4}, {}, "q = \\frac{E r^2}{k}"},
+		{"Electric Field Point Charge", {variables + 1498, 4}, {}, "r = \\sqrt{\\frac{kq}{E}}"},
+		{"Electric Potential Point Charge", {variables + 1502, 4}, {}, "q = \\frac{Vr}{k}"},
+		{"Electric Potential Point Charge", {variables + 1506, 4}, {}, "r = \\frac{kq}{V}"},
+		{"Electric Field from Potential", {variables + 1510, 3}, {}, "d = \\frac{V}{E}"},
+		{"Electric Potential Energy", {variables + 1513, 5}, {}, "q_1 = \\frac{Ur}{k q_2}"},
+		{"Electric Potential Energy", {variables + 1518, 5}, {}, "r = k \\frac{q_1 q_2}{U}"},
+		{"Capacitance", {variables + 1523, 3}, {}, "V = \\frac{Q}{C}"},
+		{"Parallel Plate Capacitor", {variables + 1526, 4}, {}, "A = \\frac{Cd}{\\epsilon_0}"},
+		{"Parallel Plate Capacitor", {variables + 1530, 4}, {}, "d = \\epsilon_0 \\frac{A}{C}"},
+		{"Capacitor Energy", {variables + 1534, 3}, {}, "C = \\frac{2U}{V^2}"},
+		{"Capacitor Energy", {variables + 1537, 3}, {}, "V = \\sqrt{\\frac{2U}{C}}"},
+		{"Capacitor Energy from Charge", {variables + 1540, 3}, {}, "Q = \\sqrt{2UC}"},
+		{"Capacitor Energy from Charge", {variables + 1543, 3}, {}, "C = \\frac{Q^2}{2U}"},
+		{"Capacitance with Dielectric", {variables + 1546, 3}, {}, "C_0 = \\frac{C}{\\kappa}"},
+		{"Electric Field in Dielectric", {variables + 1549, 3}, {}, "E_0 = \\kappa E"},
+		{"Electric Energy Density", {variables + 1552, 3}, {}, "E = \\sqrt{\\frac{2u}{\\epsilon_0}}"},
+		{"Electric Dipole Moment", {variables + 1555, 3}, {}, "d = \\frac{p}{q}"},
+		{"Electric Flux", {variables + 1558, 3}, {}, "A = \\frac{\\Phi_E}{E}"},
+		{"Gauss's Law", {variables + 1561, 3}, {}, "Q_{enc} = \\epsilon_0 \\Phi_E"},
+		{"Surface Charge Density", {variables + 1564, 3}, {}, "A = \\frac{Q}{\\sigma}"},
+		{"Linear Charge Density", {variables + 1567, 3}, {}, "L = \\frac{Q}{\\lambda}"},
+		{"Volume Charge Density", {variables + 1570, 3}, {}, "V = \\frac{Q}{\\rho_q}"},
+		{"Electric Field of Infinite Plane", {variables + 1573, 3}, {}, "\\sigma = 2\\epsilon_0 E"},
+		{"Kinetic Energy", {variables + 1576, 3}, {}, "m = \\frac{2KE}{v^2}"},
+		{"Kinetic Energy", {variables + 1579, 3}, {}, "v = \\sqrt{\\frac{2KE}{m}}"},
+		{"Gravitational Potential Energy", {variables + 1582, 4}, {}, "m = \\frac{PE}{gh}"},
+		{"Gravitational Potential Energy", {variables + 1586, 4}, {}, "h = \\frac{PE}{mg}"},
+		{"Elastic Potential Energy", {variables + 1590, 3}, {}, "PE = \\frac{1}{2}kx^2"},
+		{"Elastic Potential Energy", {variables + 1593, 3}, {}, "k = \\frac{2PE}{x^2}"},
+		{"Elastic Potential Energy", {variables + 1596, 3}, {}, "x = \\sqrt{\\frac{2PE}{k}}"},
+		{"Mechanical Energy", {variables + 1599, 3}, {}, "E = KE + PE"},
+		{"Power from Work", {variables + 1602, 3}, {}, "t = \\frac{W}{P}"},
+		{"Power from Force", {variables + 1605, 3}, {}, "v = \\frac{P}{F}"},
+		{"Efficiency", {variables + 1608, 3}, {}, "W_{in} = \\frac{W_{out}}{\\eta}"},
+		{"Pressure", {variables + 1611, 3}, {}, "A = \\frac{F}{P}"},
+		{"Hydrostatic Pressure", {variables + 1614, 4}, {}, "\\rho = \\frac{P}{gh}"},
+		{"Hydrostatic Pressure", {variables + 1618, 4}, {}, "h = \\frac{P}{\\rho g}"},
+		{"Buoyancy", {variables + 1622, 4}, {}, "F_b = \\rho V g"},
+		{"Buoyancy", {variables + 1626, 4}, {}, "\\rho = \\frac{F_b}{Vg}"},
+		{"Buoyancy", {variables + 1630, 4}, {}, "V = \\frac{F_b}{\\rho g}"},
+		{"Continuity Equation", {variables + 1634, 4}, {}, "A_2 = \\frac{A_1 v_1}{v_2}"},
+		{"Flow Rate", {variables + 1638, 3}, {}, "v = \\frac{Q}{A}"},
+		{"Universal Gravitation", {variables + 1641, 5}, {}, "m_1 = \\frac{Fr^2}{Gm_2}"},
+		{"Universal Gravitation", {variables + 1646, 5}, {}, "r = \\sqrt{\\frac{Gm_1 m_2}{F}}"},
+		{"Gravitational Potential Energy", {variables + 1651, 5}, {}, "U = -G\\frac{m_1 m_2}{r}"},
+		{"Gravitational Potential Energy", {variables + 1656, 5}, {}, "r = -G\\frac{m_1 m_2}{U}"},
+		{"Orbital Velocity", {variables + 1661, 4}, {}, "M = \\frac{v^2 r}{G}"},
+		{"Orbital Velocity", {variables + 1665, 4}, {}, "r = \\frac{GM}{v^2}"},
+		{"Escape Velocity", {variables + 1669, 4}, {}, "v_{esc} = \\sqrt{\\frac{2GM}{r}}"},
+		{"Escape Velocity", {variables + 1673, 4}, {}, "M = \\frac{v_{esc}^2 r}{2G}"},
+		{"Escape Velocity", {variables + 1677, 4}, {}, "r = \\frac{2GM}{v_{esc}^2}"},
+		{"Faraday's Law", {variables + 1681, 4}, {}, "\\varepsilon = N \\frac{\\Delta \\Phi}{\\Delta t}"},
+		{"Faraday's Law", {variables + 1685, 4}, {}, "N = \\frac{\\varepsilon \\Delta t}{\\Delta \\Phi}"},
+		{"Faraday's Law", {variables + 1689, 4}, {}, "\\Delta \\Phi = \\frac{\\varepsilon \\Delta t}{N}"},
+		{"Faraday's Law", {variables + 1693, 4}, {}, "\\Delta t = \\frac{N \\Delta \\Phi}{\\varepsilon}"},
+		{"Motional EMF", {variables + 1697, 4}, {}, "B = \\frac{\\varepsilon}{Lv}"},
+		{"Motional EMF", {variables + 1701, 4}, {}, "L = \\frac{\\varepsilon}{Bv}"},
+		{"Motional EMF", {variables + 1705, 4}, {}, "v = \\frac{\\varepsilon}{BL}"},
+		{"Inductance EMF", {variables + 1709, 4}, {}, "\\varepsilon = L \\frac{\\Delta I}{\\Delta t}"},
+		{"Inductance EMF", {variables + 1713, 4}, {}, "L = \\frac{\\varepsilon \\Delta t}{\\Delta I}"},
+		{"Inductance EMF", {variables + 1717, 4}, {}, "\\Delta I = \\frac{\\varepsilon \\Delta t}{L}"},
+		{"Inductance EMF", {variables + 1721, 4}, {}, "\\Delta t = \\frac{L \\Delta I}{\\varepsilon}"},
+		{"Inductor Energy", {variables + 1725, 3}, {}, "L = \\frac{2U}{I^2}"},
+		{"Inductor Energy", {variables + 1728, 3}, {}, "I = \\sqrt{\\frac{2U}{L}}"},
+		{"LR Time Constant", {variables + 1731, 3}, {}, "R = \\frac{L}{\\tau}"},
+		{"Solenoid Inductance", {variables + 1734, 5}, {}, "n = \\sqrt{\\frac{L}{\\mu_0 A l}}"},
+		{"Solenoid Inductance", {variables + 1739, 5}, {}, "A = \\frac{L}{\\mu_0 n^2 l}"},
+		{"Solenoid Inductance", {variables + 1744, 5}, {}, "l = \\frac{L}{\\mu_0 n^2 A}"},
+		{"LC Circuit Angular Frequency", {variables + 1749, 3}, {}, "L = \\frac{1}{\\omega^2 C}"},
+		{"LC Circuit Angular Frequency", {variables + 1752, 3}, {}, "C = \\frac{1}{\\omega^2 L}"},
+		{"Velocity with Acceleration", {variables + 1755, 4}, {}, "t = \\frac{v - v_0}{a}"},
+		{"Position with Acceleration", {variables + 1759, 5}, {}, "x_0 = x - v_0 t - \\frac{1}{2}at^2"},
+		{"Position with Acceleration", {variables + 1764, 5}, {}, "a = \\frac{2(x - x_0 - v_0 t)}{t^2}"},
+		{"Velocity-Position Relation", {variables + 1769, 5}, {}, "v_0 = \\sqrt{v^2 - 2a(x - x_0)}"},
+		{"Velocity-Position Relation", {variables + 1774, 5}, {}, "a = \\frac{v^2 - v_0^2}{2(x - x_0)}"},
+		{"Velocity-Position Relation", {variables + 1779, 5}, {}, "x = x_0 + \\frac{v^2 - v_0^2}{2a}"},
+		{"Average Velocity", {variables + 1784, 4}, {}, "v_{avg} = \\frac{x - x_0}{t}"},
+		{"Average Velocity", {variables + 1788, 4}, {}, "x = x_0 + v_{avg} t"},
+		{"Average Velocity", {variables + 1792, 4}, {}, "t = \\frac{x - x_0}{v_{avg}}"},
+		{"Average Velocity from Endpoints", {variables + 1796, 3}, {}, "v_0 = 2v_{avg} - v"},
+		{"Average Velocity from Endpoints", {variables + 1799, 3}, {}, "v = 2v_{avg} - v_0"},
+		{"Free Fall Velocity", {variables + 1802, 3}, {}, "t = \\frac{v}{g}"},
+		{"Free Fall Distance", {variables + 1805, 3}, {}, "t = \\sqrt{\\frac{2y}{g}}"},
+		{"Free Fall Velocity-Distance", {variables + 1808, 3}, {}, "y = \\frac{v^2}{2g}"},
+		{"Magnetic Force on Charge", {variables + 1811, 4}, {}, "q = \\frac{F}{vB}"},
+		{"Magnetic Force on Charge", {variables + 1815, 4}, {}, "v = \\frac{F}{qB}"},
+		{"Magnetic Force on Charge", {variables + 1819, 4}, {}, "B = \\frac{F}{qv}"},
+		{"Magnetic Force on Current", {variables + 1823, 4}, {}, "B = \\frac{F}{IL}"},
+		{"Magnetic Force on Current", {variables + 1827, 4}, {}, "I = \\frac{F}{BL}"},
+		{"Magnetic Force on Current", {variables + 1831, 4}, {}, "L = \\frac{F}{BI}"},
+		{"Magnetic Field of Wire", {variables + 1835, 4}, {}, "I = \\frac{2\\pi r B}{\\mu_0}"},
+		{"Magnetic Field of Wire", {variables + 1839, 4}, {}, "r = \\frac{\\mu_0 I}{2\\pi B}"},
+		{"Magnetic Field of Solenoid", {variables + 1843, 4}, {}, "n = \\frac{B}{\\mu_0 I}"},
+		{"Magnetic Field of Solenoid", {variables + 1847, 4}, {}, "I = \\frac{B}{\\mu_0 n}"},
+		{"Cyclotron Radius", {variables + 1851, 5}, {}, "m = \\frac{rqB}{v}"},
+		{"Cyclotron Radius", {variables + 1856, 5}, {}, "v = \\frac{rqB}{m}"},
+		{"Cyclotron Radius", {variables + 1861, 5}, {}, "q = \\frac{mv}{rB}"},
+		{"Cyclotron Radius", {variables + 1866, 5}, {}, "B = \\frac{mv}{qr}"},
+		{"Magnetic Flux", {variables + 1871, 3}, {}, "\\Phi = BA"},
+		{"Magnetic Flux", {variables + 1874, 3}, {}, "A = \\frac{\\Phi}{B}"},
+		{"Cyclotron Frequency", {variables + 1877, 4}, {}, "q = \\frac{2\\pi m f}{B}"},
+		{"Cyclotron Frequency", {variables + 1881, 4}, {}, "B = \\frac{2\\pi m f}{q}"},
+		{"Cyclotron Frequency", {variables + 1885, 4}, {}, "m = \\frac{qB}{2\\pi f}"},
+		{"Magnetic Energy Density", {variables + 1889, 3}, {}, "B = \\sqrt{2\\mu_0 u}"},
+		{"Hall Voltage", {variables + 1892, 6}, {}, "n = \\frac{IB}{qV_H t}"},
+		{"Hall Voltage", {variables + 1898, 6}, {}, "B = \\frac{nqV_H t}{I}"},
+		{"Ampere's Law for Circular Path", {variables + 1904, 4}, {}, "B = \\frac{\\mu_0 I_{enc}}{2\\pi r}"},
+		{"Ampere's Law for Circular Path", {variables + 1908, 4}, {}, "I_{enc} = \\frac{2\\pi r B}{\\mu_0}"},
+		{"Magnetic Dipole Moment", {variables + 1912, 3}, {}, "\\mu = IA"},
+		{"Magnetic Dipole Moment", {variables + 1915, 3}, {}, "A = \\frac{\\mu}{I}"},
+		{"Torque on Magnetic Dipole", {variables + 1918, 3}, {}, "\\tau = \\mu B"},
+		{"Torque on Magnetic Dipole", {variables + 1921, 3}, {}, "B = \\frac{\\tau}{\\mu}"},
+		{"Magnetic Dipole Potential Energy", {variables + 1924, 3}, {}, "U = -\\mu B"},
+		{"Force Between Parallel Currents", {variables + 1927, 5}, {}, "d = \\frac{\\mu_0 I_1 I_2}{2\\pi F/L}"},
+		{"Magnetic Field at Center of Loop", {variables + 1932, 4}, {}, "B = \\frac{\\mu_0 I}{2r}"},
+		{"Magnetic Field at Center of Loop", {variables + 1936, 4}, {}, "I = \\frac{2rB}{\\mu_0}"},
+		{"Magnetic Field at Center of Loop", {variables + 1940, 4}, {}, "r = \\frac{\\mu_0 I}{2B}"},
+		{"Biot-Savart Law", {variables + 1944, 6}, {}, "dB = \\frac{\\mu_0 I dl \\sin\\theta}{4\\pi r^2}"},
+		{"Cyclotron Period", {variables + 1950, 4}, {}, "m = \\frac{TqB}{2\\pi}"},
+		{"Cyclotron Period", {variables + 1954, 4}, {}, "B = \\frac{2\\pi m}{qT}"},
+		{"Magnetic Field in Toroid", {variables + 1958, 5}, {}, "N = \\frac{2\\pi r B}{\\mu_0 I}"},
+		{"Magnetic Field in Toroid", {variables + 1963, 5}, {}, "I = \\frac{2\\pi r B}{\\mu_0 N}"},
+		{"Velocity Selector", {variables + 1968, 3}, {}, "B = \\frac{E}{v}"},
+		{"Mass Spectrometer", {variables + 1971, 5}, {}, "m = \\frac{qB^2 r^2}{2V}"},
+		{"Mass Spectrometer", {variables + 1976, 5}, {}, "r = \\sqrt{\\frac{2mV}{qB^2}}"},
+		{"Mass Spectrometer", {variables + 1981, 5}, {}, "B = \\sqrt{\\frac{2mV}{qr^2}}"},
+		{"Photoelectric Effect", {variables + 1986, 4}, {}, "f = \\frac{KE_{max} + \\phi}{h}"},
+		{"Photoelectric Effect", {variables + 1990, 4}, {}, "\\phi = hf - KE_{max}"},
+		{"Photon Energy", {variables + 1994, 3}, {}, "f = \\frac{E}{h}"},
+		{"de Broglie Wavelength", {variables + 1997, 3}, {}, "p = \\frac{h}{\\lambda}"},
+		{"Momentum", {variables + 2000, 3}, {}, "v = \\frac{p}{m}"},
+		{"Change in Momentum", {variables + 2003, 3}, {}, "\\Delta p = m\\Delta v"},
+		{"Change in Momentum", {variables + 2006, 3}, {}, "\\Delta v = \\frac{\\Delta p}{m}"},
+		{"Conservation of Momentum", {variables + 2009, 2}, {}, "p_f = p_i"},
+		{"Perfectly Inelastic Collision", {variables + 2011, 5}, {}, "v_f = \\frac{m_1 v_{1i} + m_2 v_{2i}}{m_1 + m_2}"},
+		{"Magnification", {variables + 2016, 3}, {}, "m = -\\frac{d_i}{d_o}"},
+		{"Magnification", {variables + 2019, 3}, {}, "d_o = -\\frac{d_i}{m}"},
+		{"Magnification from Height", {variables + 2022, 3}, {}, "m = \\frac{h_i}{h_o}"},
+		{"Magnification from Height", {variables + 2025, 3}, {}, "h_o = \\frac{h_i}{m}"},
+		{"SHM Angular Frequency", {variables + 2028, 3}, {}, "\\omega = \\sqrt{\\frac{k}{m}}"},
+		{"SHM Angular Frequency", {variables + 2031, 3}, {}, "k = m\\omega^2"},
+		{"Mass-Spring Period", {variables + 2034, 3}, {}, "m = \\frac{kT^2}{4\\pi^2}"},
+		{"Mass-Spring Period", {variables + 2037, 3}, {}, "k = \\frac{4\\pi^2 m}{T^2}"},
+		{"Simple Pendulum Period", {variables + 2040, 3}, {}, "L = \\frac{gT^2}{4\\pi^2}"},
+		{"Angular Frequency", {variables + 2043, 2}, {}, "f = \\frac{\\omega}{2\\pi}"},
+		{"Torque", {variables + 2045, 3}, {}, "F = \\frac{\\tau}{r}"},
+		{"Rotational Second Law", {variables + 2048, 3}, {}, "\\alpha = \\frac{\\tau}{I}"},
+		{"Rotational Kinetic Energy", {variables + 2051, 3}, {}, "KE = \\frac{1}{2}I\\omega^2"},
+		{"Rotational Kinetic Energy", {variables + 2054, 3}, {}, "I = \\frac{2KE}{\\omega^2}"},
+		{"Rotational Kinetic Energy", {variables + 2057, 3}, {}, "\\omega = \\sqrt{\\frac{2KE}{I}}"},
+		{"Angular Momentum", {variables + 2060, 3}, {}, "\\omega = \\frac{L}{I}"},
+		{"Linear-Angular Velocity", {variables + 2063, 3}, {}, "\\omega = \\frac{v}{r}"},
+		{"Moment of Inertia Point Mass", {variables + 2066, 3}, {}, "r = \\sqrt{\\frac{I}{m}}"},
+		{"Heat Transfer", {variables + 2069, 4}, {}, "m = \\frac{Q}{c\\Delta T}"},
+		{"Heat Transfer", {variables + 2073, 4}, {}, "c = \\frac{Q}{m\\Delta T}"},
+		{"Heat Transfer", {variables + 2077, 4}, {}, "\\Delta T = \\frac{Q}{mc}"},
+		{"Latent Heat", {variables + 2081, 3}, {}, "L = \\frac{Q}{m}"},
+		{"Linear Thermal Expansion", {variables + 2084, 4}, {}, "\\alpha = \\frac{\\Delta L}{L_0 \\Delta T}"},
+		{"First Law of Thermodynamics", {variables + 2088, 3}, {}, "W = Q - \\Delta U"},
+		{"Carnot Efficiency", {variables + 2091, 3}, {}, "T_c = T_h(1 - \\eta)"},
+		{"Wave Velocity", {variables + 2094, 3}, {}, "\\lambda = \\frac{v}{f}"},
+		{"Wave Speed on String", {variables + 2097, 3}, {}, "T = \\mu v^2"},
+		{"Doppler Effect Moving Source", {variables + 2100, 4}, {}, "f_{obs} = f_s \\frac{v}{v \\mp v_s}"},
+    };
+    // FormulaDatabase keeps MAX_INPUT_TYPES input slots per formula
+    static_assert(std::ranges::all_of(families, [](const FormulaFamily& f) { return f.variables.size() <= MAX_INPUT_TYPES; }),
+                  "a formula family has more variables than MAX_INPUT_TYPES");
+
+    constexpr Formula formulas[] = {
+		{families + 0, "", 0},
+		{families + 0, "", 2},
+		{families + 0, "", 1},
+		{families + 1, "", 0},
+		{families + 1, "", 2},
+		{families + 1, "", 1},
+		{families + 2, "", 0},
+		{families + 2, "", 2},
+		{families + 2, "", 1},
+		{families + 3, "", 0},
+		{families + 3, "", 1},
+		{families + 3, "", 2},
+		{families + 4, "", 0},
+		{families + 4, "", 1},
+		{families + 4, "", 2},
+		{families + 5, "", 0},
+		{families + 5, "", 1},
+		{families + 5, "", 3},
+		{families + 5, "", 2},
+		{families + 6, "", 0},
+		{families + 6, "", 1},
+		{families + 6, "", 2},
+		{families + 6, "", 3},
+		{families + 6, "", 4},
+		{families + 7, "", 1},
+		{families + 7, "", 2},
+		{families + 7, "", 0},
+		{families + 7, "", 3},
+		{families + 8, "", 1},
+		{families + 8, "", 0},
+		{families + 8, "", 2},
+		{families + 8, "", 3},
+		{families + 8, "", 4},
+		{families + 9, "", 1},
+		{families + 9, "", 2},
+		{families + 9, "", 3},
+		{families + 9, "", 0},
+		{families + 10, "", 1},
+		{families + 10, "", 2},
+		{families + 10, "", 3},
+		{families + 10, "", 0},
+		{families + 11, "", 3},
+		{families + 11, "", 4},
+		{families + 11, "", 0},
+		{families + 11, "", 1},
+		{families + 11, "", 2},
+		{families + 12, "", 1},
+		{families + 12, "", 2},
+		{families + 12, "", 3},
+		{families + 12, "", 0},
+		{families + 13, "", 0},
+		{families + 13, "", 2},
+		{families + 13, "", 1},
+		{families + 14, "", 0},
+		{families + 14, "", 2},
+		{families + 14, "", 1},
+		{families + 15, "", 0},
+		{families + 15, "", 3},
+		{families + 15, "", 2},
+		{families + 15, "", 1},
+		{families + 16, "E_max = \\frac{h \\cdot f - \\phi}{K}", Formula::no_solve_for},
+		{families + 16, "K = \\frac{h \\cdot f - \\phi}{E_max}", Formula::no_solve_for},
+		{families + 16, "", 3},
+		{families + 16, "", 2},
+		{families + 16, "", 1},
+		{families + 17, "", 0},
+		{families + 17, "", 1},
+		{families + 17, "", 2},
+		{families + 17, "", 3},
+		{families + 18, "", 0},
+		{families + 18, "", 1},
+		{families + 18, "", 2},
+		{families + 19, "", 1},
+		{families + 19, "", 0},
+		{families + 19, "", 2},
+		{families + 20, "", 2},
+		{families + 20, "", 1},
+		{families + 20, "", 0},
+		{families + 21, "", 0},
+		{families + 21, "", 1},
+		{families + 21, "", 2},
+		{families + 21, "e = \\left(\\frac{N}{N_0}\\right)^{\\frac{1}{-\\lambda \\cdot t}}", Formula::no_solve_for},
+		{families + 21, "", 3},
+		{families + 22, "", 1},
+		{families + 22, "t_\\frac{1}{2} = \\frac{0.6931471805599453}{\\lambda}", Formula::no_solve_for},
+		{families + 23, "", 0},
+		{families + 23, "", 1},
+		{families + 23, "", 2},
+		{families + 23, "", 3},
+		{families + 23, "", 4},
+		{families + 24, "", 0},
+		{families + 24, "", 1},
+		{families + 24, "", 2},
+		{families + 25, "", 0},
+		{families + 25, "", 1},
+		{families + 25, "", 2},
+		{families + 25, "", 3},
+		{families + 26, "", 0},
+		{families + 26, "", 1},
+		{families + 26, "", 2},
+		{families + 26, "", 3},
+		{families + 27, "", 0},
+		{families + 27, "", 1},
+		{families + 27, "", 2},
+		{families + 28, "", 0},
+		{families + 28, "", 1},
+		{families + 28, "", 2},
+		{families + 28, "", 3},
+		{families + 28, "", 4},
+		{families + 29, "", 2},
+		{families + 29, "", 1},
+		{families + 29, "", 0},
+		{families + 30, "Q_enc = \\Phi_E \\cdot \\epsilon_0", Formula::no_solve_for},
+		{families + 30, "", 0},
+		{families + 30, "", 2},
+		{families + 31, "E = \\frac{\\sigma}{2 \\epsilon_0}", 0},
+		{families + 31, "\\epsilon_0 = \\frac{\\frac{\\sigma}{E}}{2}", 2},
+		{families + 31, "\\sigma = E \\cdot 2 \\epsilon_0", 1},
+		{families + 32, "A = \\frac{Q}{\\sigma}", 2},
+		{families + 32, "Q = \\sigma \\cdot A", 1},
+		{families + 32, "\\sigma = \\frac{Q}{A}", 0},
+		{families + 33, "", 2},
+		{families + 33, "", 1},
+		{families + 33, "", 0},
+		{families + 34, "", 1},
+		{families + 34, "", 2},
+		{families + 34, "", 0},
+		{families + 35, "", 2},
+		{families + 35, "", 0},
+		{families + 35, "", 1},
+		{families + 36, "", 2},
+		{families + 36, "", 1},
+		{families + 36, "", 0},
+		{families + 37, "", 0},
+		{families + 37, "", 1},
+		{families + 37, "", 2},
+		{families + 38, "", 0},
+		{families + 38, "", 2},
+		{families + 38, "", 4},
+		{families + 38, "", 1},
+		{families + 39, "", 2},
+		{families + 39, "", 0},
+		{families + 39, "", 3},
+		{families + 39, "", 1},
+		{families + 40, "", 2},
+		{families + 40, "", 0},
+		{families + 40, "", 3},
+		{families + 40, "", 1},
+		{families + 41, "E = \\frac{\\sigma}{\\epsilon_0}", 0},
+		{families + 41, "\\epsilon_0 = \\frac{\\sigma}{E}", 2},
+		{families + 41, "\\sigma = E \\cdot \\epsilon_0", 1},
+		{families + 42, "", 0},
+		{families + 42, "", 3},
+		{families + 42, "", 1},
+		{families + 42, "", 2},
+		{families + 42, "", 4},
+		{families + 43, "", 2},
+		{families + 43, "", 0},
+		{families + 43, "", 1},
+		{families + 44, "", 2},
+		{families + 44, "", 0},
+		{families + 44, "", 1},
+		{families + 45, "", 0},
+		{families + 45, "", 2},
+		{families + 45, "", 1},
+		{families + 45, "", 3},
+		{families + 46, "", 2},
+		{families + 46, "", 1},
+		{families + 46, "", 0},
+		{families + 46, "", 3},
+		{families + 47, "", 3},
+		{families + 47, "", 0},
+		{families + 47, "", 1},
+		{families + 47, "", 4},
+		{families + 47, "", 2},
+		{families + 48, "", 2},
+		{families + 48, "", 1},
+		{families + 48, "", 0},
+		{families + 49, "", 1},
+		{families + 49, "", 2},
+		{families + 49, "", 0},
+		{families + 50, "", 0},
+		{families + 50, "", 2},
+		{families + 50, "", 1},
+		{families + 50, "", 3},
+		{families + 51, "", 3},
+		{families + 51, "", 2},
+		{families + 51, "", 1},
+		{families + 51, "", 0},
+		{families + 52, "", 3},
+		{families + 52, "", 0},
+		{families + 52, "", 1},
+		{families + 52, "", 2},
+		{families + 53, "", 3},
+		{families + 53, "", 0},
+		{families + 53, "", 2},
+		{families + 53, "", 1},
+		{families + 53, "", 4},
+		{families + 53, "", 5},
+		{families + 54, "", 2},
+		{families + 54, "", 3},
+		{families + 54, "", 0},
+		{families + 54, "", 1},
+		{families + 55, "", 2},
+		{families + 55, "", 1},
+		{families + 55, "", 0},
+		{families + 56, "", 2},
+		{families + 56, "", 0},
+		{families + 56, "", 3},
+		{families + 56, "", 1},
+		{families + 57, "", 1},
+		{families + 57, "", 3},
+		{families + 57, "", 0},
+		{families + 57, "", 2},
+		{families + 58, "", 2},
+		{families + 58, "", 1},
+		{families + 58, "", 0},
+		{families + 59, "", 0},
+		{families + 59, "", 1},
+		{families + 59, "", 2},
+		{families + 60, "", 0},
+		{families + 60, "", 1},
+		{families + 60, "", 2},
+		{families + 61, "", 2},
+		{families + 61, "", 3},
+		{families + 61, "", 0},
+		{families + 61, "", 1},
+		{families + 62, "", 0},
+		{families + 62, "", 2},
+		{families + 62, "", 1},
+		{families + 63, "", 0},
+		{families + 63, "", 2},
+		{families + 63, "", 1},
+		{families + 64, "", 1},
+		{families + 64, "", 0},
+		{families + 64, "", 2},
+		{families + 65, "", 0},
+		{families + 65, "", 1},
+		{families + 65, "", 2},
+		{families + 66, "", 2},
+		{families + 66, "", 0},
+		{families + 66, "", 1},
+		{families + 66, "", 3},
+		{families + 67, "", 1},
+		{families + 67, "", 0},
+		{families + 67, "", 2},
+		{families + 68, "", 2},
+		{families + 68, "", 1},
+		{families + 68, "", 0},
+		{families + 69, "", 1},
+		{families + 69, "", 2},
+		{families + 69, "C_total = C_1 + C_2", Formula::no_solve_for},
+		{families + 70, "", 0},
+		{families + 70, "", 2},
+		{families + 70, "", 1},
+		{families + 71, "", 0},
+		{families + 71, "", 1},
+		{families + 71, "", 2},
+		{families + 72, "", 0},
+		{families + 72, "", 2},
+		{families + 72, "", 1},
+		{families + 73, "", 0},
+		{families + 73, "", 3},
+		{families + 73, "", 2},
+		{families + 73, "", 1},
+		{families + 73, "", 4},
+		{families + 73, "", 5},
+		{families + 74, "", 1},
+		{families + 74, "", 0},
+		{families + 74, "", 2},
+		{families + 75, "", 3},
+		{families + 75, "", 0},
+		{families + 75, "", 2},
+		{families + 75, "", 1},
+		{families + 75, "", 4},
+		{families + 76, "", 0},
+		{families + 76, "", 3},
+		{families + 76, "", 2},
+		{families + 76, "", 1},
+		{families + 77, "", 3},
+		{families + 77, "", 2},
+		{families + 77, "", 1},
+		{families + 77, "", 0},
+		{families + 78, "C_total = \\frac{C_1 \\cdot C_2}{C_1 + C_2}", Formula::no_solve_for},
+		{families + 79, "E = \\frac{\\frac{1}{2} m \\cdot v^{2}}{K}", Formula::no_solve_for},
+		{families + 79, "K = \\frac{\\frac{1}{2} m \\cdot v^{2}}{E}", Formula::no_solve_for},
+		{families + 79, "", 1},
+		{families + 79, "", 2},
+		{families + 80, "E = \\frac{m \\cdot g \\cdot h}{P}", Formula::no_solve_for},
+		{families + 80, "P = \\frac{m \\cdot g \\cdot h}{E}", Formula::no_solve_for},
+		{families + 80, "", 2},
+		{families + 80, "", 3},
+		{families + 80, "", 1},
+		{families + 81, "", 1},
+		{families + 81, "", 0},
+		{families + 81, "", 2},
+		{families + 82, "E = \\frac{W}{\\Delta K}", Formula::no_solve_for},
+		{families + 82, "", 0},
+		{families + 82, "\\Delta K = \\frac{W}{E}", Formula::no_solve_for},
+		{families + 83, "", 0},
+		{families + 83, "", 1},
+		{families + 83, "", 2},
+		{families + 84, "", 1},
+		{families + 84, "", 0},
+		{families + 84, "", 2},
+		{families + 85, "", 1},
+		{families + 85, "", 0},
+		{families + 85, "", 2},
+		{families + 86, "", 1},
+		{families + 86, "", 0},
+		{families + 86, "", 2},
+		{families + 87, "", 0},
+		{families + 87, "", 1},
+		{families + 88, "", 0},
+		{families + 88, "", 1},
+		{families + 88, "\\Delta \\Phi_B = \\frac{E \\cdot \\Delta t}{N}", Formula::no_solve_for},
+		{families + 88, "", 3},
+		{families + 89, "", 3},
+		{families + 89, "", 2},
+		{families + 89, "", 0},
+		{families + 89, "", 1},
+		{families + 89, "", 4},
+		{families + 90, "", 1},
+		{families + 90, "", 0},
+		{families + 90, "", 2},
+		{families + 90, "", 3},
+		{families + 91, "", 3},
+		{families + 91, "", 2},
+		{families + 91, "", 0},
+		{families + 91, "", 1},
+		{families + 91, "", 4},
+		{families + 92, "", 3},
+		{families + 92, "", 2},
+		{families + 92, "", 1},
+		{families + 92, "", 0},
+		{families + 93, "", 1},
+		{families + 93, "", 0},
+		{families + 93, "", 2},
+		{families + 93, "", 3},
+		{families + 94, "", 1},
+		{families + 94, "", 0},
+		{families + 94, "", 3},
+		{families + 94, "", 2},
+		{families + 95, "", 1},
+		{families + 95, "", 2},
+		{families + 95, "\\Delta \\Phi_B = B \\cdot \\Delta A", Formula::no_solve_for},
+		{families + 96, "", 0},
+		{families + 96, "", 1},
+		{families + 97, "", 0},
+		{families + 97, "", 1},
+		{families + 97, "", 2},
+		{families + 98, "", 2},
+		{families + 98, "", 1},
+		{families + 98, "", 0},
+		{families + 99, "", 2},
+		{families + 99, "", 0},
+		{families + 99, "", 1},
+		{families + 99, "", 3},
+		{families + 100, "", 0},
+		{families + 100, "", 1},
+		{families + 100, "", 3},
+		{families + 100, "", 2},
+		{families + 101, "", 1},
+		{families + 101, "", 2},
+		{families + 101, "", 0},
+		{families + 102, "", 2},
+		{families + 102, "", 0},
+		{families + 102, "", 1},
+		{families + 103, "", 1},
+		{families + 103, "", 0},
+		{families + 103, "", 2},
+		{families + 104, "", 2},
+		{families + 104, "", 1},
+		{families + 104, "", 0},
+		{families + 105, "", 0},
+		{families + 105, "", 3},
+		{families + 105, "", 4},
+		{families + 105, "", 1},
+		{families + 105, "", 2},
+		{families + 106, "", 0},
+		{families + 106, "", 2},
+		{families + 106, "", 1},
+		{families + 106, "", 3},
+		{families + 107, "", 0},
+		{families + 107, "", 2},
+		{families + 107, "", 1},
+		{families + 108, "H = -\\frac{-14}{p + p \\cdot O}", Formula::no_solve_for},
+		{families + 108, "O = \\frac{\\frac{14 - p \\cdot H}{H}}{p}", Formula::no_solve_for},
+		{families + 108, "p = -\\frac{-14}{H + H \\cdot O}", Formula::no_solve_for},
+		{families + 109, "", 2},
+		{families + 109, "", 0},
+		{families + 109, "", 1},
+		{families + 109, "", 3},
+		{families + 110, "E = 1 - \\frac{R \\cdot T}{n \\cdot F} \\cdot \\ln\\left(Q\\right)", 0},
+		{families + 110, "", 5},
+		{families + 110, "", 6},
+		{families + 110, "", 2},
+		{families + 110, "", 3},
+		{families + 110, "", 4},
+		{families + 111, "", 0},
+		{families + 111, "", 1},
+		{families + 111, "", 2},
+		{families + 111, "", 3},
+		{families + 112, "", 3},
+		{families + 112, "", 2},
+		{families + 112, "", 1},
+		{families + 112, "", 0},
+		{families + 113, "", 0},
+		{families + 113, "", 1},
+		{families + 113, "e = \\left(\\frac{A}{A_0}\\right)^{\\frac{1}{-k \\cdot t}}", Formula::no_solve_for},
+		{families + 113, "", 2},
+		{families + 113, "", 3},
+		{families + 114, "", 3},
+		{families + 114, "", 2},
+		{families + 114, "", 0},
+		{families + 114, "", 1},
+		{families + 115, "A = \\frac{F}{\\sigma}", 2},
+		{families + 115, "F = \\sigma \\cdot A", 1},
+		{families + 115, "\\sigma = \\frac{F}{A}", 0},
+		{families + 116, "", 2},
+		{families + 116, "", 1},
+		{families + 116, "", 0},
+		{families + 117, "E = \\frac{\\sigma}{\\epsilon}", 0},
+		{families + 117, "\\epsilon = \\frac{\\sigma}{E}", 2},
+		{families + 117, "\\sigma = E \\cdot \\epsilon", 1},
+		{families + 118, "", 2},
+		{families + 118, "", 1},
+		{families + 118, "", 0},
+		{families + 119, "I = \\frac{M \\cdot y}{\\sigma}", 3},
+		{families + 119, "M = \\frac{\\sigma \\cdot I}{y}", 1},
+		{families + 119, "\\sigma = \\frac{M \\cdot y}{I}", 0},
+		{families + 119, "y = \\frac{\\sigma \\cdot I}{M}", 2},
+		{families + 120, "E = \\frac{\\frac{\\sigma}{\\Delta T}}{\\alpha}", 1},
+		{families + 120, "\\Delta T = \\frac{\\sigma}{E \\cdot \\alpha}", 3},
+		{families + 120, "\\alpha = \\frac{\\frac{\\sigma}{\\Delta T}}{E}", 2},
+		{families + 120, "\\sigma = E \\cdot \\alpha \\cdot \\Delta T", 0},
+		{families + 121, "", 3},
+		{families + 121, "", 0},
+		{families + 121, "", 1},
+		{families + 121, "", 2},
+		{families + 122, "", 3},
+		{families + 122, "", 0},
+		{families + 122, "", 1},
+		{families + 122, "", 2},
+		{families + 123, "", 3},
+		{families + 123, "", 2},
+		{families + 123, "", 1},
+		{families + 123, "", 0},
+		{families + 124, "", 3},
+		{families + 124, "", 2},
+		{families + 124, "", 1},
+		{families + 124, "", 0},
+		{families + 125, "", 3},
+		{families + 125, "R = \\frac{\\frac{\\rho \\cdot v \\cdot D}{\\mu}}{e}", Formula::no_solve_for},
+		{families + 125, "", 4},
+		{families + 125, "", 1},
+		{families + 125, "e = \\frac{\\frac{\\rho \\cdot v \\cdot D}{\\mu}}{R}", Formula::no_solve_for},
+		{families + 125, "", 2},
+		{families + 126, "W_in = \\frac{W_out}{\\eta}", Formula::no_solve_for},
+		{families + 126, "W_out = \\eta \\cdot W_in", Formula::no_solve_for},
+		{families + 126, "", 0},
+		{families + 127, "P_in = \\frac{P_out}{\\eta}", Formula::no_solve_for},
+		{families + 127, "P_out = \\eta \\cdot P_in", Formula::no_solve_for},
+		{families + 127, "", 0},
+		{families + 128, "", 1},
+		{families + 128, "", 2},
+		{families + 128, "", 0},
+		{families + 129, "", 0},
+		{families + 129, "", 3},
+		{families + 129, "", 1},
+		{families + 129, "", 2},
+		{families + 130, "", 0},
+		{families + 131, "", 4},
+		{families + 131, "t = \\frac{-v_0}{a} \\pm \\frac{\\left(v_0^{2} - 4 \\cdot \\frac{1}{2} a \\cdot \\left(x_0 - x\\right)\\right)^{\\frac{1}{2}}}{a}", 3},
+		{families + 131, "", 2},
+		{families + 131, "", 0},
+		{families + 131, "", 1},
+		{families + 132, "", 2},
+		{families + 132, "", 0},
+		{families + 132, "", 1},
+		{families + 132, "", 3},
+		{families + 132, "", 4},
+		{families + 133, "", 2},
+		{families + 133, "", 1},
+		{families + 133, "", 0},
+		{families + 134, "", 1},
+		{families + 134, "", 2},
+		{families + 134, "", 0},
+		{families + 135, "", 1},
+		{families + 135, "", 2},
+		{families + 135, "", 0},
+		{families + 136, "", 1},
+		{families + 136, "", 0},
+		{families + 136, "", 2},
+		{families + 137, "", 0},
+		{families + 137, "\\theta = \\frac{\\arcsin\\left(\\frac{R \\cdot g}{v_0^{2}}\\right)}{2}", Formula::no_solve_for},
+		{families + 137, "", 3},
+		{families + 137, "", 1},
+		{families + 138, "", 0},
+		{families + 138, "", 2},
+		{families + 138, "", 1},
+		{families + 139, "", 2},
+		{families + 139, "", 0},
+		{families + 139, "", 1},
+		{families + 140, "", 1},
+		{families + 140, "", 2},
+		{families + 140, "", 0},
+		{families + 141, "", 0},
+		{families + 141, "", 1},
+		{families + 141, "", 2},
+		{families + 142, "", 0},
+		{families + 142, "", 1},
+		{families + 142, "", 2},
+		{families + 142, "", 3},
+		{families + 143, "", 0},
+		{families + 144, "", 3},
+		{families + 144, "", 1},
+		{families + 144, "", 0},
+		{families + 144, "t = \\frac{-\\omega_0}{\\alpha} \\pm \\frac{\\left(\\omega_0^{2} - 4 \\cdot \\frac{1}{2} \\alpha \\cdot -\\theta\\right)^{\\frac{1}{2}}}{\\alpha}", 2},
+		{families + 145, "E_rot = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{K}", Formula::no_solve_for},
+		{families + 145, "", 1},
+		{families + 145, "K = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{E_rot}", Formula::no_solve_for},
+		{families + 145, "", 2},
+		{families + 146, "", 1},
+		{families + 146, "", 0},
+		{families + 146, "", 2},
+		{families + 147, "", 0},
+		{families + 147, "", 1},
+		{families + 147, "", 2},
+		{families + 148, "", 2},
+		{families + 148, "", 1},
+		{families + 148, "", 0},
+		{families + 149, "", 2},
+		{families + 149, "", 0},
+		{families + 149, "", 1},
+		{families + 150, "", 1},
+		{families + 150, "", 2},
+		{families + 150, "", 0},
+		{families + 151, "", 3},
+		{families + 151, "", 2},
+		{families + 151, "", 0},
+		{families + 151, "", 1},
+		{families + 152, "", 0},
+		{families + 152, "", 1},
+		{families + 152, "", 2},
+		{families + 153, "", 2},
+		{families + 153, "", 1},
+		{families + 153, "", 0},
+		{families + 154, "", 1},
+		{families + 154, "", 3},
+		{families + 154, "", 2},
+		{families + 154, "", 0},
+		{families + 155, "", 1},
+		{families + 155, "", 0},
+		{families + 155, "", 2},
+		{families + 156, "", 1},
+		{families + 156, "", 0},
+		{families + 156, "", 2},
+		{families + 157, "", 0},
+		{families + 157, "", 2},
+		{families + 157, "", 1},
+		{families + 158, "\\rho = \\frac{1}{\\sigma}", 1},
+		{families + 158, "\\sigma = \\frac{1}{\\rho}", 0},
+		{families + 159, "", 0},
+		{families + 159, "", 1},
+		{families + 159, "", 3},
+		{families + 159, "", 2},
+		{families + 160, "E = \\frac{J}{\\sigma}", 2},
+		{families + 160, "J = \\sigma \\cdot E", 0},
+		{families + 160, "\\sigma = \\frac{J}{E}", 1},
+		{families + 161, "", 3},
+		{families + 161, "", 1},
+		{families + 161, "", 4},
+		{families + 161, "", 2},
+		{families + 161, "", 0},
+		{families + 162, "", 0},
+		{families + 162, "", 1},
+		{families + 162, "", 2},
+		{families + 163, "", 0},
+		{families + 163, "", 1},
+		{families + 163, "", 2},
+		{families + 164, "", 0},
+		{families + 165, "", 2},
+		{families + 165, "", 0},
+		{families + 165, "", 1},
+		{families + 166, "", 2},
+		{families + 166, "", 1},
+		{families + 166, "", 0},
+		{families + 167, "", 0},
+		{families + 167, "", 1},
+		{families + 167, "", 2},
+		{families + 167, "", 3},
+		{families + 168, "", 0},
+		{families + 168, "", 3},
+		{families + 168, "", 1},
+		{families + 168, "", 2},
+		{families + 169, "", 1},
+		{families + 169, "", 3},
+		{families + 169, "", 2},
+		{families + 169, "", 0},
+		{families + 170, "", 1},
+		{families + 170, "", 0},
+		{families + 170, "", 2},
+		{families + 171, "", 1},
+		{families + 171, "", 0},
+		{families + 171, "", 2},
+		{families + 172, "", 2},
+		{families + 172, "", 0},
+		{families + 172, "", 1},
+		{families + 172, "", 3},
+		{families + 173, "", 0},
+		{families + 173, "", 2},
+		{families + 173, "", 1},
+		{families + 173, "", 3},
+		{families + 173, "", 4},
+		{families + 174, "", 0},
+		{families + 174, "", 3},
+		{families + 174, "", 1},
+		{families + 174, "", 2},
+		{families + 175, "", 0},
+		{families + 175, "", 3},
+		{families + 175, "", 2},
+		{families + 175, "", 1},
+		{families + 175, "", 4},
+		{families + 175, "", 5},
+		{families + 176, "", 0},
+		{families + 176, "", 2},
+		{families + 176, "", 3},
+		{families + 176, "", 1},
+		{families + 177, "", 0},
+		{families + 177, "", 3},
+		{families + 177, "", 4},
+		{families + 177, "", 1},
+		{families + 177, "", 2},
+		{families + 177, "", 5},
+		{families + 177, "", 6},
+		{families + 178, "", 1},
+		{families + 178, "", 2},
+		{families + 178, "", 0},
+		{families + 179, "", 0},
+		{families + 179, "", 2},
+		{families + 179, "", 1},
+		{families + 179, "", 4},
+		{families + 180, "", 0},
+		{families + 180, "", 3},
+		{families + 180, "", 4},
+		{families + 180, "", 2},
+		{families + 180, "", 1},
+		{families + 181, "", 0},
+		{families + 181, "", 2},
+		{families + 181, "", 5},
+		{families + 181, "", 1},
+		{families + 181, "", 4},
+		{families + 181, "", 3},
+		{families + 182, "", 0},
+		{families + 182, "", 2},
+		{families + 182, "", 1},
+		{families + 182, "", 3},
+		{families + 182, "", 4},
+		{families + 183, "", 0},
+		{families + 183, "", 3},
+		{families + 183, "", 2},
+		{families + 183, "", 1},
+		{families + 184, "", 2},
+		{families + 184, "", 0},
+		{families + 184, "", 1},
+		{families + 185, "", 2},
+		{families + 185, "", 0},
+		{families + 185, "", 3},
+		{families + 185, "", 1},
+		{families + 186, "", 2},
+		{families + 186, "", 0},
+		{families + 186, "", 3},
+		{families + 186, "", 4},
+		{families + 186, "", 1},
+		{families + 187, "A = \\frac{\\frac{P}{T^{4}}}{\\sigma}", 2},
+		{families + 187, "P = \\sigma \\cdot A \\cdot T^{4}", 0},
+		{families + 187, "T = \\pm \\left(\\frac{P}{\\sigma \\cdot A}\\right)^{\\frac{1}{4}}", 3},
+		{families + 187, "\\sigma = \\frac{\\frac{P}{T^{4}}}{A}", 1},
+		{families + 188, "", 1},
+		{families + 188, "", 2},
+		{families + 188, "", 0},
+		{families + 189, "", 1},
+		{families + 189, "", 2},
+		{families + 189, "", 0},
+		{families + 190, "", 1},
+		{families + 190, "", 2},
+		{families + 190, "", 0},
+		{families + 191, "", 1},
+		{families + 191, "", 0},
+		{families + 191, "", 2},
+		{families + 192, "E = \\frac{\\frac{3}{2} k_B \\cdot T}{K}", Formula::no_solve_for},
+		{families + 192, "K = \\frac{\\frac{3}{2} k_B \\cdot T}{E}", Formula::no_solve_for},
+		{families + 192, "", 2},
+		{families + 192, "", 1},
+		{families + 193, "", 1},
+		{families + 193, "", 2},
+		{families + 193, "R_total = R_1 + R_2", Formula::no_solve_for},
+		{families + 194, "R_total = \\frac{R_1 \\cdot R_2}{R_1 + R_2}", Formula::no_solve_for},
+		{families + 195, "", 2},
+		{families + 195, "V_in = \\frac{V_out}{\\frac{R_2}{R_1 + R_2}}", Formula::no_solve_for},
+		{families + 195, "V_out = V_in \\cdot \\frac{R_2}{R_1 + R_2}", Formula::no_solve_for},
+		{families + 196, "", 1},
+		{families + 196, "", 2},
+		{families + 196, "", 0},
+		{families + 196, "", 3},
+		{families + 197, "", 2},
+		{families + 197, "", 1},
+		{families + 197, "", 0},
+		{families + 198, "", 1},
+		{families + 198, "", 2},
+		{families + 198, "I_in = I_1 + I_2", Formula::no_solve_for},
+		{families + 199, "", 3},
+		{families + 199, "", 2},
+		{families + 199, "", 1},
+		{families + 199, "", 0},
+		{families + 200, "", 0},
+		{families + 200, "I_total = \\frac{I_1}{\\frac{R_2}{R_1 + R_2}}", Formula::no_solve_for},
+		{families + 200, "", 2},
+		{families + 201, "", 1},
+		{families + 201, "P_max = \\frac{E^{2}}{4 R}", Formula::no_solve_for},
+		{families + 201, "", 2},
+		{families + 202, "", 1},
+		{families + 202, "", 2},
+		{families + 202, "", 0},
+		{families + 203, "", 0},
+		{families + 203, "", 1},
+		{families + 203, "", 2},
+		{families + 204, "", 0},
+		{families + 204, "", 1},
+		{families + 204, "", 2},
+		{families + 205, "", 0},
+		{families + 205, "", 1},
+		{families + 205, "", 2},
+		{families + 206, "", 0},
+		{families + 206, "", 1},
+		{families + 206, "", 2},
+		{families + 206, "", 3},
+		{families + 207, "", 0},
+		{families + 207, "", 1},
+		{families + 207, "", 2},
+		{families + 208, "", 0},
+		{families + 208, "", 1},
+		{families + 208, "", 2},
+		{families + 208, "", 3},
+		{families + 209, "", 0},
+		{families + 209, "", 1},
+		{families + 209, "", 2},
+		{families + 210, "", 0},
+		{families + 210, "", 1},
+		{families + 210, "", 3},
+		{families + 210, "r = \\frac{-2 \\pi \\cdot h}{4 \\pi} \\pm \\frac{\\left(\\left(2 \\pi \\cdot h\\right)^{2} - 4 \\cdot 2 \\pi \\cdot -S\\right)^{\\frac{1}{2}}}{4 \\pi}", 2},
+		{families + 211, "", 0},
+		{families + 211, "", 1},
+		{families + 211, "", 3},
+		{families + 211, "r = \\frac{-\\pi \\cdot l}{2 \\pi} \\pm \\frac{\\left(\\left(\\pi \\cdot l\\right)^{2} - 4 \\cdot \\pi \\cdot -S\\right)^{\\frac{1}{2}}}{2 \\pi}", 2},
+		{families + 212, "", 0},
+		{families + 212, "", 1},
+		{families + 213, "", 0},
+		{families + 213, "", 1},
+		{families + 213, "", 2},
+		{families + 214, "", 0},
+		{families + 214, "", 1},
+		{families + 214, "", 3},
+		{families + 214, "", 2},
+		{families + 215, "", 0},
+		{families + 215, "", 1},
+		{families + 215, "", 3},
+		{families + 215, "", 2},
+		{families + 216, "", 0},
+		{families + 216, "", 1},
+		{families + 217, "", 0},
+		{families + 217, "", 3},
+		{families + 217, "", 1},
+		{families + 217, "", 2},
+		{families + 218, "", 1},
+		{families + 218, "", 0},
+		{families + 218, "", 2},
+		{families + 219, "", 0},
+		{families + 219, "", 1},
+		{families + 219, "", 2},
+		{families + 219, "", 3},
+		{families + 219, "", 4},
+		{families + 220, "", 2},
+		{families + 220, "", 0},
+		{families + 220, "", 1},
+		{families + 220, "", 3},
+		{families + 221, "", 3},
+		{families + 221, "", 0},
+		{families + 221, "", 1},
+		{families + 221, "", 2},
+		{families + 222, "", 1},
+		{families + 222, "", 0},
+		{families + 222, "", 2},
+		{families + 222, "", 3},
+		{families + 223, "", 4},
+		{families + 223, "", 1},
+		{families + 223, "", 3},
+		{families + 223, "", 0},
+		{families + 223, "", 2},
+		{families + 224, "", 2},
+		{families + 224, "", 3},
+		{families + 224, "", 0},
+		{families + 224, "", 4},
+		{families + 224, "", 1},
+		{families + 225, "", 4},
+		{families + 225, "", 0},
+		{families + 225, "", 1},
+		{families + 225, "", 2},
+		{families + 225, "", 3},
+		{families + 226, "", 2},
+		{families + 226, "", 1},
+		{families + 226, "", 0},
+		{families + 227, "", 1},
+		{families + 227, "", 2},
+		{families + 227, "", 0},
+		{families + 227, "", 3},
+		{families + 227, "", 4},
+		{families + 227, "", 5},
+		{families + 227, "", 6},
+		{families + 228, "", 3},
+		{families + 228, "", 4},
+		{families + 228, "", 2},
+		{families + 228, "", 0},
+		{families + 228, "", 1},
+		{families + 229, "", 3},
+		{families + 229, "", 2},
+		{families + 229, "", 0},
+		{families + 229, "", 1},
+		{families + 230, "", 2},
+		{families + 230, "", 1},
+		{families + 230, "", 0},
+		{families + 231, "", 3},
+		{families + 231, "", 0},
+		{families + 231, "", 4},
+		{families + 231, "", 1},
+		{families + 231, "", 2},
+		{families + 232, "", 1},
+		{families + 232, "", 0},
+		{families + 232, "", 2},
+		{families + 232, "", 3},
+		{families + 232, "", 4},
+		{families + 233, "", 2},
+		{families + 233, "E = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{2 m}}{K}", Formula::no_solve_for},
+		{families + 233, "K = \\frac{\\frac{q^{2} \\cdot B^{2} \\cdot r^{2}}{2 m}}{E}", Formula::no_solve_for},
+		{families + 233, "", 4},
+		{families + 233, "", 1},
+		{families + 233, "", 3},
+		{families + 234, "", 2},
+		{families + 234, "", 0},
+		{families + 234, "", 1},
+		{families + 235, "", 0},
+		{families + 235, "", 1},
+		{families + 235, "", 2},
+		{families + 236, "", 0},
+		{families + 236, "", 1},
+		{families + 237, "\\rho = \\rho_0", 0},
+		{families + 237, "\\rho_0 = \\rho", 1},
+		{families + 238, "", 1},
+		{families + 238, "", 0},
+		{families + 238, "", 2},
+		{families + 239, "", 1},
+		{families + 239, "", 0},
+		{families + 239, "", 2},
+		{families + 240, "", 2},
+		{families + 240, "", 0},
+		{families + 240, "", 1},
+		{families + 240, "", 3},
+		{families + 241, "R_1 = R_eq - R_n - \\cdots - R_2", 1},
+		{families + 241, "R_2 = R_eq - R_n - \\cdots - R_1", 2},
+		{families + 241, "R_eq = R_1 + R_2 + \\cdots + R_n", Formula::no_solve_for},
+		{families + 241, "R_n = R_eq - \\left(R_1 + R_2 + \\cdots\\right)", Formula::no_solve_for},
+		{families + 241, "\\cdots = R_eq - R_n - \\left(R_1 + R_2\\right)", Formula::no_solve_for},
+		{families + 242, "R_1 = \\frac{1}{\\frac{1}{R_eq} - \\frac{1}{R_n} - \\cdots - \\frac{1}{R_2}}", 1},
+		{families + 242, "R_2 = \\frac{1}{\\frac{1}{R_eq} - \\frac{1}{R_n} - \\cdots - \\frac{1}{R_1}}", 2},
+		{families + 242, "R_eq = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2} + \\cdots + \\frac{1}{R_n}}", Formula::no_solve_for},
+		{families + 242, "R_n = \\frac{1}{\\frac{1}{R_eq} - \\left(\\frac{1}{R_1} + \\frac{1}{R_2} + \\cdots\\right)}", Formula::no_solve_for},
+		{families + 242, "\\cdots = \\frac{1}{R_eq} - \\frac{1}{R_n} - \\left(\\frac{1}{R_1} + \\frac{1}{R_2}\\right)", Formula::no_solve_for},
+		{families + 243, "", 3},
+		{families + 243, "", 4},
+		{families + 243, "", 2},
+		{families + 243, "V_total = \\frac{V_x}{\\frac{R_x}{R_1 + R_2}}", Formula::no_solve_for},
+		{families + 243, "", 0},
+		{families + 244, "I_total = \\frac{I_x}{\\frac{R_other}{R_1 + R_2}}", Formula::no_solve_for},
+		{families + 244, "", 0},
+		{families + 244, "", 3},
+		{families + 244, "", 4},
+		{families + 244, "R_other = \\frac{I_x}{I_total} \\cdot \\left(R_1 + R_2\\right)", Formula::no_solve_for},
+		{families + 245, "", 1},
+		{families + 245, "", 2},
+		{families + 245, "", 0},
+		{families + 246, "Q_max = \\frac{q \\cdot t}{1 - e^{\\frac{-t}{\\tau}}}", Formula::no_solve_for},
+		{families + 246, "", 3},
+		{families + 246, "e = \\left(1 - \\frac{q \\cdot t}{Q_max}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", Formula::no_solve_for},
+		{families + 246, "q = \\frac{Q_max \\cdot \\left(1 - e^{\\frac{-t}{\\tau}}\\right)}{t}", Formula::no_solve_for},
+		{families + 247, "", 1},
+		{families + 247, "", 3},
+		{families + 247, "e = \\left(\\frac{q \\cdot t}{Q_0}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", Formula::no_solve_for},
+		{families + 247, "q = \\frac{Q_0 \\cdot e^{\\frac{-t}{\\tau}}}{t}", Formula::no_solve_for},
+		{families + 248, "I = \\frac{\\frac{\\varepsilon}{R} \\cdot e^{\\frac{-t}{\\tau}}}{t}", Formula::no_solve_for},
+		{families + 248, "", 2},
+		{families + 248, "", 4},
+		{families + 248, "", 1},
+		{families + 248, "e = \\left(\\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)^{\\frac{1}{\\frac{-t}{\\tau}}}", Formula::no_solve_for},
+		{families + 249, "", 1},
+		{families + 249, "", 2},
+		{families + 249, "", 0},
+		{families + 250, "I = \\frac{\\frac{\\varepsilon}{R} \\cdot \\left(1 - e^{\\frac{-t}{\\tau_L}}\\right)}{t}", Formula::no_solve_for},
+		{families + 250, "", 2},
+		{families + 250, "", 4},
+		{families + 250, "", 1},
+		{families + 250, "e = \\left(1 - \\frac{I \\cdot t}{\\frac{\\varepsilon}{R}}\\right)^{\\frac{1}{\\frac{-t}{\\tau_L}}}", Formula::no_solve_for},
+		{families + 251, "I = \\frac{I_0 \\cdot e^{\\frac{-t}{\\tau_L}}}{t}", Formula::no_solve_for},
+		{families + 251, "", 1},
+		{families + 251, "", 3},
+		{families + 251, "e = \\left(\\frac{I \\cdot t}{I_0}\\right)^{\\frac{1}{\\frac{-t}{\\tau_L}}}", Formula::no_solve_for},
+		{families + 252, "", 0},
+		{families + 252, "\\pi = \\frac{A}{r_2^{2} - r_1^{2}}", Formula::no_solve_for},
+		{families + 252, "", 2},
+		{families + 252, "", 1},
+		{families + 253, "", 1},
+		{families + 253, "", 2},
+		{families + 253, "V_vol = A \\cdot L", Formula::no_solve_for},
+		{families + 254, "V_vol = \\frac{m}{\\rho_d}", Formula::no_solve_for},
+		{families + 254, "\\rho_d = \\frac{m}{V_vol}", Formula::no_solve_for},
+		{families + 254, "", 0},
+		{families + 255, "", 1},
+		{families + 255, "", 0},
+		{families + 255, "", 2},
+		{families + 256, "", 1},
+		{families + 256, "", 0},
+		{families + 256, "", 2},
+		{families + 256, "", 3},
+		{families + 257, "", 1},
+		{families + 257, "", 2},
+		{families + 257, "", 3},
+		{families + 257, "", 0},
+		{families + 258, "", 4},
+		{families + 258, "", 0},
+		{families + 258, "", 1},
+		{families + 258, "", 2},
+		{families + 258, "", 3},
+		{families + 259, "C_1 = \\frac{1}{\\frac{1}{C_eq} - \\cdots - \\frac{1}{C_2}}", 1},
+		{families + 259, "C_2 = \\frac{1}{\\frac{1}{C_eq} - \\cdots - \\frac{1}{C_1}}", 2},
+		{families + 259, "C_eq = \\frac{1}{\\frac{1}{C_1} + \\frac{1}{C_2} + \\cdots}", Formula::no_solve_for},
+		{families + 259, "\\cdots = \\frac{1}{C_eq} - \\left(\\frac{1}{C_1} + \\frac{1}{C_2}\\right)", Formula::no_solve_for},
+		{families + 260, "C_1 = C_eq - \\cdots - C_2", 1},
+		{families + 260, "C_2 = C_eq - \\cdots - C_1", 2},
+		{families + 260, "C_eq = C_1 + C_2 + \\cdots", Formula::no_solve_for},
+		{families + 260, "\\cdots = C_eq - \\left(C_1 + C_2\\right)", Formula::no_solve_for},
+		{families + 261, "", 2},
+		{families + 261, "", 0},
+		{families + 261, "", 1},
+		{families + 261, "", 3},
+		{families + 262, "", 3},
+		{families + 262, "", 0},
+		{families + 262, "", 1},
+		{families + 262, "", 2},
+		{families + 262, "", 4},
+		{families + 263, "", 2},
+		{families + 263, "", 4},
+		{families + 263, "", 1},
+		{families + 263, "\\pi = \\frac{\\frac{\\mu_0 \\cdot I}{\\frac{d \\cdot \\vec{B}}{\\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}}}}{4}", Formula::no_solve_for},
+		{families + 263, "\\vec{B} = \\frac{\\frac{\\mu_0 \\cdot I}{4 \\pi} \\cdot \\frac{d \\cdot \\vec{l} \\cdot \\hat{r}}{r^{2}}}{d}", Formula::no_solve_for},
+		{families + 263, "\\vec{l} = \\frac{\\frac{\\frac{d \\cdot \\vec{B}}{\\frac{\\mu_0 \\cdot I}{4 \\pi}} \\cdot r^{2}}{\\hat{r}}}{d}", Formula::no_solve_for},
+		{families + 263, "", 5},
+		{families + 264, "I_enc = \\frac{\\oint \\cdot \\vec{B} \\cdot d \\cdot \\vec{l}}{\\mu_0}", Formula::no_solve_for},
+		{families + 264, "", 2},
+		{families + 264, "\\oint = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_enc}{\\vec{l}}}{d}}{\\vec{B}}", Formula::no_solve_for},
+		{families + 264, "", 0},
+		{families + 264, "\\vec{l} = \\frac{\\mu_0 \\cdot I_enc}{\\oint \\cdot \\vec{B} \\cdot d}", Formula::no_solve_for},
+		{families + 264, "d = \\frac{\\frac{\\mu_0 \\cdot I_enc}{\\vec{l}}}{\\oint \\cdot \\vec{B}}", Formula::no_solve_for},
+		{families + 265, "\\Phi_B = \\int \\cdot \\vec{B} \\cdot d \\cdot \\vec{A}", 0},
+		{families + 265, "\\int = \\frac{\\frac{\\frac{\\Phi_B}{\\vec{A}}}{d}}{\\vec{B}}", Formula::no_solve_for},
+		{families + 265, "\\vec{A} = \\frac{\\Phi_B}{\\int \\cdot \\vec{B} \\cdot d}", Formula::no_solve_for},
+		{families + 265, "\\vec{B} = \\frac{\\frac{\\frac{\\Phi_B}{\\vec{A}}}{d}}{\\int}", Formula::no_solve_for},
+		{families + 265, "d = \\frac{\\frac{\\Phi_B}{\\vec{A}}}{\\int \\cdot \\vec{B}}", Formula::no_solve_for},
+		{families + 266, "", 1},
+		{families + 266, "", 0},
+		{families + 266, "", 2},
+		{families + 267, "", 1},
+		{families + 267, "", 2},
+		{families + 267, "", 0},
+		{families + 267, "", 3},
+		{families + 268, "", 1},
+		{families + 268, "\\varepsilon_induced = -\\frac{d \\cdot \\Phi_B}{d \\cdot t}", Formula::no_solve_for},
+		{families + 268, "", 2},
+		{families + 269, "", 1},
+		{families + 269, "", 2},
+		{families + 269, "", 0},
+		{families + 269, "", 3},
+		{families + 270, "", 2},
+		{families + 270, "", 1},
+		{families + 270, "", 0},
+		{families + 270, "", 3},
+		{families + 271, "", 0},
+		{families + 271, "V_vol = \\frac{L}{\\mu_0 \\cdot n^{2}}", Formula::no_solve_for},
+		{families + 271, "", 1},
+		{families + 271, "", 5},
+		{families + 272, "", 2},
+		{families + 272, "", 1},
+		{families + 272, "", 0},
+		{families + 272, "", 3},
+		{families + 273, "", 0},
+		{families + 273, "", 4},
+		{families + 273, "", 1},
+		{families + 273, "", 2},
+		{families + 273, "", 3},
+		{families + 274, "", 1},
+		{families + 274, "", 2},
+		{families + 274, "", 0},
+		{families + 275, "", 0},
+		{families + 275, "", 2},
+		{families + 275, "", 1},
+		{families + 275, "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I}{\\frac{B}{\\sin\\left(\\theta_1\\right) + \\sin\\left(\\theta_2\\right)}}}{r}}{4}", Formula::no_solve_for},
+		{families + 275, "", 4},
+		{families + 275, "", 5},
+		{families + 275, "", 3},
+		{families + 276, "", 3},
+		{families + 276, "", 0},
+		{families + 276, "", 2},
+		{families + 276, "", 1},
+		{families + 277, "", 4},
+		{families + 277, "", 2},
+		{families + 277, "", 0},
+		{families + 277, "", 3},
+		{families + 277, "", 1},
+		{families + 278, "B = \\frac{\\omega \\cdot m}{q}", 2},
+		{families + 278, "\\omega = \\frac{q \\cdot B}{m}", 0},
+		{families + 278, "m = \\frac{q \\cdot B}{\\omega}", 3},
+		{families + 278, "q = \\frac{\\omega \\cdot m}{B}", 1},
+		{families + 279, "", 1},
+		{families + 279, "", 3},
+		{families + 279, "", 0},
+		{families + 279, "", 2},
+		{families + 280, "", 3},
+		{families + 280, "", 2},
+		{families + 280, "", 1},
+		{families + 280, "", 0},
+		{families + 281, "", 2},
+		{families + 281, "", 1},
+		{families + 281, "", 0},
+		{families + 282, "", 3},
+		{families + 282, "", 4},
+		{families + 282, "", 2},
+		{families + 282, "", 1},
+		{families + 282, "", 0},
+		{families + 282, "", 5},
+		{families + 283, "", 0},
+		{families + 283, "", 2},
+		{families + 283, "", 1},
+		{families + 284, "", 2},
+		{families + 284, "", 1},
+		{families + 284, "", 0},
+		{families + 284, "", 3},
+		{families + 284, "", 4},
+		{families + 284, "", 5},
+		{families + 285, "T = \\frac{p}{v_\\parallel}", 5},
+		{families + 285, "p = v_\\parallel \\cdot T", 0},
+		{families + 285, "v_\\parallel = \\frac{p}{T}", Formula::no_solve_for},
+		{families + 286, "", 1},
+		{families + 286, "", 3},
+		{families + 286, "\\vec{F} = \\frac{I \\cdot d \\cdot \\vec{l} \\cdot \\vec{B}}{d}", Formula::no_solve_for},
+		{families + 286, "\\vec{l} = \\frac{\\frac{d \\cdot \\vec{F}}{\\vec{B}}}{I \\cdot d}", Formula::no_solve_for},
+		{families + 287, "", 2},
+		{families + 287, "", 0},
+		{families + 287, "", 4},
+		{families + 287, "", 1},
+		{families + 287, "", 3},
+		{families + 288, "", 3},
+		{families + 288, "", 2},
+		{families + 288, "", 1},
+		{families + 288, "", 0},
+		{families + 288, "", 4},
+		{families + 289, "", 2},
+		{families + 289, "L = \\frac{\\varepsilon}{v \\cdot B \\cdot \\sin\\left(\\theta\\right)}", Formula::no_solve_for},
+		{families + 289, "", 3},
+		{families + 289, "\\varepsilon = v \\cdot B \\cdot \\sin\\left(\\theta\\right) \\cdot L", Formula::no_solve_for},
+		{families + 289, "", 1},
+		{families + 290, "B = \\frac{\\frac{F}{\\mu} \\cdot d \\cdot z}{d}", Formula::no_solve_for},
+		{families + 290, "", 0},
+		{families + 290, "", 1},
+		{families + 290, "z = \\frac{\\frac{d \\cdot B}{\\frac{F}{\\mu}}}{d}", Formula::no_solve_for},
+		{families + 291, "", 0},
+		{families + 291, "W = \\frac{E \\cdot d \\cdot q}{d}", Formula::no_solve_for},
+		{families + 291, "q = \\frac{\\frac{d \\cdot W}{E}}{d}", Formula::no_solve_for},
+		{families + 292, "", 2},
+		{families + 292, "", 0},
+		{families + 292, "", 1},
+		{families + 293, "", 1},
+		{families + 293, "V_ab = E", Formula::no_solve_for},
+		{families + 294, "", 1},
+		{families + 294, "", 2},
+		{families + 294, "V_ab = E - I \\cdot r", Formula::no_solve_for},
+		{families + 294, "", 3},
+		{families + 295, "", 1},
+		{families + 295, "", 2},
+		{families + 295, "V_ab = E + I \\cdot r", Formula::no_solve_for},
+		{families + 295, "", 3},
+		{families + 296, "", 0},
+		{families + 296, "I = -\\frac{E}{-r - R}", 1},
+		{families + 296, "", 3},
+		{families + 296, "", 2},
+		{families + 297, "", 1},
+		{families + 297, "", 0},
+		{families + 297, "", 2},
+		{families + 297, "", 3},
+		{families + 298, "", 1},
+		{families + 298, "q = \\frac{I \\cdot d \\cdot t}{d}", Formula::no_solve_for},
+		{families + 298, "t = \\frac{d \\cdot q}{I \\cdot d}", Formula::no_solve_for},
+		{families + 299, "U = \\frac{d \\cdot q \\cdot V_ab}{d}", Formula::no_solve_for},
+		{families + 299, "V_ab = \\frac{d \\cdot U}{d \\cdot q}", Formula::no_solve_for},
+		{families + 299, "q = \\frac{\\frac{d \\cdot U}{V_ab}}{d}", Formula::no_solve_for},
+		{families + 300, "", 1},
+		{families + 300, "I = \\frac{E}{2 r} \\pm \\frac{\\left(E^{2} - 4 \\cdot r \\cdot P_out\\right)^{\\frac{1}{2}}}{2 r}", 2},
+		{families + 300, "P_out = E \\cdot I - I^{2} \\cdot r", Formula::no_solve_for},
+		{families + 300, "", 3},
+		{families + 301, "", 1},
+		{families + 301, "", 0},
+		{families + 301, "", 2},
+		{families + 302, "", 1},
+		{families + 302, "I = \\frac{-E}{2 r} \\pm \\frac{\\left(E^{2} - 4 \\cdot r \\cdot -P_in\\right)^{\\frac{1}{2}}}{2 r}", 2},
+		{families + 302, "P_in = E \\cdot I + I^{2} \\cdot r", Formula::no_solve_for},
+		{families + 302, "", 3},
+		{families + 303, "", 2},
+		{families + 303, "", 0},
+		{families + 303, "V_ab = \\frac{P}{I}", Formula::no_solve_for},
+		{families + 304, "P_out = \\eta \\cdot P_total", Formula::no_solve_for},
+		{families + 304, "P_total = \\frac{P_out}{\\eta}", Formula::no_solve_for},
+		{families + 304, "", 0},
+		{families + 305, "R_load = r", Formula::no_solve_for},
+		{families + 305, "", 1},
+		{families + 306, "", 1},
+		{families + 306, "P_max = \\frac{E^{2}}{4 r}", Formula::no_solve_for},
+		{families + 306, "", 2},
+		{families + 307, "", 2},
+		{families + 307, "", 0},
+		{families + 307, "", 3},
+		{families + 307, "", 1},
+		{families + 308, "", 4},
+		{families + 308, "", 2},
+		{families + 308, "", 3},
+		{families + 308, "", 1},
+		{families + 308, "", 0},
+		{families + 309, "", 5},
+		{families + 309, "", 0},
+		{families + 309, "", 3},
+		{families + 309, "", 4},
+		{families + 309, "", 1},
+		{families + 309, "", 2},
+		{families + 310, "", 0},
+		{families + 310, "", 4},
+		{families + 310, "", 3},
+		{families + 310, "", 1},
+		{families + 310, "", 2},
+		{families + 311, "\\sigma = \\frac{n \\cdot e^{2} \\cdot \\tau}{m}", 0},
+		{families + 311, "\\tau = \\frac{\\sigma \\cdot m}{n \\cdot e^{2}}", 3},
+		{families + 311, "e = \\pm \\left(\\frac{\\frac{\\sigma \\cdot m}{\\tau}}{n}\\right)^{\\frac{1}{2}}", 2},
+		{families + 311, "m = \\frac{n \\cdot e^{2} \\cdot \\tau}{\\sigma}", 4},
+		{families + 311, "n = \\frac{\\frac{\\sigma \\cdot m}{\\tau}}{e^{2}}", 1},
+		{families + 312, "", 3},
+		{families + 312, "", 5},
+		{families + 312, "", 4},
+		{families + 312, "", 2},
+		{families + 312, "t = \\frac{v_0 + \\frac{q \\cdot E}{m} \\cdot \\tau}{v}", Formula::no_solve_for},
+		{families + 312, "v = \\frac{v_0 + \\frac{q \\cdot E}{m} \\cdot \\tau}{t}", Formula::no_solve_for},
+		{families + 312, "", 1},
+		{families + 313, "", 0},
+		{families + 313, "", 2},
+		{families + 313, "", 1},
+		{families + 314, "\\mu_e = \\frac{q \\cdot \\tau}{m}", 0},
+		{families + 314, "\\tau = \\frac{\\mu_e \\cdot m}{q}", 2},
+		{families + 314, "m = \\frac{q \\cdot \\tau}{\\mu_e}", 3},
+		{families + 314, "q = \\frac{\\mu_e \\cdot m}{\\tau}", 1},
+		{families + 315, "\\mu_e = \\frac{\\sigma}{n \\cdot q}", 3},
+		{families + 315, "\\sigma = n \\cdot q \\cdot \\mu_e", 0},
+		{families + 315, "n = \\frac{\\frac{\\sigma}{\\mu_e}}{q}", 1},
+		{families + 315, "q = \\frac{\\frac{\\sigma}{\\mu_e}}{n}", 2},
+		{families + 316, "", 1},
+		{families + 316, "", 0},
+		{families + 316, "", 2},
+		{families + 317, "\\Delta U_net = \\sum \\cdot \\Delta V", Formula::no_solve_for},
+		{families + 317, "\\Delta V = \\frac{\\Delta U_net}{\\sum}", 1},
+		{families + 317, "\\sum = \\frac{\\Delta U_net}{\\Delta V}", Formula::no_solve_for},
+		{families + 318, "", 1},
+		{families + 318, "", 2},
+		{families + 318, "E_total = E_1 + E_2", Formula::no_solve_for},
+		{families + 319, "", 1},
+		{families + 319, "", 2},
+		{families + 319, "E_total = E_1 - E_2", Formula::no_solve_for},
+		{families + 320, "\\cdots = r_total - \\left(r_1 + r_2\\right)", Formula::no_solve_for},
+		{families + 320, "r_1 = r_total - \\cdots - r_2", 1},
+		{families + 320, "r_2 = r_total - \\cdots - r_1", 2},
+		{families + 320, "r_total = r_1 + r_2 + \\cdots", Formula::no_solve_for},
+		{families + 321, "H = -\\frac{-14}{\\text \\cdot p + \\text \\cdot p \\cdot O}", Formula::no_solve_for},
+		{families + 321, "O = \\frac{\\frac{\\frac{14 - \\text \\cdot p \\cdot H}{\\text}}{H}}{p}", Formula::no_solve_for},
+		{families + 321, "\\text = -\\frac{-14}{p \\cdot H + p \\cdot O \\cdot H}", Formula::no_solve_for},
+		{families + 321, "p = -\\frac{-14}{\\text \\cdot H + \\text \\cdot H \\cdot O}", Formula::no_solve_for},
+		{families + 322, "H = -\\frac{-14}{\\text \\cdot p \\cdot O + \\text \\cdot p}", Formula::no_solve_for},
+		{families + 322, "\\text = -\\frac{-14}{p \\cdot O \\cdot H + p \\cdot H}", Formula::no_solve_for},
+		{families + 322, "p = -\\frac{-14}{\\text \\cdot H \\cdot O + \\text \\cdot H}", Formula::no_solve_for},
+		{families + 323, "K = 0", Formula::no_solve_for},
+		{families + 323, "\\text = 0", Formula::no_solve_for},
+		{families + 323, "p = 0", Formula::no_solve_for},
+		{families + 324, "K = \\frac{\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{-\\text}}{p}", Formula::no_solve_for},
+		{families + 324, "K_a = 10^{-\\text \\cdot p \\cdot K}", 0},
+		{families + 324, "\\text = -\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{p \\cdot K}", Formula::no_solve_for},
+		{families + 324, "p = \\frac{\\frac{\\frac{\\ln\\left(K_a\\right)}{2.302585092994046}}{-\\text}}{K}", Formula::no_solve_for},
+		{families + 325, "K = \\frac{\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{-\\text}}{p}", Formula::no_solve_for},
+		{families + 325, "K_b = 10^{-\\text \\cdot p \\cdot K}", 0},
+		{families + 325, "\\text = -\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{p \\cdot K}", Formula::no_solve_for},
+		{families + 325, "p = \\frac{\\frac{\\frac{\\ln\\left(K_b\\right)}{2.302585092994046}}{-\\text}}{K}", Formula::no_solve_for},
+		{families + 326, "H = \\frac{\\frac{\\text \\cdot p \\cdot K}{\\text}}{p}", Formula::no_solve_for},
+		{families + 326, "K = \\frac{\\frac{\\text \\cdot p \\cdot H}{\\text}}{p}", Formula::no_solve_for},
+		{families + 327, "", 2},
+		{families + 327, "", 3},
+		{families + 327, "", 1},
+		{families + 328, "", 3},
+		{families + 328, "", 4},
+		{families + 328, "", 0},
+		{families + 329, "", 1},
+		{families + 329, "", 2},
+		{families + 330, "", 1},
+		{families + 331, "", 1},
+		{families + 332, "\\% = \\frac{m_component}{m_total} \\cdot 100", Formula::no_solve_for},
+		{families + 332, "m_component = \\frac{\\%}{100} \\cdot m_total", Formula::no_solve_for},
+		{families + 332, "m_total = \\frac{m_component}{\\frac{\\%}{100}}", Formula::no_solve_for},
+		{families + 333, "\\% = \\frac{m_component \\cdot 100}{m_total}", Formula::no_solve_for},
+		{families + 333, "m_component = \\frac{\\% \\cdot m_total}{100}", Formula::no_solve_for},
+		{families + 333, "m_total = \\frac{m_component \\cdot 100}{\\%}", Formula::no_solve_for},
+		{families + 334, "\\% = \\frac{100 m_component}{m_total}", Formula::no_solve_for},
+		{families + 334, "m_component = \\frac{m_total \\cdot \\%}{100}", Formula::no_solve_for},
+		{families + 334, "m_total = \\frac{100 m_component}{\\%}", Formula::no_solve_for},
+		{families + 335, "E_anode = E_cathode - E_cell", Formula::no_solve_for},
+		{families + 335, "E_cathode = E_cell + E_anode", Formula::no_solve_for},
+		{families + 335, "E_cell = E_cathode - E_anode", Formula::no_solve_for},
+		{families + 336, "E_cathode = E_anode + E_cell", Formula::no_solve_for},
+		{families + 337, "", 5},
+		{families + 337, "", 6},
+		{families + 337, "", 2},
+		{families + 337, "", 3},
+		{families + 337, "\\circ = \\frac{\\ln\\left(E + \\frac{R \\cdot T}{n \\cdot F} \\cdot \\ln\\left(Q\\right)\\right)}{\\ln\\left(E\\right)}", Formula::no_solve_for},
+		{families + 337, "", 4},
+		{families + 338, "", 4},
+		{families + 338, "", 2},
+		{families + 338, "", 1},
+		{families + 338, "", 0},
+		{families + 338, "", 3},
+		{families + 339, "", 3},
+		{families + 339, "", 1},
+		{families + 339, "", 2},
+		{families + 340, "", 1},
+		{families + 341, "", 0},
+		{families + 341, "", 3},
+		{families + 341, "\\Delta G = -E \\cdot n \\cdot F", Formula::no_solve_for},
+		{families + 341, "", 2},
+		{families + 342, "", 1},
+		{families + 342, "", 0},
+		{families + 342, "", 2},
+		{families + 342, "", 3},
+		{families + 342, "\\Delta n = \\frac{\\ln\\left(\\frac{K_p}{K_c}\\right)}{\\ln\\left(R \\cdot T\\right)}", Formula::no_solve_for},
+		{families + 343, "A = \\exp\\left(\\ln\\left(k\\right) + \\frac{E_a}{R \\cdot T}\\right)", Formula::no_solve_for},
+		{families + 343, "", 2},
+		{families + 343, "", 3},
+		{families + 343, "", 4},
+		{families + 343, "k = \\exp\\left(\\ln\\left(A\\right) - \\frac{E_a}{R \\cdot T}\\right)", Formula::no_solve_for},
+		{families + 344, "", 1},
+		{families + 344, "t_\\frac{1}{2} = \\frac{0.693}{k}", Formula::no_solve_for},
+		{families + 345, "k = \\frac{1}{t_\\frac{1}{2}}", 1},
+		{families + 345, "t_\\frac{1}{2} = \\frac{1}{k}", Formula::no_solve_for},
+		{families + 346, "", 1},
+		{families + 347, "", 1},
+		{families + 347, "", 2},
+		{families + 348, "", 1},
+		{families + 348, "", 2},
+		{families + 349, "a = 0", Formula::no_solve_for},
+		{families + 349, "m = 0", Formula::no_solve_for},
+		{families + 349, "s = 0", Formula::no_solve_for},
+		{families + 350, "\\text = \\frac{\\frac{100 m_solute}{m_solution}}{m \\cdot a \\cdot s \\cdot s}", Formula::no_solve_for},
+		{families + 350, "a = \\frac{\\frac{\\frac{\\frac{\\frac{100 m_solute}{m_solution}}{\\text}}{s}}{s}}{m}", Formula::no_solve_for},
+		{families + 350, "m = \\frac{\\frac{\\frac{\\frac{\\frac{100 m_solute}{m_solution}}{\\text}}{s}}{s}}{a}", Formula::no_solve_for},
+		{families + 350, "m_solute = \\frac{m_solution \\cdot \\text \\cdot m \\cdot a \\cdot s \\cdot s}{100}", Formula::no_solve_for},
+		{families + 350, "m_solution = \\frac{100 m_solute}{\\text \\cdot m \\cdot a \\cdot s \\cdot s}", Formula::no_solve_for},
+		{families + 351, "", 0},
+		{families + 351, "", 1},
+		{families + 351, "n_total = \\frac{n_A}{X_A}", Formula::no_solve_for},
+		{families + 352, "", 1},
+		{families + 353, "H_products = \\Delta H + H_reactants", Formula::no_solve_for},
+		{families + 353, "H_reactants = H_products - \\Delta H", Formula::no_solve_for},
+		{families + 353, "\\Delta H = H_products - H_reactants", Formula::no_solve_for},
+		{families + 354, "H_products = H_reactants + \\Delta H", Formula::no_solve_for},
+		{families + 355, "\\Delta H = T \\cdot \\Delta S + \\Delta G", Formula::no_solve_for},
+		{families + 356, "\\Delta G = \\Delta H - \\Delta S \\cdot T", Formula::no_solve_for},
+		{families + 356, "\\Delta H = \\Delta S \\cdot T + \\Delta G", Formula::no_solve_for},
+		{families + 357, "", 3},
+		{families + 357, "", 1},
+		{families + 357, "", 2},
+		{families + 357, "\\Delta G = -R \\cdot T \\cdot \\ln\\left(K\\right)", Formula::no_solve_for},
+		{families + 358, "", 0},
+		{families + 358, "", 2},
+		{families + 358, "", 3},
+		{families + 358, "\\Delta G = -\\frac{\\frac{\\ln\\left(K\\right)}{\\ln\\left(e\\right)}}{T} \\cdot R", Formula::no_solve_for},
+		{families + 358, "e = K^{\\frac{1}{\\frac{-\\Delta G}{R} \\cdot T}}", Formula::no_solve_for},
+		{families + 359, "", 3},
+		{families + 359, "", 2},
+		{families + 359, "", 0},
+		{families + 359, "\\Delta G = -T \\cdot R \\cdot \\ln\\left(K\\right)", Formula::no_solve_for},
+		{families + 360, "", 1},
+		{families + 361, "", 1},
+		{families + 362, "", 0},
+		{families + 363, "", 1},
+		{families + 364, "", 0},
+		{families + 365, "", 1},
+		{families + 366, "R_total = R_2 + R_1", Formula::no_solve_for},
+		{families + 367, "", 1},
+		{families + 367, "", 2},
+		{families + 367, "R_total = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2}}", Formula::no_solve_for},
+		{families + 368, "", 3},
+		{families + 368, "", 2},
+		{families + 368, "", 0},
+		{families + 368, "\\rho = \\frac{R}{\\frac{L}{A}}", Formula::no_solve_for},
+		{families + 369, "", 2},
+		{families + 369, "", 3},
+		{families + 369, "", 1},
+		{families + 369, "\\rho = R \\cdot \\frac{A}{L}", Formula::no_solve_for},
+		{families + 370, "", 2},
+		{families + 370, "", 0},
+		{families + 370, "", 1},
+		{families + 370, "\\rho = \\frac{A}{\\frac{L}{R}}", Formula::no_solve_for},
+		{families + 371, "", 0},
+		{families + 371, "", 2},
+		{families + 372, "", 1},
+		{families + 373, "\\tau = C \\cdot R", Formula::no_solve_for},
+		{families + 374, "", 1},
+		{families + 375, "", 4},
+		{families + 375, "", 1},
+		{families + 375, "", 2},
+		{families + 375, "", 3},
+		{families + 375, "", 0},
+		{families + 376, "", 4},
+		{families + 376, "", 0},
+		{families + 376, "", 2},
+		{families + 376, "", 3},
+		{families + 377, "", 1},
+		{families + 378, "", 1},
+		{families + 378, "\\Delta T = \\frac{\\frac{R - R_0}{\\alpha}}{R_0}", Formula::no_solve_for},
+		{families + 378, "\\alpha = \\frac{R - R_0}{R_0 \\cdot \\Delta T}", Formula::no_solve_for},
+		{families + 379, "I_in = \\frac{\\sum \\cdot I_out}{\\sum}", Formula::no_solve_for},
+		{families + 379, "I_out = \\frac{\\sum \\cdot I_in}{\\sum}", Formula::no_solve_for},
+		{families + 380, "V = 0", Formula::no_solve_for},
+		{families + 380, "\\sum = 0", Formula::no_solve_for},
+		{families + 381, "\\varepsilon = I \\cdot r + V", Formula::no_solve_for},
+		{families + 382, "", 2},
+		{families + 382, "\\varepsilon = r \\cdot I + V", Formula::no_solve_for},
+		{families + 383, "", 4},
+		{families + 383, "Q = \\frac{Q_max \\cdot \\left(1 - e^{\\frac{-t}{R} \\cdot C}\\right)}{t}", Formula::no_solve_for},
+		{families + 383, "Q_max = \\frac{Q \\cdot t}{1 - e^{\\frac{-t}{R} \\cdot C}}", Formula::no_solve_for},
+		{families + 383, "", 3},
+		{families + 383, "e = \\left(1 - \\frac{Q \\cdot t}{Q_max}\\right)^{\\frac{1}{\\frac{-t}{R} \\cdot C}}", Formula::no_solve_for},
+		{families + 384, "", 4},
+		{families + 384, "Q = \\frac{Q_0 \\cdot e^{\\frac{-t}{R} \\cdot C}}{t}", Formula::no_solve_for},
+		{families + 384, "", 1},
+		{families + 384, "", 3},
+		{families + 384, "e = \\left(\\frac{Q \\cdot t}{Q_0}\\right)^{\\frac{1}{\\frac{-t}{R} \\cdot C}}", Formula::no_solve_for},
+		{families + 385, "", 1},
+		{families + 385, "", 2},
+		{families + 385, "", 3},
+		{families + 385, "R_total = R_1 + R_2 + R_3", Formula::no_solve_for},
+		{families + 386, "", 1},
+		{families + 386, "", 2},
+		{families + 386, "", 3},
+		{families + 386, "R_total = \\frac{1}{\\frac{1}{R_1} + \\frac{1}{R_2} + \\frac{1}{R_3}}", Formula::no_solve_for},
+		{families + 387, "", 1},
+		{families + 387, "", 2},
+		{families + 387, "", 3},
+		{families + 387, "", 0},
+		{families + 388, "\\theta = t \\cdot \\omega", Formula::no_solve_for},
+		{families + 389, "", 0},
+		{families + 389, "\\omega = \\frac{2 \\pi}{T}", Formula::no_solve_for},
+		{families + 389, "\\pi = \\frac{T \\cdot \\omega}{2}", Formula::no_solve_for},
+		{families + 390, "\\pi = \\frac{\\omega \\cdot T}{2}", Formula::no_solve_for},
+		{families + 391, "", 1},
+		{families + 392, "", 1},
+		{families + 393, "", 1},
+		{families + 394, "", 1},
+		{families + 395, "", 1},
+		{families + 395, "", 2},
+		{families + 395, "", 0},
+		{families + 396, "", 1},
+		{families + 396, "", 2},
+		{families + 397, "", 0},
+		{families + 398, "", 1},
+		{families + 399, "", 0},
+		{families + 399, "\\omega = \\pm \\left(\\frac{\\frac{F_c}{r}}{m}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 399, "", 1},
+		{families + 399, "", 3},
+		{families + 400, "\\omega = \\pm \\left(\\frac{\\frac{F_c}{m}}{r}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 400, "", 0},
+		{families + 400, "", 3},
+		{families + 401, "", 1},
+		{families + 401, "\\omega = \\left(\\frac{F_c}{m \\cdot r}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 401, "", 2},
+		{families + 401, "", 3},
+		{families + 402, "", 1},
+		{families + 403, "", 1},
+		{families + 404, "\\lambda = \\frac{c}{f}", Formula::no_solve_for},
+		{families + 404, "", 0},
+		{families + 404, "", 1},
+		{families + 405, "", 1},
+		{families + 406, "", 1},
+		{families + 407, "", 1},
+		{families + 407, "", 3},
+		{families + 407, "", 0},
+		{families + 407, "", 4},
+		{families + 407, "", 2},
+		{families + 408, "", 1},
+		{families + 408, "", 3},
+		{families + 408, "", 4},
+		{families + 408, "", 0},
+		{families + 408, "", 2},
+		{families + 409, "", 4},
+		{families + 409, "", 1},
+		{families + 409, "", 2},
+		{families + 409, "", 3},
+		{families + 409, "", 0},
+		{families + 410, "", 1},
+		{families + 411, "", 1},
+		{families + 411, "", 3},
+		{families + 411, "", 0},
+		{families + 411, "", 2},
+		{families + 412, "", 3},
+		{families + 412, "", 1},
+		{families + 412, "", 2},
+		{families + 412, "", 0},
+		{families + 413, "", 1},
+		{families + 413, "", 3},
+		{families + 413, "", 0},
+		{families + 413, "", 2},
+		{families + 414, "", 3},
+		{families + 414, "", 1},
+		{families + 414, "", 2},
+		{families + 414, "", 0},
+		{families + 415, "", 1},
+		{families + 416, "", 1},
+		{families + 416, "", 3},
+		{families + 416, "", 0},
+		{families + 416, "", 4},
+		{families + 416, "", 2},
+		{families + 417, "", 4},
+		{families + 417, "", 1},
+		{families + 417, "", 2},
+		{families + 417, "", 3},
+		{families + 417, "", 0},
+		{families + 418, "", 1},
+		{families + 419, "", 0},
+		{families + 419, "", 1},
+		{families + 419, "\\epsilon_0 = \\frac{C \\cdot d}{A}", Formula::no_solve_for},
+		{families + 419, "", 2},
+		{families + 420, "", 2},
+		{families + 420, "", 3},
+		{families + 420, "\\epsilon_0 = \\frac{d}{\\frac{A}{C}}", Formula::no_solve_for},
+		{families + 420, "", 0},
+		{families + 421, "", 0},
+		{families + 421, "", 1},
+		{families + 421, "", 2},
+		{families + 422, "", 1},
+		{families + 422, "", 0},
+		{families + 423, "", 2},
+		{families + 423, "", 0},
+		{families + 423, "", 1},
+		{families + 424, "", 1},
+		{families + 425, "", 1},
+		{families + 426, "", 0},
+		{families + 427, "", 0},
+		{families + 427, "\\epsilon_0 = \\frac{2 u}{E^{2}}", Formula::no_solve_for},
+		{families + 427, "", 1},
+		{families + 428, "", 1},
+		{families + 429, "\\Phi_E = A \\cdot E", Formula::no_solve_for},
+		{families + 430, "Q_enc = \\epsilon_0 \\cdot \\Phi_E", Formula::no_solve_for},
+		{families + 431, "Q = A \\cdot \\sigma", 1},
+		{families + 432, "", 1},
+		{families + 433, "", 1},
+		{families + 434, "\\sigma = 2 \\epsilon_0 \\cdot E", Formula::no_solve_for},
+		{families + 435, "E = \\frac{m \\cdot v^{2}}{2 K}", Formula::no_solve_for},
+		{families + 435, "K = \\frac{\\frac{m \\cdot v^{2}}{E}}{2}", Formula::no_solve_for},
+		{families + 435, "", 0},
+		{families + 435, "", 2},
+		{families + 436, "E = \\frac{v^{2} \\cdot m}{2 K}", Formula::no_solve_for},
+		{families + 436, "K = \\frac{\\frac{v^{2} \\cdot m}{E}}{2}", Formula::no_solve_for},
+		{families + 436, "", 0},
+		{families + 437, "", 2},
+		{families + 437, "", 3},
+		{families + 437, "", 0},
+		{families + 438, "E = \\frac{h \\cdot m \\cdot g}{P}", Formula::no_solve_for},
+		{families + 438, "P = \\frac{h \\cdot m \\cdot g}{E}", Formula::no_solve_for},
+		{families + 439, "E = \\frac{\\frac{1}{2} k \\cdot x^{2}}{P}", Formula::no_solve_for},
+		{families + 439, "P = \\frac{\\frac{1}{2} k \\cdot x^{2}}{E}", Formula::no_solve_for},
+		{families + 439, "", 1},
+		{families + 439, "", 2},
+		{families + 440, "E = \\frac{k \\cdot x^{2}}{2 P}", Formula::no_solve_for},
+		{families + 440, "P = \\frac{\\frac{k \\cdot x^{2}}{E}}{2}", Formula::no_solve_for},
+		{families + 440, "", 0},
+		{families + 440, "", 2},
+		{families + 441, "E = \\frac{x^{2} \\cdot k}{2 P}", Formula::no_solve_for},
+		{families + 441, "P = \\frac{\\frac{x^{2} \\cdot k}{E}}{2}", Formula::no_solve_for},
+		{families + 441, "", 0},
+		{families + 442, "K = \\frac{E - P \\cdot E}{E}", Formula::no_solve_for},
+		{families + 442, "P = \\frac{E - K \\cdot E}{E}", Formula::no_solve_for},
+		{families + 443, "", 1},
+		{families + 444, "", 1},
+		{families + 445, "W_out = W_in \\cdot \\eta", Formula::no_solve_for},
+		{families + 446, "", 1},
+		{families + 447, "\\rho = \\frac{P}{g \\cdot h}", Formula::no_solve_for},
+		{families + 447, "", 2},
+		{families + 447, "", 3},
+		{families + 448, "", 1},
+		{families + 449, "", 0},
+		{families + 449, "", 2},
+		{families + 449, "\\rho = \\frac{\\frac{F_b}{g}}{V}", Formula::no_solve_for},
+		{families + 449, "", 3},
+		{families + 450, "", 2},
+		{families + 450, "\\rho = \\frac{F_b}{V \\cdot g}", Formula::no_solve_for},
+		{families + 450, "", 3},
+		{families + 451, "", 1},
+		{families + 452, "", 1},
+		{families + 452, "", 2},
+		{families + 453, "", 1},
+		{families + 454, "", 1},
+		{families + 454, "", 3},
+		{families + 454, "", 0},
+		{families + 454, "", 4},
+		{families + 454, "", 2},
+		{families + 455, "", 4},
+		{families + 455, "", 1},
+		{families + 455, "", 2},
+		{families + 455, "", 3},
+		{families + 455, "", 0},
+		{families + 456, "", 1},
+		{families + 456, "", 0},
+		{families + 456, "", 2},
+		{families + 456, "", 3},
+		{families + 456, "", 4},
+		{families + 457, "", 1},
+		{families + 457, "", 4},
+		{families + 457, "", 2},
+		{families + 457, "", 3},
+		{families + 457, "", 0},
+		{families + 458, "", 2},
+		{families + 458, "", 1},
+		{families + 459, "", 1},
+		{families + 459, "", 2},
+		{families + 459, "", 3},
+		{families + 460, "", 1},
+		{families + 460, "", 2},
+		{families + 460, "", 3},
+		{families + 460, "v_esc = \\left(\\frac{2 G \\cdot M}{r}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 461, "", 2},
+		{families + 461, "v_esc = \\pm \\left(\\frac{M \\cdot 2 G}{r}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 462, "", 1},
+		{families + 462, "", 2},
+		{families + 462, "v_esc = \\pm \\left(\\frac{2 G \\cdot M}{r}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 463, "", 1},
+		{families + 463, "\\Delta \\Phi = \\frac{\\varepsilon}{N} \\cdot \\Delta t", Formula::no_solve_for},
+		{families + 463, "\\Delta t = \\frac{\\Delta \\Phi}{\\frac{\\varepsilon}{N}}", Formula::no_solve_for},
+		{families + 463, "\\varepsilon = N \\cdot \\frac{\\Delta \\Phi}{\\Delta t}", Formula::no_solve_for},
+		{families + 464, "", 0},
+		{families + 464, "\\Delta \\Phi = \\frac{\\varepsilon \\cdot \\Delta t}{N}", Formula::no_solve_for},
+		{families + 464, "\\Delta t = \\frac{N \\cdot \\Delta \\Phi}{\\varepsilon}", Formula::no_solve_for},
+		{families + 464, "\\varepsilon = \\frac{N \\cdot \\Delta \\Phi}{\\Delta t}", Formula::no_solve_for},
+		{families + 465, "\\Delta t = \\frac{\\Delta \\Phi \\cdot N}{\\varepsilon}", Formula::no_solve_for},
+		{families + 465, "\\varepsilon = \\frac{\\Delta \\Phi \\cdot N}{\\Delta t}", Formula::no_solve_for},
+		{families + 466, "", 1},
+		{families + 466, "\\Delta \\Phi = \\frac{\\Delta t \\cdot \\varepsilon}{N}", Formula::no_solve_for},
+		{families + 467, "", 0},
+		{families + 467, "", 2},
+		{families + 467, "", 3},
+		{families + 468, "", 2},
+		{families + 468, "", 0},
+		{families + 468, "\\varepsilon = L \\cdot B \\cdot v", Formula::no_solve_for},
+		{families + 468, "", 3},
+		{families + 469, "\\varepsilon = v \\cdot B \\cdot L", Formula::no_solve_for},
+		{families + 470, "", 1},
+		{families + 470, "\\Delta I = \\frac{\\varepsilon}{L} \\cdot \\Delta t", Formula::no_solve_for},
+		{families + 470, "\\Delta t = \\frac{\\Delta I}{\\frac{\\varepsilon}{L}}", Formula::no_solve_for},
+		{families + 470, "\\varepsilon = L \\cdot \\frac{\\Delta I}{\\Delta t}", Formula::no_solve_for},
+		{families + 471, "", 0},
+		{families + 471, "\\Delta I = \\frac{\\varepsilon \\cdot \\Delta t}{L}", Formula::no_solve_for},
+		{families + 471, "\\Delta t = \\frac{L \\cdot \\Delta I}{\\varepsilon}", Formula::no_solve_for},
+		{families + 471, "\\varepsilon = \\frac{L \\cdot \\Delta I}{\\Delta t}", Formula::no_solve_for},
+		{families + 472, "\\Delta t = \\frac{\\Delta I \\cdot L}{\\varepsilon}", Formula::no_solve_for},
+		{families + 472, "\\varepsilon = \\frac{\\Delta I \\cdot L}{\\Delta t}", Formula::no_solve_for},
+		{families + 473, "", 1},
+		{families + 473, "\\Delta I = \\frac{\\Delta t \\cdot \\varepsilon}{L}", Formula::no_solve_for},
+		{families + 474, "", 2},
+		{families + 474, "", 0},
+		{families + 474, "", 1},
+		{families + 475, "", 0},
+		{families + 475, "", 1},
+		{families + 476, "", 1},
+		{families + 477, "", 3},
+		{families + 477, "", 1},
+		{families + 477, "\\mu_0 = \\frac{\\frac{\\frac{L}{n^{2}}}{l}}{A}", Formula::no_solve_for},
+		{families + 477, "", 4},
+		{families + 477, "", 0},
+		{families + 478, "", 0},
+		{families + 478, "", 1},
+		{families + 478, "\\mu_0 = \\frac{\\frac{\\frac{L}{A}}{l}}{n^{2}}", Formula::no_solve_for},
+		{families + 478, "", 4},
+		{families + 478, "", 3},
+		{families + 479, "", 1},
+		{families + 480, "", 2},
+		{families + 480, "", 0},
+		{families + 480, "\\omega = \\pm \\left(\\frac{\\frac{1}{L}}{C}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 481, "", 0},
+		{families + 481, "", 2},
+		{families + 481, "\\omega = \\pm \\left(\\frac{\\frac{1}{C}}{L}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 482, "", 1},
+		{families + 482, "", 2},
+		{families + 483, "", 4},
+		{families + 483, "", 2},
+		{families + 483, "", 1},
+		{families + 483, "", 0},
+		{families + 484, "", 0},
+		{families + 484, "", 3},
+		{families + 484, "", 1},
+		{families + 484, "", 2},
+		{families + 485, "", 0},
+		{families + 486, "", 0},
+		{families + 486, "", 1},
+		{families + 486, "", 2},
+		{families + 486, "", 3},
+		{families + 486, "", 4},
+		{families + 487, "", 2},
+		{families + 487, "", 3},
+		{families + 487, "", 0},
+		{families + 488, "", 3},
+		{families + 488, "v_avg = \\frac{x - x_0}{t}", Formula::no_solve_for},
+		{families + 488, "", 1},
+		{families + 488, "", 2},
+		{families + 489, "", 0},
+		{families + 490, "", 1},
+		{families + 490, "", 2},
+		{families + 491, "", 2},
+		{families + 491, "", 0},
+		{families + 492, "v_avg = \\frac{v + v_0}{2}", Formula::no_solve_for},
+		{families + 493, "", 1},
+		{families + 494, "", 2},
+		{families + 494, "", 0},
+		{families + 494, "", 1},
+		{families + 495, "", 1},
+		{families + 496, "", 3},
+		{families + 496, "", 0},
+		{families + 496, "", 2},
+		{families + 497, "", 3},
+		{families + 497, "", 1},
+		{families + 497, "", 2},
+		{families + 497, "", 0},
+		{families + 498, "", 1},
+		{families + 499, "", 0},
+		{families + 499, "", 2},
+		{families + 499, "", 3},
+		{families + 500, "", 2},
+		{families + 500, "", 1},
+		{families + 500, "", 0},
+		{families + 500, "", 3},
+		{families + 501, "", 1},
+		{families + 502, "", 2},
+		{families + 502, "", 0},
+		{families + 502, "\\mu_0 = \\frac{2 \\pi \\cdot r \\cdot B}{I}", Formula::no_solve_for},
+		{families + 502, "\\pi = \\frac{\\frac{\\frac{I \\cdot \\mu_0}{B}}{r}}{2}", Formula::no_solve_for},
+		{families + 502, "", 1},
+		{families + 503, "", 3},
+		{families + 503, "", 2},
+		{families + 503, "\\mu_0 = \\frac{r \\cdot 2 \\pi \\cdot B}{I}", Formula::no_solve_for},
+		{families + 503, "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I}{r}}{B}}{2}", Formula::no_solve_for},
+		{families + 503, "", 0},
+		{families + 504, "", 1},
+		{families + 504, "", 3},
+		{families + 504, "\\mu_0 = \\frac{\\frac{B}{n}}{I}", Formula::no_solve_for},
+		{families + 504, "", 0},
+		{families + 505, "", 1},
+		{families + 506, "", 3},
+		{families + 506, "", 2},
+		{families + 506, "", 1},
+		{families + 507, "", 3},
+		{families + 507, "", 2},
+		{families + 507, "", 1},
+		{families + 508, "", 4},
+		{families + 508, "", 1},
+		{families + 508, "", 0},
+		{families + 508, "", 3},
+		{families + 508, "", 2},
+		{families + 509, "", 0},
+		{families + 509, "", 1},
+		{families + 509, "", 2},
+		{families + 510, "", 2},
+		{families + 510, "", 1},
+		{families + 510, "\\Phi = B \\cdot A", Formula::no_solve_for},
+		{families + 511, "\\Phi = A \\cdot B", Formula::no_solve_for},
+		{families + 512, "", 3},
+		{families + 512, "", 0},
+		{families + 513, "\\pi = \\frac{\\frac{\\frac{B \\cdot q}{f}}{m}}{2}", Formula::no_solve_for},
+		{families + 513, "", 2},
+		{families + 513, "", 1},
+		{families + 514, "", 2},
+		{families + 514, "\\pi = \\frac{\\frac{\\frac{q \\cdot B}{m}}{f}}{2}", Formula::no_solve_for},
+		{families + 514, "", 3},
+		{families + 514, "", 0},
+		{families + 514, "", 1},
+		{families + 515, "", 0},
+		{families + 516, "", 2},
+		{families + 516, "", 1},
+		{families + 516, "", 4},
+		{families + 516, "", 0},
+		{families + 516, "", 3},
+		{families + 516, "", 5},
+		{families + 517, "", 3},
+		{families + 517, "", 1},
+		{families + 517, "", 2},
+		{families + 517, "", 4},
+		{families + 518, "", 0},
+		{families + 518, "I_enc = \\frac{B \\cdot 2 \\pi \\cdot r}{\\mu_0}", Formula::no_solve_for},
+		{families + 518, "\\mu_0 = \\frac{B \\cdot 2 \\pi \\cdot r}{I_enc}", Formula::no_solve_for},
+		{families + 518, "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_enc}{B}}{r}}{2}", Formula::no_solve_for},
+		{families + 518, "", 3},
+		{families + 519, "", 2},
+		{families + 519, "I_enc = \\frac{2 \\pi \\cdot r \\cdot B}{\\mu_0}", Formula::no_solve_for},
+		{families + 519, "\\mu_0 = \\frac{2 \\pi \\cdot r \\cdot B}{I_enc}", Formula::no_solve_for},
+		{families + 519, "\\pi = \\frac{\\frac{\\frac{I_enc \\cdot \\mu_0}{B}}{r}}{2}", Formula::no_solve_for},
+		{families + 519, "", 1},
+		{families + 520, "", 2},
+		{families + 520, "", 1},
+		{families + 520, "\\mu = I \\cdot A", Formula::no_solve_for},
+		{families + 521, "\\mu = A \\cdot I", Formula::no_solve_for},
+		{families + 522, "", 2},
+		{families + 522, "\\mu = \\frac{\\tau}{B}", Formula::no_solve_for},
+		{families + 522, "\\tau = \\mu \\cdot B", Formula::no_solve_for},
+		{families + 523, "\\tau = B \\cdot \\mu", Formula::no_solve_for},
+		{families + 524, "", 2},
+		{families + 524, "", 0},
+		{families + 524, "\\mu = -\\frac{U}{B}", Formula::no_solve_for},
+		{families + 525, "F = \\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d} \\cdot L}{2 \\pi}", Formula::no_solve_for},
+		{families + 525, "", 2},
+		{families + 525, "", 3},
+		{families + 525, "L = \\frac{2 \\pi \\cdot F}{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d}}", Formula::no_solve_for},
+		{families + 525, "\\mu_0 = \\frac{\\frac{d \\cdot \\frac{2 \\pi \\cdot F}{L}}{I_2}}{I_1}", Formula::no_solve_for},
+		{families + 525, "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I_1 \\cdot I_2}{d} \\cdot L}{F}}{2}", Formula::no_solve_for},
+		{families + 525, "", 0},
+		{families + 526, "", 0},
+		{families + 526, "", 2},
+		{families + 526, "\\mu_0 = \\frac{B \\cdot 2 r}{I}", Formula::no_solve_for},
+		{families + 526, "", 3},
+		{families + 527, "", 2},
+		{families + 527, "", 0},
+		{families + 527, "\\mu_0 = \\frac{2 r \\cdot B}{I}", Formula::no_solve_for},
+		{families + 527, "", 1},
+		{families + 528, "", 3},
+		{families + 528, "", 2},
+		{families + 528, "\\mu_0 = \\frac{r \\cdot 2 B}{I}", Formula::no_solve_for},
+		{families + 528, "", 0},
+		{families + 529, "B = \\frac{\\frac{\\mu_0 \\cdot I \\cdot d \\cdot l \\cdot \\sin\\left(\\theta\\right)}{4 \\pi \\cdot r^{2}}}{d}", Formula::no_solve_for},
+		{families + 529, "", 2},
+		{families + 529, "\\mu_0 = \\frac{\\frac{\\frac{\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\sin\\left(\\theta\\right)}}{l}}{d}}{I}", Formula::no_solve_for},
+		{families + 529, "\\pi = \\frac{\\frac{\\frac{\\mu_0 \\cdot I \\cdot d \\cdot l \\cdot \\sin\\left(\\theta\\right)}{d \\cdot B}}{r^{2}}}{4}", Formula::no_solve_for},
+		{families + 529, "\\theta = \\arcsin\\left(\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\mu_0 \\cdot I \\cdot d \\cdot l}\\right)", Formula::no_solve_for},
+		{families + 529, "l = \\frac{\\frac{d \\cdot B \\cdot 4 \\pi \\cdot r^{2}}{\\sin\\left(\\theta\\right)}}{\\mu_0 \\cdot I \\cdot d}", Formula::no_solve_for},
+		{families + 529, "", 5},
+		{families + 530, "", 3},
+		{families + 530, "", 1},
+		{families + 530, "", 2},
+		{families + 531, "", 0},
+		{families + 531, "", 3},
+		{families + 531, "\\pi = \\frac{\\frac{B \\cdot q \\cdot T}{m}}{2}", Formula::no_solve_for},
+		{families + 531, "", 1},
+		{families + 531, "", 2},
+		{families + 532, "", 2},
+		{families + 532, "", 4},
+		{families + 532, "", 0},
+		{families + 532, "\\mu_0 = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{N}}{I}", Formula::no_solve_for},
+		{families + 532, "\\pi = \\frac{\\frac{\\frac{N \\cdot \\mu_0 \\cdot I}{B}}{r}}{2}", Formula::no_solve_for},
+		{families + 532, "", 1},
+		{families + 533, "", 2},
+		{families + 533, "", 0},
+		{families + 533, "", 4},
+		{families + 533, "\\mu_0 = \\frac{\\frac{2 \\pi \\cdot r \\cdot B}{I}}{N}", Formula::no_solve_for},
+		{families + 533, "\\pi = \\frac{\\frac{\\frac{I \\cdot \\mu_0 \\cdot N}{B}}{r}}{2}", Formula::no_solve_for},
+		{families + 533, "", 1},
+		{families + 534, "", 1},
+		{families + 535, "", 2},
+		{families + 535, "", 4},
+		{families + 535, "", 0},
+		{families + 535, "", 1},
+		{families + 535, "", 3},
+		{families + 536, "", 4},
+		{families + 536, "", 2},
+		{families + 536, "", 1},
+		{families + 536, "", 3},
+		{families + 536, "", 0},
+		{families + 537, "", 0},
+		{families + 537, "", 2},
+		{families + 537, "", 1},
+		{families + 537, "", 3},
+		{families + 537, "", 4},
+		{families + 538, "E_max = \\frac{f \\cdot h - \\phi}{K}", Formula::no_solve_for},
+		{families + 538, "K = \\frac{f \\cdot h - \\phi}{E_max}", Formula::no_solve_for},
+		{families + 538, "\\phi = f \\cdot h - K \\cdot E_max", Formula::no_solve_for},
+		{families + 539, "", 2},
+		{families + 539, "", 1},
+		{families + 540, "", 1},
+		{families + 541, "", 1},
+		{families + 542, "", 1},
+		{families + 543, "\\Delta p = m \\cdot \\Delta v", Formula::no_solve_for},
+		{families + 543, "\\Delta v = \\frac{\\Delta p}{m}", Formula::no_solve_for},
+		{families + 543, "", 1},
+		{families + 544, "\\Delta p = \\Delta v \\cdot m", Formula::no_solve_for},
+		{families + 545, "", 0},
+		{families + 545, "", 1},
+		{families + 546, "v_1i = \\frac{v_f \\cdot \\left(m_1 + m_2\\right) - m_2 \\cdot v_2i}{m_1}", Formula::no_solve_for},
+		{families + 546, "v_2i = \\frac{v_f \\cdot \\left(m_1 + m_2\\right) - m_1 \\cdot v_1i}{m_2}", Formula::no_solve_for},
+		{families + 546, "", 0},
+		{families + 547, "", 1},
+		{families + 547, "", 2},
+		{families + 547, "", 0},
+		{families + 548, "", 1},
+		{families + 548, "", 0},
+		{families + 548, "", 2},
+		{families + 549, "", 1},
+		{families + 549, "", 2},
+		{families + 549, "", 0},
+		{families + 550, "", 1},
+		{families + 551, "\\omega = \\left(\\frac{k}{m}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 551, "", 1},
+		{families + 551, "", 2},
+		{families + 552, "\\omega = \\pm \\left(\\frac{k}{m}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 552, "", 0},
+		{families + 553, "", 2},
+		{families + 553, "\\pi = \\pm \\left(\\frac{\\frac{k \\cdot T^{2}}{m}}{4}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 553, "", 1},
+		{families + 553, "", 0},
+		{families + 554, "", 2},
+		{families + 554, "", 0},
+		{families + 555, "", 0},
+		{families + 555, "", 2},
+		{families + 555, "\\pi = \\pm \\left(\\frac{\\frac{g \\cdot T^{2}}{L}}{4}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 555, "", 1},
+		{families + 556, "\\omega = f \\cdot 2 \\pi", Formula::no_solve_for},
+		{families + 557, "\\tau = F \\cdot r", Formula::no_solve_for},
+		{families + 558, "\\tau = \\alpha \\cdot I", Formula::no_solve_for},
+		{families + 559, "E = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{K}", Formula::no_solve_for},
+		{families + 559, "", 1},
+		{families + 559, "K = \\frac{\\frac{1}{2} I \\cdot \\omega^{2}}{E}", Formula::no_solve_for},
+		{families + 559, "\\omega = \\pm \\left(\\frac{K \\cdot E}{\\frac{1}{2} I}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 560, "E = \\frac{I \\cdot \\omega^{2}}{2 K}", Formula::no_solve_for},
+		{families + 560, "", 0},
+		{families + 560, "K = \\frac{\\frac{I \\cdot \\omega^{2}}{E}}{2}", Formula::no_solve_for},
+		{families + 560, "\\omega = \\pm \\left(\\frac{2 K \\cdot E}{I}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 561, "E = \\frac{\\omega^{2} \\cdot I}{2 K}", Formula::no_solve_for},
+		{families + 561, "K = \\frac{\\frac{\\omega^{2} \\cdot I}{E}}{2}", Formula::no_solve_for},
+		{families + 561, "\\omega = \\left(\\frac{2 K \\cdot E}{I}\\right)^{\\frac{1}{2}}", Formula::no_solve_for},
+		{families + 562, "", 1},
+		{families + 563, "", 1},
+		{families + 564, "", 1},
+		{families + 564, "", 0},
+		{families + 565, "\\Delta T = \\frac{\\frac{Q}{m}}{c}", Formula::no_solve_for},
+		{families + 565, "", 2},
+		{families + 565, "", 0},
+		{families + 566, "", 1},
+		{families + 566, "\\Delta T = \\frac{\\frac{Q}{c}}{m}", Formula::no_solve_for},
+		{families + 566, "", 0},
+		{families + 566, "", 2},
+		{families + 567, "", 1},
+		{families + 568, "", 1},
+		{families + 569, "", 2},
+		{families + 569, "\\Delta T = \\frac{\\frac{\\Delta L}{\\alpha}}{L_0}", Formula::no_solve_for},
+		{families + 569, "\\alpha = \\frac{\\Delta L}{L_0 \\cdot \\Delta T}", Formula::no_solve_for},
+		{families + 570, "", 1},
+		{families + 571, "", 0},
+		{families + 572, "", 1},
+		{families + 573, "", 0},
+		{families + 573, "", 2},
+		{families + 574, "f_obs = f_s \\cdot \\frac{v}{v \\pm v_s}", Formula::no_solve_for},
+		{families + 574, "", 1},
+    };
+
+    constexpr OutputGroup output_groups[] = {
+		{{0, 0, 0, 0, 0, 0, 0}, 0, 116},
+		{{1, 0, 0, 0, 0, 0, 0}, 116, 217},
+		{{2, 0, 0, 0, 0, 0, 0}, 333, 59},
+		{{3, 0, 0, 0, 0, 0, 0}, 392, 21},
+		{{4, 0, 0, 0, 0, 0, 0}, 413, 1},
+		{{-3, 0, 0, 0, 0, 0, 0}, 414, 15},
+		{{-1, 0, 0, 0, 0, 0, 0}, 429, 7},
+		{{0, 1, 0, 0, 0, 0, 0}, 436, 55},
+		{{0, -2, 0, 0, 0, 0, 0}, 491, 4},
+		{{1, -2, 0, 0, 0, 0, 0}, 495, 27},
+		{{2, -2, 0, 0, 0, 0, 0}, 522, 2},
+		{{0, -1, 0, 0, 0, 0, 0}, 524, 33},
+		{{1, -1, 0, 0, 0, 0, 0}, 557, 87},
+		{{3, -1, 0, 0, 0, 0, 0}, 644, 2},
+		{{0, 0, 1, 0, 0, 0, 0}, 646, 73},
+		{{2, 0, 1, 0, 0, 0, 0}, 719, 7},
+		{{-3, 0, 1, 0, 0, 0, 0}, 726, 6},
+		{{-1, 0, 1, 0, 0, 0, 0}, 732, 1},
+		{{0, -3, 1, 0, 0, 0, 0}, 733, 1},
+		{{2, -3, 1, 0, 0, 0, 0}, 734, 16},
+		{{0, -2, 1, 0, 0, 0, 0}, 750, 9},
+		{{1, -2, 1, 0, 0, 0, 0}, 759, 50},
+		{{2, -2, 1, 0, 0, 0, 0}, 809, 65},
+		{{-1, -2, 1, 0, 0, 0, 0}, 874, 19},
+		{{0, -1, 1, 0, 0, 0, 0}, 893, 1},
+		{{1, -1, 1, 0, 0, 0, 0}, 894, 9},
+		{{2, -1, 1, 0, 0, 0, 0}, 903, 9},
+		{{-1, -1, 1, 0, 0, 0, 0}, 912, 1},
+		{{3, -2, -1, 0, 0, 0, 0}, 913, 14},
+		{{0, 0, 0, 1, 0, 0, 0}, 927, 78},
+		{{2, 0, 0, 1, 0, 0, 0}, 1005, 7},
+		{{-2, 0, 0, 1, 0, 0, 0}, 1012, 7},
+		{{0, 1, 0, 1, 0, 0, 0}, 1019, 87},
+		{{1, 1, 0, 1, 0, 0, 0}, 1106, 5},
+		{{-3, 1, 0, 1, 0, 0, 0}, 1111, 1},
+		{{-2, 1, 0, 1, 0, 0, 0}, 1112, 3},
+		{{-1, 1, 0, 1, 0, 0, 0}, 1115, 2},
+		{{0, 2, -1, 1, 0, 0, 0}, 1117, 2},
+		{{-3, 3, -1, 2, 0, 0, 0}, 1119, 4},
+		{{-2, 3, -1, 2, 0, 0, 0}, 1123, 1},
+		{{-3, 4, -1, 2, 0, 0, 0}, 1124, 12},
+		{{-2, 4, -1, 2, 0, 0, 0}, 1136, 33},
+		{{3, -4, 1, -2, 0, 0, 0}, 1169, 16},
+		{{2, -3, 1, -2, 0, 0, 0}, 1185, 68},
+		{{3, -3, 1, -2, 0, 0, 0}, 1253, 6},
+		{{1, -2, 1, -2, 0, 0, 0}, 1259, 18},
+		{{2, -2, 1, -2, 0, 0, 0}, 1277, 29},
+		{{3, -1, 0, -1, 0, 0, 0}, 1306, 1},
+		{{1, -3, 1, -1, 0, 0, 0}, 1307, 29},
+		{{2, -3, 1, -1, 0, 0, 0}, 1336, 69},
+		{{3, -3, 1, -1, 0, 0, 0}, 1405, 2},
+		{{0, -2, 1, -1, 0, 0, 0}, 1407, 77},
+		{{2, -2, 1, -1, 0, 0, 0}, 1484, 7},
+		{{0, 0, 0, 0, 1, 0, 0}, 1491, 23},
+		{{0, -3, 1, 0, -4, 0, 0}, 1514, 1},
+		{{0, 0, 0, 0, -1, 0, 0}, 1515, 3},
+		{{2, -2, 0, 0, -1, 0, 0}, 1518, 4},
+		{{1, -3, 1, 0, -1, 0, 0}, 1522, 1},
+		{{2, -2, 1, 0, -1, 0, 0}, 1523, 3},
+		{{0, 0, 0, 0, 0, 1, 0}, 1526, 8},
+		{{-3, 0, 0, 0, 0, 1, 0}, 1534, 5},
+		{{0, 0, 0, 0, 0, -3, 0}, 1539, 3},
+		{{2, 0, 0, 0, 0, -1, 0}, 1542, 1},
+		{{3, -1, 0, 0, 0, -1, 0}, 1543, 1},
+		{{0, 0, 1, 0, 0, -1, 0}, 1544, 2},
+		{{0, 1, 0, 1, 0, -1, 0}, 1546, 6},
+		{{2, -2, 1, 0, -1, -1, 0}, 1552, 10},
+    };
+
+    constexpr std::uint32_t producers[] = {
+		8, 44, 74, 76, 78, 79, 152, 187, 191, 195, 197, 202, 207, 210, 211, 212,
+		213, 217, 220, 226, 227, 228, 229, 230, 231, 232, 234, 254, 257, 260, 264, 273,
+		278, 281, 314, 320, 329, 331, 332, 337, 338, 349, 356, 359, 370, 395, 398, 399,
+		415, 421, 423, 438, 442, 446, 460, 463, 508, 517, 613, 621, 623, 634, 646, 652,
+		657, 684, 732, 742, 746, 749, 753, 759, 762, 766, 779, 785, 801, 807, 824, 828,
+		834, 841, 956, 960, 980, 1006, 1015, 1016, 1037, 1045, 1047, 1071, 1073, 1076, 1129, 1205,
+		1209, 1238, 1242, 1247, 1250, 1255, 1256, 1257, 1283, 1294, 1298, 1303, 1561, 1565, 1571, 1777,
+		1783, 1822, 1825, 1828, 11, 14, 17, 23, 27, 32, 35, 39, 45, 48, 57, 65,
+		69, 75, 77, 89, 96, 100, 103, 108, 121, 127, 138, 142, 146, 155, 165, 173,
+		198, 214, 215, 216, 218, 219, 221, 222, 223, 224, 225, 242, 262, 265, 266, 274,
+		276, 291, 295, 324, 341, 351, 354, 368, 369, 401, 419, 420, 431, 452, 464, 475,
+		476, 480, 481, 490, 493, 494, 499, 503, 528, 530, 534, 539, 591, 614, 624, 627,
+		632, 635, 642, 645, 650, 653, 658, 666, 667, 673, 726, 727, 729, 730, 733, 735,
+		736, 737, 739, 740, 743, 744, 747, 750, 751, 754, 755, 757, 760, 763, 764, 767,
+		768, 770, 772, 773, 774, 777, 780, 781, 782, 783, 786, 794, 798, 816, 819, 840,
+		847, 918, 919, 921, 953, 958, 965, 988, 1017, 1034, 1056, 1058, 1068, 1167, 1318, 1322,
+		1326, 1330, 1386, 1395, 1398, 1402, 1414, 1419, 1424, 1429, 1433, 1437, 1441, 1447, 1452, 1457,
+		1461, 1491, 1498, 1502, 1505, 1514, 1531, 1536, 1541, 1546, 1547, 1554, 1556, 1574, 1577, 1602,
+		1607, 1620, 1621, 1624, 1625, 1630, 1631, 1634, 1637, 1638, 1639, 1640, 1641, 1648, 1660, 1664,
+		1670, 1675, 1683, 1686, 1690, 1715, 1719, 1724, 1729, 1747, 1751, 1755, 1759, 1766, 1780, 1786,
+		1792, 1797, 1802, 1820, 1821, 1823, 1824, 1826, 1827, 1829, 1841, 1862, 1872, 109, 118, 170,
+		193, 239, 270, 317, 326, 344, 365, 416, 425, 448, 449, 538, 545, 570, 585, 596,
+		597, 603, 606, 670, 675, 725, 728, 731, 734, 738, 741, 745, 748, 752, 756, 775,
+		810, 820, 825, 916, 920, 937, 950, 954, 1035, 1042, 1069, 1317, 1321, 1325, 1329, 1334,
+		1339, 1454, 1458, 1524, 1599, 1604, 1695, 1730, 125, 377, 381, 382, 384, 582, 593, 690,
+		758, 761, 765, 769, 771, 776, 778, 784, 1221, 1272, 1274, 1517, 1520, 428, 550, 573,
+		817, 852, 934, 939, 1054, 1148, 1154, 1159, 1176, 1336, 1340, 1713, 1717, 174, 618, 998,
+		1007, 1603, 1608, 1679, 43, 82, 169, 180, 184, 301, 310, 316, 321, 346, 355, 358,
+		411, 465, 468, 473, 486, 489, 509, 513, 518, 544, 577, 708, 806, 860, 863, 892,
+		896, 901, 906, 909, 914, 932, 979, 983, 986, 994, 1002, 1057, 1140, 1146, 1151, 1156,
+		1161, 1168, 1171, 1377, 1635, 1647, 1768, 1771, 1835, 1839, 1842, 505, 510, 515, 532, 1,
+		4, 26, 49, 290, 357, 467, 472, 477, 485, 488, 491, 496, 498, 533, 590, 595,
+		1136, 1490, 1513, 1519, 1522, 1618, 1622, 1627, 1646, 1844, 663, 926, 54, 63, 80, 83,
+		188, 205, 209, 330, 342, 347, 348, 350, 352, 410, 439, 443, 447, 507, 511, 512,
+		514, 516, 522, 525, 529, 802, 1028, 1266, 1407, 1702, 1706, 1806, 1881, 18, 36, 40,
+		51, 58, 68, 233, 235, 287, 304, 307, 325, 353, 364, 457, 466, 469, 470, 471,
+		474, 478, 479, 482, 483, 484, 487, 492, 497, 500, 531, 551, 574, 598, 599, 602,
+		605, 609, 790, 799, 831, 836, 936, 941, 990, 1020, 1025, 1078, 1143, 1166, 1169, 1338,
+		1342, 1387, 1389, 1390, 1391, 1406, 1408, 1409, 1486, 1489, 1525, 1548, 1551, 1575, 1579, 1616,
+		1617, 1619, 1623, 1626, 1628, 1629, 1632, 1633, 1642, 1643, 1645, 1649, 1652, 1656, 1691, 1694,
+		1819, 1860, 1877, 1879, 604, 1526, 2, 5, 16, 21, 22, 25, 30, 31, 34, 38,
+		42, 47, 52, 67, 286, 292, 305, 361, 372, 405, 527, 584, 662, 665, 796, 803,
+		808, 845, 925, 928, 1029, 1066, 1137, 1141, 1147, 1153, 1158, 1162, 1172, 1222, 1223, 1246,
+		1249, 1388, 1394, 1397, 1401, 1485, 1492, 1529, 1530, 1534, 1535, 1539, 1540, 1544, 1545, 1550,
+		1553, 1559, 1688, 1693, 1703, 1707, 1773, 1790, 1795, 1800, 1813, 1832, 1838, 1865, 1869, 504,
+		520, 523, 526, 1849, 1853, 1861, 455, 583, 589, 594, 600, 608, 363, 366, 299, 303,
+		367, 553, 556, 558, 576, 671, 676, 724, 858, 1118, 1125, 1308, 1310, 1509, 10, 13,
+		360, 1497, 1501, 1831, 1834, 1837, 1840, 0, 3, 6, 7, 9, 15, 19, 85, 91,
+		293, 302, 308, 362, 417, 426, 450, 451, 501, 586, 592, 629, 788, 792, 833, 838,
+		1019, 1024, 1033, 1080, 1381, 1382, 1383, 1385, 1392, 1399, 1403, 1410, 1415, 1420, 1425, 1511,
+		1516, 1523, 1527, 1532, 1654, 1657, 1662, 1665, 1878, 12, 29, 50, 53, 56, 62, 72,
+		73, 104, 141, 145, 157, 160, 177, 244, 248, 268, 294, 297, 300, 390, 391, 406,
+		414, 429, 502, 506, 575, 579, 659, 664, 679, 680, 681, 685, 689, 823, 849, 859,
+		927, 930, 1041, 1046, 1048, 1065, 1087, 1262, 1333, 1384, 1443, 1448, 1463, 1465, 1469, 1508,
+		1538, 1543, 1595, 1597, 1739, 1808, 1866, 1870, 1871, 1875, 132, 282, 374, 418, 422, 424,
+		427, 430, 432, 435, 587, 588, 601, 638, 688, 1010, 1220, 1475, 1515, 607, 71, 306,
+		309, 311, 312, 1404, 1810, 1815, 1816, 55, 59, 64, 66, 70, 524, 1807, 1809, 1859,
+		454, 20, 24, 28, 33, 37, 41, 46, 1528, 1533, 1537, 1542, 1549, 1552, 1558, 166,
+		175, 182, 189, 335, 336, 535, 542, 546, 552, 555, 571, 611, 616, 620, 626, 630,
+		631, 640, 644, 649, 703, 709, 710, 716, 723, 793, 814, 822, 826, 839, 861, 864,
+		884, 913, 929, 938, 959, 991, 999, 1004, 1012, 1031, 1036, 1044, 1052, 1060, 1092, 1096,
+		1100, 1104, 1107, 1114, 1117, 1121, 1124, 1178, 1309, 1331, 1335, 1343, 1593, 1596, 1659, 1663,
+		1667, 1672, 1677, 1711, 1731, 1742, 1743, 1749, 1753, 1757, 1761, 1776, 1782, 655, 827, 850,
+		1038, 1040, 1050, 1081, 134, 547, 548, 568, 581, 933, 1145, 87, 88, 92, 95, 99,
+		106, 107, 119, 122, 124, 129, 137, 143, 147, 237, 247, 267, 543, 549, 572, 580,
+		789, 797, 804, 809, 818, 835, 846, 853, 862, 890, 895, 935, 940, 1021, 1026, 1030,
+		1055, 1067, 1088, 1138, 1142, 1149, 1152, 1157, 1163, 1173, 1177, 1245, 1251, 1337, 1341, 1361,
+		1412, 1413, 1417, 1418, 1422, 1423, 1428, 1432, 1436, 1440, 1445, 1446, 1450, 1451, 1453, 1468,
+		1470, 1479, 1480, 1481, 1651, 1655, 1682, 1685, 1689, 1700, 1708, 1714, 1718, 1769, 1774, 1791,
+		1796, 1801, 128, 154, 158, 161, 1476, 126, 117, 120, 150, 123, 163, 1170, 1174, 562,
+		569, 1155, 1175, 854, 114, 116, 131, 149, 241, 259, 263, 272, 277, 280, 952, 957,
+		185, 203, 236, 240, 243, 246, 249, 250, 252, 253, 258, 261, 271, 275, 436, 444,
+		706, 888, 942, 943, 946, 947, 951, 955, 1354, 1359, 1455, 1459, 1462, 1467, 1471, 1610,
+		1613, 86, 94, 98, 105, 139, 153, 164, 1411, 1416, 1421, 1427, 1431, 1435, 1439, 1444,
+		1449, 179, 208, 437, 441, 536, 540, 557, 559, 563, 564, 695, 696, 699, 705, 707,
+		712, 713, 714, 715, 718, 721, 855, 867, 868, 869, 873, 874, 878, 879, 880, 885,
+		886, 900, 905, 908, 931, 1094, 1098, 1101, 1102, 1105, 1106, 1116, 1119, 1123, 1131, 1134,
+		1180, 1191, 1192, 1314, 1315, 1319, 1323, 1327, 1344, 1357, 1362, 1364, 1365, 1366, 1368, 1369,
+		1370, 1372, 1373, 1374, 1375, 135, 541, 561, 856, 857, 1150, 172, 196, 612, 617, 622,
+		628, 633, 637, 641, 647, 651, 656, 961, 967, 997, 1005, 1009, 1013, 167, 171, 176,
+		178, 183, 186, 190, 194, 199, 200, 201, 204, 206, 440, 445, 904, 992, 995, 1000,
+		1581, 1585, 1591, 1594, 1598, 1600, 1605, 1609, 1611, 1614, 851, 90, 93, 101, 110, 115,
+		130, 133, 136, 140, 144, 148, 156, 159, 162, 255, 256, 279, 567, 830, 1023, 1135,
+		1139, 1144, 1160, 1426, 1430, 1472, 1473, 1787, 97, 102, 151, 168, 181, 238, 245, 269,
+		313, 319, 323, 328, 333, 334, 340, 393, 412, 537, 554, 560, 578, 702, 704, 719,
+		722, 815, 865, 866, 882, 889, 902, 910, 978, 982, 989, 993, 1001, 1053, 1083, 1086,
+		1089, 1091, 1095, 1099, 1103, 1113, 1120, 1132, 1179, 1182, 1184, 1185, 1187, 1188, 1252, 1307,
+		1311, 1312, 1352, 1434, 1438, 1442, 1464, 1466, 1712, 1716, 1789, 1794, 1799, 111, 113, 318,
+		322, 327, 339, 343, 610, 615, 619, 625, 636, 639, 643, 648, 654, 787, 791, 795,
+		800, 805, 811, 813, 821, 829, 832, 837, 842, 848, 969, 987, 1003, 1008, 1011, 1018,
+		1022, 1027, 1032, 1039, 1043, 1049, 1051, 1061, 1064, 1070, 1074, 1573, 1576, 1650, 1653, 1658,
+		1661, 1666, 1671, 1676, 1680, 1681, 1684, 1687, 1692, 1696, 1699, 1704, 1709, 1710, 1720, 1725,
+		1734, 1738, 1748, 1752, 1756, 1767, 1770, 1775, 1781, 1788, 1793, 1798, 192, 812, 972, 977,
+		981, 984, 1072, 376, 389, 397, 403, 433, 565, 660, 668, 672, 677, 682, 683, 686,
+		693, 1215, 1218, 1240, 1259, 1264, 1296, 1300, 1305, 1876, 678, 434, 566, 669, 404, 661,
+		1864, 1868, 674, 392, 687, 694, 373, 378, 385, 1216, 1219, 1270, 1284, 1286, 402, 407,
+		408, 1271, 1273, 379, 380, 383, 400, 1268, 371, 1244, 394, 413, 1237, 1243, 1248, 1253,
+		375, 396, 1214, 1217, 1239, 1258, 1263, 1295, 1299, 1304,
+    };
+} // namespace
+
+    FormulaCatalogue builtin_catalogue() noexcept { return { formulas, output_groups, producers }; }
+#endif
+} // namespace Physics
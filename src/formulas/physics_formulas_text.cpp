@@ -0,0 +1,167 @@
+#include "physics_formulas.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Physics {
+namespace {
+    constexpr float NAME_WEIGHT = 3.0f;
+    constexpr float DESCRIPTION_WEIGHT = 1.5f;
+    constexpr float CATEGORY_WEIGHT = 1.0f;
+    // Fuzzy matches share at least this fraction of trigrams (Jaccard) with the word
+    constexpr float MIN_SIMILARITY = 0.3f;
+    constexpr std::size_t MAX_EXPANSIONS = 5;
+
+    constexpr std::array<std::string_view, 13> STOPWORDS{
+        "an", "and", "as", "at", "by", "for", "in", "is", "of", "on", "the", "to", "with"
+    };
+
+    // Lowercase ASCII letter and digit runs of two or more characters, minus stopwords
+    template <typename Fn>
+    void for_each_word(std::string_view text, Fn&& fn) {
+        std::string word;
+        auto flush = [&] {
+            if (word.size() > 1 && std::ranges::find(STOPWORDS, word) == STOPWORDS.end()) fn(word);
+            word.clear();
+        };
+        for (const char c : text) {
+            if (c >= 'A' && c <= 'Z') word += static_cast<char>(c - 'A' + 'a');
+            else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) word += c;
+            else flush();
+        }
+        flush();
+    }
+
+    // Trigrams of the word padded with '$' at both ends, so short words and word
+    // boundaries count too
+    template <typename Fn>
+    void for_each_trigram(std::string_view word, Fn&& fn) {
+        const auto padded = [word](std::size_t i) -> std::uint32_t {
+            return static_cast<unsigned char>(i == 0 || i > word.size() ? '$' : word[i - 1]);
+        };
+        for (std::size_t i = 0; i < word.size(); ++i)
+            fn(padded(i) << 16 | padded(i + 1) << 8 | padded(i + 2));
+    }
+
+    // The word's trigrams with repeats ("aaaa") removed, as the index stores them
+    std::vector<std::uint32_t> distinct_trigrams(std::string_view word) {
+        std::vector<std::uint32_t> found;
+        found.reserve(word.size());
+        for_each_trigram(word, [&](std::uint32_t trigram) { found.push_back(trigram); });
+        std::ranges::sort(found);
+        found.erase(std::ranges::unique(found).begin(), found.end());
+        return found;
+    }
+} // namespace
+
+    void FormulaDatabase::build_text() const {
+        auto& [families, terms, vocabulary, postings, trigrams] = text;
+
+        std::vector<std::pair<std::string, float>> family_terms;
+        auto add = [&](std::string_view field, float weight) {
+            for_each_word(field, [&](const std::string& word) {
+                const auto found = std::ranges::find(family_terms, word, &std::pair<std::string, float>::first);
+                if (found == family_terms.end()) family_terms.emplace_back(word, weight);
+                else found->second = std::max(found->second, weight);
+            });
+        };
+
+        for (std::size_t idx = 0; idx < size(); ++idx) {
+            const Formula& f = catalogue.formulas[idx];
+            if (idx > 0 && catalogue.formulas[idx - 1].family == f.family) continue;
+            const auto family = static_cast<std::uint32_t>(families.size());
+            families.push_back(static_cast<std::uint32_t>(idx));
+
+            family_terms.clear();
+            add(f.name(), NAME_WEIGHT);
+            add(f.category(), CATEGORY_WEIGHT);
+            for (const auto& v : f.variables()) add(v.description, DESCRIPTION_WEIGHT);
+            for (auto& [word, weight] : family_terms) {
+                auto [id, added] = terms.try_emplace(word, static_cast<std::uint32_t>(vocabulary.size()));
+                if (added) {
+                    vocabulary.push_back(word);
+                    postings.emplace_back();
+                }
+                postings[id->second].push_back({family, weight});
+            }
+        }
+
+        // Rare terms say more about a family than ones shared by many
+        for (auto& list : postings) {
+            const float idf = std::log(1.0f + static_cast<float>(families.size()) / list.size());
+            for (auto& posting : list) posting.weight *= idf;
+        }
+        for (std::uint32_t id = 0; id < vocabulary.size(); ++id)
+            for_each_trigram(vocabulary[id], [&](std::uint32_t trigram) {
+                auto& ids = trigrams[trigram];
+                if (ids.empty() || ids.back() != id) ids.push_back(id);
+            });
+    }
+
+    std::vector<TextMatch> FormulaDatabase::search_text(std::string_view query, std::size_t limit) const {
+        std::call_once(text_built, [this] { build_text(); });
+        const auto& [families, terms, vocabulary, postings, trigrams] = text;
+
+        std::vector<std::string> words;
+        for_each_word(query, [&](const std::string& word) {
+            if (std::ranges::find(words, word) == words.end()) words.push_back(word);
+        });
+        if (words.empty() || limit == 0) return {};
+
+        // Index terms standing in for `word`, with how closely they match it
+        auto expand = [&](const std::string& word) {
+            std::vector<std::pair<std::uint32_t, float>> expansions;
+            if (const auto exact = terms.find(word); exact != terms.end()) {
+                expansions.emplace_back(exact->second, 1.0f);
+                return expansions;
+            }
+            const auto word_trigrams = distinct_trigrams(word);
+            std::unordered_map<std::uint32_t, std::uint32_t> shared;
+            for (const auto trigram : word_trigrams)
+                if (const auto found = trigrams.find(trigram); found != trigrams.end())
+                    for (const auto id : found->second) shared[id]++;
+            for (const auto& [id, count] : shared) {
+                const std::size_t term_trigrams = distinct_trigrams(vocabulary[id]).size();
+                const float similarity = static_cast<float>(count) / (word_trigrams.size() + term_trigrams - count);
+                if (similarity >= MIN_SIMILARITY) expansions.emplace_back(id, similarity);
+            }
+            // Closest first, term id breaking ties so results do not depend on hashing
+            std::ranges::sort(expansions, [](const auto& a, const auto& b) {
+                return a.second != b.second ? a.second > b.second : a.first < b.first;
+            });
+            if (expansions.size() > MAX_EXPANSIONS) expansions.resize(MAX_EXPANSIONS);
+            return expansions;
+        };
+
+        // A family scores its best match per word; families matching more of the
+        // words are scaled up over ones matching a single word strongly
+        std::vector<float> total(families.size(), 0.0f), best(families.size(), 0.0f);
+        std::vector<std::uint32_t> matched(families.size(), 0);
+        std::vector<std::uint32_t> hit, touched;
+        for (const auto& word : words) {
+            for (const auto& [id, similarity] : expand(word))
+                for (const auto& posting : postings[id]) {
+                    if (best[posting.family] == 0.0f) touched.push_back(posting.family);
+                    best[posting.family] = std::max(best[posting.family], similarity * posting.weight);
+                }
+            for (const auto family : touched) {
+                if (matched[family]++ == 0) hit.push_back(family);
+                total[family] += best[family];
+                best[family] = 0.0f;
+            }
+            touched.clear();
+        }
+
+        std::vector<TextMatch> results;
+        results.reserve(hit.size());
+        for (const auto family : hit)
+            results.push_back({families[family], total[family] * matched[family] / words.size()});
+        const auto ranked = [](const TextMatch& a, const TextMatch& b) {
+            return a.score != b.score ? a.score > b.score : a.index < b.index;
+        };
+        const auto keep = std::min(limit, results.size());
+        std::ranges::partial_sort(results, results.begin() + keep, ranked);
+        results.resize(keep);
+        return results;
+    }
+} // namespace Physics
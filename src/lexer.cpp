@@ -36,7 +36,7 @@ constexpr bool isnumeric(char c){
     return std::isdigit(c) || c == '.';
 }
 
-dv::Lexer::Lexer(const std::string_view view) noexcept{
+dv::Lexer::Lexer(const std::string_view view, const UnitRegistry &units) noexcept: units{&units} {
     begin = view.data();
     it = begin;
     length = view.size();
@@ -109,7 +109,7 @@ dv::Token dv::Lexer::get_numeric_literal_token() noexcept{
         buffer[write++] = c;
         advance();
     }
-    dv::UnitValue uv{(long double)std::atof(buffer.data())};
+    dv::UnitValue uv{(dv::Scalar)std::atof(buffer.data())};
     uv.sig_figs = count_sig_figs(std::string_view{buffer.data(), (size_t)write});
     return {uv, {begit, it}};
 }
@@ -225,7 +225,7 @@ dv::Token dv::Lexer::get_special_indentifier_token() noexcept{
                 buffer.fill(0);
                 auto result = collect_curly_brackets(buffer.data(), buffer.size(), write);
                 if(!result) return {TokenType::UNKNOWN, "Bad \\begin environment"};
-                std::string env_name(buffer.data(), write);
+                const std::string_view env_name{it - 1 - write, write};
                 if(env_name == "cases") return {TokenType::PIECEWISE_BEGIN, "\\begin{cases}"};
                 if(env_name == "bmatrix") return {TokenType::MATRIX_BEGIN, "\\begin{bmatrix}"};
                 return {TokenType::BEGIN_ENV, env_name};
@@ -250,7 +250,7 @@ dv::Token dv::Lexer::get_special_indentifier_token() noexcept{
                 buffer.fill(0);
                 auto result = collect_curly_brackets(buffer.data(), buffer.size(), write);
                 if(!result) return {TokenType::UNKNOWN, "Bad \\text"};
-                std::string text_content(buffer.data(), write);
+                const std::string_view text_content{it - 1 - write, write};
                 if(text_content == "otherwise") return {TokenType::TEXT_OTHERWISE, "otherwise"};
                 return {TokenType::IDENTIFIER, text_content};
             }
@@ -289,7 +289,7 @@ dv::Token dv::Lexer::get_special_indentifier_token() noexcept{
                 buffer.fill(0);
                 auto result = collect_curly_brackets(buffer.data(), buffer.size(), write);
                 if(!result) return {TokenType::UNKNOWN, "Bad \\end environment"};
-                std::string env_name(buffer.data(), write);
+                const std::string_view env_name{it - 1 - write, write};
                 return {TokenType::END_ENV, env_name};
             }
             default: break;
@@ -361,295 +361,12 @@ dv::Token dv::Lexer::get_special_indentifier_token() noexcept{
     return get_indentifier_token();
 }
 
-// ban = bar.split('\n').map(a => a.trim()).filter(s => s).sort((a,b) => {
-    // return a.split(',')[0].length - b.split(',')[0].length;
-// })
-#define UNIT_CASE(str, value, unit) case strint<str>(): return advance_with_token(dv::UnitValue{value, unit}, sizeof(str) - 1)
-#define UNIT_CASE_LIST_BEGIN(size) if(remaining_length() >= size) { switch(strint(it, size)) { default: break;
-#define UNIT_CASE_LIST_END(size) }}
 dv::Token dv::Lexer::get_unit_token() noexcept {
-    UNIT_CASE_LIST_BEGIN(6) {
-        UNIT_CASE("mu mol", 1e-6, DIM_MOLE);
-        UNIT_CASE("mu Ohm", 1e-6, DIM_OHM);
-    } UNIT_CASE_LIST_END()
-    UNIT_CASE_LIST_BEGIN(5) {
-        UNIT_CASE("mu cd", 1e-6, DIM_CANDELA);
-        UNIT_CASE("mu Pa", 1e-6, DIM_PASCAL);
-        UNIT_CASE("mu Hz", 1e-6, DIM_HERTZ);
-    } UNIT_CASE_LIST_END()
-    UNIT_CASE_LIST_BEGIN(4) {
-        UNIT_CASE("amol", 1e-18, DIM_MOLE);
-        UNIT_CASE("aOhm", 1e-18, DIM_OHM);
-        UNIT_CASE("fmol", 1e-15, DIM_MOLE);
-        UNIT_CASE("fOhm", 1e-15, DIM_OHM);
-        UNIT_CASE("pmol", 1e-12, DIM_MOLE);
-        UNIT_CASE("pOhm", 1e-12, DIM_OHM);
-        UNIT_CASE("nmol", 1e-9, DIM_MOLE);
-        UNIT_CASE("nOhm", 1e-9, DIM_OHM);
-        UNIT_CASE("mu m", 1e-6, DIM_METER);
-        UNIT_CASE("mu s", 1e-6, DIM_SECOND);
-        UNIT_CASE("mu g", 1e-9, DIM_KILOGRAM);
-        UNIT_CASE("mu A", 1e-6, DIM_AMPERE);
-        UNIT_CASE("mu K", 1e-6, DIM_KELVIN);
-        UNIT_CASE("mu N", 1e-6, DIM_NEWTON);
-        UNIT_CASE("mu J", 1e-6, DIM_JOULE);
-        UNIT_CASE("mu C", 1e-6, DIM_COULOMB);
-        UNIT_CASE("mu S", 1e-6, DIM_SIEMENS);
-        UNIT_CASE("mu F", 1e-6, DIM_FARAD);
-        UNIT_CASE("mu V", 1e-6, DIM_VOLT);
-        UNIT_CASE("mu W", 1e-6, DIM_WATT);
-        UNIT_CASE("mmol", 1e-3, DIM_MOLE);
-        UNIT_CASE("mOhm", 1e-3, DIM_OHM);
-        UNIT_CASE("cmol", 1e-2, DIM_MOLE);
-        UNIT_CASE("cOhm", 1e-2, DIM_OHM);
-        UNIT_CASE("dmol", 1e-1, DIM_MOLE);
-        UNIT_CASE("dOhm", 1e-1, DIM_OHM);
-        UNIT_CASE("kmol", 1e+3, DIM_MOLE);
-        UNIT_CASE("kOhm", 1e+3, DIM_OHM);
-        UNIT_CASE("Mmol", 1e+6, DIM_MOLE);
-        UNIT_CASE("MOhm", 1e+6, DIM_OHM);
-        UNIT_CASE("Gmol", 1e+9, DIM_MOLE);
-        UNIT_CASE("GOhm", 1e+9, DIM_OHM);
-        UNIT_CASE("Tmol", 1e+12, DIM_MOLE);
-        UNIT_CASE("TOhm", 1e+12, DIM_OHM);
-        UNIT_CASE("Pmol", 1e+15, DIM_MOLE);
-        UNIT_CASE("POhm", 1e+15, DIM_OHM);
-        UNIT_CASE("Emol", 1e+18, DIM_MOLE);
-        UNIT_CASE("EOhm", 1e+18, DIM_OHM);
-
-        UNIT_CASE("hour", 60 * 60, DIM_SECOND);
-    } UNIT_CASE_LIST_END()
-    UNIT_CASE_LIST_BEGIN(3) {
-        UNIT_CASE("acd", 1e-18, DIM_CANDELA);
-        UNIT_CASE("aPa", 1e-18, DIM_PASCAL);
-        UNIT_CASE("aHz", 1e-18, DIM_HERTZ);
-        UNIT_CASE("fcd", 1e-15, DIM_CANDELA);
-        UNIT_CASE("fPa", 1e-15, DIM_PASCAL);
-        UNIT_CASE("fHz", 1e-15, DIM_HERTZ);
-        UNIT_CASE("pcd", 1e-12, DIM_CANDELA);
-        UNIT_CASE("pPa", 1e-12, DIM_PASCAL);
-        UNIT_CASE("pHz", 1e-12, DIM_HERTZ);
-        UNIT_CASE("ncd", 1e-9, DIM_CANDELA);
-        UNIT_CASE("nPa", 1e-9, DIM_PASCAL);
-        UNIT_CASE("nHz", 1e-9, DIM_HERTZ);
-        UNIT_CASE("mcd", 1e-3, DIM_CANDELA);
-        UNIT_CASE("mPa", 1e-3, DIM_PASCAL);
-        UNIT_CASE("mHz", 1e-3, DIM_HERTZ);
-        UNIT_CASE("ccd", 1e-2, DIM_CANDELA);
-        UNIT_CASE("cPa", 1e-2, DIM_PASCAL);
-        UNIT_CASE("cHz", 1e-2, DIM_HERTZ);
-        UNIT_CASE("dcd", 1e-1, DIM_CANDELA);
-        UNIT_CASE("dPa", 1e-1, DIM_PASCAL);
-        UNIT_CASE("dHz", 1e-1, DIM_HERTZ);
-        UNIT_CASE("mol", 1, DIM_MOLE);
-        UNIT_CASE("Ohm", 1, DIM_OHM);
-        UNIT_CASE("kcd", 1e+3, DIM_CANDELA);
-        UNIT_CASE("kPa", 1e+3, DIM_PASCAL);
-        UNIT_CASE("kHz", 1e+3, DIM_HERTZ);
-        UNIT_CASE("Mcd", 1e+6, DIM_CANDELA);
-        UNIT_CASE("MPa", 1e+6, DIM_PASCAL);
-        UNIT_CASE("MHz", 1e+6, DIM_HERTZ);
-        UNIT_CASE("Gcd", 1e+9, DIM_CANDELA);
-        UNIT_CASE("GPa", 1e+9, DIM_PASCAL);
-        UNIT_CASE("GHz", 1e+9, DIM_HERTZ);
-        UNIT_CASE("Tcd", 1e+12, DIM_CANDELA);
-        UNIT_CASE("TPa", 1e+12, DIM_PASCAL);
-        UNIT_CASE("THz", 1e+12, DIM_HERTZ);
-        UNIT_CASE("Pcd", 1e+15, DIM_CANDELA);
-        UNIT_CASE("PPa", 1e+15, DIM_PASCAL);
-        UNIT_CASE("PHz", 1e+15, DIM_HERTZ);
-        UNIT_CASE("Ecd", 1e+18, DIM_CANDELA);
-        UNIT_CASE("EPa", 1e+18, DIM_PASCAL);
-        UNIT_CASE("EHz", 1e+18, DIM_HERTZ);
-
-        UNIT_CASE("min", 60, DIM_SECOND);
-        UNIT_CASE("ATM", 101325, DIM_PASCAL);
-    } UNIT_CASE_LIST_END()
-    UNIT_CASE_LIST_BEGIN(2) {
-        UNIT_CASE("am", 1e-18, DIM_METER);
-        UNIT_CASE("as", 1e-18, DIM_SECOND);
-        UNIT_CASE("ag", 1e-21, DIM_KILOGRAM);
-        UNIT_CASE("aA", 1e-18, DIM_AMPERE);
-        UNIT_CASE("aK", 1e-18, DIM_KELVIN);
-        UNIT_CASE("aN", 1e-18, DIM_NEWTON);
-        UNIT_CASE("aJ", 1e-18, DIM_JOULE);
-        UNIT_CASE("aC", 1e-18, DIM_COULOMB);
-        UNIT_CASE("aS", 1e-18, DIM_SIEMENS);
-        UNIT_CASE("aF", 1e-18, DIM_FARAD);
-        UNIT_CASE("aV", 1e-18, DIM_VOLT);
-        UNIT_CASE("aW", 1e-18, DIM_WATT);
-        UNIT_CASE("fm", 1e-15, DIM_METER);
-        UNIT_CASE("fs", 1e-15, DIM_SECOND);
-        UNIT_CASE("fg", 1e-18, DIM_KILOGRAM);
-        UNIT_CASE("fA", 1e-15, DIM_AMPERE);
-        UNIT_CASE("fK", 1e-15, DIM_KELVIN);
-        UNIT_CASE("fN", 1e-15, DIM_NEWTON);
-        UNIT_CASE("fJ", 1e-15, DIM_JOULE);
-        UNIT_CASE("fC", 1e-15, DIM_COULOMB);
-        UNIT_CASE("fS", 1e-15, DIM_SIEMENS);
-        UNIT_CASE("fF", 1e-15, DIM_FARAD);
-        UNIT_CASE("fV", 1e-15, DIM_VOLT);
-        UNIT_CASE("fW", 1e-15, DIM_WATT);
-        UNIT_CASE("pm", 1e-12, DIM_METER);
-        UNIT_CASE("ps", 1e-12, DIM_SECOND);
-        UNIT_CASE("pg", 1e-15, DIM_KILOGRAM);
-        UNIT_CASE("pA", 1e-12, DIM_AMPERE);
-        UNIT_CASE("pK", 1e-12, DIM_KELVIN);
-        UNIT_CASE("pN", 1e-12, DIM_NEWTON);
-        UNIT_CASE("pJ", 1e-12, DIM_JOULE);
-        UNIT_CASE("pC", 1e-12, DIM_COULOMB);
-        UNIT_CASE("pS", 1e-12, DIM_SIEMENS);
-        UNIT_CASE("pF", 1e-12, DIM_FARAD);
-        UNIT_CASE("pV", 1e-12, DIM_VOLT);
-        UNIT_CASE("pW", 1e-12, DIM_WATT);
-        UNIT_CASE("nm", 1e-9, DIM_METER);
-        UNIT_CASE("ns", 1e-9, DIM_SECOND);
-        UNIT_CASE("ng", 1e-12, DIM_KILOGRAM);
-        UNIT_CASE("nA", 1e-9, DIM_AMPERE);
-        UNIT_CASE("nK", 1e-9, DIM_KELVIN);
-        UNIT_CASE("nN", 1e-9, DIM_NEWTON);
-        UNIT_CASE("nJ", 1e-9, DIM_JOULE);
-        UNIT_CASE("nC", 1e-9, DIM_COULOMB);
-        UNIT_CASE("nS", 1e-9, DIM_SIEMENS);
-        UNIT_CASE("nF", 1e-9, DIM_FARAD);
-        UNIT_CASE("nV", 1e-9, DIM_VOLT);
-        UNIT_CASE("nW", 1e-9, DIM_WATT);
-        UNIT_CASE("mm", 1e-3, DIM_METER);
-        UNIT_CASE("ms", 1e-3, DIM_SECOND);
-        UNIT_CASE("mg", 1e-6, DIM_KILOGRAM);
-        UNIT_CASE("mA", 1e-3, DIM_AMPERE);
-        UNIT_CASE("mK", 1e-3, DIM_KELVIN);
-        UNIT_CASE("mN", 1e-3, DIM_NEWTON);
-        UNIT_CASE("mJ", 1e-3, DIM_JOULE);
-        UNIT_CASE("mC", 1e-3, DIM_COULOMB);
-        UNIT_CASE("mS", 1e-3, DIM_SIEMENS);
-        UNIT_CASE("mF", 1e-3, DIM_FARAD);
-        UNIT_CASE("mV", 1e-3, DIM_VOLT);
-        UNIT_CASE("mW", 1e-3, DIM_WATT);
-        UNIT_CASE("cm", 1e-2, DIM_METER);
-        UNIT_CASE("cs", 1e-2, DIM_SECOND);
-        UNIT_CASE("cg", 1e-5, DIM_KILOGRAM);
-        UNIT_CASE("cA", 1e-2, DIM_AMPERE);
-        UNIT_CASE("cK", 1e-2, DIM_KELVIN);
-        UNIT_CASE("cN", 1e-2, DIM_NEWTON);
-        UNIT_CASE("cJ", 1e-2, DIM_JOULE);
-        UNIT_CASE("cC", 1e-2, DIM_COULOMB);
-        UNIT_CASE("cS", 1e-2, DIM_SIEMENS);
-        UNIT_CASE("cF", 1e-2, DIM_FARAD);
-        UNIT_CASE("cV", 1e-2, DIM_VOLT);
-        UNIT_CASE("cW", 1e-2, DIM_WATT);
-        UNIT_CASE("dm", 1e-1, DIM_METER);
-        UNIT_CASE("ds", 1e-1, DIM_SECOND);
-        UNIT_CASE("dg", 1e-4, DIM_KILOGRAM);
-        UNIT_CASE("dA", 1e-1, DIM_AMPERE);
-        UNIT_CASE("dK", 1e-1, DIM_KELVIN);
-        UNIT_CASE("dN", 1e-1, DIM_NEWTON);
-        UNIT_CASE("dJ", 1e-1, DIM_JOULE);
-        UNIT_CASE("dC", 1e-1, DIM_COULOMB);
-        UNIT_CASE("dS", 1e-1, DIM_SIEMENS);
-        UNIT_CASE("dF", 1e-1, DIM_FARAD);
-        UNIT_CASE("dV", 1e-1, DIM_VOLT);
-        UNIT_CASE("dW", 1e-1, DIM_WATT);
-        UNIT_CASE("cd", 1, DIM_CANDELA);
-        UNIT_CASE("Pa", 1, DIM_PASCAL);
-        UNIT_CASE("Hz", 1, DIM_HERTZ);
-        UNIT_CASE("km", 1e+3, DIM_METER);
-        UNIT_CASE("ks", 1e+3, DIM_SECOND);
-        UNIT_CASE("kg", 1, DIM_KILOGRAM);
-        UNIT_CASE("kA", 1e+3, DIM_AMPERE);
-        UNIT_CASE("kK", 1e+3, DIM_KELVIN);
-        UNIT_CASE("kN", 1e+3, DIM_NEWTON);
-        UNIT_CASE("kJ", 1e+3, DIM_JOULE);
-        UNIT_CASE("kC", 1e+3, DIM_COULOMB);
-        UNIT_CASE("kS", 1e+3, DIM_SIEMENS);
-        UNIT_CASE("kF", 1e+3, DIM_FARAD);
-        UNIT_CASE("kV", 1e+3, DIM_VOLT);
-        UNIT_CASE("kW", 1e+3, DIM_WATT);
-        UNIT_CASE("Mm", 1e+6, DIM_METER);
-        UNIT_CASE("Ms", 1e+6, DIM_SECOND);
-        UNIT_CASE("Mg", 1e+3, DIM_KILOGRAM);
-        UNIT_CASE("MA", 1e+6, DIM_AMPERE);
-        UNIT_CASE("MK", 1e+6, DIM_KELVIN);
-        UNIT_CASE("MN", 1e+6, DIM_NEWTON);
-        UNIT_CASE("MJ", 1e+6, DIM_JOULE);
-        UNIT_CASE("MC", 1e+6, DIM_COULOMB);
-        UNIT_CASE("MS", 1e+6, DIM_SIEMENS);
-        UNIT_CASE("MF", 1e+6, DIM_FARAD);
-        UNIT_CASE("MV", 1e+6, DIM_VOLT);
-        UNIT_CASE("MW", 1e+6, DIM_WATT);
-        UNIT_CASE("Gm", 1e+9, DIM_METER);
-        UNIT_CASE("Gs", 1e+9, DIM_SECOND);
-        UNIT_CASE("Gg", 1e+6, DIM_KILOGRAM);
-        UNIT_CASE("GA", 1e+9, DIM_AMPERE);
-        UNIT_CASE("GK", 1e+9, DIM_KELVIN);
-        UNIT_CASE("GN", 1e+9, DIM_NEWTON);
-        UNIT_CASE("GJ", 1e+9, DIM_JOULE);
-        UNIT_CASE("GC", 1e+9, DIM_COULOMB);
-        UNIT_CASE("GS", 1e+9, DIM_SIEMENS);
-        UNIT_CASE("GF", 1e+9, DIM_FARAD);
-        UNIT_CASE("GV", 1e+9, DIM_VOLT);
-        UNIT_CASE("GW", 1e+9, DIM_WATT);
-        UNIT_CASE("Tm", 1e+12, DIM_METER);
-        UNIT_CASE("Ts", 1e+12, DIM_SECOND);
-        UNIT_CASE("Tg", 1e+9, DIM_KILOGRAM);
-        UNIT_CASE("TA", 1e+12, DIM_AMPERE);
-        UNIT_CASE("TK", 1e+12, DIM_KELVIN);
-        UNIT_CASE("TN", 1e+12, DIM_NEWTON);
-        UNIT_CASE("TJ", 1e+12, DIM_JOULE);
-        UNIT_CASE("TC", 1e+12, DIM_COULOMB);
-        UNIT_CASE("TS", 1e+12, DIM_SIEMENS);
-        UNIT_CASE("TF", 1e+12, DIM_FARAD);
-        UNIT_CASE("TV", 1e+12, DIM_VOLT);
-        UNIT_CASE("TW", 1e+12, DIM_WATT);
-        UNIT_CASE("Pm", 1e+15, DIM_METER);
-        UNIT_CASE("Ps", 1e+15, DIM_SECOND);
-        UNIT_CASE("Pg", 1e+12, DIM_KILOGRAM);
-        UNIT_CASE("PA", 1e+15, DIM_AMPERE);
-        UNIT_CASE("PK", 1e+15, DIM_KELVIN);
-        UNIT_CASE("PN", 1e+15, DIM_NEWTON);
-        UNIT_CASE("PJ", 1e+15, DIM_JOULE);
-        UNIT_CASE("PC", 1e+15, DIM_COULOMB);
-        UNIT_CASE("PS", 1e+15, DIM_SIEMENS);
-        UNIT_CASE("PF", 1e+15, DIM_FARAD);
-        UNIT_CASE("PV", 1e+15, DIM_VOLT);
-        UNIT_CASE("PW", 1e+15, DIM_WATT);
-        UNIT_CASE("Em", 1e+18, DIM_METER);
-        UNIT_CASE("Es", 1e+18, DIM_SECOND);
-        UNIT_CASE("Eg", 1e+15, DIM_KILOGRAM);
-        UNIT_CASE("EA", 1e+18, DIM_AMPERE);
-        UNIT_CASE("EK", 1e+18, DIM_KELVIN);
-        UNIT_CASE("EN", 1e+18, DIM_NEWTON);
-        UNIT_CASE("EJ", 1e+18, DIM_JOULE);
-        UNIT_CASE("EC", 1e+18, DIM_COULOMB);
-        UNIT_CASE("ES", 1e+18, DIM_SIEMENS);
-        UNIT_CASE("EF", 1e+18, DIM_FARAD);
-        UNIT_CASE("EV", 1e+18, DIM_VOLT);
-        UNIT_CASE("EW", 1e+18, DIM_WATT);
-
-        UNIT_CASE("in", 0.0254, DIM_METER);
-        UNIT_CASE("ft", 0.3048, DIM_METER);
-        UNIT_CASE("yd", 0.9144, DIM_METER);
-        UNIT_CASE("mi", 1609.34, DIM_METER);
-        UNIT_CASE("lb", 0.453, DIM_KILOGRAM);
-    } UNIT_CASE_LIST_END()
-    UNIT_CASE_LIST_BEGIN(1) {
-        UNIT_CASE("m", 1, DIM_METER);
-        UNIT_CASE("s", 1, DIM_SECOND);
-        UNIT_CASE("g", 1e-3, DIM_KILOGRAM);
-        UNIT_CASE("A", 1, DIM_AMPERE);
-        UNIT_CASE("K", 1, DIM_KELVIN);
-        UNIT_CASE("N", 1, DIM_NEWTON);
-        UNIT_CASE("J", 1, DIM_JOULE);
-        UNIT_CASE("C", 1, DIM_COULOMB);
-        UNIT_CASE("S", 1, DIM_SIEMENS);
-        UNIT_CASE("F", 1, DIM_FARAD);
-        UNIT_CASE("V", 1, DIM_VOLT);
-        UNIT_CASE("W", 1, DIM_WATT);
-    } UNIT_CASE_LIST_END()
-    return {};
+    const auto match = units->longest_match({it, remaining_length()});
+    if(!match.length) return {};
+    return advance_with_token(dv::UnitValue{match.unit->factor, match.unit->unit}, match.length);
 }
 
-
 void dv::Lexer::devoure_whitespace() noexcept{
     while(std::isspace(peek())) advance();
 }
@@ -695,7 +412,7 @@ dv::Token dv::Lexer::consume_next_token() noexcept{
                     else if(c >= 'A' && c <= 'F') hex_val += c - 'A' + 10;
                     advance();
                 }
-                return {UnitValue{(long double)hex_val}, {begit, it}};
+                return {UnitValue{(dv::Scalar)hex_val}, {begit, it}};
             }
             // Binary literals: 0b...
             if(peek() == '0' && remaining_length() >= 2 && (peek_next() == 'b' || peek_next() == 'B')) {
@@ -706,7 +423,7 @@ dv::Token dv::Lexer::consume_next_token() noexcept{
                     bin_val = (bin_val << 1) | (peek() - '0');
                     advance();
                 }
-                return {UnitValue{(long double)bin_val}, {begit, it}};
+                return {UnitValue{(dv::Scalar)bin_val}, {begit, it}};
             }
             if(isnumeric(peek())) return get_numeric_literal_token();
             if(std::isalpha(peek())) {
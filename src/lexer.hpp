@@ -2,19 +2,24 @@
 
 #include "dimeval.hpp"
 #include "token.hpp"
+#include "unit_registry.hpp"
 #include <expected>
 #include <vector>
 
 namespace dv {
     class Lexer {
     public:
-        Lexer(const std::string_view view) noexcept;
+        // Unit commands are looked up in `units`, which must outlive the lexer
+        Lexer(const std::string_view view, const UnitRegistry &units = UnitRegistry::builtin()) noexcept;
         using MaybeTokens = std::expected<std::vector<dv::Token>, std::string>;
         MaybeTokens extract_all_tokens() noexcept;
+        // Pull mode (TokenStream): the next token, TEOF once the input is used up
+        Token next_token() noexcept { return consume_next_token(); }
     private:
         std::uint32_t length;
         const char *begin;
         const char *it;
+        const UnitRegistry *units;
     
         std::uint32_t remaining_length() const noexcept;
         char peek() const noexcept;
@@ -2,7 +2,11 @@
 #include "evaluator.hpp"
 #include "testing.hpp"
 #include "value_utils.hpp"
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
 #include <span>
 
 int main(){
@@ -167,6 +171,9 @@ int main(){
         {"\\sum_{i=1}^{4}(i^2)", 30},
         // Product: \prod_{i=1}^{5} i = 120
         {"\\prod_{i=1}^{5}(i)", 120},
+        // Loop variables shadow outer loop variables and constants
+        {"\\sum_{i=1}^{2}(\\sum_{i=1}^{3}(i))", 12},
+        {"\\sum_{h=1}^{3}(h)", 6},
 
         // Comparison operators
         {"3<5", 1}, {"5<3", 0},
@@ -255,6 +262,18 @@ int main(){
         {{"x = 100.0", "\\sig(x)"}, 4},  // 100.0 has 4 sig figs
         {{"x = 5.6 * 3.21", "\\sig(x)"}, 2}, // min(2, 3) = 2
 
+        // Dependency order: lines may use names defined further down
+        {{"y = x + 2", "x = 3", "y^2"}, 25},
+        {{"y = sq(2) + x", "sq(x) = x^3", "x = 1", "y"}, 9},
+        // Reassignment: each read sees the nearest definition above it
+        {{"x = 2", "y = x", "x = 5", "y + x"}, 7},
+        {{"x = 2", "x = x + 1", "x"}, 3},
+        // Loop variables are not dependencies
+        {{"s = \\sum_{i=1}^{3} i", "i = s"}, 6},
+        {{"x = 5", "sq(x) = x^2", "sq(3) + x"}, 14},
+        // Function bodies see globals, not the caller's loop variables
+        {{"k = 10", "add(x) = x + k", "\\sum_{k=1}^{2} add(k)"}, 23},
+
     };
 
     std::println("=== Single Expression Tests ===");
@@ -263,6 +282,20 @@ int main(){
     std::println("\n=== Multi Expression Tests ===");
     run_multi_tests(MULTI_TESTS);
 
+    std::println("\n=== Bytecode vs Tree Walker ===");
+    run_bytecode_differential_tests(ALL_TESTS, MULTI_TESTS);
+
+    std::println("\n=== Scalar Throughput ===");
+    run_scalar_throughput_benchmark(ALL_TESTS);
+    run_parse_benchmark(ALL_TESTS);
+    run_long_line_benchmark();
+    run_unit_lexing_benchmark();
+
+    std::println("\n=== Formula Search Scaling ===");
+    run_formula_search_scaling_benchmark();
+    run_formula_text_search_benchmark();
+    run_formula_rearrangement_benchmark();
+
     std::array<dv::Expression, 2> expressions = {
         dv::Expression{"a = 5 \\pm 3"},
         dv::Expression{"a[1]"}
@@ -275,7 +308,7 @@ int main(){
             std::visit([](const auto& v) {
                 using T = std::decay_t<decltype(v)>;
                 if constexpr (std::is_same_v<T, dv::UnitValue>)
-                    std::println("[VALUE]: {} {}", (double)v.value, v.unit.vec);
+                    std::println("[VALUE]: {} {}", (double)v.value, v.unit.to_array());
                 else if constexpr (std::is_same_v<T, dv::UnitValueList>)
                     std::println("[LIST]: {}", v.to_result_string());
                 else if constexpr (std::is_same_v<T, dv::BooleanValue>)
@@ -328,16 +361,16 @@ int main(){
 
     // value_to_scientific with sig_figs
     {
-        struct Case { long double v; int sf; const char* expected; };
+        struct Case { dv::Scalar v; int sf; const char* expected; };
         static const Case cases[] = {
-            {5.65L,      3,  "5.65"},            // normal range, trailing digits preserved
-            {5.60L,      3,  "5.60"},            // trailing zero after decimal
-            {17.976L,    2,  "18"},              // rounds to integer
-            {8.81L,      2,  "8.8"},             // 1 decimal place
-            {9.99L,      2,  "10"},              // rounding pushes order of magnitude
-            {0.001234L,  3,  "1.23\\times10^{-3}"},  // small → sci notation
-            {123456.0L,  3,  "1.23\\times10^{5}"},   // large → sci notation
-            {100.0L,     4,  "100.0"},           // trailing decimal digit
+            {5.65,       3,  "5.65"},            // normal range, trailing digits preserved
+            {5.60,       3,  "5.60"},            // trailing zero after decimal
+            {17.976,     2,  "18"},              // rounds to integer
+            {8.81,       2,  "8.8"},             // 1 decimal place
+            {9.99,       2,  "10"},              // rounding pushes order of magnitude
+            {0.001234,   3,  "1.23\\times10^{-3}"},  // small → sci notation
+            {123456.0,   3,  "1.23\\times10^{5}"},   // large → sci notation
+            {100.0,      4,  "100.0"},           // trailing decimal digit
         };
         bool sf_ok = true;
         for (const auto& c : cases) {
@@ -377,5 +410,560 @@ int main(){
             ok ? " ✓\033[0m" : " ✗\033[0m");
     }
 
+    // Circular definitions are reported instead of evaluated
+    {
+        std::vector<dv::Expression> cycle_exprs = {
+            dv::Expression{.value_expr = "a = b + 1"},
+            dv::Expression{.value_expr = "b = a + 1"},
+            dv::Expression{.value_expr = "c = 4"},
+        };
+        dv::Evaluator cycle_eval;
+        const auto cycle_results = cycle_eval.evaluate_expression_list(cycle_exprs);
+        bool ok = !cycle_results[0] && !cycle_results[1] && cycle_results[2];
+        std::println("{} circular dependency: {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            cycle_results[0] ? std::string{"no error"} : cycle_results[0].error(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Incremental re-evaluation: editing a line only re-runs it and its dependents
+    {
+        std::vector<dv::Expression> sheet_exprs = {
+            dv::Expression{.value_expr = "a = 2"},
+            dv::Expression{.value_expr = "b = a \\cdot 3"},
+            dv::Expression{.value_expr = "n = 10"},
+            dv::Expression{.value_expr = "b + n"},
+        };
+        dv::Evaluator sheet_eval;
+        sheet_eval.evaluate_expression_list(sheet_exprs);
+        sheet_exprs[0].value_expr = "a = 4";
+        const auto sheet_results = sheet_eval.evaluate_expression_list(sheet_exprs);
+        const auto stats = sheet_eval.last_evaluation_stats;
+        bool ok = sheet_results[3] && std::fabs((double)get_scalar_val(sheet_results[3].value()) - 22.0) < 0.001
+                  && stats.lines_evaluated == 3 && stats.lines_reused == 1;
+        std::println("{} incremental edit: evaluated={} reused={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            stats.lines_evaluated, stats.lines_reused,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Parse cache: re-submitting or restoring a line costs no lexing/parsing
+    {
+        std::vector<dv::Expression> cache_exprs = {
+            dv::Expression{.value_expr = "d = 5000", .unit_expr = "\\m", .conversion_unit_expr = "\\km"},
+            dv::Expression{.value_expr = "d^2"},
+        };
+        dv::Evaluator cache_eval;
+        cache_eval.evaluate_expression_list(cache_exprs);
+        const auto misses_after_first = cache_eval.get_parse_cache().misses();
+        cache_eval.evaluate_expression_list(cache_exprs);
+        bool ok = cache_eval.get_parse_cache().misses() == misses_after_first;
+        cache_exprs[1].value_expr = "d^3";
+        cache_eval.evaluate_expression_list(cache_exprs);
+        cache_exprs[1].value_expr = "d^2";
+        const auto hits_before_restore = cache_eval.get_parse_cache().hits();
+        const auto restored = cache_eval.evaluate_expression_list(cache_exprs);
+        ok = ok && cache_eval.get_parse_cache().misses() == misses_after_first + 1
+                && cache_eval.get_parse_cache().hits() > hits_before_restore
+                && restored[1] && std::fabs((double)get_scalar_val(restored[1].value()) - 2.5e7) < 0.001;
+        std::println("{} parse cache: hits={} misses={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            cache_eval.get_parse_cache().hits(), cache_eval.get_parse_cache().misses(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Packed unit vectors: SWAR lanes must not carry into each other
+    {
+        const dv::UnitVector newton = dv::UnitVec DIM_NEWTON, pascal = dv::UnitVec DIM_PASCAL;
+        const dv::UnitVector area = newton / pascal;
+        const auto inverse_square = newton ^ -2.0;
+        bool ok = area == dv::UnitVec{2, 0, 0, 0, 0, 0, 0}
+                  && (area * pascal) == newton
+                  && inverse_square == dv::UnitVec{-2, 4, -2, 0, 0, 0, 0}
+                  && (inverse_square * newton * newton).is_dimensionless()
+                  && (newton ^ 0.5) == dv::UnitVec{0, -1, 0, 0, 0, 0, 0}
+                  && std::hash<dv::UnitVector>{}(area * pascal) == std::hash<dv::UnitVector>{}(newton);
+        std::println("{} packed unit vector: N/Pa = {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            area.to_array(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Real fast path: arithmetic on provably real operands compiles to APPLY_REAL
+    {
+        auto count_real_ops = [](const std::string &source) {
+            dv::Evaluator real_eval;
+            dv::ParseSession session;
+            const auto parsed = session.parse(source);
+            const auto program = dv::compile(*parsed->ast, real_eval.get_symbols());
+            return std::ranges::count_if(program.code, [](const dv::Instruction &ins) { return ins.op == dv::OpCode::APPLY_REAL; });
+        };
+        const auto literal_ops = count_real_ops("2\\cdot3+\\sum_{i=1}^{3} i^2");
+        const auto variable_ops = count_real_ops("x\\cdot2");
+        bool ok = literal_ops == 3 && variable_ops == 0;
+        std::println("{} real fast path: literal={} variable={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            literal_ops, variable_ops,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Symbol compaction: names a sheet stopped using are dropped instead of growing the table forever
+    {
+        dv::Evaluator symbol_eval;
+        constexpr int rounds = 5000;
+        std::size_t peak = 0;
+        bool values_ok = true;
+        for(int i = 0; i < rounds; i++) {
+            const auto results = symbol_eval.evaluate_expression_list(std::vector<dv::Expression>{
+                dv::Expression{.value_expr = std::format("twice(t_{{{}}}) = 2t_{{{}}}", i, i)},
+                dv::Expression{.value_expr = std::format("y_{{{}}} = 3", i)},
+                dv::Expression{.value_expr = std::format("x_{{{}}} = twice(y_{{{}}})\\cdot\\frac{{m_e}}{{m_e}}", i, i)},
+            });
+            const auto *uv = results[2] ? std::get_if<dv::UnitValue>(&*results[2]) : nullptr;
+            values_ok = values_ok && uv && uv->value == 6.0;
+            peak = std::max(peak, symbol_eval.get_symbols().size());
+        }
+        bool ok = values_ok && peak < rounds && symbol_eval.fixed_constants.contains("m_e");
+        std::println("{} symbol compaction: {} sheets with fresh names, at most {} symbols{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            rounds, peak,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula query: results are index records into the shared database
+    {
+        dv::Evaluator query_eval;
+        const std::vector<dv::Expression> sheet{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "a = 2 \\m/\\s^2"},
+            dv::Expression{.value_expr = "? = \\N"},
+        };
+        query_eval.evaluate_expression_list(sheet);
+        const auto &results = query_eval.last_formula_results;
+        const auto &db = query_eval.get_formula_database();
+        bool ok = !results.empty() && results.front().depth == 0
+               && db[results.front().index].name() == "Newton's Second Law";
+        std::println("{} formula query: {} results, first = {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            results.size(),
+            results.empty() ? std::string_view{} : db[results.front().index].name(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula suggestions: repeated queries over the same multiset of units reuse the search
+    {
+        dv::Evaluator suggest_eval;
+        const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0};
+        suggest_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "a = 2 \\m/\\s^2"},
+        });
+        const auto first = suggest_eval.get_available_formulas(newton);
+        const auto again = suggest_eval.get_available_formulas(newton);
+        // Same units (ans included) under new names and values: still a hit
+        suggest_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "M = 3 \\kg"},
+            dv::Expression{.value_expr = "g = 9.8 \\m/\\s^2"},
+        });
+        const auto renamed = suggest_eval.get_available_formulas(newton);
+        const auto cached = suggest_eval.formula_suggestion_stats;
+        // A new unit in the pool searches again
+        suggest_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "t = 2 \\s"},
+        });
+        const auto changed = suggest_eval.get_available_formulas(newton);
+        const auto stats = suggest_eval.formula_suggestion_stats;
+        const auto same = [](const auto &a, const auto &b) {
+            return std::ranges::equal(a, b, [](const auto &x, const auto &y) { return x.index == y.index && x.depth == y.depth; });
+        };
+        bool ok = !first.empty() && same(first, again) && same(first, renamed)
+               && cached.searches == 1 && cached.hits == 2 && stats.searches == 2 && !same(first, changed);
+        std::println("{} formula suggestions: {} searches, {} hits{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            stats.searches, stats.hits,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Unit symbols: the longest unit a command starts with wins, prefixed or not
+    {
+        auto lex_unit = [](std::string_view source) {
+            dv::Lexer lexer{source};
+            const auto tokens = lexer.extract_all_tokens();
+            return tokens && tokens->size() == 2 ? std::optional{tokens->front()} : std::nullopt;
+        };
+        struct UnitCase { std::string_view source; double value; dv::UnitVector unit; };
+        const std::array<UnitCase, 8> cases{{
+            {"\\m", 1, DIM_METER}, {"\\mm", 1e-3, DIM_METER}, {"\\mu m", 1e-6, DIM_METER},
+            {"\\mu mol", 1e-6, DIM_MOLE}, {"\\mOhm", 1e-3, DIM_OHM}, {"\\kg", 1, DIM_KILOGRAM},
+            {"\\hour", 3600, DIM_SECOND}, {"\\mi", 1609.34, DIM_METER},
+        }};
+        std::size_t matched = 0;
+        for(const auto &[source, value, unit] : cases) {
+            const auto token = lex_unit(source);
+            matched += token && token->text == source.substr(1) && (double)token->value.value == value && token->value.unit == unit;
+        }
+        bool ok = matched == cases.size();
+        std::println("{} unit symbols: {}/{} matched{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            matched, cases.size(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Zero-copy tokens: token text views the source, and a cloned tree keeps its own copy
+    {
+        const std::string source = "x_{1} + \\text{speed} \\cdot 2.5 \\km - \\sin(\\theta)";
+        dv::Lexer lexer{source};
+        const auto tokens = lexer.extract_all_tokens();
+        const bool in_source = tokens && std::ranges::all_of(*tokens, [&](const dv::Token &token) {
+            return token.type == dv::TokenType::TEOF
+                || (token.text.data() >= source.data() && token.text.data() + token.text.size() <= source.data() + source.size());
+        });
+        dv::ParseSession kept;
+        std::unique_ptr<dv::AST> copy;
+        std::string printed;
+        {
+            dv::ParseSession scratch;
+            const auto parsed = scratch.parse("\\frac{v_{0}}{2} + \\sum_{i=1}^{3} i \\cdot \\text{speed}");
+            if(parsed) {
+                printed = parsed->ast->to_string();
+                copy = kept.clone(*parsed->ast);
+            }
+        }
+        bool ok = in_source && copy && copy->to_string() == printed;
+        std::println("{} zero-copy tokens: {} tokens view the source, clone outlives its session: {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            tokens ? tokens->size() : 0, copy && copy->to_string() == printed,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // AST arena: a session's nodes sit in its arena, nodes made outside a session on the heap
+    {
+        dv::ParseSession session, copies;
+        const auto parsed = session.parse("\\frac{a}{b} + \\sqrt{c} \\cdot \\sum_{i=1}^{3} i^2");
+        std::size_t nodes = 0, in_arena = 0;
+        auto count = [&](auto &self, const dv::AST &ast, const dv::Arena &arena) -> void {
+            nodes++;
+            in_arena += arena.owns(&ast);
+            if(const auto *expr = std::get_if<dv::AST::ASTExpression>(&ast.data)) {
+                if(expr->lhs) self(self, *expr->lhs, arena);
+                if(expr->rhs) self(self, *expr->rhs, arena);
+                return;
+            }
+            const auto &call = std::get<dv::AST::ASTCall>(ast.data);
+            for(const auto &arg : call.args) self(self, *arg, arena);
+            if(call.special_value) self(self, *call.special_value, arena);
+        };
+        if(parsed) count(count, *parsed->ast, session.get_arena());
+        const auto parsed_nodes = nodes, parsed_in_arena = in_arena;
+        nodes = in_arena = 0;
+        const auto copy = parsed ? copies.clone(*parsed->ast) : nullptr;
+        if(copy) count(count, *copy, copies.get_arena());
+        const auto heap_node = std::make_unique<dv::AST>();
+        bool ok = parsed && parsed_nodes > 10 && parsed_in_arena == parsed_nodes && in_arena == nodes && nodes == parsed_nodes
+               && session.get_arena().block_count() == 1 && !session.get_arena().owns(heap_node.get());
+        std::println("{} AST arena: {}/{} parsed nodes and {}/{} cloned nodes in their session's arena{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            parsed_in_arena, parsed_nodes, in_arena, nodes,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Streaming lexer: the parser pulls tokens through a small ring, even for a long literal
+    {
+        std::string matrix = "\\begin{bmatrix}";
+        for(std::int32_t row = 0; row < 40; row++) {
+            for(std::int32_t column = 0; column < 40; column++) matrix += std::format("{}{}", column ? " & " : "", row * 40 + column);
+            matrix += row < 39 ? " \\\\ " : " \\end{bmatrix}";
+        }
+        dv::Lexer lexer{matrix};
+        dv::TokenStream tokens{lexer};
+        dv::Parser parser{tokens};
+        const bool parsed = parser.parse().has_value() && tokens.finish().has_value();
+        dv::ParseSession session;
+        const auto late_error = session.parse("x + 1 @");
+        const auto integral = session.parse("\\int_{0}^{1} \\int_{0}^{2} x y \\, dy \\, dx");
+        bool ok = parsed && tokens.get_position() > 3000 && tokens.capacity() <= 16
+               && !late_error && late_error.error().starts_with("Unknown Token") && integral.has_value();
+        std::println("{} streaming lexer: {} tokens read through a ring of {}, late lexing error: {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            tokens.get_position(), tokens.capacity(), late_error ? std::string{"none"} : late_error.error(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Custom units: an evaluator's added units lex like the built-in ones, and only for that evaluator
+    {
+        dv::Evaluator unit_eval, plain_eval;
+        const dv::UnitVector pascal = dv::UnitVec DIM_PASCAL;
+        const bool added = unit_eval.add_unit("psi", 6894.757, pascal).has_value()
+                        && unit_eval.add_unit("bar", 1e5, pascal, true).has_value();
+        const bool rejected = !unit_eval.add_unit("m", 1, dv::UnitVec DIM_METER)
+                           && !unit_eval.add_unit("ba r", 1, pascal) && !unit_eval.add_unit("", 1, pascal);
+        auto in_pascal = [&](dv::Evaluator &eval, std::string_view source) {
+            const auto value = eval.evaluate_expression(dv::Expression{.value_expr = std::string{source}});
+            const auto *uv = value ? std::get_if<dv::UnitValue>(&*value) : nullptr;
+            return uv && uv->unit == pascal ? (double)uv->value : -1.0;
+        };
+        const double psi = in_pascal(unit_eval, "2 \\psi"), mbar = in_pascal(unit_eval, "\\mbar");
+        bool ok = added && rejected && std::abs(psi - 13789.514) < 1e-6 && std::abs(mbar - 100.0) < 1e-9
+               && in_pascal(plain_eval, "\\bar") == -1.0 && plain_eval.get_units().size() + 2 + 14 == unit_eval.get_units().size();
+        std::println("{} custom units: 2 psi={} Pa, 1 mbar={} Pa, {} units{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            psi, mbar, unit_eval.get_units().size(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula execution: a found formula runs on the sheet's values, and a chain derives its missing inputs
+    {
+        dv::Evaluator run_eval;
+        const auto &db = run_eval.get_formula_database();
+        const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0};
+        const auto second_law = std::ranges::find_if(db.producing(newton), [&](std::uint32_t i) {
+            return db[i].name() == "Newton's Second Law";
+        });
+        run_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "a = 2 \\m/\\s^2"},
+        });
+        const auto direct = run_eval.evaluate_formula(*second_law);
+        run_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "v = 6 \\m/\\s"},
+            dv::Expression{.value_expr = "t = 3 \\s"},
+        });
+        const auto missing = run_eval.evaluate_formula(*second_law);
+        const auto chained = run_eval.evaluate_formula_chain(newton, *second_law);
+        auto force = [](const dv::Evaluator::MaybeEvaluated &value) {
+            const auto *uv = value ? std::get_if<dv::UnitValue>(&*value) : nullptr;
+            return uv && uv->unit == dv::UnitVector{1, -2, 1, 0, 0, 0, 0} ? (double)uv->value : -1.0;
+        };
+        bool ok = force(direct) == 10.0 && !missing && std::abs(force(chained) - 10.0) < 1e-9;
+        std::println("{} formula execution: direct={} chained={} without chain: {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            force(direct), force(chained), missing ? std::string{"ran"} : missing.error(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula chain with a partly covered unit: the sheet's mass is kept and only the second mass is derived
+    {
+        dv::Evaluator mass_eval;
+        const auto &db = mass_eval.get_formula_database();
+        const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0};
+        const auto gravitation = std::ranges::find_if(db.producing(newton), [&](std::uint32_t i) {
+            return db[i].name() == "Newton's Law of Gravitation";
+        });
+        mass_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "G = 6.674*10^{-11} \\N\\m^2/\\kg^2"},
+            dv::Expression{.value_expr = "m_1 = 5 \\kg"},
+            dv::Expression{.value_expr = "r = 2 \\m"},
+            dv::Expression{.value_expr = "\\rho = 1000 \\kg/\\m^3"},
+            dv::Expression{.value_expr = "V = 0.002 \\m^3"},
+        });
+        dv::Evaluator::MaybeEvaluated chained = std::unexpected{std::string{"No Newton's Law of Gravitation"}};
+        if(gravitation != db.producing(newton).end()) chained = mass_eval.evaluate_formula_chain(newton, *gravitation);
+        const auto *uv = chained ? std::get_if<dv::UnitValue>(&*chained) : nullptr;
+        const double expected = 6.674e-11 * 5.0 * 2.0 / (2.0 * 2.0);   // G m_1 (rho V) / r^2
+        bool ok = uv && uv->unit == newton && std::abs(uv->value / expected - 1.0) < 1e-3;
+        std::println("{} formula chain, shared unit: F={} (expected {}){}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            uv ? (double)uv->value : -1.0, expected, chained ? std::string{} : " " + chained.error(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula rearrangement: derived forms are solved from the family's equation on first use
+    {
+        dv::Evaluator solve_eval;
+        const auto &db = solve_eval.get_formula_database();
+        auto find = [&](std::string_view name, std::string_view output) {
+            for(std::size_t i = 0; i < db.size(); i++)
+                if(db[i].name() == name && db[i].output() && db[i].output()->name == output) return i;
+            return db.size();
+        };
+        const auto acceleration = find("Newton's Second Law", "a"), position = find("Velocity-Position", "a");
+        const auto &latex = solve_eval.formula_latex(acceleration);
+        solve_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "F = 10 \\N"},
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "v = 5 \\m/\\s"},
+            dv::Expression{.value_expr = "v_0 = 1 \\m/\\s"},
+            dv::Expression{.value_expr = "x = 7 \\m"},
+            dv::Expression{.value_expr = "x_0 = 1 \\m"},
+        });
+        auto value = [](const dv::Evaluator::MaybeEvaluated &result) {
+            const auto *uv = result ? std::get_if<dv::UnitValue>(&*result) : nullptr;
+            return uv ? (double)uv->value : -1.0;
+        };
+        const double from_newton = value(solve_eval.evaluate_formula(acceleration));
+        const double from_position = value(solve_eval.evaluate_formula(position));   // (25 - 1) / (2 * 6)
+        const bool derived = acceleration < db.size() && db[acceleration].derived() && position < db.size() && db[position].derived();
+        bool ok = derived && latex && *latex == "a = \\frac{F}{m}"
+            && std::abs(from_newton - 2.0) < 1e-9 && std::abs(from_position - 2.0) < 1e-9;
+        std::println("{} formula rearrangement: {} newton={} velocity-position={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            latex ? *latex : latex.error(), from_newton, from_position,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Derived formulas: every form stored without text must be one the native engine can solve
+    {
+        dv::Evaluator derived_eval;
+        const auto &db = derived_eval.get_formula_database();
+        std::size_t derived = 0, solved = 0;
+        std::string first_failure;
+        for(std::size_t i = 0; i < db.size(); i++) {
+            if(!db[i].derived()) continue;
+            derived++;
+            dv::SymbolTable symbols;
+            const auto &latex = derived_eval.formula_latex(i);
+            const auto compiled = dv::compile_formula(db[i], symbols);
+            if(latex && compiled) solved++;
+            else if(first_failure.empty()) first_failure = latex ? compiled.error() : latex.error();
+        }
+        bool ok = derived > 0 && solved == derived;
+        std::println("{} derived formulas: {}/{} solved{}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            solved, derived, first_failure.empty() ? first_failure : ", " + first_failure,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula text search: words match names and descriptions, misspellings match by trigrams
+    {
+        const dv::Evaluator text_eval;
+        const auto &db = text_eval.get_formula_database();
+        auto top = [&](std::string_view query) {
+            const auto found = text_eval.search_formulas(query, 5);
+            return found.empty() ? std::string_view{} : db[found.front().index].name();
+        };
+        const auto exact = top("coulomb force charge"), fuzzy = top("colomb's law"), none = top("zzzz qqqq");
+        // "masz" shares 2 of its 4 trigrams with the 4 of "mass": a Jaccard similarity of 1/3
+        const auto short_fuzzy = top("masz");
+        bool ok = exact == "Coulomb's Law" && fuzzy == "Coulomb's Law" && none.empty() && !short_fuzzy.empty();
+        std::println("{} formula text search: exact={} fuzzy={} short fuzzy={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            exact, fuzzy, short_fuzzy,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula pack: the generated pack matches the compiled-in tables and can back a search
+    {
+        const auto pack = Physics::FormulaPack::map_file(NERO_FORMULA_PACK);
+        const auto &builtin = formula_database;
+        bool same = pack && (*pack)->database().size() == builtin.size();
+        for(std::size_t i = 0; same && i < builtin.size(); i++) {
+            const auto &a = builtin[i];
+            const auto &b = (*pack)->database()[i];
+            same = a.name() == b.name() && a.latex == b.latex && a.family->equation == b.family->equation && a.solve_for == b.solve_for
+                && a.variables().size() == b.variables().size();
+            for(std::size_t v = 0; same && v < a.variables().size(); v++)
+                same = a.variables()[v].name == b.variables()[v].name
+                    && a.variables()[v].units == b.variables()[v].units;
+        }
+        const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0};
+        same = same && std::ranges::equal(builtin.producing(newton), (*pack)->database().producing(newton));
+
+        std::vector<std::byte> truncated(16);
+        const bool rejected = !Physics::FormulaPack::from_bytes(truncated);
+
+        dv::Evaluator pack_eval;
+        if(pack) pack_eval.use_formula_pack(*pack);
+        pack_eval.evaluate_expression_list(std::vector<dv::Expression>{
+            dv::Expression{.value_expr = "m = 5 \\kg"},
+            dv::Expression{.value_expr = "a = 2 \\m/\\s^2"},
+            dv::Expression{.value_expr = "? = \\N"},
+        });
+        const auto &results = pack_eval.last_formula_results;
+        const bool searched = !results.empty()
+            && pack_eval.get_formula_database()[results.front().index].name() == "Newton's Second Law";
+
+        bool ok = same && rejected && searched;
+        std::println("{} formula pack: {}, matches builtin={} rejects truncated={} search={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            pack ? std::string{"mapped"} : pack.error(),
+            same, rejected, searched,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Derived formulas without a target: a pack naming none is rejected, and a hand-built one reports an error
+    {
+        std::ifstream file{NERO_FORMULA_PACK, std::ios::binary};
+        std::vector<std::byte> bytes;
+        for(char c; file.get(c);) bytes.push_back(static_cast<std::byte>(c));
+        auto header = [&](std::size_t field) {
+            std::uint32_t value = 0;
+            std::memcpy(&value, bytes.data() + 4 * field, sizeof value);
+            return std::uint64_t{value};
+        };
+        // Section offsets as laid out in formula_pack.hpp
+        auto align8 = [](std::uint64_t n) { return (n + 7) & ~std::uint64_t{7}; };
+        const auto formulas_at = 32 + align8(header(6) * 16) + align8(header(7) * 4)
+                               + align8(header(3) * 32) + align8(header(4) * 32);
+        bool patched = false;
+        for(std::uint64_t i = 0; !patched && bytes.size() >= 32 && i < header(5); i++) {
+            std::byte *at = bytes.data() + formulas_at + i * 16;
+            std::uint32_t latex_length = 0;
+            std::memcpy(&latex_length, at + 4, sizeof latex_length);
+            if(latex_length != 0) continue;
+            const std::uint32_t none = Physics::Formula::no_solve_for;
+            std::memcpy(at + 12, &none, sizeof none);
+            patched = true;
+        }
+        const auto loaded = Physics::FormulaPack::from_bytes(std::move(bytes));
+
+        const auto &family = *formula_database[0].family;
+        const Physics::Formula untargeted{&family, "", Physics::Formula::no_solve_for};
+        const auto latex = dv::formula_latex(untargeted);
+        const auto expression = dv::formula_expression(untargeted);
+
+        bool ok = patched && !loaded && !latex && !expression;
+        std::println("{} derived without target: pack {}, latex {}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            loaded ? std::string{"loaded"} : loaded.error(),
+            latex ? *latex : latex.error(),
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Formula chaining: plans respect the depth limit and a deeper limit finds deeper chains
+    {
+        FormulaSearcher chain_searcher;
+        const std::vector<dv::UnitVector> pool{ {0, 0, 1, 0, 0, 0, 0}, {1, -2, 0, 0, 0, 0, 0} };   // kg, m/s^2
+        const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0};
+        auto deepest = [&](int max_depth) {
+            int depth = -1;
+            for(const auto &plan : chain_searcher.plan_derivations(pool, newton, ChainOptions{.max_depth = max_depth}))
+                for(const auto &step : plan.steps) depth = std::max(depth, step.depth);
+            return depth;
+        };
+        const auto direct = chain_searcher.plan_derivations(pool, newton, ChainOptions{.max_depth = 0});
+        const bool direct_ok = !direct.empty() && std::ranges::all_of(direct, [&](const DerivationPlan &plan) {
+            return plan.steps.size() == 1 && plan.cost == direct.front().cost;
+        });
+        const int two = deepest(2), four = deepest(4);
+        bool ok = direct_ok && two == 2 && four > 2 && four <= 4;
+        std::println("{} formula chaining: direct plans={} deepest at limit 2={} at limit 4={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            direct.size(), two, four,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
+    // Parallel formula search: splitting a large catalogue over threads gives the same plans
+    {
+        const ReplicatedCatalogue replicated{8};
+        const Physics::FormulaDatabase database{replicated.catalogue()};
+        const FormulaSearcher parallel_searcher{database};
+        const std::vector<dv::UnitVector> pool{ {0, 0, 1, 0, 0, 0, 0}, {1, -2, 0, 0, 0, 0, 0} };   // kg, m/s^2
+        const dv::UnitVector joule{2, -2, 1, 0, 0, 0, 0};
+        const auto serial = parallel_searcher.plan_derivations(pool, joule, ChainOptions{.max_depth = 3});
+        const auto split = parallel_searcher.plan_derivations(pool, joule, ChainOptions{.max_depth = 3, .threads = 4});
+        const bool same = std::ranges::equal(serial, split, [](const DerivationPlan &a, const DerivationPlan &b) {
+            return a.cost == b.cost && std::ranges::equal(a.steps, b.steps, [](const auto &x, const auto &y) {
+                return x.index == y.index && x.depth == y.depth;
+            });
+        });
+        bool ok = !serial.empty() && same;
+        std::println("{} formula parallel search: {} formulas, {} plans, same as serial={}{}",
+            ok ? "\033[0;32m[PASS]" : "\033[31m[FAIL]",
+            database.size(), serial.size(), same,
+            ok ? " ✓\033[0m" : " ✗\033[0m");
+    }
+
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,242 @@
+#include "operators.hpp"
+#include "builtins.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <numeric>
+
+using dv::ops::get_real;
+using dv::ops::get_imag;
+using dv::ops::get_unit;
+using dv::ops::as_uv;
+
+dv::Scalar dv::ops::get_real(const dv::EValue &e) {
+    if (auto p = std::get_if<dv::UnitValue>(&e)) return p->value;
+    if (auto p = std::get_if<dv::UnitValueList>(&e)) return p->elements.empty() ? 0.0 : p->elements[0].value;
+    if (auto p = std::get_if<dv::BooleanValue>(&e)) return p->value ? 1.0 : 0.0;
+    return 0.0;
+}
+
+dv::Scalar dv::ops::get_imag(const dv::EValue &e) {
+    if (auto p = std::get_if<dv::UnitValue>(&e)) return p->imag;
+    return 0.0;
+}
+
+dv::UnitVector dv::ops::get_unit(const dv::EValue &e) {
+    if (auto p = std::get_if<dv::UnitValue>(&e)) return p->unit;
+    if (auto p = std::get_if<dv::UnitValueList>(&e))
+        return p->elements.empty() ? dv::UnitVector{dv::DIMENSIONLESS_VEC} : p->elements[0].unit;
+    return dv::UnitVector{dv::DIMENSIONLESS_VEC};
+}
+
+dv::UnitValue dv::ops::as_uv(const dv::EValue &e) {
+    if (auto p = std::get_if<dv::UnitValue>(&e)) return *p;
+    if (auto p = std::get_if<dv::UnitValueList>(&e)) return p->elements.empty() ? dv::UnitValue{} : p->elements[0];
+    if (auto p = std::get_if<dv::BooleanValue>(&e)) return dv::UnitValue{p->value ? 1.0 : 0.0};
+    return dv::UnitValue{};
+}
+
+bool dv::is_eager_operator(dv::TokenType type) noexcept {
+    switch (type) {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::PLUS_MINUS:
+        case TokenType::TIMES:
+        case TokenType::DIVIDE:
+        case TokenType::FRACTION:
+        case TokenType::EXPONENT:
+        case TokenType::FACTORIAL:
+        case TokenType::PERCENT:
+        case TokenType::MODULO:
+        case TokenType::LESS_THAN:
+        case TokenType::GREATER_THAN:
+        case TokenType::LESS_EQUAL:
+        case TokenType::GREATER_EQUAL:
+        case TokenType::LOGICAL_AND:
+        case TokenType::LOGICAL_OR:
+        case TokenType::LOGICAL_NOT:
+        case TokenType::ARRAY_LITERAL:
+        case TokenType::INDEX_ACCESS:
+        case TokenType::BUILTIN_FUNC_LN:
+        case TokenType::BUILTIN_FUNC_SIN:
+        case TokenType::BUILTIN_FUNC_COS:
+        case TokenType::BUILTIN_FUNC_TAN:
+        case TokenType::BUILTIN_FUNC_SEC:
+        case TokenType::BUILTIN_FUNC_CSC:
+        case TokenType::BUILTIN_FUNC_COT:
+        case TokenType::BUILTIN_FUNC_LOG:
+        case TokenType::ABSOLUTE_BAR:
+        case TokenType::BUILTIN_FUNC_ABS:
+        case TokenType::BUILTIN_FUNC_NCR:
+        case TokenType::BUILTIN_FUNC_NPR:
+        case TokenType::BUILTIN_FUNC_SQRT:
+        case TokenType::BUILTIN_FUNC_CEIL:
+        case TokenType::BUILTIN_FUNC_FACT:
+        case TokenType::BUILTIN_FUNC_FLOOR:
+        case TokenType::BUILTIN_FUNC_ROUND:
+        case TokenType::BUILTIN_FUNC_ARCSIN:
+        case TokenType::BUILTIN_FUNC_ARCCOS:
+        case TokenType::BUILTIN_FUNC_ARCTAN:
+        case TokenType::BUILTIN_FUNC_ARCSEC:
+        case TokenType::BUILTIN_FUNC_ARCCSC:
+        case TokenType::BUILTIN_FUNC_ARCCOT:
+        case TokenType::BUILTIN_FUNC_VALUE:
+        case TokenType::BUILTIN_FUNC_UNIT:
+        case TokenType::BUILTIN_FUNC_MIN:
+        case TokenType::BUILTIN_FUNC_MAX:
+        case TokenType::BUILTIN_FUNC_GCD:
+        case TokenType::BUILTIN_FUNC_LCM:
+        case TokenType::BUILTIN_FUNC_SIG:
+        case TokenType::BUILTIN_FUNC_RE:
+        case TokenType::BUILTIN_FUNC_IM:
+        case TokenType::BUILTIN_FUNC_CONJ:
+            return true;
+        default: return false;
+    }
+}
+
+dv::MaybeEValue dv::apply_operator(dv::TokenType type, std::span<const dv::EValue> operands) {
+    switch (type) {
+        case TokenType::PLUS:
+            if(operands.size() == 1) return operands[0];
+            return operands[0] + operands[1];
+        case TokenType::MINUS:
+            if(operands.size() == 1) return -operands[0];
+            return operands[0] - operands[1];
+        case TokenType::PLUS_MINUS: {
+            // Returns UnitValueList {lhs+rhs, lhs-rhs}
+            UnitValue l = as_uv(operands[0]), r = as_uv(operands[1]);
+            UnitValueList result;
+            result.elements = {l + r, l - r};
+            return result;
+        }
+        case TokenType::TIMES:
+            return operands[0] * operands[1];
+        case TokenType::DIVIDE:
+        case TokenType::FRACTION:
+            return operands[0] / operands[1];
+        case TokenType::EXPONENT:
+            return operands[0] ^ operands[1];
+        case TokenType::FACTORIAL:
+            return dv::evalue_fact(operands[0]);
+        case TokenType::PERCENT:
+            return operands[0] / EValue{UnitValue{100.0}};
+        case TokenType::MODULO:
+            return UnitValue{std::fmod((double)get_real(operands[0]), (double)get_real(operands[1]))};
+        // Comparison operators
+        case TokenType::LESS_THAN:
+            return UnitValue{get_real(operands[0]) < get_real(operands[1]) ? 1.0 : 0.0};
+        case TokenType::GREATER_THAN:
+            return UnitValue{get_real(operands[0]) > get_real(operands[1]) ? 1.0 : 0.0};
+        case TokenType::LESS_EQUAL:
+            return UnitValue{get_real(operands[0]) <= get_real(operands[1]) ? 1.0 : 0.0};
+        case TokenType::GREATER_EQUAL:
+            return UnitValue{get_real(operands[0]) >= get_real(operands[1]) ? 1.0 : 0.0};
+        case TokenType::LOGICAL_AND:
+            return UnitValue{(get_real(operands[0]) != 0.0 && get_real(operands[1]) != 0.0) ? 1.0 : 0.0};
+        case TokenType::LOGICAL_OR:
+            return UnitValue{(get_real(operands[0]) != 0.0 || get_real(operands[1]) != 0.0) ? 1.0 : 0.0};
+        case TokenType::LOGICAL_NOT:
+            return UnitValue{get_real(operands[0]) == 0.0 ? 1.0 : 0.0};
+        // Array literal — returns UnitValueList
+        case TokenType::ARRAY_LITERAL: {
+            if(operands.empty()) return EValue{UnitValueList{}};
+            UnitValueList result;
+            result.elements.reserve(operands.size());
+            for(const auto &operand : operands) result.elements.push_back(as_uv(operand));
+            return result;
+        }
+        // Array indexing
+        case TokenType::INDEX_ACCESS: {
+            std::size_t index = (std::size_t)get_real(operands[1]);
+            if(auto* list = std::get_if<UnitValueList>(&operands[0])) {
+                if(index >= list->elements.size()) {
+                    return std::unexpected{std::format("Index {} out of bounds (size {})", index, list->elements.size())};
+                }
+                return list->elements[index];
+            }
+            // Single UnitValue — only index 0 valid
+            if(index != 0)
+                return std::unexpected{std::format("Index {} out of bounds (scalar value)", index)};
+            return as_uv(operands[0]);
+        }
+        // Builtins
+        case TokenType::BUILTIN_FUNC_LN:  return dv::builtins::ln(as_uv(operands[0]));
+        case TokenType::BUILTIN_FUNC_SIN: return dv::builtins::sin(as_uv(operands[0]));
+        case TokenType::BUILTIN_FUNC_COS: return dv::builtins::cos(as_uv(operands[0]));
+        case TokenType::BUILTIN_FUNC_TAN: return dv::builtins::tan(as_uv(operands[0]));
+        case TokenType::BUILTIN_FUNC_SEC: return dv::builtins::sec(as_uv(operands[0]).value);
+        case TokenType::BUILTIN_FUNC_CSC: return dv::builtins::csc(as_uv(operands[0]).value);
+        case TokenType::BUILTIN_FUNC_COT: return dv::builtins::cot(as_uv(operands[0]).value);
+        case TokenType::BUILTIN_FUNC_LOG:
+            if(operands.size() == 1) return dv::builtins::log(get_real(operands[0]));
+            return dv::builtins::log(get_real(operands[0]), (std::int32_t)get_real(operands[1]));
+        case TokenType::ABSOLUTE_BAR:
+        case TokenType::BUILTIN_FUNC_ABS:
+            return dv::builtins::abs(operands[0]);
+        case TokenType::BUILTIN_FUNC_NCR: return dv::builtins::nCr(get_real(operands[0]), get_real(operands[1]));
+        case TokenType::BUILTIN_FUNC_NPR: return dv::builtins::nPr(get_real(operands[0]), get_real(operands[1]));
+        case TokenType::BUILTIN_FUNC_SQRT: {
+            // Handle sqrt of negative value → pure imaginary
+            if(auto* uv = std::get_if<UnitValue>(&operands[0])) {
+                if(uv->value < 0.0 && uv->imag == 0.0 && operands.size() == 1) {
+                    return UnitValue{0.0, (dv::Scalar)std::sqrt((double)(-uv->value)), uv->unit};
+                }
+            }
+            if(operands.size() == 1) return dv::builtins::nthsqrt(operands[0], 2.0);
+            return dv::builtins::nthsqrt(operands[0], (double)get_real(operands[1]));
+        }
+        case TokenType::BUILTIN_FUNC_CEIL:  return dv::builtins::ceil(operands[0]);
+        case TokenType::BUILTIN_FUNC_FACT:  return dv::builtins::factorial(operands[0]);
+        case TokenType::BUILTIN_FUNC_FLOOR: return dv::builtins::floor(operands[0]);
+        case TokenType::BUILTIN_FUNC_ROUND: return dv::builtins::round(operands[0], (double)get_real(operands[1]));
+        case TokenType::BUILTIN_FUNC_ARCSIN: return dv::builtins::arcsin(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_ARCCOS: return dv::builtins::arccos(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_ARCTAN: return dv::builtins::arctan(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_ARCSEC: return dv::builtins::arcsec(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_ARCCSC: return dv::builtins::arccsc(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_ARCCOT: return dv::builtins::arccot(get_real(operands[0]));
+        case TokenType::BUILTIN_FUNC_VALUE:  return UnitValue{get_real(operands[0])};
+        case TokenType::BUILTIN_FUNC_UNIT:   return UnitValue{1.0, get_unit(operands[0])};
+        // min, max, gcd, lcm
+        case TokenType::BUILTIN_FUNC_MIN: {
+            dv::Scalar result = get_real(operands[0]);
+            for(std::size_t i = 1; i < operands.size(); i++) result = std::min(result, get_real(operands[i]));
+            return UnitValue{result, get_unit(operands[0])};
+        }
+        case TokenType::BUILTIN_FUNC_MAX: {
+            dv::Scalar result = get_real(operands[0]);
+            for(std::size_t i = 1; i < operands.size(); i++) result = std::max(result, get_real(operands[i]));
+            return UnitValue{result, get_unit(operands[0])};
+        }
+        case TokenType::BUILTIN_FUNC_GCD: {
+            long long result = (long long)get_real(operands[0]);
+            for(std::size_t i = 1; i < operands.size(); i++) result = std::gcd(result, (long long)get_real(operands[i]));
+            return UnitValue{(dv::Scalar)result};
+        }
+        case TokenType::BUILTIN_FUNC_LCM: {
+            long long result = (long long)get_real(operands[0]);
+            for(std::size_t i = 1; i < operands.size(); i++) result = std::lcm(result, (long long)get_real(operands[i]));
+            return UnitValue{(dv::Scalar)result};
+        }
+        // sig(x) — returns the significant figures count of the evaluated variable
+        case TokenType::BUILTIN_FUNC_SIG: {
+            dv::Scalar sf = 0.0;
+            if (const auto* uv = std::get_if<UnitValue>(&operands[0]))
+                sf = (dv::Scalar)uv->sig_figs;
+            else if (const auto* uvl = std::get_if<UnitValueList>(&operands[0]))
+                sf = uvl->elements.empty() ? 0.0 : (dv::Scalar)uvl->elements[0].sig_figs;
+            return UnitValue{sf};
+        }
+        // Complex number builtins
+        case TokenType::BUILTIN_FUNC_RE: return UnitValue{get_real(operands[0]), get_unit(operands[0])};
+        case TokenType::BUILTIN_FUNC_IM: return UnitValue{get_imag(operands[0]), get_unit(operands[0])};
+        case TokenType::BUILTIN_FUNC_CONJ: {
+            auto uv = as_uv(operands[0]);
+            uv.imag = -uv.imag;
+            return uv;
+        }
+        default: break;
+    }
+    return std::unexpected{std::format("Unsupported operator (token type {})", static_cast<std::int32_t>(type))};
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "dimeval.hpp"
+#include "token.hpp"
+#include <expected>
+#include <span>
+#include <string>
+
+namespace dv {
+    using MaybeEValue = std::expected<EValue, std::string>;
+
+    // ============================================================================
+    // Helpers for extracting from the EValue variant
+    // ============================================================================
+    namespace ops {
+        // Real (scalar) part
+        Scalar get_real(const EValue &e);
+        // Imaginary part
+        Scalar get_imag(const EValue &e);
+        // Unit vector
+        UnitVector get_unit(const EValue &e);
+        // Extract as UnitValue (first element for lists)
+        UnitValue as_uv(const EValue &e);
+    }
+
+    // Operators whose result depends only on their evaluated operands. Operands are the
+    // node's lhs then rhs, or its args then special value, in that order; an absent rhs or
+    // special value (unary minus, \log without a base, \sqrt without an index) is omitted.
+    bool is_eager_operator(TokenType type) noexcept;
+    MaybeEValue apply_operator(TokenType type, std::span<const EValue> operands);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace dv {
+    // Threads to split `count` items over so that each gets at least `grain`:
+    // `requested` 0 means one per hardware thread. Always 1 in the WASM build,
+    // which is compiled without thread support.
+    inline unsigned parallel_thread_count(unsigned requested, std::size_t count, std::size_t grain = 1) noexcept {
+#ifdef __EMSCRIPTEN__
+        return 1;
+#else
+        if(requested == 0) requested = std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t useful = std::max<std::size_t>(1, count / std::max<std::size_t>(1, grain));
+        return static_cast<unsigned>(std::min<std::size_t>(requested, useful));
+#endif
+    }
+
+    // Splits [0, count) into `threads` contiguous chunks and calls fn(chunk, begin, end)
+    // for each, the first on the calling thread. The chunks depend only on count and
+    // threads, so results stored per chunk and joined in chunk order are the same
+    // for any thread count.
+    template<typename Fn>
+    void parallel_chunks(std::size_t count, unsigned threads, Fn &&fn) {
+        threads = std::max(1u, threads);
+        auto bounds = [&](unsigned chunk) { return count * chunk / threads; };
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for(unsigned chunk = 1; chunk < threads; chunk++)
+            workers.emplace_back([&fn, chunk, begin = bounds(chunk), end = bounds(chunk + 1)] { fn(chunk, begin, end); });
+        fn(0u, bounds(0), bounds(1));
+    }
+}
@@ -0,0 +1,33 @@
+#include "parse_cache.hpp"
+#include "parser.hpp"
+
+const dv::MaybeSharedCompiledExpression* dv::ParseCache::find(std::string_view source){
+    auto found = index.find(source);
+    if(found == index.end()) {
+        miss_count++;
+        return nullptr;
+    }
+    hit_count++;
+    entries.splice(entries.begin(), entries, found->second);
+    return &found->second->parsed;
+}
+
+const dv::MaybeSharedCompiledExpression& dv::ParseCache::insert(std::string source, MaybeSharedCompiledExpression parsed){
+    if(auto found = index.find(source); found != index.end()) {
+        found->second->parsed = std::move(parsed);
+        entries.splice(entries.begin(), entries, found->second);
+        return entries.front().parsed;
+    }
+    entries.push_front(Entry{std::move(source), std::move(parsed)});
+    index.emplace(entries.front().source, entries.begin());
+    while(index.size() > max_entries) {
+        index.erase(entries.back().source);
+        entries.pop_back();
+    }
+    return entries.front().parsed;
+}
+
+void dv::ParseCache::clear() noexcept{
+    index.clear();
+    entries.clear();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dv {
+    struct CompiledExpression;
+    // Parsed expressions are immutable once cached and shared between the cache and sheet lines
+    using SharedCompiledExpression = std::shared_ptr<const CompiledExpression>;
+    using MaybeSharedCompiledExpression = std::expected<SharedCompiledExpression, std::string>;
+
+    // Bounded LRU cache from expression source text to its parse (or parse error)
+    class ParseCache {
+    public:
+        explicit ParseCache(std::size_t capacity = 1024): max_entries{capacity ? capacity : 1} {}
+
+        // Returns nullptr on a miss; a hit becomes the most recently used entry
+        const MaybeSharedCompiledExpression* find(std::string_view source);
+        const MaybeSharedCompiledExpression& insert(std::string source, MaybeSharedCompiledExpression parsed);
+        void clear() noexcept;
+
+        std::size_t size() const noexcept { return index.size(); }
+        std::size_t capacity() const noexcept { return max_entries; }
+        std::size_t hits() const noexcept { return hit_count; }
+        std::size_t misses() const noexcept { return miss_count; }
+
+    private:
+        struct Entry {
+            std::string source;
+            MaybeSharedCompiledExpression parsed;
+        };
+        std::list<Entry> entries;  // most recently used first
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;  // views into entries
+        std::size_t max_entries;
+        std::size_t hit_count = 0;
+        std::size_t miss_count = 0;
+    };
+}
@@ -0,0 +1,60 @@
+#include "parse_session.hpp"
+#include "lexer.hpp"
+
+namespace {
+    std::size_t text_size(const dv::AST &ast) noexcept {
+        std::size_t size = ast.token.text.size();
+        if(const auto *expr = std::get_if<dv::AST::ASTExpression>(&ast.data)) {
+            if(expr->lhs) size += text_size(*expr->lhs);
+            if(expr->rhs) size += text_size(*expr->rhs);
+        }
+        else {
+            const auto &call = std::get<dv::AST::ASTCall>(ast.data);
+            for(const auto &arg : call.args) size += text_size(*arg);
+            if(call.special_value) size += text_size(*call.special_value);
+        }
+        return size;
+    }
+
+    // Points every token of `ast` at a copy of its text written to `storage`, which has
+    // room for all of it
+    void rebase(dv::AST &ast, char *&storage) {
+        ast.token.text = {storage, ast.token.text.copy(storage, ast.token.text.size())};
+        storage += ast.token.text.size();
+        if(auto *expr = std::get_if<dv::AST::ASTExpression>(&ast.data)) {
+            if(expr->lhs) rebase(*expr->lhs, storage);
+            if(expr->rhs) rebase(*expr->rhs, storage);
+        }
+        else {
+            auto &call = std::get<dv::AST::ASTCall>(ast.data);
+            for(auto &arg : call.args) rebase(*arg, storage);
+            if(call.special_value) rebase(*call.special_value, storage);
+        }
+    }
+}
+
+dv::MaybeASTDependencies dv::ParseSession::parse(std::string_view source, const UnitRegistry &units){
+    Lexer lexer{keep(source), units};
+    TokenStream tokens{lexer};
+    Arena::Scope scope{arena};
+    Parser parser{tokens};
+    auto parsed = parser.parse();
+    // A lexing error wins over whatever the parser made of the tokens before it
+    if(auto lexed = tokens.finish(); !lexed) return std::unexpected{lexed.error()};
+    return parsed;
+}
+
+std::unique_ptr<dv::AST> dv::ParseSession::clone(const AST &ast){
+    Arena::Scope scope{arena};
+    auto copy = ast.clone();
+    auto *storage = static_cast<char*>(arena.allocate(text_size(ast), 1));
+    rebase(*copy, storage);
+    return copy;
+}
+
+std::string_view dv::ParseSession::keep(std::string_view text){
+    // NUL-terminated, as the lexer reads error tokens up to the end of the string
+    auto *copy = static_cast<char*>(arena.allocate(text.size() + 1, 1));
+    copy[text.copy(copy, text.size())] = '\0';
+    return {copy, text.size()};
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "arena.hpp"
+#include "parser.hpp"
+#include "unit_registry.hpp"
+#include <memory>
+#include <string_view>
+
+namespace dv {
+    // Owns the text a parse reads from and the nodes it builds, both in one arena. Tokens
+    // keep their text as a std::string_view into the session and AST nodes sit in its
+    // memory, so a tree is only valid while its session lives: whatever stores a tree
+    // stores the session before it, so the tree is destroyed first (ASTDependencies,
+    // Function, FormulaExpression).
+    class ParseSession {
+    public:
+        ParseSession() = default;
+        ParseSession(const ParseSession&) = delete;
+        ParseSession& operator=(const ParseSession&) = delete;
+
+        // Keeps a copy of `source` and parses it, lexing tokens as the parser reaches them
+        MaybeASTDependencies parse(std::string_view source, const UnitRegistry &units = UnitRegistry::builtin());
+        // A copy of `ast`, nodes and token text, in this session, for trees that
+        // outlive the session they were parsed in
+        std::unique_ptr<AST> clone(const AST &ast);
+        // Copies `text` into the session; the view stays valid as long as the session
+        std::string_view keep(std::string_view text);
+        const Arena& get_arena() const noexcept { return arena; }
+
+    private:
+        Arena arena;
+    };
+}
@@ -1,6 +1,7 @@
 #include "parser.hpp"
 #include "ast.hpp"
 #include "token.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <expected>
 #include <format>
@@ -49,7 +50,7 @@ static std::string describe_token(const dv::Token& token) {
 }
 
 bool dv::Parser::match(dv::TokenType type) {
-    if (peek().type == type) { position++; return true; }
+    if (peek().type == type) { tokens.skip(); return true; }
     return false;
 }
 
@@ -274,31 +275,30 @@ dv::MaybeAST dv::Parser::match_parentheses(){
 
 dv::MaybeAST dv::Parser::match_fraction(const dv::Token &token){
     // Check for derivative pattern: \frac{d}{dx} or \frac{d^n}{dx^n}
-    // Save position to potentially backtrack
-    auto saved_pos = position;
-
     if(peek().type == TokenType::LEFT_CURLY_BRACKET) {
+        // Save position to potentially backtrack
+        TokenStream::Mark saved_pos{tokens};
         // Look ahead to see if this is a derivative
-        auto test_pos = position + 1;
-        if(test_pos < tokens.size() && tokens[test_pos].type == TokenType::IDENTIFIER && tokens[test_pos].text == "d") {
+        auto test_pos = tokens.get_position() + 1;
+        if(tokens.at(test_pos).type == TokenType::IDENTIFIER && tokens.at(test_pos).text == "d") {
             // Could be \frac{d}{dx} or \frac{d^n}{dx^n}
             auto test_pos2 = test_pos + 1;
             bool is_derivative = false;
             int deriv_order = 1;
 
             // Check for \frac{d}{d...} pattern
-            if(test_pos2 < tokens.size() && tokens[test_pos2].type == TokenType::RIGHT_CURLY_BRACKET) {
+            if(tokens.at(test_pos2).type == TokenType::RIGHT_CURLY_BRACKET) {
                 // Simple \frac{d}{dx}
                 auto test_pos3 = test_pos2 + 1;
-                if(test_pos3 < tokens.size() && tokens[test_pos3].type == TokenType::LEFT_CURLY_BRACKET) {
+                if(tokens.at(test_pos3).type == TokenType::LEFT_CURLY_BRACKET) {
                     auto test_pos4 = test_pos3 + 1;
-                    if(test_pos4 < tokens.size() && tokens[test_pos4].type == TokenType::IDENTIFIER && tokens[test_pos4].text == "d") {
+                    if(tokens.at(test_pos4).type == TokenType::IDENTIFIER && tokens.at(test_pos4).text == "d") {
                         is_derivative = true;
                     }
                 }
             }
             // Check for \frac{d^n}{dx^n} pattern
-            else if(test_pos2 < tokens.size() && tokens[test_pos2].type == TokenType::EXPONENT) {
+            else if(tokens.at(test_pos2).type == TokenType::EXPONENT) {
                 is_derivative = true; // we'll parse the order
             }
 
@@ -322,26 +322,26 @@ dv::MaybeAST dv::Parser::match_fraction(const dv::Token &token){
                 }
                 if(!match(TokenType::RIGHT_CURLY_BRACKET)) {
                     // backtrack
-                    position = saved_pos;
+                    saved_pos.rewind();
                     goto normal_fraction;
                 }
                 // Parse denominator {dx} or {dx^n}
                 if(!match(TokenType::LEFT_CURLY_BRACKET)) {
-                    position = saved_pos;
+                    saved_pos.rewind();
                     goto normal_fraction;
                 }
                 // Consume 'd'
                 if(peek().type != TokenType::IDENTIFIER || peek().text != "d") {
-                    position = saved_pos;
+                    saved_pos.rewind();
                     goto normal_fraction;
                 }
                 next();
                 // Get variable name
                 if(peek().type != TokenType::IDENTIFIER) {
-                    position = saved_pos;
+                    saved_pos.rewind();
                     goto normal_fraction;
                 }
-                std::string var_name = std::string(next().text);
+                const std::string_view var_name = next().text;
                 // skip ^n if present
                 if(peek().type == TokenType::EXPONENT) {
                     next();
@@ -352,7 +352,7 @@ dv::MaybeAST dv::Parser::match_fraction(const dv::Token &token){
                     }
                 }
                 if(!match(TokenType::RIGHT_CURLY_BRACKET)) {
-                    position = saved_pos;
+                    saved_pos.rewind();
                     goto normal_fraction;
                 }
                 // Now parse the body expression - it might be in parens
@@ -368,7 +368,7 @@ dv::MaybeAST dv::Parser::match_fraction(const dv::Token &token){
 
                 // Build DERIVATIVE ASTCall: args=[body], special_value=var_name identifier
                 Token deriv_token{TokenType::DERIVATIVE, "derivative"};
-                deriv_token.value = UnitValue{(long double)deriv_order};
+                deriv_token.value = UnitValue{(dv::Scalar)deriv_order};
                 std::vector<std::unique_ptr<AST>> args;
                 args.emplace_back(std::move(body.value()));
                 Token var_token{TokenType::IDENTIFIER, var_name};
@@ -392,7 +392,7 @@ dv::MaybeAST dv::Parser::match_exponent(std::int32_t right_binding_power){
     if(uses_brackets){
         // Check for ^{T} (transpose) or ^{-1} (inverse)
         if(peek().type == TokenType::IDENTIFIER && peek().text == "T" &&
-           position + 1 < tokens.size() && tokens[position + 1].type == TokenType::RIGHT_CURLY_BRACKET) {
+           peek_next().type == TokenType::RIGHT_CURLY_BRACKET) {
             next(); // consume T
             match(TokenType::RIGHT_CURLY_BRACKET);
             Token transpose_token{TokenType::TRANSPOSE, "T"};
@@ -506,7 +506,7 @@ dv::MaybeAST dv::Parser::match_sum_prod(const dv::Token &token) {
     if(peek().type != TokenType::IDENTIFIER) {
         return std::unexpected{std::format("'{}' expects loop variable", token.text)};
     }
-    std::string loop_var = std::string(next().text);
+    const std::string_view loop_var = next().text;
     if(!match(TokenType::EQUAL)) {
         return std::unexpected{std::format("'{}' expects '=' after loop variable", token.text)};
     }
@@ -534,6 +534,7 @@ dv::MaybeAST dv::Parser::match_sum_prod(const dv::Token &token) {
 
     // Parse body expression
     MaybeAST body = nullptr;
+    bound_identifiers.emplace_back(loop_var);
     if(peek().type == TokenType::LEFT_PAREN) {
         body = match_parentheses();
     } else if(peek().type == TokenType::LEFT_CURLY_BRACKET) {
@@ -541,6 +542,7 @@ dv::MaybeAST dv::Parser::match_sum_prod(const dv::Token &token) {
     } else {
         body = parse_expression(19);
     }
+    bound_identifiers.pop_back();
     if(!body) return body;
 
     // Build ASTCall: args = [start, end, body], special_value = loop_var identifier
@@ -591,34 +593,38 @@ dv::MaybeAST dv::Parser::match_integral(const dv::Token &token) {
     // We need to detect the trailing 'dx' pattern. Strategy: scan ahead to find
     // the last 'd' identifier before end of expression, and only parse up to there.
     // For simplicity, save position and look for the 'd' + identifier pattern near the end.
-    std::string int_var = "x"; // default
+    std::string_view int_var = "x"; // default
 
-    // Find the last 'd' identifier in the remaining tokens
+    // Find the last 'd' identifier in the remaining tokens; the mark keeps them all
+    // buffered until the 'd' is put back
+    TokenStream::Mark body_start{tokens};
     std::size_t d_pos = 0;
     bool found_d = false;
-    for(std::size_t i = position; i + 1 < tokens.size(); i++) {
-        if(tokens[i].type == TokenType::IDENTIFIER && tokens[i].text == "d" &&
-           i + 1 < tokens.size() && tokens[i+1].type == TokenType::IDENTIFIER) {
+    for(std::size_t i = tokens.get_position(); tokens.at(i).type != TokenType::TEOF; i++) {
+        if(tokens.at(i).type == TokenType::IDENTIFIER && tokens.at(i).text == "d" &&
+           tokens.at(i + 1).type == TokenType::IDENTIFIER) {
             d_pos = i;
             found_d = true;
         }
     }
 
     MaybeAST body = nullptr;
-    if(found_d && d_pos > position) {
+    if(found_d && d_pos > tokens.get_position()) {
         // Parse body up to but not including the 'd'
         // We need to insert a temporary stop. Easiest: save and modify token
-        auto saved_token = tokens[d_pos];
-        tokens[d_pos] = Token{TokenType::TEOF, ""};
+        auto saved_token = tokens.at(d_pos);
+        tokens.at(d_pos) = Token{TokenType::TEOF, ""};
+        bound_identifiers.emplace_back(tokens.at(d_pos + 1).text);
         body = parse_expression(0);
-        tokens[d_pos] = saved_token;
+        bound_identifiers.pop_back();
+        tokens.at(d_pos) = saved_token;
         if(!body) return body;
 
         // Now consume 'd' and variable
         if(peek().type == TokenType::IDENTIFIER && peek().text == "d") {
             next(); // consume 'd'
             if(peek().type == TokenType::IDENTIFIER) {
-                int_var = std::string(next().text);
+                int_var = next().text;
             }
         }
     } else {
@@ -726,7 +732,7 @@ dv::MaybeAST dv::Parser::match_matrix(const dv::Token &token) {
 
     // Store dimensions in token value
     Token mat_token{TokenType::MATRIX_BEGIN, "matrix"};
-    mat_token.value = UnitValue{(long double)(rows * 1000 + cols)}; // encode rows and cols
+    mat_token.value = UnitValue{(dv::Scalar)(rows * 1000 + cols)}; // encode rows and cols
     return std::make_unique<AST>(mat_token, std::move(args));
 }
 
@@ -808,7 +814,8 @@ dv::MaybeAST dv::Parser::match_builtin_function(const dv::Token &token){
 dv::MaybeAST dv::Parser::match_atom(const dv::Token &token){
     if(token.type == TokenType::NUMERIC_LITERAL) return std::make_unique<AST>(token);
     if(token.type == TokenType::IDENTIFIER) {
-        identifier_dependencies.insert(std::string{token.text});
+        if(std::find(bound_identifiers.begin(), bound_identifiers.end(), token.text) == bound_identifiers.end())
+            identifier_dependencies.insert(std::string{token.text});
 
         // Check for f'(x) syntax: IDENTIFIER followed by PRIME
         if(peek().type == TokenType::PRIME) {
@@ -832,8 +839,8 @@ dv::MaybeAST dv::Parser::match_atom(const dv::Token &token){
                 if(!match(TokenType::RIGHT_PAREN)) {
                     return std::unexpected{std::format("Missing ')' in f'(...)")};
                 }
-                Token prime_token{TokenType::PRIME, std::string(token.text)};
-                prime_token.value = UnitValue{(long double)prime_count};
+                Token prime_token{TokenType::PRIME, token.text};
+                prime_token.value = UnitValue{(dv::Scalar)prime_count};
                 return std::make_unique<AST>(prime_token, std::move(args));
             }
         }
@@ -841,20 +848,20 @@ dv::MaybeAST dv::Parser::match_atom(const dv::Token &token){
         // Check for custom function call: IDENTIFIER LEFT_PAREN (but not single-char variables that should implicit multiply)
         if(peek().type == TokenType::LEFT_PAREN && token.text.size() > 1) {
             // This looks like a function call: f(x), foo(x,y)
-            auto saved = position;
+            TokenStream::Mark saved{tokens};
             next(); // consume (
             std::vector<std::unique_ptr<AST>> args;
             if(peek().type != TokenType::RIGHT_PAREN) {
                 auto arg = parse_expression(0);
                 if(!arg) {
-                    position = saved;
+                    saved.rewind();
                     return std::make_unique<AST>(token);
                 }
                 args.emplace_back(std::move(arg.value()));
                 while(match(TokenType::COMMA)) {
                     arg = parse_expression(0);
                     if(!arg) {
-                        position = saved;
+                        saved.rewind();
                         return std::make_unique<AST>(token);
                     }
                     args.emplace_back(std::move(arg.value()));
@@ -862,7 +869,7 @@ dv::MaybeAST dv::Parser::match_atom(const dv::Token &token){
             }
             if(!match(TokenType::RIGHT_PAREN)) {
                 // Not a function call, backtrack
-                position = saved;
+                saved.rewind();
                 return std::make_unique<AST>(token);
             }
             Token func_token{TokenType::FUNC_CALL, token.text};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "token.hpp"
+#include "token_stream.hpp"
 #include "ast.hpp"
 #include <expected>
 #include <memory>
@@ -10,7 +11,9 @@
 
 namespace dv {
     using MaybeAST = std::expected<std::unique_ptr<AST>, std::string>;
+    class ParseSession;
     struct ASTDependencies {
+        std::shared_ptr<const ParseSession> session;  // owns `ast`'s nodes and text, set by whoever keeps the tree
         std::unique_ptr<AST> ast;
         std::unordered_set<std::string> identifier_dependencies;  // owned copy
     };
@@ -18,24 +21,26 @@ namespace dv {
 
     class Parser {
     public:
-        Parser(const std::vector<dv::Token> &token_list): tokens{token_list} {}
+        // Reads tokens from `token_stream` as it goes; the parser may rewrite them in place
+        Parser(TokenStream &token_stream): tokens{token_stream} {}
         inline MaybeASTDependencies parse() {
             auto maybe_ast = parse_expression(0);
             if(!maybe_ast) return std::unexpected{maybe_ast.error()};
             return ASTDependencies{
+                nullptr,
                 std::move(maybe_ast.value()),
                 this->identifier_dependencies  // copied by value into the struct
             };
         }
     private:
-        std::vector<dv::Token> tokens;
+        TokenStream &tokens;
         std::unordered_set<std::string> identifier_dependencies;
-        std::size_t position = 0;
+        std::vector<std::string> bound_identifiers;  // \sum/\prod/\int variables in scope, not dependencies
         bool has_equal = false;
     
-        inline Token& peek() { return tokens[position]; }
-        inline Token& peek_next() { return tokens[position + 1]; }
-        inline Token& next() { return tokens[position++]; }
+        inline Token& peek() { return tokens.peek(); }
+        inline Token& peek_next() { return tokens.peek_next(); }
+        inline Token next() { return tokens.next(); }
 
         bool match(dv::TokenType type);
         
@@ -0,0 +1,240 @@
+#include "rearrange.hpp"
+#include <cctype>
+#include <format>
+#include <numbers>
+#include <utility>
+
+namespace {
+    using dv::AST;
+    using dv::Token;
+    using dv::TokenType;
+
+    std::unique_ptr<AST> number(double value, std::string_view text) {
+        return std::make_unique<AST>(Token{dv::UnitValue{value}, text});
+    }
+    std::unique_ptr<AST> binary(TokenType type, std::string_view text, std::unique_ptr<AST> lhs, std::unique_ptr<AST> rhs) {
+        return std::make_unique<AST>(Token{type, text}, std::move(lhs), std::move(rhs));
+    }
+    std::unique_ptr<AST> function(TokenType type, std::string_view text, std::unique_ptr<AST> arg, std::unique_ptr<AST> special_value = nullptr) {
+        std::vector<std::unique_ptr<AST>> args;
+        args.push_back(std::move(arg));
+        return std::make_unique<AST>(Token{type, text}, std::move(args), std::move(special_value));
+    }
+    std::unique_ptr<AST> fraction(std::unique_ptr<AST> numerator, std::unique_ptr<AST> denominator) {
+        return binary(TokenType::FRACTION, "frac", std::move(numerator), std::move(denominator));
+    }
+
+    bool is_number(const AST *ast, double value) noexcept {
+        return ast && ast->token.type == TokenType::NUMERIC_LITERAL
+            && ast->token.value.unit.is_dimensionless() && ast->token.value.value == value;
+    }
+
+    // The function that undoes a single-argument builtin, UNKNOWN if there is none
+    TokenType inverse_of(TokenType type) noexcept {
+        switch(type) {
+            case TokenType::BUILTIN_FUNC_SIN: return TokenType::BUILTIN_FUNC_ARCSIN;
+            case TokenType::BUILTIN_FUNC_COS: return TokenType::BUILTIN_FUNC_ARCCOS;
+            case TokenType::BUILTIN_FUNC_TAN: return TokenType::BUILTIN_FUNC_ARCTAN;
+            case TokenType::BUILTIN_FUNC_ARCSIN: return TokenType::BUILTIN_FUNC_SIN;
+            case TokenType::BUILTIN_FUNC_ARCCOS: return TokenType::BUILTIN_FUNC_COS;
+            case TokenType::BUILTIN_FUNC_ARCTAN: return TokenType::BUILTIN_FUNC_TAN;
+            default: return TokenType::UNKNOWN;
+        }
+    }
+
+    // LaTeX command of a builtin that prints as \name(arg), empty for anything else
+    std::string_view command_of(TokenType type) noexcept {
+        switch(type) {
+            case TokenType::BUILTIN_FUNC_LN: return "\\ln";
+            case TokenType::BUILTIN_FUNC_SIN: return "\\sin";
+            case TokenType::BUILTIN_FUNC_COS: return "\\cos";
+            case TokenType::BUILTIN_FUNC_TAN: return "\\tan";
+            case TokenType::BUILTIN_FUNC_SEC: return "\\sec";
+            case TokenType::BUILTIN_FUNC_CSC: return "\\csc";
+            case TokenType::BUILTIN_FUNC_COT: return "\\cot";
+            case TokenType::BUILTIN_FUNC_ARCSIN: return "\\arcsin";
+            case TokenType::BUILTIN_FUNC_ARCCOS: return "\\arccos";
+            case TokenType::BUILTIN_FUNC_ARCTAN: return "\\arctan";
+            case TokenType::BUILTIN_FUNC_ARCSEC: return "\\arcsec";
+            case TokenType::BUILTIN_FUNC_ARCCSC: return "\\arccsc";
+            case TokenType::BUILTIN_FUNC_ARCCOT: return "\\arccot";
+            default: return {};
+        }
+    }
+
+    // Binding strength when printing: sums, products, signs, powers, atoms
+    int precedence(const AST &ast) noexcept {
+        const auto *expr = std::get_if<AST::ASTExpression>(&ast.data);
+        switch(ast.token.type) {
+            case TokenType::PLUS:
+            case TokenType::MINUS: return expr && expr->rhs ? 1 : 3;
+            case TokenType::PLUS_MINUS: return 1;
+            case TokenType::TIMES:
+            case TokenType::DIVIDE:
+            case TokenType::MODULO: return 2;
+            case TokenType::EXPONENT: return 4;
+            default: return 5;
+        }
+    }
+
+    std::string operand(const AST &ast, int min_precedence) {
+        auto latex = dv::to_latex(ast);
+        return precedence(ast) < min_precedence ? std::format("({})", latex) : latex;
+    }
+}
+
+std::size_t dv::count_identifier(const AST &ast, std::string_view name) noexcept {
+    std::size_t count = ast.token.type == TokenType::IDENTIFIER && ast.token.text == name;
+    if(const auto *expr = std::get_if<AST::ASTExpression>(&ast.data)) {
+        if(expr->lhs) count += count_identifier(*expr->lhs, name);
+        if(expr->rhs) count += count_identifier(*expr->rhs, name);
+    } else {
+        const auto &call = std::get<AST::ASTCall>(ast.data);
+        for(const auto &arg : call.args) count += count_identifier(*arg, name);
+        if(call.special_value) count += count_identifier(*call.special_value, name);
+    }
+    return count;
+}
+
+dv::MaybeAST dv::isolate(const AST &lhs, const AST &rhs, std::string_view target) {
+    const auto in_lhs = count_identifier(lhs, target);
+    const auto occurrences = in_lhs + count_identifier(rhs, target);
+    if(occurrences == 0) return std::unexpected{std::format("'{}' does not occur in the equation", target)};
+    if(occurrences > 1)
+        return std::unexpected{std::format("'{}' occurs {} times, only a single occurrence can be isolated", target, occurrences)};
+
+    // `side` holds the target; everything peeled off it is undone on `other`
+    const AST *side = in_lhs ? &lhs : &rhs;
+    auto other = (in_lhs ? rhs : lhs).clone();
+    while(side->token.type != TokenType::IDENTIFIER) {
+        const auto type = side->token.type;
+        const AST *inner = nullptr;
+        if(const auto *expr = std::get_if<AST::ASTExpression>(&side->data)) {
+            const bool in_left = expr->lhs && count_identifier(*expr->lhs, target) > 0;
+            inner = in_left ? expr->lhs.get() : expr->rhs.get();
+            const AST *sibling = in_left ? expr->rhs.get() : expr->lhs.get();
+            switch(type) {
+                case TokenType::PLUS:
+                    if(sibling) other = binary(TokenType::MINUS, "-", std::move(other), sibling->clone());
+                    break;
+                case TokenType::MINUS:
+                    if(!sibling) other = binary(TokenType::MINUS, "-", std::move(other), nullptr);
+                    else if(in_left) other = binary(TokenType::PLUS, "+", std::move(other), sibling->clone());
+                    else other = binary(TokenType::MINUS, "-", sibling->clone(), std::move(other));
+                    break;
+                case TokenType::TIMES:
+                    other = fraction(std::move(other), sibling->clone());
+                    break;
+                case TokenType::DIVIDE:
+                case TokenType::FRACTION:
+                    other = in_left ? binary(TokenType::TIMES, "*", std::move(other), sibling->clone())
+                                    : fraction(sibling->clone(), std::move(other));
+                    break;
+                case TokenType::EXPONENT:
+                    if(!in_left) {
+                        // b^x = y: x = ln(y) / ln(b)
+                        other = fraction(function(TokenType::BUILTIN_FUNC_LN, "ln", std::move(other)),
+                                         function(TokenType::BUILTIN_FUNC_LN, "ln", sibling->clone()));
+                    }
+                    else if(is_number(sibling, 2.0)) other = function(TokenType::BUILTIN_FUNC_SQRT, "sqrt", std::move(other));
+                    else if(sibling->token.type == TokenType::NUMERIC_LITERAL && sibling->token.value.unit.is_dimensionless())
+                        other = function(TokenType::BUILTIN_FUNC_SQRT, "sqrt", std::move(other), sibling->clone());
+                    else other = binary(TokenType::EXPONENT, "^", std::move(other), fraction(number(1.0, "1"), sibling->clone()));
+                    break;
+                default:
+                    return std::unexpected{std::format("Cannot isolate '{}' from inside '{}'", target, side->token.text)};
+            }
+            if(!inner) return std::unexpected{std::format("Cannot isolate '{}' from inside '{}'", target, side->token.text)};
+        }
+        else {
+            const auto &call = std::get<AST::ASTCall>(side->data);
+            if(call.args.size() != 1 || count_identifier(*call.args[0], target) == 0)
+                return std::unexpected{std::format("Cannot isolate '{}' from an argument of '{}'", target, side->token.text)};
+            inner = call.args[0].get();
+            switch(type) {
+                case TokenType::BUILTIN_FUNC_SQRT:
+                    other = binary(TokenType::EXPONENT, "^", std::move(other),
+                                   call.special_value ? call.special_value->clone() : number(2.0, "2"));
+                    break;
+                case TokenType::BUILTIN_FUNC_LN:
+                    other = binary(TokenType::EXPONENT, "^", number(std::numbers::e, "e"), std::move(other));
+                    break;
+                case TokenType::BUILTIN_FUNC_LOG:
+                    other = binary(TokenType::EXPONENT, "^",
+                                   call.special_value ? call.special_value->clone() : number(10.0, "10"), std::move(other));
+                    break;
+                default: {
+                    const auto inverse = inverse_of(type);
+                    if(inverse == TokenType::UNKNOWN)
+                        return std::unexpected{std::format("Cannot isolate '{}' from inside '{}'", target, side->token.text)};
+                    other = function(inverse, command_of(inverse).substr(1), std::move(other));
+                }
+            }
+        }
+        side = inner;
+    }
+    return other;
+}
+
+std::string dv::to_latex(const AST &ast) {
+    const auto &token = ast.token;
+    if(const auto *expr = std::get_if<AST::ASTExpression>(&ast.data)) {
+        const AST *lhs = expr->lhs.get(), *rhs = expr->rhs.get();
+        switch(token.type) {
+            case TokenType::NUMERIC_LITERAL:
+                if(!token.value.unit.is_dimensionless()) return std::format("\\{}", token.text);
+                if(token.text == "pi") return "\\pi";
+                if(!token.text.empty() && (std::isdigit(static_cast<unsigned char>(token.text[0])) || token.text[0] == '.' || token.text == "e"))
+                    return std::string{token.text};
+                return std::format("{}", (double)token.value.value);
+            case TokenType::IDENTIFIER:
+                return std::string{token.text};
+            case TokenType::PLUS:
+                if(!rhs) return std::format("+{}", operand(*lhs, 3));
+                return std::format("{} + {}", operand(*lhs, 1), operand(*rhs, 1));
+            case TokenType::MINUS:
+                if(!rhs) return std::format("-{}", operand(*lhs, 2));
+                return std::format("{} - {}", operand(*lhs, 1), operand(*rhs, 2));
+            case TokenType::PLUS_MINUS:
+                return std::format("{} \\pm {}", operand(*lhs, 1), operand(*rhs, 2));
+            case TokenType::TIMES: {
+                const auto left = operand(*lhs, 2), right = operand(*rhs, 2);
+                // Two numbers side by side would read as one
+                const bool dot = std::isdigit(static_cast<unsigned char>(right.front())) || right.front() == '.';
+                return std::format("{}{}{}", left, dot ? " \\cdot " : " ", right);
+            }
+            case TokenType::DIVIDE:
+            case TokenType::FRACTION:
+                return std::format("\\frac{{{}}}{{{}}}", to_latex(*lhs), to_latex(*rhs));
+            case TokenType::EXPONENT: {
+                // A fraction or function call as the base needs brackets to take the power
+                const bool bracket = precedence(*lhs) < 5 || lhs->token.type == TokenType::FRACTION
+                    || lhs->token.type == TokenType::DIVIDE || std::holds_alternative<AST::ASTCall>(lhs->data);
+                const auto base = bracket ? std::format("({})", to_latex(*lhs)) : to_latex(*lhs);
+                return std::format("{}^{{{}}}", base, to_latex(*rhs));
+            }
+            case TokenType::FACTORIAL:
+                return std::format("{}!", operand(*lhs, 5));
+            default:
+                return std::string{token.text};
+        }
+    }
+    const auto &call = std::get<AST::ASTCall>(ast.data);
+    std::string args;
+    for(const auto &arg : call.args) args += (args.empty() ? "" : ", ") + to_latex(*arg);
+    switch(token.type) {
+        case TokenType::BUILTIN_FUNC_SQRT:
+            if(call.special_value) return std::format("\\sqrt[{}]{{{}}}", to_latex(*call.special_value), args);
+            return std::format("\\sqrt{{{}}}", args);
+        case TokenType::BUILTIN_FUNC_LOG:
+            if(call.special_value) return std::format("\\log_{{{}}}({})", to_latex(*call.special_value), args);
+            return std::format("\\log({})", args);
+        case TokenType::BUILTIN_FUNC_ABS:
+            return std::format("|{}|", args);
+        case TokenType::FUNC_CALL:
+            return std::format("{}({})", token.text, args);
+        default:
+            if(const auto command = command_of(token.type); !command.empty()) return std::format("{}({})", command, args);
+            return std::format("{}({})", token.text, args);
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ast.hpp"
+#include "parser.hpp"
+#include <string>
+#include <string_view>
+
+namespace dv {
+    // Solves `lhs = rhs` for the identifier `target` by peeling the operations around
+    // it off one at a time and applying their inverses to the other side: + and -, *,
+    // / and \frac, powers and roots, \ln, \log and the trigonometric functions. The
+    // target must occur exactly once; even powers and roots take the principal root.
+    // Subtrees that do not contain the target are cloned as they are.
+    MaybeAST isolate(const AST &lhs, const AST &rhs, std::string_view target);
+
+    // How often the identifier `name` occurs in `ast`
+    std::size_t count_identifier(const AST &ast, std::string_view name) noexcept;
+
+    // LaTeX for an expression tree, for showing a rearranged formula. Operators the
+    // rearrangement produces print as they would be typed; anything else falls back
+    // to its token text.
+    std::string to_latex(const AST &ast);
+}
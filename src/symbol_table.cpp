@@ -0,0 +1,64 @@
+#include "symbol_table.hpp"
+#include <format>
+#include <stdexcept>
+
+dv::SymbolId dv::SymbolTable::intern(std::string_view name){
+    if(auto found = ids.find(name); found != ids.end()) return found->second;
+    const auto id = static_cast<SymbolId>(names.size());
+    ids.emplace(names.emplace_back(name), id);
+    return id;
+}
+
+std::optional<dv::SymbolId> dv::SymbolTable::find(std::string_view name) const noexcept{
+    if(auto found = ids.find(name); found != ids.end()) return found->second;
+    return std::nullopt;
+}
+
+void dv::SymbolTable::clear() noexcept{
+    ids.clear();    // views into names
+    names.clear();
+}
+
+void dv::VariableStore::set(SymbolId id, EValue value){
+    if(id >= slots.size()) slots.resize(symbols->size() > id ? symbols->size() : id + 1);
+    if(!slots[id]) bound++;
+    slots[id] = std::move(value);
+}
+
+bool dv::VariableStore::erase(SymbolId id) noexcept{
+    if(id >= slots.size() || !slots[id]) return false;
+    slots[id].reset();
+    bound--;
+    return true;
+}
+
+const dv::EValue* dv::VariableStore::find(std::string_view name) const noexcept{
+    const auto id = symbols->find(name);
+    return id ? get(*id) : nullptr;
+}
+
+dv::EValue* dv::VariableStore::find(std::string_view name) noexcept{
+    const auto id = symbols->find(name);
+    return id ? get(*id) : nullptr;
+}
+
+const dv::EValue& dv::VariableStore::at(std::string_view name) const{
+    if(const auto *value = find(name)) return *value;
+    throw std::out_of_range{std::format("Unbound variable '{}'", name)};
+}
+
+dv::EValue& dv::VariableStore::operator[](std::string_view name){
+    const auto id = symbols->intern(name);
+    if(!get(id)) set(id, EValue{});
+    return *get(id);
+}
+
+bool dv::VariableStore::erase(std::string_view name) noexcept{
+    const auto id = symbols->find(name);
+    return id && erase(*id);
+}
+
+void dv::VariableStore::clear() noexcept{
+    slots.clear();
+    bound = 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "dimeval.hpp"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dv {
+    using SymbolId = std::uint32_t;
+
+    // Interns identifier names to dense ids. Ids stay valid until clear(), so compiled
+    // programs can hold them until their owner clears the table (the evaluator drops
+    // every program it compiled first, see Evaluator::compact_symbols).
+    class SymbolTable {
+    public:
+        SymbolId intern(std::string_view name);
+        std::optional<SymbolId> find(std::string_view name) const noexcept;
+        const std::string& name(SymbolId id) const noexcept { return names[id]; }
+        std::size_t size() const noexcept { return names.size(); }
+        void clear() noexcept;
+
+    private:
+        std::deque<std::string> names;                          // stable storage for the views below
+        std::unordered_map<std::string_view, SymbolId> ids;
+    };
+
+    // Values indexed by symbol id. Slot access is plain array indexing; the name based
+    // overloads go through the symbol table and keep the std::map style call sites working.
+    class VariableStore {
+    public:
+        explicit VariableStore(std::shared_ptr<SymbolTable> symbols): symbols{std::move(symbols)} {}
+
+        const EValue* get(SymbolId id) const noexcept { return id < slots.size() && slots[id] ? &*slots[id] : nullptr; }
+        EValue* get(SymbolId id) noexcept { return id < slots.size() && slots[id] ? &*slots[id] : nullptr; }
+        void set(SymbolId id, EValue value);
+        bool erase(SymbolId id) noexcept;
+
+        const EValue* find(std::string_view name) const noexcept;
+        EValue* find(std::string_view name) noexcept;
+        bool contains(std::string_view name) const noexcept { return find(name) != nullptr; }
+        // Throws std::out_of_range when unbound, like std::map::at
+        const EValue& at(std::string_view name) const;
+        // Binds an unbound name to a default value first
+        EValue& operator[](std::string_view name);
+        void insert_or_assign(std::string_view name, EValue value) { set(symbols->intern(name), std::move(value)); }
+        bool erase(std::string_view name) noexcept;
+        void clear() noexcept;
+        std::size_t size() const noexcept { return bound; }
+
+        // Visits (name, value) for every bound slot in id order
+        template<typename Visitor>
+        void for_each(Visitor &&visit) const {
+            for(SymbolId id = 0; id < slots.size(); id++)
+                if(slots[id]) visit(symbols->name(id), *slots[id]);
+        }
+
+    private:
+        std::shared_ptr<SymbolTable> symbols;
+        std::vector<std::optional<EValue>> slots;
+        std::size_t bound = 0;
+    };
+}
@@ -0,0 +1,25 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces every unaligned form of the global operator new and delete so each pair
+// matches, and keeps them out of line in this test-only file so the counting new is
+// never inlined next to a free. Linked into the test executable only.
+thread_local std::size_t heap_allocations = 0;
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    heap_allocations++;
+    return std::malloc(size ? size : 1);
+}
+void* operator new(std::size_t size) {
+    if (void *memory = operator new(size, std::nothrow)) return memory;
+    throw std::bad_alloc{};
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return operator new(size, std::nothrow); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
@@ -1,9 +1,22 @@
+#include "ast.hpp"
+#include "bytecode.hpp"
 #include "evaluator.hpp"
 #include "lexer.hpp"
 #include "parser.hpp"
+#include "parse_session.hpp"
+#include "token_stream.hpp"
 #include <array>
+#include <chrono>
+#include <cmath>
 #include <print>
 #include <span>
+#include <thread>
+#include <utility>
+
+// Heap allocations made by the calling thread, counted by the global operator new
+// replacements in testing.cpp
+extern thread_local std::size_t heap_allocations;
+
 struct LatexTest {
     const std::string expression;
     const double expected_result;
@@ -14,11 +27,11 @@ struct LatexMultiTest {
     double expected_result; // expected result of last expression
 };
 
-static inline long double get_scalar_val(const dv::EValue &ev) {
+static inline dv::Scalar get_scalar_val(const dv::EValue &ev) {
     if (auto p = std::get_if<dv::UnitValue>(&ev)) return p->value;
-    if (auto p = std::get_if<dv::UnitValueList>(&ev)) return p->elements.empty() ? 0.0L : p->elements[0].value;
-    if (auto p = std::get_if<dv::BooleanValue>(&ev)) return p->value ? 1.0L : 0.0L;
-    return 0.0L;
+    if (auto p = std::get_if<dv::UnitValueList>(&ev)) return p->elements.empty() ? 0.0 : p->elements[0].value;
+    if (auto p = std::get_if<dv::BooleanValue>(&ev)) return p->value ? 1.0 : 0.0;
+    return 0.0;
 }
 
 static inline void print_tokens_red(const std::string view){
@@ -31,11 +44,8 @@ static inline void print_tokens_red(const std::string view){
 }
 
 static inline void print_ast_red(const std::string view){
-    dv::Lexer lexer{view};
-    const auto &tokens = lexer.extract_all_tokens();
-    if(!tokens) return;
-    dv::Parser parser{tokens.value()};
-    const auto &ast = parser.parse();
+    dv::ParseSession session;
+    const auto &ast = session.parse(view);
     if(!ast) return;
     std::print("\033[31m");
     std::println("{}", *ast.value().ast);
@@ -125,3 +135,252 @@ static inline bool run_multi_tests(const std::span<const LatexMultiTest> tests){
     }
     return success;
 }
+
+static inline bool same_scalar(dv::Scalar a, dv::Scalar b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+static inline bool same_unit_value(const dv::UnitValue &a, const dv::UnitValue &b) {
+    return same_scalar(a.value, b.value) && same_scalar(a.imag, b.imag)
+        && a.unit == b.unit && a.sig_figs == b.sig_figs;
+}
+
+static inline bool same_result(const dv::MaybeEValue &a, const dv::MaybeEValue &b) {
+    if(!a || !b) return !a && !b && a.error() == b.error();
+    if(a->index() != b->index()) return false;
+    if(auto p = std::get_if<dv::UnitValue>(&*a)) return same_unit_value(*p, std::get<dv::UnitValue>(*b));
+    if(auto p = std::get_if<dv::UnitValueList>(&*a)) {
+        const auto &q = std::get<dv::UnitValueList>(*b);
+        if(p->elements.size() != q.elements.size()) return false;
+        for(std::size_t i = 0; i < p->elements.size(); i++)
+            if(!same_unit_value(p->elements[i], q.elements[i])) return false;
+        return true;
+    }
+    if(auto p = std::get_if<dv::BooleanValue>(&*a)) return p->value == std::get<dv::BooleanValue>(*b).value;
+    const auto &f = std::get<dv::Function>(*a), &g = std::get<dv::Function>(*b);
+    return f.name == g.name && f.param_names == g.param_names;
+}
+
+// Runs every line through both the tree walker and the bytecode VM, in source order on
+// separate evaluators, and requires bit-identical results (or the same error)
+static inline bool run_bytecode_differential_tests(const std::span<const LatexTest> tests, const std::span<const LatexMultiTest> multi_tests){
+    std::vector<std::vector<std::string>> sheets;
+    for(const auto &test: tests) sheets.push_back({test.expression});
+    for(const auto &test: multi_tests) sheets.push_back(test.expressions);
+
+    std::int32_t compared = 0;
+    bool success = true;
+    for(const auto &sheet: sheets){
+        dv::Evaluator walker{}, vm{};
+        for(const auto &line: sheet){
+            dv::ParseSession session;
+            const auto parsed = session.parse(line);
+            if(!parsed) continue;
+            const auto program = dv::compile(*parsed->ast, vm.get_symbols());
+            const auto walked = parsed->ast->evaluate(walker);
+            const auto executed = dv::execute(program, vm);
+            compared++;
+            if(!same_result(walked, executed)){
+                success = false;
+                std::println("\033[31m[FAIL] {} : walker and VM disagree ✗\033[0m", line);
+            }
+        }
+    }
+    if(success) std::println("\033[0;32m[DIFFERENTIAL PASSED] {}\033[0m", compared);
+    return success;
+}
+
+// Re-runs the compiled single-expression corpus on the VM and reports its throughput for
+// the configured dv::Scalar; configure with -DNERO_HIGH_PRECISION=ON to compare long double
+static inline void run_scalar_throughput_benchmark(const std::span<const LatexTest> tests, const std::int32_t rounds = 200){
+    dv::Evaluator evaluator{};
+    std::vector<dv::Program> programs;
+    for(const auto &test: tests){
+        dv::ParseSession session;
+        const auto parsed = session.parse(test.expression);
+        if(!parsed) continue;
+        programs.push_back(dv::compile(*parsed->ast, evaluator.get_symbols()));
+    }
+
+    dv::Scalar checksum = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::int32_t round = 0; round < rounds; round++){
+        for(const auto &program: programs){
+            const auto result = dv::execute(program, evaluator);
+            if(result) checksum += get_scalar_val(*result);
+        }
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    const auto evaluations = programs.size() * rounds;
+    std::println("[BENCH] {}: {} evaluations in {:.2f} ms ({:.0f} evals/s, checksum {})",
+        std::is_same_v<dv::Scalar, double> ? "double" : "long double",
+        evaluations, elapsed.count(), evaluations / (elapsed.count() / 1000.0), (double)checksum);
+}
+
+// Parses the single-expression corpus in a fresh session each time, as the evaluator does
+// on a parse cache miss, and reports the time and heap allocations per parse
+static inline void run_parse_benchmark(const std::span<const LatexTest> tests, const std::int32_t rounds = 1000){
+    std::size_t parsed_count = 0;
+    const auto allocations = heap_allocations;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::int32_t round = 0; round < rounds; round++){
+        for(const auto &test: tests){
+            dv::ParseSession session;
+            const auto parsed = session.parse(test.expression);
+            parsed_count += parsed.has_value();
+        }
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    const auto parses = tests.size() * rounds;
+    std::println("[BENCH] parsing: {} parses ({} ok) in {:.2f} ms ({:.0f} ns, {:.1f} heap allocations per parse)",
+        parses, parsed_count, elapsed.count(), elapsed.count() * 1e6 / parses,
+        static_cast<double>(heap_allocations - allocations) / parses);
+}
+
+// Parses one long pasted line, a `size` x `size` bmatrix, pulling tokens through the
+// stream's ring, and compares the tokens buffered with the vector lexing it whole needs
+static inline void run_long_line_benchmark(const std::int32_t size = 300){
+    std::string matrix = "\\begin{bmatrix}";
+    for(std::int32_t row = 0; row < size; row++) {
+        for(std::int32_t column = 0; column < size; column++) matrix += std::format("{}{}.5", column ? " & " : "", row + column);
+        matrix += row + 1 < size ? " \\\\ " : " \\end{bmatrix}";
+    }
+    dv::Lexer whole_lexer{matrix};
+    const auto whole = whole_lexer.extract_all_tokens();
+
+    const auto start = std::chrono::steady_clock::now();
+    dv::Lexer lexer{matrix};
+    dv::TokenStream tokens{lexer};
+    dv::Parser parser{tokens};
+    const bool parsed = parser.parse().has_value() && tokens.finish().has_value();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::println("[BENCH] long line: {}x{} bmatrix, {} tokens parsed{} in {:.2f} ms; {} tokens buffered ({} bytes), lexing it whole takes {} bytes",
+        size, size, tokens.get_position(), parsed ? "" : " (failed)", elapsed.count(),
+        tokens.capacity(), tokens.capacity() * sizeof(dv::Token), whole ? whole->capacity() * sizeof(dv::Token) : 0);
+}
+
+// Lexes a line made of unit literals: single-letter units, prefixed units, \\mu forms and
+// the longer non-SI names, so every length of unit symbol is looked up. It runs against
+// the built-in units and again with `extra_units` more registered, which should not
+// change the time per token.
+static inline void run_unit_lexing_benchmark(const std::int32_t rounds = 2000, const std::size_t extra_units = 5000){
+    const std::string line = "5 \\m + 3 \\km \\cdot 2 \\s / 4 \\ms + 7 \\mu m - 2 \\kg \\cdot \\N + 9 \\kOhm "
+        "+ 1 \\mu mol + 6 \\GHz + 8 \\hour + 2 \\min \\cdot \\V + 3 \\mu Ohm \\cdot \\A + \\W \\cdot \\J / \\C";
+    dv::UnitRegistry extended = dv::UnitRegistry::builtin();
+    for(std::size_t i = 0; i < extra_units; i++){
+        std::string symbol = "Z";   // no built-in symbol starts with Z
+        for(std::size_t rest = i; symbol.size() < 4; rest /= 26) symbol += static_cast<char>('a' + rest % 26);
+        (void)extended.add(symbol, 1.0, dv::UnitVector{});
+    }
+
+    for(const auto *units : {&dv::UnitRegistry::builtin(), &std::as_const(extended)}){
+        std::size_t tokens = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for(std::int32_t round = 0; round < rounds; round++){
+            dv::Lexer lexer{line, *units};
+            const auto lexed = lexer.extract_all_tokens();
+            if(lexed) tokens += lexed->size();
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::println("[BENCH] unit lexing, {} units: {} tokens in {:.2f} ms ({:.1f} ns per token)",
+            units->size(), tokens, elapsed.count(), elapsed.count() * 1e6 / tokens);
+    }
+}
+
+// `copies` back-to-back copies of the built-in catalogue, standing in for a large
+// custom formula pack; copy c of formula i is formula c * N + i
+struct ReplicatedCatalogue {
+    std::vector<Physics::Formula> formulas;
+    std::vector<Physics::OutputGroup> output_groups;
+    std::vector<std::uint32_t> producers;
+
+    explicit ReplicatedCatalogue(std::uint32_t copies) {
+        const auto builtin = Physics::builtin_catalogue();
+        const auto count = static_cast<std::uint32_t>(builtin.formulas.size());
+        for(std::uint32_t copy = 0; copy < copies; copy++)
+            formulas.insert(formulas.end(), builtin.formulas.begin(), builtin.formulas.end());
+        for(const auto &group : builtin.output_groups) {
+            output_groups.push_back({group.unit, static_cast<std::uint32_t>(producers.size()), group.count * copies});
+            for(std::uint32_t copy = 0; copy < copies; copy++)
+                for(const auto formula : builtin.producers.subspan(group.first, group.count))
+                    producers.push_back(copy * count + formula);
+        }
+    }
+    Physics::FormulaCatalogue catalogue() const noexcept { return {formulas, output_groups, producers}; }
+};
+
+// Plans a few chained queries over a replicated catalogue with 1, 2, 4, ... threads up
+// to the hardware thread count, and reports the speed-up over one thread
+static inline void run_formula_search_scaling_benchmark(const std::uint32_t copies = 32, const std::int32_t rounds = 5){
+    const ReplicatedCatalogue replicated{copies};
+    const Physics::FormulaDatabase database{replicated.catalogue()};
+    const FormulaSearcher searcher{database};
+    const dv::UnitVector m{1, 0, 0, 0, 0, 0, 0}, s{0, 1, 0, 0, 0, 0, 0}, kg{0, 0, 1, 0, 0, 0, 0};
+    const dv::UnitVector velocity{1, -1, 0, 0, 0, 0, 0}, acceleration{1, -2, 0, 0, 0, 0, 0};
+    const dv::UnitVector newton{1, -2, 1, 0, 0, 0, 0}, joule{2, -2, 1, 0, 0, 0, 0}, watt{2, -3, 1, 0, 0, 0, 0};
+    const std::vector<std::pair<std::vector<dv::UnitVector>, dv::UnitVector>> queries{
+        {{kg, acceleration}, newton}, {{kg, velocity}, joule}, {{m, s}, velocity}, {{kg, m, s}, watt},
+    };
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    double single = 0.0;
+    std::size_t plan_count = 0;
+    for(unsigned threads = 1;; threads = std::min(threads * 2, hardware)){
+        const ChainOptions options{.threads = threads};
+        database.match_pool({});   // input tables are built once, outside the timing
+        std::size_t plans = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for(std::int32_t round = 0; round < rounds; round++)
+            for(const auto &[pool, target] : queries)
+                plans += searcher.plan_derivations(pool, target, options).size();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if(threads == 1) { single = elapsed.count(); plan_count = plans; }
+        std::println("[BENCH] formula search, {} formulas, {} thread(s): {:.2f} ms per round, {:.2f}x{}",
+            database.size(), threads, elapsed.count() / rounds, single / elapsed.count(),
+            plans == plan_count ? "" : " (plan count differs!)");
+        if(threads == hardware) break;
+    }
+}
+
+// Free-text formula lookups over a replicated catalogue, timed after the index is built
+static inline void run_formula_text_search_benchmark(const std::uint32_t copies = 32, const std::int32_t rounds = 50){
+    const ReplicatedCatalogue replicated{copies};
+    const Physics::FormulaDatabase database{replicated.catalogue()};
+    const std::array<std::string_view, 4> queries{"coulomb force charge", "kinetic energy mass velocity", "colomb", "magnetic flux"};
+    database.search_text("index");   // built on the first search, outside the timing
+
+    std::size_t results = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::int32_t round = 0; round < rounds; round++)
+        for(const auto query : queries)
+            results += database.search_text(query, 20).size();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::println("[BENCH] formula text search, {} formulas: {:.3f} ms per query ({} results)",
+        database.size(), elapsed.count() / (rounds * queries.size()), results);
+}
+
+// Formula text the built-in catalogue stores, and the cost of deriving its rearrangements:
+// every formula's LaTeX is asked for twice, the first time solving the derived ones
+static inline void run_formula_rearrangement_benchmark(){
+    dv::Evaluator evaluator;
+    const auto &database = evaluator.get_formula_database();
+    std::size_t text_bytes = 0, derived = 0, solved = 0;
+    const Physics::FormulaFamily *family = nullptr;
+    for(std::size_t i = 0; i < database.size(); i++) {
+        text_bytes += database[i].latex.size();
+        if(database[i].family != family) text_bytes += database[i].family->equation.size();
+        family = database[i].family;
+        derived += database[i].derived();
+    }
+
+    auto ask_all = [&] {
+        const auto start = std::chrono::steady_clock::now();
+        solved = 0;
+        for(std::size_t i = 0; i < database.size(); i++) solved += evaluator.formula_latex(i).has_value();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / database.size();
+    };
+    const double first = ask_all(), cached = ask_all();
+    std::println("[BENCH] formula rearrangement: {} of {} formulas derived, {} bytes of formula text; "
+        "{} shown, {:.2f} us first / {:.3f} us cached per formula",
+        derived, database.size(), text_bytes, solved, first, cached);
+}
@@ -3,6 +3,7 @@
 #include "dimeval.hpp"
 #include <string_view>
 #include <format>
+#include <string>
 #include <vector>
 
 namespace dv {
@@ -99,9 +100,11 @@ namespace dv {
         END_ENV,
     };
     
+    // `text` views the source the token was lexed from (or a string literal), so a token
+    // is valid only as long as that source; see ParseSession
     struct Token {
         TokenType type;
-        std::string text;
+        std::string_view text;
         UnitValue value;
         Token(): type{TokenType::UNKNOWN}, text{""}, value{0} {}
         Token(const UnitValue value, const std::string_view token_text): type{TokenType::NUMERIC_LITERAL}, text{token_text}, value{value} {}
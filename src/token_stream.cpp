@@ -0,0 +1,44 @@
+#include "token_stream.hpp"
+#include <algorithm>
+
+namespace {
+    // Enough for every fixed lookahead the parser does (\frac{d}{dx} looks four ahead)
+    constexpr std::size_t initial_capacity = 8;
+}
+
+dv::TokenStream::TokenStream(Lexer &lexer): lexer{lexer}, ring(initial_capacity) {}
+
+void dv::TokenStream::pull(){
+    // The slot the next token goes to still holds token `lexed - size`; grow instead of
+    // overwriting it if the parser may still read it
+    if(lexed >= ring.size() && lexed - ring.size() >= std::min(position, pinned)) {
+        std::vector<Token> grown(ring.size() * 2);
+        for(std::size_t n = lexed - ring.size(); n < lexed; n++) grown[n & (grown.size() - 1)] = ring[n & (ring.size() - 1)];
+        ring = std::move(grown);
+    }
+    Token token = ended ? Token{TokenType::TEOF, ""} : lexer.next_token();
+    if(token.has_error()) {
+        error = token.get_error_message();
+        token = {TokenType::TEOF, ""};
+    }
+    ended = ended || token.type == TokenType::TEOF;
+    ring[lexed & (ring.size() - 1)] = token;
+    lexed++;
+}
+
+std::expected<void, std::string> dv::TokenStream::finish(){
+    while(!ended) {
+        const Token token = lexer.next_token();
+        if(token.has_error()) error = token.get_error_message();
+        ended = token.has_error() || token.type == TokenType::TEOF;
+    }
+    if(!error.empty()) return std::unexpected{error};
+    return {};
+}
+
+dv::TokenStream::Mark::Mark(TokenStream &stream) noexcept
+    : stream{stream}, position{stream.position}, previous_pinned{stream.pinned} {
+    stream.pinned = std::min(stream.pinned, position);
+}
+
+dv::TokenStream::Mark::~Mark() { stream.pinned = previous_pinned; }
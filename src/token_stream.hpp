@@ -0,0 +1,66 @@
+#pragma once
+
+#include "lexer.hpp"
+#include "token.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <vector>
+
+namespace dv {
+    // The token sequence as the parser sees it. Tokens are pulled from the Lexer when the
+    // parser first reaches them and kept in a small ring indexed by absolute position, so
+    // a long line (a large bmatrix, a long array) is never held as one token vector. The
+    // ring only grows while a Mark holds on to earlier tokens for backtracking, or when a
+    // lookahead runs further than it holds, as \int does when it looks for its dx.
+    class TokenStream {
+    public:
+        // Pulls from `lexer`, which must outlive the stream
+        explicit TokenStream(Lexer &lexer);
+
+        // The token at absolute position `index`, lexing up to it. Past the end, or past a
+        // token the lexer rejected, every token is TEOF. Positions before the read position
+        // are only valid while a Mark keeps them. The reference lasts until the next pull.
+        Token& at(std::size_t index) {
+            while(lexed <= index) pull();
+            return ring[index & (ring.size() - 1)];
+        }
+        Token& peek() { return at(position); }
+        Token& peek_next() { return at(position + 1); }
+        Token next() { Token token = at(position); position++; return token; }
+        void skip() noexcept { position++; }
+        std::size_t get_position() const noexcept { return position; }
+        std::size_t capacity() const noexcept { return ring.size(); }
+
+        // Lexes whatever the parser did not read, so a bad token after the expression is
+        // still reported; returns the first lexing error
+        std::expected<void, std::string> finish();
+
+        // Keeps the tokens from the read position on buffered while it lives, so the
+        // parser can rewind to it. Marks nest.
+        class Mark {
+        public:
+            explicit Mark(TokenStream &stream) noexcept;
+            ~Mark();
+            Mark(const Mark&) = delete;
+            Mark& operator=(const Mark&) = delete;
+            void rewind() noexcept { stream.position = position; }
+        private:
+            TokenStream &stream;
+            std::size_t position;
+            std::size_t previous_pinned;
+        };
+
+    private:
+        Lexer &lexer;
+        std::vector<Token> ring;                // power-of-two size, token n lives at n % size
+        std::size_t lexed = 0;                  // tokens pulled so far
+        std::size_t position = 0;
+        std::size_t pinned = SIZE_MAX;          // oldest position a Mark still needs
+        bool ended = false;                     // TEOF or an error was pulled
+        std::string error;
+
+        void pull();
+    };
+}
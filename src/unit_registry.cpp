@@ -0,0 +1,143 @@
+#include "unit_registry.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <format>
+
+namespace {
+    // Powers of ten from 1e-21 to 1e+18 as literals, so a prefixed unit's factor is
+    // exactly the literal it would have been written as
+    constexpr std::array<dv::Scalar, 40> powers_of_ten{
+        1e-21, 1e-20, 1e-19, 1e-18, 1e-17, 1e-16, 1e-15, 1e-14, 1e-13, 1e-12,
+        1e-11, 1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2,
+        1e-1, 1e+0, 1e+1, 1e+2, 1e+3, 1e+4, 1e+5, 1e+6, 1e+7, 1e+8,
+        1e+9, 1e+10, 1e+11, 1e+12, 1e+13, 1e+14, 1e+15, 1e+16, 1e+17, 1e+18,
+    };
+    constexpr dv::Scalar power_of_ten(int exponent) { return powers_of_ten[exponent + 21]; }
+
+    struct UnitPrefix {
+        std::string_view symbol;
+        int exponent;
+    };
+    // "mu " is how \mu m is typed
+    constexpr std::array<UnitPrefix, 14> unit_prefixes{{
+        {"a", -18}, {"f", -15}, {"p", -12}, {"n", -9}, {"mu ", -6}, {"m", -3}, {"c", -2},
+        {"d", -1}, {"k", 3}, {"M", 6}, {"G", 9}, {"T", 12}, {"P", 15}, {"E", 18},
+    }};
+
+    struct PrefixedUnit {
+        std::string_view symbol;
+        int exponent;   // of the SI unit, so g is 1e-3 kg and kg comes out as 1
+        dv::UnitVector unit;
+    };
+    // Units that take every prefix
+    constexpr std::array<PrefixedUnit, 17> prefixed_units{{
+        {"m", 0, DIM_METER}, {"s", 0, DIM_SECOND}, {"g", -3, DIM_KILOGRAM}, {"A", 0, DIM_AMPERE},
+        {"K", 0, DIM_KELVIN}, {"N", 0, DIM_NEWTON}, {"J", 0, DIM_JOULE}, {"C", 0, DIM_COULOMB},
+        {"S", 0, DIM_SIEMENS}, {"F", 0, DIM_FARAD}, {"V", 0, DIM_VOLT}, {"W", 0, DIM_WATT},
+        {"mol", 0, DIM_MOLE}, {"Ohm", 0, DIM_OHM}, {"cd", 0, DIM_CANDELA}, {"Pa", 0, DIM_PASCAL},
+        {"Hz", 0, DIM_HERTZ},
+    }};
+
+    struct PlainUnit {
+        std::string_view symbol;
+        dv::Scalar factor;
+        dv::UnitVector unit;
+    };
+    // Units that take no prefix
+    constexpr std::array<PlainUnit, 8> plain_units{{
+        {"hour", 60 * 60, DIM_SECOND}, {"min", 60, DIM_SECOND}, {"ATM", 101325, DIM_PASCAL},
+        {"in", 0.0254, DIM_METER}, {"ft", 0.3048, DIM_METER}, {"yd", 0.9144, DIM_METER},
+        {"mi", 1609.34, DIM_METER}, {"lb", 0.453, DIM_KILOGRAM},
+    }};
+}
+
+const dv::UnitRegistry& dv::UnitRegistry::builtin(){
+    static const UnitRegistry registry = [] {
+        UnitRegistry built;
+        for(const auto &unit : prefixed_units) {
+            built.insert(std::string{unit.symbol}, power_of_ten(unit.exponent), unit.unit);
+            for(const auto &prefix : unit_prefixes)
+                built.insert(std::format("{}{}", prefix.symbol, unit.symbol), power_of_ten(prefix.exponent + unit.exponent), unit.unit);
+        }
+        for(const auto &unit : plain_units) built.insert(std::string{unit.symbol}, unit.factor, unit.unit);
+        built.layout();
+        return built;
+    }();
+    return registry;
+}
+
+std::expected<void, std::string> dv::UnitRegistry::add(std::string_view symbol, Scalar factor, UnitVector unit, bool prefixable){
+    if(symbol.empty() || !std::ranges::all_of(symbol, [](char c) { return std::isalpha(static_cast<unsigned char>(c)) != 0; }))
+        return std::unexpected{std::format("Unit symbol '{}' must be letters only", symbol)};
+    std::vector<std::pair<std::string, Scalar>> forms{{std::string{symbol}, factor}};
+    if(prefixable)
+        for(const auto &prefix : unit_prefixes)
+            forms.emplace_back(std::format("{}{}", prefix.symbol, symbol), factor * power_of_ten(prefix.exponent));
+    for(const auto &[form, _] : forms)
+        if(longest_match(form).length == form.size())
+            return std::unexpected{std::format("Unit '\\{}' already exists", form)};
+    for(auto &[form, form_factor] : forms) insert(std::move(form), form_factor, unit);
+    layout();
+    return {};
+}
+
+dv::UnitRegistry::Match dv::UnitRegistry::longest_match(std::string_view text) const noexcept{
+    Match best;
+    std::uint32_t node = 0;
+    for(std::uint32_t i = 0; i < text.size(); i++) {
+        std::uint32_t next = first_child[node];
+        const std::uint32_t last = next + child_count[node];
+        while(next < last && labels[next] != text[i]) next++;
+        if(next == last) break;
+        node = next;
+        if(unit_at[node] >= 0) best = {i + 1, &units[unit_at[node]]};
+    }
+    return best;
+}
+
+void dv::UnitRegistry::insert(std::string symbol, Scalar factor, UnitVector unit){
+    units.push_back({std::move(symbol), factor, unit});
+}
+
+void dv::UnitRegistry::layout(){
+    // Build a trie with sibling links, then number it breadth first
+    struct Node {
+        char c = 0;
+        std::uint32_t child = 0;     // first child, 0 for none (the root is nobody's child)
+        std::uint32_t sibling = 0;   // next child of the same parent, 0 for none
+        std::int32_t unit = -1;
+    };
+    std::vector<Node> nodes(1);
+    for(std::size_t i = 0; i < units.size(); i++) {
+        std::uint32_t node = 0;
+        for(const char c : units[i].symbol) {
+            std::uint32_t link = nodes[node].child, previous = 0;
+            while(link && nodes[link].c != c) link = nodes[previous = link].sibling;
+            if(!link) {
+                link = static_cast<std::uint32_t>(nodes.size());
+                nodes.push_back({c});
+                (previous ? nodes[previous].sibling : nodes[node].child) = link;
+            }
+            node = link;
+        }
+        nodes[node].unit = static_cast<std::int32_t>(i);
+    }
+
+    labels.assign(nodes.size(), '\0');
+    first_child.assign(nodes.size(), 0);
+    child_count.assign(nodes.size(), 0);
+    unit_at.assign(nodes.size(), -1);
+    std::vector<std::uint32_t> order{0};   // breadth-first position -> node
+    order.reserve(nodes.size());
+    unit_at[0] = nodes[0].unit;
+    for(std::size_t at = 0; at < order.size(); at++) {
+        first_child[at] = static_cast<std::uint32_t>(order.size());
+        for(std::uint32_t child = nodes[order[at]].child; child; child = nodes[child].sibling) {
+            labels[order.size()] = nodes[child].c;
+            unit_at[order.size()] = nodes[child].unit;
+            order.push_back(child);
+            child_count[at]++;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "dimeval.hpp"
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dv {
+    // Unit symbols the lexer recognises after a backslash, \km or \mu mol. The built-in
+    // set is made at startup from the SI prefixes and unit tables in unit_registry.cpp;
+    // a copy can be extended with more units at runtime (Evaluator::add_unit).
+    //
+    // Symbols live in a trie laid out breadth first, so each node's children are one
+    // contiguous run of labels. A lookup walks the input once, so its cost depends on
+    // the symbol length, not on how many units are registered.
+    class UnitRegistry {
+    public:
+        struct Unit {
+            std::string symbol;
+            Scalar factor;
+            UnitVector unit;
+        };
+        struct Match {
+            std::uint32_t length = 0;      // characters matched, 0 if no unit
+            const Unit *unit = nullptr;
+        };
+
+        // The SI units with every prefix, and the plain units (hour, ATM, ft, ...)
+        static const UnitRegistry& builtin();
+
+        // Registers `symbol` (letters only), and with `prefixable` also every SI prefixed
+        // form of it. Nothing is added if any of the symbols is already taken.
+        std::expected<void, std::string> add(std::string_view symbol, Scalar factor, UnitVector unit, bool prefixable = false);
+
+        // The longest registered symbol `text` starts with
+        Match longest_match(std::string_view text) const noexcept;
+        std::size_t size() const noexcept { return units.size(); }
+
+    private:
+        std::vector<Unit> units;
+        // Breadth-first trie: node 0 is the root, children of node n are
+        // [first_child[n], first_child[n] + child_count[n])
+        std::vector<char> labels{'\0'};
+        std::vector<std::uint32_t> first_child{0};
+        std::vector<std::uint32_t> child_count{0};
+        std::vector<std::int32_t> unit_at{-1};     // index into units, -1 if no symbol ends here
+
+        void insert(std::string symbol, Scalar factor, UnitVector unit);
+        void layout();
+    };
+}
@@ -88,19 +88,19 @@ std::string dv::unit_to_latex(const UnitVector& unit) {
 
     // Exact match with a derived unit
     for (const auto& derived : DERIVED_UNITS) {
-        if (unit.vec == derived.dimensions) {
+        if (unit == derived.dimensions) {
             return std::format("\\mathrm{{{}}}", derived.symbol);
         }
     }
 
     // Base representation
-    auto best = build_from_base(unit.vec, BASE_UNITS);
+    auto best = build_from_base(unit.to_array(), BASE_UNITS);
 
     // Try one derived unit in numerator
     for (const auto& derived : DERIVED_UNITS) {
         UnitVec remaining;
         for (std::size_t i = 0; i < 7; i++)
-            remaining[i] = unit.vec[i] - derived.dimensions[i];
+            remaining[i] = unit[i] - derived.dimensions[i];
 
         auto rem = build_from_base(remaining, BASE_UNITS);
         std::vector<std::string> total_num = {std::format("\\mathrm{{{}}}", derived.symbol)};
@@ -116,7 +116,7 @@ std::string dv::unit_to_latex(const UnitVector& unit) {
     for (const auto& derived : DERIVED_UNITS) {
         UnitVec remaining;
         for (std::size_t i = 0; i < 7; i++)
-            remaining[i] = unit.vec[i] + derived.dimensions[i];
+            remaining[i] = unit[i] + derived.dimensions[i];
 
         auto rem = build_from_base(remaining, BASE_UNITS);
         std::vector<std::string> total_den = {std::format("\\mathrm{{{}}}", derived.symbol)};
@@ -133,7 +133,7 @@ std::string dv::unit_to_latex(const UnitVector& unit) {
         for (const auto& den_d : DERIVED_UNITS) {
             bool matches = true;
             for (std::size_t i = 0; i < 7; i++) {
-                if (unit.vec[i] != num_d.dimensions[i] - den_d.dimensions[i]) {
+                if (unit[i] != num_d.dimensions[i] - den_d.dimensions[i]) {
                     matches = false;
                     break;
                 }
@@ -160,29 +160,29 @@ std::string dv::unit_to_latex(const UnitVector& unit) {
     return std::format("\\frac{{{}}}{{{}}}", join_cdot(best.num), join_cdot(best.den));
 }
 
-std::string dv::value_to_scientific(const long double& value, int sig_figs) {
+std::string dv::value_to_scientific(const dv::Scalar value, int sig_figs) {
     // sig_figs == 0: unlimited precision (original behavior)
     // sig_figs >  0: round to that many significant figures
 
-    const auto abs_value = std::fabsl(value);
+    const auto abs_value = std::fabs(value);
 
-    if (sig_figs > 0 && abs_value > 0.0L) {
+    if (sig_figs > 0 && abs_value > 0.0) {
         // Round to sig_figs significant digits using the original exponent
-        const int exp_orig = static_cast<int>(std::floorl(std::log10l(abs_value)));
-        const long double scale = std::powl(10.0L, (long double)(sig_figs - 1 - exp_orig));
-        const long double rounded = std::roundl(value * scale) / scale;
-        const long double rounded_abs = std::fabsl(rounded);
+        const int exp_orig = static_cast<int>(std::floor(std::log10(abs_value)));
+        const dv::Scalar scale = std::pow(dv::Scalar{10}, (dv::Scalar)(sig_figs - 1 - exp_orig));
+        const dv::Scalar rounded = std::round(value * scale) / scale;
+        const dv::Scalar rounded_abs = std::fabs(rounded);
 
         // Re-compute exponent of the rounded value (rounding can bump the order of magnitude)
-        const int exp_r = (rounded_abs > 0.0L)
-            ? static_cast<int>(std::floorl(std::log10l(rounded_abs)))
+        const int exp_r = (rounded_abs > 0.0)
+            ? static_cast<int>(std::floor(std::log10(rounded_abs)))
             : exp_orig;
 
         // Choose display format: scientific for very large/small, decimal otherwise
         const bool use_sci = (exp_r >= 5) || (exp_r <= -3);
 
         if (use_sci) {
-            const double coeff = static_cast<double>(rounded / std::powl(10.0L, (long double)exp_r));
+            const double coeff = static_cast<double>(rounded / std::pow(dv::Scalar{10}, (dv::Scalar)exp_r));
             const int decimals = sig_figs - 1;
             if (decimals <= 0)
                 return std::format("{:.0f}\\times10^{{{}}}", coeff, exp_r);
@@ -191,21 +191,21 @@ std::string dv::value_to_scientific(const long double& value, int sig_figs) {
             // Decimal display: enough decimal places to show all sig figs
             const int dp = sig_figs - 1 - exp_r;
             if (dp <= 0)
-                return std::format("{}", static_cast<long long>(std::roundl(rounded)));
+                return std::format("{}", static_cast<long long>(std::round(rounded)));
             return std::format("{:.{}f}", static_cast<double>(rounded), dp);
         }
     }
 
-    if (value == 0.0L) return "0";
+    if (value == 0.0) return "0";
 
-    if ((abs_value >= 5e9L) || (abs_value < 5e-4L && abs_value > 0.0L)) {
-        const int exponent = static_cast<int>(std::floorl(std::log10l(abs_value)));
-        const double coefficient = static_cast<double>(value / std::powl(10.0L, exponent));
+    if ((abs_value >= 5e9) || (abs_value < 5e-4 && abs_value > 0.0)) {
+        const int exponent = static_cast<int>(std::floor(std::log10(abs_value)));
+        const double coefficient = static_cast<double>(value / std::pow(dv::Scalar{10}, exponent));
         return std::format("{:.10g}\\times10^{{{}}}", coefficient, exponent);
     }
 
     const double dval = static_cast<double>(value);
-    if (dval == std::floor(dval) && abs_value < 1e15L) {
+    if (dval == std::floor(dval) && abs_value < 1e15) {
         return std::format("{}", static_cast<long long>(dval));
     }
     return std::format("{:.10g}", dval);
@@ -4,5 +4,5 @@
 namespace dv {
     dv::UnitVector unit_latex_to_unit(const std::string &unit_latex);
     std::string unit_to_latex(const UnitVector &unit);
-    std::string value_to_scientific(const long double &value, int sig_figs = 0);
+    std::string value_to_scientific(const Scalar value, int sig_figs = 0);
 }
\ No newline at end of file
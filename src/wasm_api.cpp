@@ -35,6 +35,7 @@ struct JsFormulaVariable {
 };
 
 struct JsFormula {
+    int index;                      // in the searched database, for dv_evaluate_formula_chain
     std::string name;
     std::string latex;
     std::string category;
@@ -65,7 +66,7 @@ static JsResult evalue_to_js_result(const EValue& ev) {
             r.value = (double)v.value;
             r.imag  = (double)v.imag;
             r.sig_figs = (int)v.sig_figs;
-            for (int i = 0; i < 7; i++) r.unit[i] = v.unit.vec[i];
+            for (int i = 0; i < 7; i++) r.unit[i] = v.unit[i];
             r.unit_latex = (v.unit == dv::UnitVector{dv::DIMENSIONLESS_VEC})
                 ? "" : unit_to_latex(v.unit);
             r.value_scientific = value_to_scientific(v.value, (int)v.sig_figs);
@@ -74,7 +75,7 @@ static JsResult evalue_to_js_result(const EValue& ev) {
                 r.value = (double)v.elements[0].value;
                 r.imag  = (double)v.elements[0].imag;
                 r.sig_figs = (int)v.elements[0].sig_figs;
-                for (int i = 0; i < 7; i++) r.unit[i] = v.elements[0].unit.vec[i];
+                for (int i = 0; i < 7; i++) r.unit[i] = v.elements[0].unit[i];
                 r.unit_latex = (v.elements[0].unit == dv::UnitVector{dv::DIMENSIONLESS_VEC})
                     ? "" : unit_to_latex(v.elements[0].unit);
                 r.value_scientific = value_to_scientific(v.elements[0].value, (int)v.elements[0].sig_figs);
@@ -94,16 +95,22 @@ static JsResult evalue_to_js_result(const EValue& ev) {
     return r;
 }
 
-static JsFormula physics_formula_to_js(const Physics::Formula& f) {
+// Strings are only copied out of the database here; chained formulas are
+// tagged in the category column by depth, as the UI expects. A derived
+// rearrangement is solved when it is first shown.
+static JsFormula physics_formula_to_js(const Physics::FormulaMatch& match) {
+    const Physics::Formula& f = g_eval->get_formula_database()[match.index];
     JsFormula jf;
-    jf.name = f.name;
-    jf.latex = f.latex;
-    jf.category = f.category;
-    for (const auto& v : f.variables) {
+    jf.index = static_cast<int>(match.index);
+    jf.name = f.name();
+    const auto& latex = g_eval->formula_latex(match.index);
+    jf.latex = latex ? *latex : std::string(f.family->equation);
+    jf.category = match.depth == 0 ? f.category() : std::string(3 * match.depth, '-');
+    for (const auto& v : f.variables()) {
         jf.variables.push_back({
-            v.name,
+            std::string(v.name),
             unit_to_latex(v.units),
-            v.description,
+            std::string(v.description),
             v.is_constant
         });
     }
@@ -141,17 +148,37 @@ bool dv_set_constant(const std::string& name, const std::string& value_expr, con
 
 bool dv_remove_constant(const std::string& name) {
     if (!g_eval) return false;
-    return g_eval->fixed_constants.erase(name) > 0;
+    return g_eval->erase_constant(name);
 }
 
 void dv_clear_constants() {
-    if (g_eval) g_eval->fixed_constants.clear();
+    if (g_eval) g_eval->clear_constants();
 }
 
 int dv_get_constant_count() {
     return g_eval ? static_cast<int>(g_eval->fixed_constants.size()) : 0;
 }
 
+// ============================================================================
+// Units
+// ============================================================================
+
+// Registers \<symbol> as `factor` times the SI unit `unit_vec` (7 exponents).
+// Returns an empty string on success, otherwise why it was refused.
+std::string dv_add_unit(const std::string& symbol, double factor, const std::vector<int>& unit_vec, bool prefixable) {
+    if (!g_eval) return "Not initialized";
+    if (unit_vec.size() != 7) return "A unit needs 7 exponents";
+    UnitVector uv;
+    for (int i = 0; i < 7; i++)
+        uv.set(i, static_cast<int8_t>(unit_vec[i]));
+    const auto added = g_eval->add_unit(symbol, factor, uv, prefixable);
+    return added ? std::string{} : added.error();
+}
+
+int dv_get_unit_count() {
+    return g_eval ? static_cast<int>(g_eval->get_units().size()) : 0;
+}
+
 // ============================================================================
 // Evaluation
 // ============================================================================
@@ -210,13 +237,23 @@ std::vector<JsFormula> dv_get_available_formulas(const std::vector<int>& target_
 
     UnitVector target;
     for (int i = 0; i < 7; i++)
-        target.vec[i] = static_cast<int8_t>(target_unit_vec[i]);
+        target.set(i, static_cast<int8_t>(target_unit_vec[i]));
 
     auto formulas = g_eval->get_available_formulas(target);
     std::vector<JsFormula> out;
     out.reserve(formulas.size());
-    for (const auto& f : formulas)
-        out.push_back(physics_formula_to_js(f));
+    for (const auto& match : formulas)
+        out.push_back(physics_formula_to_js(match));
+    return out;
+}
+
+// Free-text lookup over formula names, categories and variable descriptions
+std::vector<JsFormula> dv_search_formulas(const std::string& query, int limit) {
+    if (!g_eval || limit <= 0) return {};
+
+    std::vector<JsFormula> out;
+    for (const auto& match : g_eval->search_formulas(query, static_cast<std::size_t>(limit)))
+        out.push_back(physics_formula_to_js({match.index, 0}));
     return out;
 }
 
@@ -225,20 +262,47 @@ std::vector<JsFormula> dv_get_last_formula_results() {
 
     std::vector<JsFormula> out;
     out.reserve(g_eval->last_formula_results.size());
-    for (const auto& f : g_eval->last_formula_results)
-        out.push_back(physics_formula_to_js(f));
+    for (const auto& match : g_eval->last_formula_results)
+        out.push_back(physics_formula_to_js(match));
     return out;
 }
 
+// Runs the cheapest derivation of the target unit that ends in formula `index`
+// (JsFormula::index of a depth-0 suggestion) on the current variables
+JsResult dv_evaluate_formula_chain(const std::vector<int>& target_unit_vec, int index) {
+    if (!g_eval) return make_error_result("Evaluator not initialized");
+    if (target_unit_vec.size() != 7 || index < 0) return make_error_result("Invalid formula chain request");
+
+    UnitVector target;
+    for (int i = 0; i < 7; i++)
+        target.set(i, static_cast<int8_t>(target_unit_vec[i]));
+
+    const auto result = g_eval->evaluate_formula_chain(target, static_cast<std::size_t>(index));
+    if (!result) return make_error_result(result.error());
+    return evalue_to_js_result(*result);
+}
+
+// Bytes of a pack from formula_gen/formulas_to_pack.ts, fetched by the host;
+// embind passes a Uint8Array as a std::string. False if it is not a valid pack.
+bool dv_load_formula_pack(const std::string& bytes) {
+    if (!g_eval) return false;
+    std::vector<std::byte> owned(bytes.size());
+    std::memcpy(owned.data(), bytes.data(), bytes.size());
+    auto pack = Physics::FormulaPack::from_bytes(std::move(owned));
+    if (!pack) return false;
+    g_eval->use_formula_pack(std::move(*pack));
+    return true;
+}
+
 // ============================================================================
 // Variables
 // ============================================================================
 
 val dv_get_variable(const std::string& name) {
     if (!g_eval) return val::null();
-    auto it = g_eval->evaluated_variables.find(name);
-    if (it == g_eval->evaluated_variables.end()) return val::null();
-    if (const auto* uv = std::get_if<dv::UnitValue>(&it->second))
+    const auto* value = g_eval->evaluated_variables.find(name);
+    if (!value) return val::null();
+    if (const auto* uv = std::get_if<dv::UnitValue>(value))
         return val((double)uv->value);
     return val::null();
 }
@@ -259,7 +323,7 @@ std::vector<int> dv_unit_latex_to_unit(const std::string& unit_latex) {
     auto unit = unit_latex_to_unit(unit_latex);
     std::vector<int> out(7);
     for (int i = 0; i < 7; i++)
-        out[i] = unit.vec[i];
+        out[i] = unit[i];
     return out;
 }
 
@@ -267,12 +331,12 @@ std::string dv_unit_to_latex(const std::vector<int>& unit_vec) {
     if (unit_vec.size() != 7) return "";
     UnitVector uv;
     for (int i = 0; i < 7; i++)
-        uv.vec[i] = static_cast<int8_t>(unit_vec[i]);
+        uv.set(i, static_cast<int8_t>(unit_vec[i]));
     return unit_to_latex(uv);
 }
 
 std::string dv_value_to_scientific(double value, int sig_figs) {
-    return value_to_scientific((long double)value, sig_figs);
+    return value_to_scientific((dv::Scalar)value, sig_figs);
 }
 
 std::string dv_version() {
@@ -294,6 +358,7 @@ EMSCRIPTEN_BINDINGS(UnitEval) {
         .field("is_constant", &JsFormulaVariable::is_constant);
 
     value_object<JsFormula>("Formula")
+        .field("index",     &JsFormula::index)
         .field("name",      &JsFormula::name)
         .field("latex",     &JsFormula::latex)
         .field("category",  &JsFormula::category)
@@ -332,6 +397,11 @@ EMSCRIPTEN_BINDINGS(UnitEval) {
     function("dv_clear_constants",   &dv_clear_constants);
     function("dv_get_constant_count",&dv_get_constant_count);
 
+    // --- Units ---
+
+    function("dv_add_unit",       &dv_add_unit);
+    function("dv_get_unit_count", &dv_get_unit_count);
+
     // --- Evaluation ---
 
     function("dv_eval",       &dv_eval);
@@ -341,6 +411,9 @@ EMSCRIPTEN_BINDINGS(UnitEval) {
 
     function("dv_get_available_formulas",  &dv_get_available_formulas);
     function("dv_get_last_formula_results",&dv_get_last_formula_results);
+    function("dv_search_formulas",         &dv_search_formulas);
+    function("dv_load_formula_pack",       &dv_load_formula_pack);
+    function("dv_evaluate_formula_chain",  &dv_evaluate_formula_chain);
 
     // --- Variables ---
 